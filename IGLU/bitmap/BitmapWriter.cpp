@@ -73,6 +73,19 @@ BufferOffsets getBufferOffsets(TextureFormat format) {
   }
 }
 
+void writeBitmapHeader(std::ostream& stream, uint32_t width, uint32_t height) {
+  const uint32_t imageSize = width * height * 3;
+
+  BMPHeader header{
+      .fileSize = static_cast<uint32_t>(sizeof(BMPHeader) + imageSize),
+      .imageWidth = static_cast<int32_t>(width),
+      .imageHeight = static_cast<int32_t>(height),
+      .imageSizeBytes = static_cast<uint32_t>(imageSize),
+  };
+
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
 } // namespace
 
 bool isSupportedBitmapTextureFormat(TextureFormat format) {
@@ -117,42 +130,30 @@ void writeBitmap(std::ostream& stream,
   const auto& properties = texture->getProperties();
   const uint32_t bytesPerRow = properties.getBytesPerRow(textureRange);
 
-  std::vector<uint8_t> imageData;
-  imageData.reserve(size.width * size.height * 3);
-
   IGL_DEBUG_ASSERT(buffer.size() == size.height * bytesPerRow);
 
   const auto bufferOffsets = getBufferOffsets(texture->getFormat());
 
+  // Convert and write one row at a time instead of building a copy of the whole image
+  writeBitmapHeader(stream, size.width, size.height);
+  std::vector<uint8_t> rowData(static_cast<size_t>(size.width) * 3);
   for (size_t y = 0; y < size.height; ++y) {
     const size_t row = flipY ? size.height - y - 1 : y;
-    for (size_t byte = 0; byte < bytesPerRow; byte += 4) {
-      const size_t index = row * bytesPerRow + byte;
-      const uint8_t r = buffer[index + bufferOffsets.r];
-      const uint8_t g = buffer[index + bufferOffsets.g];
-      const uint8_t b = buffer[index + bufferOffsets.b];
-
-      imageData.push_back(b);
-      imageData.push_back(g);
-      imageData.push_back(r);
+    const uint8_t* src = buffer.data() + row * bytesPerRow;
+    uint8_t* dst = rowData.data();
+    for (size_t x = 0; x < size.width; ++x, src += 4, dst += 3) {
+      dst[0] = src[bufferOffsets.b];
+      dst[1] = src[bufferOffsets.g];
+      dst[2] = src[bufferOffsets.r];
     }
+    stream.write(reinterpret_cast<const char*>(rowData.data()),
+                 static_cast<std::streamsize>(rowData.size()));
   }
-
-  writeBitmap(stream, static_cast<const uint8_t*>(imageData.data()), size.width, size.height);
 }
 
 void writeBitmap(std::ostream& stream, const uint8_t* imageData, uint32_t width, uint32_t height) {
-  const uint32_t imageSize = width * height * 3;
-
-  BMPHeader header{
-      .fileSize = static_cast<uint32_t>(sizeof(BMPHeader) + imageSize),
-      .imageWidth = static_cast<int32_t>(width),
-      .imageHeight = static_cast<int32_t>(height),
-      .imageSizeBytes = static_cast<uint32_t>(imageSize),
-  };
-
-  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
-  stream.write(reinterpret_cast<const char*>(imageData), imageSize);
+  writeBitmapHeader(stream, width, height);
+  stream.write(reinterpret_cast<const char*>(imageData), width * height * 3);
 }
 
 } // namespace igl::iglu
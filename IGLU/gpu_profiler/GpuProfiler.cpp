@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/gpu_profiler/GpuProfiler.h>
+
+#include <chrono>
+#include <cstdio>
+#include <igl/Device.h>
+#include <igl/Log.h>
+#include <igl/Macros.h>
+#include <igl/TimestampQueries.h>
+
+namespace iglu::gpu_profiler {
+
+namespace {
+
+double getSeconds() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void appendEscapedJson(std::string& json, const std::string& str) {
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      json += '\\';
+      json += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      json += ' ';
+    } else {
+      json += c;
+    }
+  }
+}
+
+} // namespace
+
+GpuProfiler::GpuProfiler(igl::IDevice& device, GpuProfilerDesc desc) : desc_(desc) {
+  // only Vulkan command buffers time every debug group with CommandBufferDesc::timestampQueries
+  if (device.getBackendType() != igl::BackendType::Vulkan) {
+    return;
+  }
+  if (desc_.framesInFlight == 0 || desc_.maxScopesPerFrame == 0 || desc_.maxFrameAge == 0 ||
+      !device.hasFeature(igl::DeviceFeatures::TimestampQueries)) {
+    return;
+  }
+  frames_.resize(desc_.framesInFlight);
+  for (auto& frame : frames_) {
+    frame.queries = device.createTimestampQueries(desc_.maxScopesPerFrame, nullptr);
+    if (!frame.queries || !frame.queries->isValid()) {
+      frames_.clear();
+      return;
+    }
+  }
+}
+
+GpuProfiler::~GpuProfiler() = default;
+
+bool GpuProfiler::isSupported() const {
+  return !frames_.empty();
+}
+
+std::shared_ptr<igl::ITimestampQueries> GpuProfiler::beginFrame() {
+  if (frames_.empty()) {
+    return nullptr;
+  }
+
+  numBeginFrameCalls_++;
+
+  PendingFrame& frame = frames_[frameIndex_ % frames_.size()];
+  if (frame.pending) {
+    if (frame.queries->resultsAvailable()) {
+      resolve(frame);
+    } else if (isExpired(frame)) {
+      drop(frame);
+    } else {
+      // Never stall: skip profiling this frame until the oldest frame has finished on the GPU
+      return nullptr;
+    }
+  }
+
+  frame.queries->reset();
+  frame.frameIndex = frameIndex_++;
+  frame.cpuStartSeconds = getSeconds();
+  frame.beginFrameCall = numBeginFrameCalls_;
+  frame.pending = true;
+  return frame.queries;
+}
+
+void GpuProfiler::endFrame() {
+  // Resolve in submission order and stop at the first frame which is still in flight
+  const uint64_t numFrames = frames_.size();
+  for (uint64_t i = frameIndex_ > numFrames ? frameIndex_ - numFrames : 0; i < frameIndex_; ++i) {
+    PendingFrame& frame = frames_[i % numFrames];
+    if (!frame.pending || frame.frameIndex != i) {
+      continue;
+    }
+    if (frame.queries->resultsAvailable()) {
+      resolve(frame);
+    } else if (isExpired(frame)) {
+      // a frame which never finishes must not hold back the frames after it
+      drop(frame);
+    } else {
+      break;
+    }
+  }
+}
+
+bool GpuProfiler::isExpired(const PendingFrame& frame) const {
+  return numBeginFrameCalls_ - frame.beginFrameCall >= desc_.maxFrameAge;
+}
+
+void GpuProfiler::drop(PendingFrame& frame) {
+  IGL_LOG_INFO_ONCE("[GpuProfiler] Dropped a frame whose timestamps never became available\n");
+  frame.pending = false;
+  frame.queries->reset();
+}
+
+void GpuProfiler::resolve(PendingFrame& frame) {
+  frame.pending = false;
+
+  const igl::ITimestampQueries& queries = *frame.queries;
+  const uint32_t count = queries.count();
+  if (count == 0) {
+    return;
+  }
+
+  GpuFrame result;
+  result.frameIndex = frame.frameIndex;
+  result.cpuStartSeconds = frame.cpuStartSeconds;
+  result.scopes.resize(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    GpuScope& scope = result.scopes[i];
+    scope.label = queries.getLabel(i);
+    scope.startNanos = queries.getStartNanos(i);
+    scope.durationNanos = queries.getElapsedNanos(i);
+    const uint32_t parent = queries.getParentSlot(i);
+    if (parent < i) {
+      scope.parent = parent;
+      scope.depth = result.scopes[parent].depth + 1;
+    }
+  }
+
+  emitCounters(result);
+  if (callback_) {
+    callback_(result);
+  }
+
+  history_.push_back(std::move(result));
+  while (history_.size() > desc_.historySize) {
+    history_.pop_front();
+  }
+}
+
+void GpuProfiler::emitCounters(const GpuFrame& frame) {
+  for (const GpuScope& scope : frame.scopes) {
+    const char* name = counterNames_.insert("GPU " + scope.label).first->c_str();
+    IGL_PROFILER_PLOT(name, static_cast<int64_t>(scope.durationNanos / 1000u));
+    (void)name;
+  }
+}
+
+const GpuFrame* GpuProfiler::getLatestFrame() const {
+  return history_.empty() ? nullptr : &history_.back();
+}
+
+const std::deque<GpuFrame>& GpuProfiler::getHistory() const {
+  return history_;
+}
+
+void GpuProfiler::setFrameCallback(FrameCallback callback) {
+  callback_ = std::move(callback);
+}
+
+bool GpuProfiler::writeChromeTrace(const std::string& path) const {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  const std::string json = exportChromeTrace(history_);
+  const bool ok = fwrite(json.data(), 1, json.size(), file) == json.size();
+  return fclose(file) == 0 && ok;
+}
+
+std::string formatGpuFrameTree(const GpuFrame& frame) {
+  std::string result = "GPU frame " + std::to_string(frame.frameIndex) + "\n";
+  char buffer[64];
+  for (const GpuScope& scope : frame.scopes) {
+    result.append(2 * (scope.depth + 1), ' ');
+    result += scope.label;
+    snprintf(buffer, sizeof(buffer), ": %.3f ms\n", static_cast<double>(scope.durationNanos) / 1e6);
+    result += buffer;
+  }
+  return result;
+}
+
+std::string exportChromeTrace(const std::deque<GpuFrame>& frames) {
+  std::string json = "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  const double origin = frames.empty() ? 0.0 : frames.front().cpuStartSeconds;
+  char buffer[256];
+  bool first = true;
+  for (const GpuFrame& frame : frames) {
+    // GPU timestamps are relative to the frame, which is placed at its CPU start time
+    const double frameStartUs = (frame.cpuStartSeconds - origin) * 1e6;
+    for (const GpuScope& scope : frame.scopes) {
+      json += first ? "\n" : ",\n";
+      first = false;
+      json += "{\"name\": \"";
+      appendEscapedJson(json, scope.label);
+      snprintf(buffer,
+               sizeof(buffer),
+               "\", \"cat\": \"gpu\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, "
+               "\"dur\": %.3f, \"args\": {\"frame\": %llu}}",
+               scope.depth,
+               frameStartUs + static_cast<double>(scope.startNanos) / 1e3,
+               static_cast<double>(scope.durationNanos) / 1e3,
+               static_cast<unsigned long long>(frame.frameIndex));
+      json += buffer;
+    }
+  }
+  json += "\n]}\n";
+  return json;
+}
+
+} // namespace iglu::gpu_profiler
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace igl {
+class IDevice;
+class ITimestampQueries;
+} // namespace igl
+
+namespace iglu::gpu_profiler {
+
+/// GPU duration of one debug group
+struct GpuScope {
+  static constexpr uint32_t kNoParent = UINT32_MAX;
+
+  std::string label;
+  uint32_t parent = kNoParent; ///< index of the enclosing scope in GpuFrame::scopes
+  uint32_t depth = 0;
+  uint64_t startNanos = 0; ///< relative to the start of the first scope of the frame
+  uint64_t durationNanos = 0;
+};
+
+/// Tree of GPU durations of one frame. Scopes are stored in the order their debug groups were
+/// pushed, so every parent precedes its children.
+struct GpuFrame {
+  uint64_t frameIndex = 0;
+  double cpuStartSeconds = 0.0; ///< CPU time of beginFrame(), used to place the frame on a timeline
+  std::vector<GpuScope> scopes;
+};
+
+struct GpuProfilerDesc {
+  uint32_t maxScopesPerFrame = 128;
+  /// Number of frames which can be waiting for their results before beginFrame() skips a frame
+  uint32_t framesInFlight = 3;
+  /// Number of beginFrame() calls after which a frame whose results never became available, e.g.
+  /// because its command buffer was never submitted, is dropped and its queries are reused
+  uint32_t maxFrameAge = 60;
+  /// Number of resolved frames kept for getHistory() and exportChromeTrace()
+  size_t historySize = 300;
+};
+
+/**
+ * Opt-in GPU profiler which times debug groups with timestamp queries.
+ *
+ * Set the queries returned by beginFrame() as CommandBufferDesc::timestampQueries of the command
+ * buffer of the frame. Every debug group pushed on that command buffer or on its encoders then
+ * writes a timestamp on push and pop. Results are collected by endFrame() a few frames later,
+ * once the GPU has finished, without ever waiting for it. Only one command buffer per frame can
+ * be timed.
+ *
+ * Resolved frames are sent to the frame callback and to profiler counters (IGL_PROFILER_PLOT),
+ * and can be dumped as a Chrome trace.
+ *
+ * Timing debug groups is only implemented by the Vulkan backend. Other backends interpret
+ * CommandBufferDesc::timestampQueries differently (e.g. Metal times the whole command buffer), so
+ * isSupported() returns false for them and when the device cannot create timestamp queries.
+ */
+class GpuProfiler final {
+ public:
+  using FrameCallback = std::function<void(const GpuFrame&)>;
+
+  explicit GpuProfiler(igl::IDevice& device, GpuProfilerDesc desc = {});
+  ~GpuProfiler();
+
+  GpuProfiler(const GpuProfiler&) = delete;
+  GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+  [[nodiscard]] bool isSupported() const;
+
+  /// Returns the queries for the command buffer of the new frame, or nullptr if profiling is not
+  /// supported or all frames in flight are still waiting for their results.
+  [[nodiscard]] std::shared_ptr<igl::ITimestampQueries> beginFrame();
+
+  /// Collects the results of all earlier frames which the GPU has finished.
+  void endFrame();
+
+  /// Returns the most recently resolved frame, or nullptr if no frame has been resolved yet.
+  [[nodiscard]] const GpuFrame* getLatestFrame() const;
+  [[nodiscard]] const std::deque<GpuFrame>& getHistory() const;
+
+  void setFrameCallback(FrameCallback callback);
+
+  /// Writes exportChromeTrace() of the history to a file which can be loaded in chrome://tracing
+  /// or Perfetto UI.
+  bool writeChromeTrace(const std::string& path) const;
+
+ private:
+  struct PendingFrame {
+    std::shared_ptr<igl::ITimestampQueries> queries;
+    uint64_t frameIndex = 0;
+    double cpuStartSeconds = 0.0;
+    uint64_t beginFrameCall = 0; ///< value of numBeginFrameCalls_ when the frame began
+    bool pending = false;
+  };
+
+  [[nodiscard]] bool isExpired(const PendingFrame& frame) const;
+  void drop(PendingFrame& frame);
+  void resolve(PendingFrame& frame);
+  void emitCounters(const GpuFrame& frame);
+
+  GpuProfilerDesc desc_;
+  std::vector<PendingFrame> frames_;
+  std::deque<GpuFrame> history_;
+  FrameCallback callback_;
+  uint64_t frameIndex_ = 0;
+  uint64_t numBeginFrameCalls_ = 0;
+  // counter names must outlive the profiler backend; unordered_set never moves its elements
+  std::unordered_set<std::string> counterNames_;
+};
+
+/// Formats a frame as an indented tree with one scope per line.
+[[nodiscard]] std::string formatGpuFrameTree(const GpuFrame& frame);
+
+/// Formats frames as Chrome trace event JSON with one complete event per scope.
+[[nodiscard]] std::string exportChromeTrace(const std::deque<GpuFrame>& frames);
+
+} // namespace iglu::gpu_profiler
@@ -113,6 +113,75 @@ ManagedUniformBuffer::~ManagedUniformBuffer() {
 #endif
 }
 
+namespace {
+int getUniformLocation(const igl::IRenderPipelineState& pipelineState,
+                       const igl::NameHandle& name) {
+  // Since the backend is opengl, getIndexByName's igl::ShaderStage parameter is ignored and
+  // will work when binding vertex/fragment
+  return pipelineState.getIndexByName(name, igl::ShaderStage::Fragment);
+}
+
+int getUniformLocation(const igl::IComputePipelineState& pipelineState,
+                       const igl::NameHandle& name) {
+  return pipelineState.getIndexByName(name);
+}
+} // namespace
+
+template<typename PipelineState>
+const ManagedUniformBuffer::ResolvedLocations& ManagedUniformBuffer::resolveLocations(
+    const PipelineState& pipelineState) {
+  const size_t numUniforms = uniformInfo.uniforms.size();
+  const uint64_t pipelineStateId = pipelineState.getId();
+
+  ResolvedLocations* resolved = nullptr;
+  for (auto& entry : resolvedLocations_) {
+    if (entry.pipelineStateId == pipelineStateId) {
+      if (entry.locations.size() == numUniforms &&
+          entry.uniforms == uniformInfo.uniforms.data()) {
+        return entry;
+      }
+      resolved = &entry;
+      break;
+    }
+  }
+  if (!resolved) {
+    if (resolvedLocations_.size() < kMaxResolvedPipelineStates) {
+      resolved = &resolvedLocations_.emplace_back();
+    } else {
+      // Evict the entries in the order they were added
+      resolved = &resolvedLocations_[nextResolvedLocations_];
+      nextResolvedLocations_ = (nextResolvedLocations_ + 1) % kMaxResolvedPipelineStates;
+    }
+  }
+
+  resolved->pipelineStateId = pipelineStateId;
+  resolved->uniforms = uniformInfo.uniforms.data();
+  resolved->locations.resize(numUniforms);
+  for (size_t i = 0; i < numUniforms; ++i) {
+    resolved->locations[i] =
+        getUniformLocation(pipelineState, igl::genNameHandle(uniformInfo.uniforms[i].name));
+  }
+  return *resolved;
+}
+
+template<typename Encoder>
+void ManagedUniformBuffer::bindUniforms(const ResolvedLocations& resolved, Encoder& encoder) {
+  for (size_t i = 0; i < resolved.locations.size(); ++i) {
+    auto& uniform = uniformInfo.uniforms[i];
+    uniform.location = resolved.locations[i];
+    if (uniform.location >= 0) {
+      encoder.bindUniform(uniform, data_);
+    } else {
+      IGL_LOG_ERROR_ONCE("The uniform %s was not found in shader\n", uniform.name.c_str());
+    }
+  }
+}
+
+void ManagedUniformBuffer::clearResolvedLocations() {
+  resolvedLocations_.clear();
+  nextResolvedLocations_ = 0;
+}
+
 void ManagedUniformBuffer::bind(const igl::IDevice& device,
                                 const igl::IRenderPipelineState& pipelineState,
                                 igl::IRenderCommandEncoder& encoder) {
@@ -122,19 +191,7 @@ void ManagedUniformBuffer::bind(const igl::IDevice& device,
   }
   if (device.getBackendType() == igl::BackendType::OpenGL) {
 #if IGL_BACKEND_OPENGL && !IGL_PLATFORM_MACCATALYST
-    for (auto& uniform : uniformInfo.uniforms) {
-      // Since the backend is opengl, getIndexByName's igl::ShaderStage parameter is ignored and
-      // will work when binding vertex/fragment
-      // Might be optimized to use NameHandle
-      uniform.location = pipelineState.getIndexByName(igl::genNameHandle(uniform.name),
-                                                      igl::ShaderStage::Fragment);
-
-      if (uniform.location >= 0) {
-        encoder.bindUniform(uniform, data_);
-      } else {
-        IGL_LOG_ERROR_ONCE("The uniform %s was not found in shader\n", uniform.name.c_str());
-      }
-    }
+    bindUniforms(resolveLocations(pipelineState), encoder);
 #else
     IGL_DEBUG_ABORT("Should not use OpenGL backend on Mac Catalyst, use Metal instead\n");
 #endif
@@ -158,14 +215,7 @@ void ManagedUniformBuffer::bind(const igl::IDevice& device,
                                 const igl::IComputePipelineState& pipelineState,
                                 igl::IComputeCommandEncoder& encoder) {
   if (device.getBackendType() == igl::BackendType::OpenGL) {
-    for (auto& uniform : uniformInfo.uniforms) {
-      uniform.location = pipelineState.getIndexByName(igl::genNameHandle(uniform.name));
-      if (uniform.location >= 0) {
-        encoder.bindUniform(uniform, data_);
-      } else {
-        IGL_LOG_ERROR_ONCE("The uniform %s was not found in shader\n", uniform.name.c_str());
-      }
-    }
+    bindUniforms(resolveLocations(pipelineState), encoder);
   } else {
     if (useBindBytes_) {
       encoder.bindBytes(uniformInfo.index, data_, length_);
@@ -218,32 +268,40 @@ bool ManagedUniformBuffer::updateData(const char* name, const void* data, size_t
   IGL_DEBUG_ASSERT(name);
 
   const int index = getIndex(name);
-
-  if (index >= 0) {
-    auto& uniform = uniformInfo.uniforms[index];
-    if (strcmp(name, uniform.name.c_str()) == 0) {
-      // If dataSize is smaller than the expected size, we will just update as client requested.
-      // This could mean the user knows only a portion of the uniform data needs updating
-      // However, if dataSize is larger than or equal to what we expect for this uniform, we will
-      // only copy data up to the expected data size for this uniform
-      const size_t uniformDataSize = getUniformDataSizeInternal(uniform);
-      if (dataSize > uniformDataSize) {
-        dataSize = uniformDataSize;
-#if IGL_DEBUG
-        IGL_LOG_INFO_ONCE(
-            "IGLU/ManagedBufferBuffer/updateData: dataSize is larger than expected. This could be "
-            "benign. See comments in updateData for more details. \n");
+  if (index < 0) {
+#ifndef GTEST
+    IGL_DEBUG_ABORT("call to updateData: uniform with name %s not found, skipping update\n", name);
 #endif
-      }
-      char* ptr = reinterpret_cast<char*>(data_);
-      checked_memcpy(ptr + uniform.offset, uniformDataSize, data, dataSize);
-      return true;
-    }
+    return false;
   }
+  return updateData(index, data, dataSize);
+}
+
+bool ManagedUniformBuffer::updateData(int slot, const void* data, size_t dataSize) {
+  if (slot < 0 || static_cast<size_t>(slot) >= uniformInfo.uniforms.size()) {
 #ifndef GTEST
-  IGL_DEBUG_ABORT("call to updateData: uniform with name %s not found, skipping update\n", name);
+    IGL_DEBUG_ABORT("call to updateData: uniform slot %d out of range, skipping update\n", slot);
 #endif
-  return false;
+    return false;
+  }
+
+  auto& uniform = uniformInfo.uniforms[slot];
+  // If dataSize is smaller than the expected size, we will just update as client requested.
+  // This could mean the user knows only a portion of the uniform data needs updating
+  // However, if dataSize is larger than or equal to what we expect for this uniform, we will
+  // only copy data up to the expected data size for this uniform
+  const size_t uniformDataSize = getUniformDataSizeInternal(uniform);
+  if (dataSize > uniformDataSize) {
+    dataSize = uniformDataSize;
+#if IGL_DEBUG
+    IGL_LOG_INFO_ONCE(
+        "IGLU/ManagedBufferBuffer/updateData: dataSize is larger than expected. This could be "
+        "benign. See comments in updateData for more details. \n");
+#endif
+  }
+  char* ptr = reinterpret_cast<char*>(data_);
+  checked_memcpy(ptr + uniform.offset, uniformDataSize, data, dataSize);
+  return true;
 }
 
 size_t ManagedUniformBuffer::getUniformDataSize(const char* name) {
@@ -25,6 +25,9 @@ class ManagedUniformBuffer {
   ~ManagedUniformBuffer();
   // This function takes a chunk of data and use it to update the value of uniform 'name'
   bool updateData(const char* name, const void* data, size_t dataSize);
+  // Same as above for the uniform at index 'slot' in uniformInfo.uniforms, as returned by
+  // getIndex(). Prefer this in per-frame code since it does not look up the name.
+  bool updateData(int slot, const void* data, size_t dataSize);
   // This function returns the expected data size for uniform with given name
   // If uniform has type UniformType::Float3, this function will return
   // 3 * sizeof(float) if elementStride is zero and return elementStride otherwise
@@ -48,12 +51,34 @@ class ManagedUniformBuffer {
 
   int getIndex(const char* name) const;
 
+  // The OpenGL code path resolves uniform locations by name the first time the buffer is bound
+  // with a pipeline state and caches them for the following binds with the same pipeline state.
+  // The cache is keyed by the pipeline state id, so destroyed pipeline states never match. Entries
+  // are also re-resolved when uniformInfo.uniforms is resized or reallocated; call this after
+  // renaming uniforms in place.
+  void clearResolvedLocations();
+
  private:
+  // Locations of uniformInfo.uniforms in one pipeline state
+  struct ResolvedLocations {
+    uint64_t pipelineStateId = 0; // IRenderPipelineState/IComputePipelineState::getId()
+    const igl::UniformDesc* uniforms = nullptr; // uniformInfo.uniforms.data() when resolved
+    std::vector<int> locations;
+  };
+  static constexpr size_t kMaxResolvedPipelineStates = 4;
+
+  template<typename PipelineState>
+  const ResolvedLocations& resolveLocations(const PipelineState& pipelineState);
+  template<typename Encoder>
+  void bindUniforms(const ResolvedLocations& resolved, Encoder& encoder);
+
   size_t getUniformDataSizeInternal(igl::UniformDesc& uniform);
   void* data_ = nullptr;
   int length_ = 0;
   std::shared_ptr<igl::IBuffer> buffer_ = nullptr;
   std::unique_ptr<std::unordered_map<std::string, size_t>> uniformLUT_ = nullptr;
+  std::vector<ResolvedLocations> resolvedLocations_;
+  size_t nextResolvedLocations_ = 0;
 #if IGL_PLATFORM_IOS_SIMULATOR
   /// If we're in the simulator we need to hold onto length so we can deallocate memory buffer
   /// properly.
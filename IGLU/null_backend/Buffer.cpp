@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/Buffer.h>
+
+#include <cstring>
+
+namespace iglu::null_backend {
+
+Buffer::Buffer(std::shared_ptr<Counters> counters, const igl::BufferDesc& desc) :
+  counters_(std::move(counters)),
+  hint_(desc.hint),
+  storage_(desc.storage),
+  type_(desc.type),
+  data_(desc.length) {
+  if (desc.data != nullptr) {
+    std::memcpy(data_.data(), desc.data, desc.length);
+  }
+  counters_->liveBuffers++;
+  counters_->liveBufferBytes += data_.size();
+}
+
+Buffer::~Buffer() {
+  counters_->liveBuffers--;
+  counters_->liveBufferBytes -= data_.size();
+}
+
+igl::Result Buffer::upload(const void* IGL_NULLABLE data, const igl::BufferRange& range) {
+  if (range.offset + range.size > data_.size()) {
+    return igl::Result{igl::Result::Code::ArgumentOutOfRange, "Upload range is out of bounds"};
+  }
+  if (data == nullptr) {
+    return igl::Result{igl::Result::Code::ArgumentNull, "Data is null"};
+  }
+  IGL_DEBUG_ASSERT(!isMapped_, "Uploading to a mapped buffer");
+
+  std::memcpy(data_.data() + range.offset, data, range.size);
+  counters_->bufferUploads++;
+  counters_->bufferUploadBytes += range.size;
+  return igl::Result{};
+}
+
+void* IGL_NULLABLE Buffer::map(const igl::BufferRange& range, igl::Result* IGL_NULLABLE outResult) {
+  if (range.offset + range.size > data_.size()) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentOutOfRange, "Map range is out of bounds");
+    return nullptr;
+  }
+  if (isMapped_) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::InvalidOperation, "Buffer is already mapped");
+    return nullptr;
+  }
+  isMapped_ = true;
+  igl::Result::setOk(outResult);
+  return data_.data() + range.offset;
+}
+
+void Buffer::unmap() {
+  IGL_DEBUG_ASSERT(isMapped_, "Unmapping a buffer which is not mapped");
+  isMapped_ = false;
+}
+
+igl::BufferDesc::BufferAPIHint Buffer::requestedApiHints() const noexcept {
+  return hint_;
+}
+
+igl::BufferDesc::BufferAPIHint Buffer::acceptedApiHints() const noexcept {
+  return hint_;
+}
+
+igl::ResourceStorage Buffer::storage() const noexcept {
+  return storage_;
+}
+
+size_t Buffer::getSizeInBytes() const {
+  return data_.size();
+}
+
+uint64_t Buffer::gpuAddress(size_t offset) const {
+  return reinterpret_cast<uint64_t>(data_.data()) + offset;
+}
+
+igl::BufferDesc::BufferType Buffer::getBufferType() const {
+  return type_;
+}
+
+} // namespace iglu::null_backend
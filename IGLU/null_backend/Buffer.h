@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/Buffer.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Buffer backed by CPU memory. Uploads are validated, counted and copied so that map() returns the
+ * latest contents, but nothing is ever sent to a GPU.
+ */
+class Buffer final : public igl::IBuffer {
+ public:
+  Buffer(std::shared_ptr<Counters> counters, const igl::BufferDesc& desc);
+  ~Buffer() override;
+
+  igl::Result upload(const void* IGL_NULLABLE data, const igl::BufferRange& range) final;
+  void* IGL_NULLABLE map(const igl::BufferRange& range, igl::Result* IGL_NULLABLE outResult) final;
+  void unmap() final;
+
+  [[nodiscard]] igl::BufferDesc::BufferAPIHint requestedApiHints() const noexcept final;
+  [[nodiscard]] igl::BufferDesc::BufferAPIHint acceptedApiHints() const noexcept final;
+  [[nodiscard]] igl::ResourceStorage storage() const noexcept final;
+  [[nodiscard]] size_t getSizeInBytes() const final;
+  [[nodiscard]] uint64_t gpuAddress(size_t offset = 0) const final;
+  [[nodiscard]] igl::BufferDesc::BufferType getBufferType() const final;
+
+ private:
+  std::shared_ptr<Counters> counters_;
+  igl::BufferDesc::BufferAPIHint hint_;
+  igl::ResourceStorage storage_;
+  igl::BufferDesc::BufferType type_;
+  std::vector<uint8_t> data_;
+  bool isMapped_ = false;
+};
+
+} // namespace iglu::null_backend
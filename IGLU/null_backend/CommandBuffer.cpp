@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/CommandBuffer.h>
+
+#include <IGLU/null_backend/ComputeCommandEncoder.h>
+#include <IGLU/null_backend/RenderCommandEncoder.h>
+#include <igl/Buffer.h>
+
+namespace iglu::null_backend {
+
+CommandBuffer::CommandBuffer(std::shared_ptr<Counters> counters, igl::CommandBufferDesc desc) :
+  igl::ICommandBuffer(std::move(desc)), counters_(std::move(counters)) {
+  counters_->commandBuffers++;
+}
+
+CommandBuffer::~CommandBuffer() {
+  IGL_DEBUG_ASSERT(debugGroupDepth_ == 0, "Unbalanced debug group labels");
+}
+
+std::unique_ptr<igl::IRenderCommandEncoder> CommandBuffer::createRenderCommandEncoder(
+    const igl::RenderPassDesc& /*renderPass*/,
+    const std::shared_ptr<igl::IFramebuffer>& framebuffer,
+    const igl::Dependencies& /*dependencies*/,
+    igl::Result* IGL_NULLABLE outResult) {
+  if (framebuffer == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentNull, "Framebuffer is null");
+    return nullptr;
+  }
+  IGL_DEBUG_ASSERT(!isSubmitted_, "Encoding into a command buffer which was submitted");
+
+  igl::Result::setOk(outResult);
+  return std::make_unique<RenderCommandEncoder>(shared_from_this(), counters_);
+}
+
+std::unique_ptr<igl::IComputeCommandEncoder> CommandBuffer::createComputeCommandEncoder() {
+  IGL_DEBUG_ASSERT(!isSubmitted_, "Encoding into a command buffer which was submitted");
+  return std::make_unique<ComputeCommandEncoder>(counters_);
+}
+
+void CommandBuffer::present(const std::shared_ptr<igl::ITexture>& /*surface*/) const {}
+
+void CommandBuffer::waitUntilScheduled() {}
+
+void CommandBuffer::waitUntilCompleted() {}
+
+void CommandBuffer::pushDebugGroupLabel(const char* IGL_NONNULL label,
+                                        const igl::Color& /*color*/) const {
+  IGL_DEBUG_ASSERT(label != nullptr && *label);
+  debugGroupDepth_++;
+}
+
+void CommandBuffer::popDebugGroupLabel() const {
+  IGL_DEBUG_ASSERT(debugGroupDepth_ > 0, "No debug group label to pop");
+  debugGroupDepth_--;
+}
+
+void CommandBuffer::copyBuffer(igl::IBuffer& src,
+                               igl::IBuffer& dst,
+                               uint64_t srcOffset,
+                               uint64_t dstOffset,
+                               uint64_t size) {
+  if (!IGL_DEBUG_VERIFY(srcOffset + size <= src.getSizeInBytes() &&
+                        dstOffset + size <= dst.getSizeInBytes())) {
+    return;
+  }
+  counters_->copies++;
+  counters_->copyBytes += size;
+}
+
+void CommandBuffer::copyTextureToBuffer(igl::ITexture& src,
+                                        igl::IBuffer& dst,
+                                        uint64_t dstOffset,
+                                        uint32_t level,
+                                        uint32_t layer) {
+  if (!IGL_DEBUG_VERIFY(level < src.getNumMipLevels() && layer < src.getNumLayers())) {
+    return;
+  }
+  const size_t numBytes = src.getProperties().getBytesPerRange(src.getLayerRange(layer, level));
+  if (!IGL_DEBUG_VERIFY(dstOffset + numBytes <= dst.getSizeInBytes())) {
+    return;
+  }
+  counters_->copies++;
+  counters_->copyBytes += numBytes;
+}
+
+} // namespace iglu::null_backend
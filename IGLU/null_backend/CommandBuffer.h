@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/CommandBuffer.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Command buffer which creates null encoders. Waiting for it never blocks because nothing is
+ * executed.
+ */
+class CommandBuffer final : public igl::ICommandBuffer,
+                            public std::enable_shared_from_this<CommandBuffer> {
+ public:
+  CommandBuffer(std::shared_ptr<Counters> counters, igl::CommandBufferDesc desc);
+  ~CommandBuffer() override;
+
+  [[nodiscard]] std::unique_ptr<igl::IRenderCommandEncoder> createRenderCommandEncoder(
+      const igl::RenderPassDesc& renderPass,
+      const std::shared_ptr<igl::IFramebuffer>& framebuffer,
+      const igl::Dependencies& dependencies,
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] std::unique_ptr<igl::IComputeCommandEncoder> createComputeCommandEncoder() final;
+  void present(const std::shared_ptr<igl::ITexture>& surface) const final;
+  void waitUntilScheduled() final;
+  void waitUntilCompleted() final;
+  void pushDebugGroupLabel(const char* IGL_NONNULL label,
+                           const igl::Color& color = igl::Color(1, 1, 1, 1)) const final;
+  void popDebugGroupLabel() const final;
+  void copyBuffer(igl::IBuffer& src,
+                  igl::IBuffer& dst,
+                  uint64_t srcOffset,
+                  uint64_t dstOffset,
+                  uint64_t size) final;
+  void copyTextureToBuffer(igl::ITexture& src,
+                           igl::IBuffer& dst,
+                           uint64_t dstOffset,
+                           uint32_t level,
+                           uint32_t layer) final;
+
+  [[nodiscard]] bool isSubmitted() const {
+    return isSubmitted_;
+  }
+
+ private:
+  friend class CommandQueue;
+
+  std::shared_ptr<Counters> counters_;
+  mutable int debugGroupDepth_ = 0;
+  mutable bool isSubmitted_ = false;
+};
+
+} // namespace iglu::null_backend
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/CommandQueue.h>
+
+#include <IGLU/null_backend/CommandBuffer.h>
+
+namespace iglu::null_backend {
+
+CommandQueue::CommandQueue(std::shared_ptr<Counters> counters) : counters_(std::move(counters)) {}
+
+std::shared_ptr<igl::ICommandBuffer> CommandQueue::createCommandBuffer(
+    const igl::CommandBufferDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  igl::Result::setOk(outResult);
+  return std::make_shared<CommandBuffer>(counters_, desc);
+}
+
+igl::SubmitHandle CommandQueue::submit(const igl::ICommandBuffer& commandBuffer, bool endOfFrame) {
+  const auto& cb = static_cast<const CommandBuffer&>(commandBuffer);
+  IGL_DEBUG_ASSERT(!cb.isSubmitted(), "Command buffer was already submitted");
+  cb.isSubmitted_ = true;
+
+  incrementDrawCount(cb.getCurrentDrawCount());
+  counters_->submits++;
+  if (endOfFrame) {
+    counters_->frames++;
+  }
+  return ++lastSubmitHandle_;
+}
+
+} // namespace iglu::null_backend
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/CommandQueue.h>
+
+namespace iglu::null_backend {
+
+class CommandQueue final : public igl::ICommandQueue {
+ public:
+  explicit CommandQueue(std::shared_ptr<Counters> counters);
+
+  [[nodiscard]] std::shared_ptr<igl::ICommandBuffer> createCommandBuffer(
+      const igl::CommandBufferDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  igl::SubmitHandle submit(const igl::ICommandBuffer& commandBuffer, bool endOfFrame = false) final;
+
+ private:
+  std::shared_ptr<Counters> counters_;
+  igl::SubmitHandle lastSubmitHandle_ = 0;
+};
+
+} // namespace iglu::null_backend
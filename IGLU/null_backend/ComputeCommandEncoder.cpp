@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/ComputeCommandEncoder.h>
+
+#include <igl/Buffer.h>
+
+namespace iglu::null_backend {
+
+ComputeCommandEncoder::ComputeCommandEncoder(std::shared_ptr<Counters> counters) :
+  counters_(std::move(counters)) {
+  counters_->computePasses++;
+}
+
+ComputeCommandEncoder::~ComputeCommandEncoder() {
+  IGL_DEBUG_ASSERT(!isEncoding_, "endEncoding() was not called");
+}
+
+void ComputeCommandEncoder::endEncoding() {
+  IGL_DEBUG_ASSERT(isEncoding_, "endEncoding() was already called");
+  IGL_DEBUG_ASSERT(debugGroupDepth_ == 0, "Unbalanced debug group labels");
+  isEncoding_ = false;
+}
+
+void ComputeCommandEncoder::pushDebugGroupLabel(const char* IGL_NONNULL label,
+                                                const igl::Color& /*color*/) const {
+  IGL_DEBUG_ASSERT(label != nullptr && *label);
+  debugGroupDepth_++;
+}
+
+void ComputeCommandEncoder::insertDebugEventLabel(const char* IGL_NONNULL label,
+                                                  const igl::Color& /*color*/) const {
+  IGL_DEBUG_ASSERT(label != nullptr && *label);
+}
+
+void ComputeCommandEncoder::popDebugGroupLabel() const {
+  IGL_DEBUG_ASSERT(debugGroupDepth_ > 0, "No debug group label to pop");
+  debugGroupDepth_--;
+}
+
+void ComputeCommandEncoder::bindUniform(const igl::UniformDesc& uniformDesc, const void* data) {
+  IGL_DEBUG_ASSERT(data != nullptr);
+  if (uniformDesc.location < 0) {
+    return;
+  }
+  counters_->uniformBinds++;
+}
+
+void ComputeCommandEncoder::bindTexture(uint32_t index, igl::ITexture* /*texture*/) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_TEXTURE_SAMPLERS_MAX);
+  counters_->textureBinds++;
+}
+
+void ComputeCommandEncoder::bindImageTexture(uint32_t index,
+                                             igl::ITexture* /*texture*/,
+                                             igl::TextureFormat /*format*/) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_TEXTURE_SAMPLERS_MAX);
+  counters_->textureBinds++;
+}
+
+void ComputeCommandEncoder::bindSamplerState(uint32_t index,
+                                             igl::ISamplerState* /*samplerState*/) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_TEXTURE_SAMPLERS_MAX);
+  counters_->samplerBinds++;
+}
+
+void ComputeCommandEncoder::bindBuffer(uint32_t index,
+                                       igl::IBuffer* buffer,
+                                       size_t offset,
+                                       size_t bufferSize) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_BUFFER_BINDINGS_MAX);
+  if (!IGL_DEBUG_VERIFY(buffer != nullptr)) {
+    return;
+  }
+  IGL_DEBUG_ASSERT(offset + bufferSize <= buffer->getSizeInBytes(),
+                   "Buffer range is out of bounds");
+  counters_->bufferBinds++;
+}
+
+void ComputeCommandEncoder::bindBytes(uint32_t index, const void* data, size_t length) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_BUFFER_BINDINGS_MAX);
+  IGL_DEBUG_ASSERT(data != nullptr || length == 0);
+  counters_->bufferBinds++;
+  counters_->inlineBytes += length;
+}
+
+void ComputeCommandEncoder::bindPushConstants(const void* data, size_t length, size_t /*offset*/) {
+  IGL_DEBUG_ASSERT(data != nullptr || length == 0);
+  counters_->inlineBytes += length;
+}
+
+void ComputeCommandEncoder::bindComputePipelineState(
+    const std::shared_ptr<igl::IComputePipelineState>& pipelineState) {
+  if (!IGL_DEBUG_VERIFY(pipelineState != nullptr)) {
+    return;
+  }
+  counters_->pipelineBinds++;
+  if (pipelineState.get() == pipelineState_) {
+    counters_->redundantPipelineBinds++;
+  }
+  pipelineState_ = pipelineState.get();
+}
+
+void ComputeCommandEncoder::countDispatch() {
+  IGL_DEBUG_ASSERT(isEncoding_, "Dispatching after endEncoding()");
+  IGL_DEBUG_ASSERT(pipelineState_ != nullptr, "No compute pipeline state is bound");
+  counters_->dispatches++;
+}
+
+void ComputeCommandEncoder::dispatchThreadGroups(const igl::Dimensions& /*threadgroupCount*/,
+                                                 const igl::Dimensions& /*threadgroupSize*/,
+                                                 const igl::Dependencies& /*dependencies*/) {
+  countDispatch();
+}
+
+void ComputeCommandEncoder::dispatchThreadGroupsIndirect(
+    igl::IBuffer& indirectBuffer,
+    size_t indirectBufferOffset,
+    const igl::Dimensions& /*threadgroupSize*/,
+    const igl::Dependencies& /*dependencies*/) {
+  IGL_DEBUG_ASSERT((indirectBuffer.getBufferType() & igl::BufferDesc::BufferTypeBits::Indirect) !=
+                   0);
+  IGL_DEBUG_ASSERT(indirectBufferOffset + 3 * sizeof(uint32_t) <= indirectBuffer.getSizeInBytes());
+  countDispatch();
+}
+
+} // namespace iglu::null_backend
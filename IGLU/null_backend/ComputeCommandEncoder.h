@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/ComputeCommandEncoder.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Compute command encoder which validates and counts commands, then discards them.
+ */
+class ComputeCommandEncoder final : public igl::IComputeCommandEncoder {
+ public:
+  explicit ComputeCommandEncoder(std::shared_ptr<Counters> counters);
+  ~ComputeCommandEncoder() override;
+
+  void endEncoding() final;
+
+  void pushDebugGroupLabel(const char* IGL_NONNULL label,
+                           const igl::Color& color = igl::Color(1, 1, 1, 1)) const final;
+  void insertDebugEventLabel(const char* IGL_NONNULL label,
+                             const igl::Color& color = igl::Color(1, 1, 1, 1)) const final;
+  void popDebugGroupLabel() const final;
+
+  void bindUniform(const igl::UniformDesc& uniformDesc, const void* data) final;
+  void bindTexture(uint32_t index, igl::ITexture* texture) final;
+  void bindImageTexture(uint32_t index, igl::ITexture* texture, igl::TextureFormat format) final;
+  void bindSamplerState(uint32_t index, igl::ISamplerState* samplerState) final;
+  void bindBuffer(uint32_t index,
+                  igl::IBuffer* buffer,
+                  size_t offset = 0,
+                  size_t bufferSize = 0) final;
+  void bindBytes(uint32_t index, const void* data, size_t length) final;
+  void bindPushConstants(const void* data, size_t length, size_t offset = 0) final;
+  void bindComputePipelineState(
+      const std::shared_ptr<igl::IComputePipelineState>& pipelineState) final;
+  void dispatchThreadGroups(const igl::Dimensions& threadgroupCount,
+                            const igl::Dimensions& threadgroupSize,
+                            const igl::Dependencies& dependencies = igl::Dependencies()) final;
+  void dispatchThreadGroupsIndirect(
+      igl::IBuffer& indirectBuffer,
+      size_t indirectBufferOffset,
+      const igl::Dimensions& threadgroupSize,
+      const igl::Dependencies& dependencies = igl::Dependencies()) final;
+
+ private:
+  void countDispatch();
+
+  std::shared_ptr<Counters> counters_;
+  const igl::IComputePipelineState* IGL_NULLABLE pipelineState_ = nullptr;
+  bool isEncoding_ = true;
+  mutable int debugGroupDepth_ = 0;
+};
+
+} // namespace iglu::null_backend
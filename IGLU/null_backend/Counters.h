@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace iglu::null_backend {
+
+/**
+ * Bookkeeping recorded by the null backend instead of doing GPU work.
+ * Command and transfer counters accumulate until reset() is called, typically once per frame.
+ * Live resource counters track the resources which currently exist and are never reset.
+ */
+struct Counters {
+  // Command buffers and passes
+  size_t commandBuffers = 0;
+  size_t submits = 0;
+  size_t frames = 0;
+  size_t renderPasses = 0;
+  size_t computePasses = 0;
+
+  // Draws and dispatches
+  size_t draws = 0;
+  size_t indexedDraws = 0;
+  size_t indirectDraws = 0;
+  size_t meshTaskDraws = 0;
+  size_t vertices = 0; ///< vertices or indices consumed by direct draws, times instance count
+  size_t dispatches = 0;
+
+  // State changes
+  size_t pipelineBinds = 0;
+  size_t redundantPipelineBinds = 0; ///< binds of the pipeline which was already bound
+  size_t depthStencilStateBinds = 0;
+  size_t bufferBinds = 0; ///< uniform, storage, vertex and index buffers
+  size_t textureBinds = 0;
+  size_t samplerBinds = 0;
+  size_t uniformBinds = 0; ///< individual uniforms bound with bindUniform()
+  size_t bindGroupBinds = 0;
+  size_t dynamicStateChanges = 0; ///< viewport, scissor, stencil reference, blend color, bias
+
+  // Transfers
+  size_t bufferUploads = 0;
+  size_t bufferUploadBytes = 0;
+  size_t textureUploads = 0;
+  size_t textureUploadBytes = 0;
+  size_t inlineBytes = 0; ///< bytes passed to bindBytes() and bindPushConstants()
+  size_t copies = 0;
+  size_t copyBytes = 0;
+
+  // Resources created
+  size_t buffersCreated = 0;
+  size_t texturesCreated = 0;
+  size_t framebuffersCreated = 0;
+  size_t pipelinesCreated = 0;
+  size_t shaderModulesCreated = 0;
+
+  // Live resources
+  size_t liveBuffers = 0;
+  size_t liveTextures = 0;
+  size_t liveBufferBytes = 0;
+  size_t liveTextureBytes = 0;
+
+  /// Resets everything except the live resource counters.
+  void reset() {
+    Counters cleared;
+    cleared.liveBuffers = liveBuffers;
+    cleared.liveTextures = liveTextures;
+    cleared.liveBufferBytes = liveBufferBytes;
+    cleared.liveTextureBytes = liveTextureBytes;
+    *this = cleared;
+  }
+};
+
+} // namespace iglu::null_backend
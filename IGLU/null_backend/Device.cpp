@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/Device.h>
+
+#include <IGLU/null_backend/Buffer.h>
+#include <IGLU/null_backend/CommandQueue.h>
+#include <IGLU/null_backend/Framebuffer.h>
+#include <IGLU/null_backend/PipelineState.h>
+#include <IGLU/null_backend/Shader.h>
+#include <IGLU/null_backend/State.h>
+#include <IGLU/null_backend/Texture.h>
+#include <igl/IGL.h>
+
+namespace iglu::null_backend {
+
+namespace {
+
+template<typename T>
+void trackResource(const igl::IDevice& device, T& resource, const std::string& debugName) {
+  if (device.hasResourceTracker()) {
+    resource.initResourceTracker(device.getResourceTracker(), debugName);
+  }
+}
+
+} // namespace
+
+Device::Device(igl::BackendType reportedBackendType) :
+  reportedBackendType_(reportedBackendType), counters_(std::make_shared<Counters>()) {}
+
+bool Device::hasFeature(igl::DeviceFeatures /*feature*/) const {
+  // Nothing is executed, so every feature can be accepted and counted.
+  return true;
+}
+
+bool Device::hasRequirement(igl::DeviceRequirement /*requirement*/) const {
+  return false;
+}
+
+igl::ICapabilities::TextureFormatCapabilities Device::getTextureFormatCapabilities(
+    igl::TextureFormat format) const {
+  return format == igl::TextureFormat::Invalid ? TextureFormatCapabilityBits::Unsupported
+                                               : TextureFormatCapabilityBits::All;
+}
+
+bool Device::getFeatureLimits(igl::DeviceFeatureLimits featureLimits, size_t& result) const {
+  switch (featureLimits) {
+  case igl::DeviceFeatureLimits::BufferAlignment:
+  case igl::DeviceFeatureLimits::BufferNoCopyAlignment:
+  case igl::DeviceFeatureLimits::ShaderStorageBufferOffsetAlignment:
+    result = 16;
+    return true;
+  case igl::DeviceFeatureLimits::PushConstantsAlignment:
+    result = 4;
+    return true;
+  case igl::DeviceFeatureLimits::MaxBindBytesBytes:
+  case igl::DeviceFeatureLimits::MaxPushConstantBytes:
+    result = 256;
+    return true;
+  case igl::DeviceFeatureLimits::MaxCubeMapDimension:
+  case igl::DeviceFeatureLimits::MaxTextureDimension1D2D:
+    result = 16384;
+    return true;
+  case igl::DeviceFeatureLimits::MaxTextureDimension3D:
+    result = 2048;
+    return true;
+  case igl::DeviceFeatureLimits::MaxFragmentUniformVectors:
+  case igl::DeviceFeatureLimits::MaxVertexUniformVectors:
+    result = 1024;
+    return true;
+  case igl::DeviceFeatureLimits::MaxMultisampleCount:
+    result = 8;
+    return true;
+  case igl::DeviceFeatureLimits::MaxStorageBufferBytes:
+    result = size_t(1) << 30;
+    return true;
+  case igl::DeviceFeatureLimits::MaxUniformBufferBytes:
+    result = 65536;
+    return true;
+  case igl::DeviceFeatureLimits::MaxComputeWorkGroupSizeX:
+  case igl::DeviceFeatureLimits::MaxComputeWorkGroupSizeY:
+  case igl::DeviceFeatureLimits::MaxComputeWorkGroupInvocations:
+    result = 1024;
+    return true;
+  case igl::DeviceFeatureLimits::MaxComputeWorkGroupSizeZ:
+    result = 64;
+    return true;
+  case igl::DeviceFeatureLimits::MaxVertexInputAttributes:
+    result = igl::IGL_VERTEX_ATTRIBUTES_MAX;
+    return true;
+  case igl::DeviceFeatureLimits::MaxColorAttachments:
+    result = igl::IGL_COLOR_ATTACHMENTS_MAX;
+    return true;
+  case igl::DeviceFeatureLimits::MaxDescriptorHeapCbvSrvUav:
+    result = 1000000;
+    return true;
+  case igl::DeviceFeatureLimits::MaxDescriptorHeapSamplers:
+    result = 2048;
+    return true;
+  case igl::DeviceFeatureLimits::MaxDescriptorHeapRtvs:
+  case igl::DeviceFeatureLimits::MaxDescriptorHeapDsvs:
+    result = 1024;
+    return true;
+  }
+  result = 0;
+  return false;
+}
+
+igl::ShaderVersion Device::getShaderVersion() const {
+  switch (reportedBackendType_) {
+  case igl::BackendType::OpenGL:
+    return {.family = igl::ShaderFamily::Glsl, .majorVersion = 4, .minorVersion = 60};
+  case igl::BackendType::Metal:
+    return {.family = igl::ShaderFamily::Metal, .majorVersion = 3, .minorVersion = 0};
+  case igl::BackendType::Vulkan:
+    return {.family = igl::ShaderFamily::SpirV, .majorVersion = 1, .minorVersion = 5};
+  case igl::BackendType::D3D12:
+    return {.family = igl::ShaderFamily::Hlsl, .majorVersion = 6, .minorVersion = 0};
+  default:
+    return {};
+  }
+}
+
+igl::BackendVersion Device::getBackendVersion() const {
+  switch (reportedBackendType_) {
+  case igl::BackendType::OpenGL:
+    return {.flavor = igl::BackendFlavor::OpenGL, .majorVersion = 4, .minorVersion = 6};
+  case igl::BackendType::Metal:
+    return {.flavor = igl::BackendFlavor::Metal, .majorVersion = 3, .minorVersion = 0};
+  case igl::BackendType::Vulkan:
+    return {.flavor = igl::BackendFlavor::Vulkan, .majorVersion = 1, .minorVersion = 3};
+  case igl::BackendType::D3D12:
+    return {.flavor = igl::BackendFlavor::D3D12, .majorVersion = 12, .minorVersion = 0};
+  default:
+    return {};
+  }
+}
+
+std::shared_ptr<igl::ICommandQueue> Device::createCommandQueue(
+    const igl::CommandQueueDesc& /*desc*/,
+    igl::Result* IGL_NULLABLE outResult) noexcept {
+  igl::Result::setOk(outResult);
+  return std::make_shared<CommandQueue>(counters_);
+}
+
+std::unique_ptr<igl::IBuffer> Device::createBuffer(const igl::BufferDesc& desc,
+                                                   igl::Result* IGL_NULLABLE
+                                                       outResult) const noexcept {
+  if (desc.type == 0) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid, "Invalid buffer type");
+    return nullptr;
+  }
+  auto buffer = std::make_unique<Buffer>(counters_, desc);
+  trackResource(*this, *buffer, desc.debugName);
+  counters_->buffersCreated++;
+  igl::Result::setOk(outResult);
+  return buffer;
+}
+
+std::shared_ptr<igl::IDepthStencilState> Device::createDepthStencilState(
+    const igl::DepthStencilStateDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  igl::Result::setOk(outResult);
+  return std::make_shared<DepthStencilState>(desc);
+}
+
+std::shared_ptr<igl::ISamplerState> Device::createSamplerState(
+    const igl::SamplerStateDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  auto sampler = std::make_shared<SamplerState>(desc);
+  trackResource(*this, *sampler, desc.debugName);
+  igl::Result::setOk(outResult);
+  return sampler;
+}
+
+std::shared_ptr<igl::ITexture> Device::createTexture(const igl::TextureDesc& desc,
+                                                     igl::Result* IGL_NULLABLE
+                                                         outResult) const noexcept {
+  const auto sanitized = sanitize(desc);
+  if (sanitized.format == igl::TextureFormat::Invalid) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid, "Invalid format");
+    return nullptr;
+  }
+  if (sanitized.usage == 0) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid, "Texture has no usage");
+    return nullptr;
+  }
+  auto texture = std::make_shared<Texture>(counters_, sanitized);
+  trackResource(*this, *texture, desc.debugName);
+  counters_->texturesCreated++;
+  igl::Result::setOk(outResult);
+  return texture;
+}
+
+std::shared_ptr<igl::ITexture> Device::createTextureView(
+    std::shared_ptr<igl::ITexture> texture,
+    const igl::TextureViewDesc& /*desc*/,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  if (texture == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentNull, "Texture is null");
+    return nullptr;
+  }
+  // Views share the storage of their texture and there is no storage to share.
+  igl::Result::setOk(outResult);
+  return texture;
+}
+
+std::shared_ptr<igl::IVertexInputState> Device::createVertexInputState(
+    const igl::VertexInputStateDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  if (desc.numAttributes > igl::IGL_VERTEX_ATTRIBUTES_MAX ||
+      desc.numInputBindings > igl::IGL_BUFFER_BINDINGS_MAX) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentOutOfRange, "Too many vertex attributes");
+    return nullptr;
+  }
+  for (size_t i = 0; i != desc.numAttributes; ++i) {
+    if (desc.attributes[i].bufferIndex >= desc.numInputBindings) {
+      igl::Result::setResult(outResult,
+                             igl::Result::Code::ArgumentOutOfRange,
+                             "Vertex attribute refers to a missing input binding");
+      return nullptr;
+    }
+  }
+  igl::Result::setOk(outResult);
+  return std::make_shared<VertexInputState>(desc);
+}
+
+std::shared_ptr<igl::IComputePipelineState> Device::createComputePipeline(
+    const igl::ComputePipelineDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  if (desc.shaderStages == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentNull, "Shader stages are null");
+    return nullptr;
+  }
+  if (desc.shaderStages->getType() != igl::ShaderStagesType::Compute) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "Shader stages are not compute stages");
+    return nullptr;
+  }
+  counters_->pipelinesCreated++;
+  igl::Result::setOk(outResult);
+  return std::make_shared<ComputePipelineState>(desc);
+}
+
+std::shared_ptr<igl::IRenderPipelineState> Device::createRenderPipeline(
+    const igl::RenderPipelineDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  if (desc.shaderStages == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentNull, "Shader stages are null");
+    return nullptr;
+  }
+  if (desc.shaderStages->getType() == igl::ShaderStagesType::Compute) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "Shader stages are not render stages");
+    return nullptr;
+  }
+  counters_->pipelinesCreated++;
+  igl::Result::setOk(outResult);
+  return std::make_shared<RenderPipelineState>(desc);
+}
+
+std::shared_ptr<igl::IShaderModule> Device::createShaderModule(
+    const igl::ShaderModuleDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  if (!desc.input.isValid()) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid, "Invalid shader input");
+    return nullptr;
+  }
+  auto module = std::make_shared<ShaderModule>(desc.info);
+  trackResource(*this, *module, desc.debugName);
+  counters_->shaderModulesCreated++;
+  igl::Result::setOk(outResult);
+  return module;
+}
+
+std::unique_ptr<igl::IShaderLibrary> Device::createShaderLibrary(
+    const igl::ShaderLibraryDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  if (!desc.input.isValid() || desc.moduleInfo.empty()) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "Invalid shader library input");
+    return nullptr;
+  }
+  std::vector<std::shared_ptr<igl::IShaderModule>> modules;
+  modules.reserve(desc.moduleInfo.size());
+  for (const auto& info : desc.moduleInfo) {
+    modules.push_back(std::make_shared<ShaderModule>(info));
+    counters_->shaderModulesCreated++;
+  }
+  auto library = std::make_unique<ShaderLibrary>(std::move(modules));
+  trackResource(*this, *library, desc.debugName);
+  igl::Result::setOk(outResult);
+  return library;
+}
+
+std::unique_ptr<igl::IShaderStages> Device::createShaderStages(
+    const igl::ShaderStagesDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) const {
+  auto stages = std::make_unique<ShaderStages>(desc);
+  if (!stages->isValid()) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid, "Invalid shader stages");
+    return nullptr;
+  }
+  trackResource(*this, *stages, desc.debugName);
+  igl::Result::setOk(outResult);
+  return stages;
+}
+
+std::shared_ptr<igl::IFramebuffer> Device::createFramebuffer(const igl::FramebufferDesc& desc,
+                                                             igl::Result* IGL_NULLABLE outResult) {
+  bool hasAttachment = desc.depthAttachment.texture != nullptr ||
+                       desc.stencilAttachment.texture != nullptr;
+  for (const auto& attachment : desc.colorAttachments) {
+    if (attachment.texture != nullptr &&
+        (attachment.texture->getUsage() & igl::TextureDesc::TextureUsageBits::Attachment) == 0) {
+      igl::Result::setResult(outResult,
+                             igl::Result::Code::ArgumentInvalid,
+                             "Color attachment was not created with attachment usage");
+      return nullptr;
+    }
+    hasAttachment = hasAttachment || attachment.texture != nullptr;
+  }
+  if (!hasAttachment) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::ArgumentInvalid, "Framebuffer has no attachments");
+    return nullptr;
+  }
+  auto framebuffer = std::make_shared<Framebuffer>(counters_, desc);
+  trackResource(*this, *framebuffer, desc.debugName);
+  counters_->framebuffersCreated++;
+  igl::Result::setOk(outResult);
+  return framebuffer;
+}
+
+std::shared_ptr<igl::ITimer> Device::createTimer(
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  igl::Result::setOk(outResult);
+  return std::make_shared<Timer>();
+}
+
+const igl::IPlatformDevice& Device::getPlatformDevice() const noexcept {
+  return platformDevice_;
+}
+
+igl::BackendType Device::getBackendType() const {
+  return reportedBackendType_;
+}
+
+igl::NormalizedZRange Device::getNormalizedZRange() const {
+  return reportedBackendType_ == igl::BackendType::OpenGL ? igl::NormalizedZRange::NegOneToOne
+                                                          : igl::NormalizedZRange::ZeroToOne;
+}
+
+size_t Device::getCurrentDrawCount() const {
+  return counters_->draws;
+}
+
+size_t Device::getShaderCompilationCount() const {
+  return counters_->shaderModulesCreated;
+}
+
+size_t Device::getGPUMemoryUsage() const {
+  return counters_->liveBufferBytes + counters_->liveTextureBytes;
+}
+
+igl::Holder<igl::BindGroupTextureHandle> Device::createBindGroup(
+    const igl::BindGroupTextureDesc& desc,
+    const igl::IRenderPipelineState* IGL_NULLABLE /*compatiblePipeline*/,
+    igl::Result* IGL_NULLABLE outResult) {
+  IGL_DEBUG_ASSERT(!desc.debugName.empty(), "Each bind group should have a debug name");
+
+  igl::BindGroupTextureDesc description(desc);
+  const auto handle = bindGroupTexturesPool_.create(std::move(description));
+
+  if (handle.empty()) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::RuntimeError, "Cannot create bind group");
+  } else {
+    igl::Result::setOk(outResult);
+  }
+  return {this, handle};
+}
+
+igl::Holder<igl::BindGroupBufferHandle> Device::createBindGroup(
+    const igl::BindGroupBufferDesc& desc,
+    igl::Result* IGL_NULLABLE outResult) {
+  IGL_DEBUG_ASSERT(!desc.debugName.empty(), "Each bind group should have a debug name");
+
+  igl::BindGroupBufferDesc description(desc);
+  const auto handle = bindGroupBuffersPool_.create(std::move(description));
+
+  if (handle.empty()) {
+    igl::Result::setResult(
+        outResult, igl::Result::Code::RuntimeError, "Cannot create bind group");
+  } else {
+    igl::Result::setOk(outResult);
+  }
+  return {this, handle};
+}
+
+void Device::destroy(igl::BindGroupTextureHandle handle) {
+  if (handle.empty()) {
+    return;
+  }
+  bindGroupTexturesPool_.destroy(handle);
+}
+
+void Device::destroy(igl::BindGroupBufferHandle handle) {
+  if (handle.empty()) {
+    return;
+  }
+  bindGroupBuffersPool_.destroy(handle);
+}
+
+void Device::destroy(igl::SamplerHandle /*handle*/) {}
+
+} // namespace iglu::null_backend
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <ldrutils/lutils/Pool.h>
+#include <IGLU/null_backend/Counters.h>
+#include <IGLU/null_backend/PlatformDevice.h>
+#include <igl/CommandEncoder.h>
+#include <igl/Device.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Device which implements the whole IGL surface without a GPU. Resources are created and tracked,
+ * arguments are validated, and every command is counted in Counters and then discarded.
+ *
+ * Running a workload on this device measures the CPU cost of the client and of IGL's front end
+ * without any driver or GPU noise. The device can report another backend type so that clients pick
+ * the same code paths (and shader sources, which are never compiled) as on that backend.
+ */
+class Device final : public igl::IDevice {
+ public:
+  explicit Device(igl::BackendType reportedBackendType = igl::BackendType::Custom);
+
+  /// Counters accumulated by everything created from this device.
+  [[nodiscard]] const Counters& getCounters() const {
+    return *counters_;
+  }
+  /// Resets the command and transfer counters, e.g. at the start of a frame.
+  void resetCounters() {
+    counters_->reset();
+  }
+
+  [[nodiscard]] igl::Holder<igl::BindGroupTextureHandle> createBindGroup(
+      const igl::BindGroupTextureDesc& desc,
+      const igl::IRenderPipelineState* IGL_NULLABLE compatiblePipeline,
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] igl::Holder<igl::BindGroupBufferHandle> createBindGroup(
+      const igl::BindGroupBufferDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  void destroy(igl::BindGroupTextureHandle handle) final;
+  void destroy(igl::BindGroupBufferHandle handle) final;
+  void destroy(igl::SamplerHandle handle) final;
+
+  [[nodiscard]] bool hasFeature(igl::DeviceFeatures feature) const final;
+  [[nodiscard]] bool hasRequirement(igl::DeviceRequirement requirement) const final;
+  [[nodiscard]] TextureFormatCapabilities getTextureFormatCapabilities(
+      igl::TextureFormat format) const final;
+  [[nodiscard]] bool getFeatureLimits(igl::DeviceFeatureLimits featureLimits,
+                                      size_t& result) const final;
+  [[nodiscard]] igl::ShaderVersion getShaderVersion() const final;
+  [[nodiscard]] igl::BackendVersion getBackendVersion() const final;
+
+  [[nodiscard]] std::shared_ptr<igl::ICommandQueue> createCommandQueue(
+      const igl::CommandQueueDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) noexcept final;
+  [[nodiscard]] std::unique_ptr<igl::IBuffer> createBuffer(const igl::BufferDesc& desc,
+                                                           igl::Result* IGL_NULLABLE
+                                                               outResult) const noexcept final;
+  [[nodiscard]] std::shared_ptr<igl::IDepthStencilState> createDepthStencilState(
+      const igl::DepthStencilStateDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::ISamplerState> createSamplerState(
+      const igl::SamplerStateDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> createTexture(const igl::TextureDesc& desc,
+                                                             igl::Result* IGL_NULLABLE
+                                                                 outResult) const noexcept final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> createTextureView(
+      std::shared_ptr<igl::ITexture> texture,
+      const igl::TextureViewDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const noexcept final;
+  [[nodiscard]] std::shared_ptr<igl::IVertexInputState> createVertexInputState(
+      const igl::VertexInputStateDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IComputePipelineState> createComputePipeline(
+      const igl::ComputePipelineDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IRenderPipelineState> createRenderPipeline(
+      const igl::RenderPipelineDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IShaderModule> createShaderModule(
+      const igl::ShaderModuleDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::shared_ptr<igl::IFramebuffer> createFramebuffer(
+      const igl::FramebufferDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) final;
+  [[nodiscard]] std::shared_ptr<igl::ITimer> createTimer(
+      igl::Result* IGL_NULLABLE outResult) const noexcept final;
+  [[nodiscard]] const igl::IPlatformDevice& getPlatformDevice() const noexcept final;
+  [[nodiscard]] igl::BackendType getBackendType() const final;
+  [[nodiscard]] igl::NormalizedZRange getNormalizedZRange() const final;
+  [[nodiscard]] size_t getCurrentDrawCount() const final;
+  [[nodiscard]] size_t getShaderCompilationCount() const final;
+  [[nodiscard]] size_t getGPUMemoryUsage() const final;
+  [[nodiscard]] std::unique_ptr<igl::IShaderLibrary> createShaderLibrary(
+      const igl::ShaderLibraryDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] std::unique_ptr<igl::IShaderStages> createShaderStages(
+      const igl::ShaderStagesDesc& desc,
+      igl::Result* IGL_NULLABLE outResult) const final;
+  [[nodiscard]] void* IGL_NULLABLE getNativeDevice() const final {
+    return nullptr;
+  }
+
+ private:
+  const igl::BackendType reportedBackendType_;
+  std::shared_ptr<Counters> counters_;
+  PlatformDevice platformDevice_;
+  ldr::Pool<igl::BindGroupTextureTag, igl::BindGroupTextureDesc> bindGroupTexturesPool_;
+  ldr::Pool<igl::BindGroupBufferTag, igl::BindGroupBufferDesc> bindGroupBuffersPool_;
+};
+
+} // namespace iglu::null_backend
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/Framebuffer.h>
+
+#include <cstring>
+
+namespace iglu::null_backend {
+
+Framebuffer::Framebuffer(std::shared_ptr<Counters> counters, igl::FramebufferDesc desc) :
+  counters_(std::move(counters)), desc_(std::move(desc)) {}
+
+std::vector<size_t> Framebuffer::getColorAttachmentIndices() const {
+  std::vector<size_t> indices;
+  for (size_t i = 0; i != igl::IGL_COLOR_ATTACHMENTS_MAX; ++i) {
+    if (desc_.colorAttachments[i].texture) {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+}
+
+std::shared_ptr<igl::ITexture> Framebuffer::getColorAttachment(size_t index) const {
+  IGL_DEBUG_ASSERT(index < igl::IGL_COLOR_ATTACHMENTS_MAX);
+  return desc_.colorAttachments[index].texture;
+}
+
+std::shared_ptr<igl::ITexture> Framebuffer::getResolveColorAttachment(size_t index) const {
+  IGL_DEBUG_ASSERT(index < igl::IGL_COLOR_ATTACHMENTS_MAX);
+  return desc_.colorAttachments[index].resolveTexture;
+}
+
+std::shared_ptr<igl::ITexture> Framebuffer::getDepthAttachment() const {
+  return desc_.depthAttachment.texture;
+}
+
+std::shared_ptr<igl::ITexture> Framebuffer::getResolveDepthAttachment() const {
+  return desc_.depthAttachment.resolveTexture;
+}
+
+std::shared_ptr<igl::ITexture> Framebuffer::getStencilAttachment() const {
+  return desc_.stencilAttachment.texture;
+}
+
+igl::FramebufferMode Framebuffer::getMode() const {
+  return desc_.mode;
+}
+
+bool Framebuffer::isSwapchainBound() const {
+  return false;
+}
+
+void Framebuffer::readBack(const std::shared_ptr<igl::ITexture>& texture,
+                           void* pixelBytes,
+                           const igl::TextureRangeDesc& range,
+                           size_t bytesPerRow) const {
+  if (!IGL_DEBUG_VERIFY(texture != nullptr && pixelBytes != nullptr)) {
+    return;
+  }
+  if (!IGL_DEBUG_VERIFY(texture->validateRange(range).isOk())) {
+    return;
+  }
+  const size_t numBytes =
+      texture->getProperties().getBytesPerRange(range, static_cast<uint32_t>(bytesPerRow));
+  std::memset(pixelBytes, 0, numBytes);
+  counters_->copies++;
+  counters_->copyBytes += numBytes;
+}
+
+void Framebuffer::copyBytesColorAttachment(igl::ICommandQueue& /*cmdQueue*/,
+                                           size_t index,
+                                           void* pixelBytes,
+                                           const igl::TextureRangeDesc& range,
+                                           size_t bytesPerRow) const {
+  readBack(getColorAttachment(index), pixelBytes, range, bytesPerRow);
+}
+
+void Framebuffer::copyBytesDepthAttachment(igl::ICommandQueue& /*cmdQueue*/,
+                                           void* pixelBytes,
+                                           const igl::TextureRangeDesc& range,
+                                           size_t bytesPerRow) const {
+  readBack(getDepthAttachment(), pixelBytes, range, bytesPerRow);
+}
+
+void Framebuffer::copyBytesStencilAttachment(igl::ICommandQueue& /*cmdQueue*/,
+                                             void* pixelBytes,
+                                             const igl::TextureRangeDesc& range,
+                                             size_t bytesPerRow) const {
+  readBack(getStencilAttachment(), pixelBytes, range, bytesPerRow);
+}
+
+void Framebuffer::copyTextureColorAttachment(igl::ICommandQueue& /*cmdQueue*/,
+                                             size_t index,
+                                             std::shared_ptr<igl::ITexture> destTexture,
+                                             const igl::TextureRangeDesc& range) const {
+  const auto source = getColorAttachment(index);
+  if (!IGL_DEBUG_VERIFY(source != nullptr && destTexture != nullptr)) {
+    return;
+  }
+  IGL_DEBUG_ASSERT(source->validateRange(range).isOk() && destTexture->validateRange(range).isOk());
+  counters_->copies++;
+  counters_->copyBytes += source->getProperties().getBytesPerRange(range);
+}
+
+void Framebuffer::updateDrawable(std::shared_ptr<igl::ITexture> texture) {
+  desc_.colorAttachments[0].texture = std::move(texture);
+}
+
+void Framebuffer::updateDrawable(igl::SurfaceTextures surfaceTextures) {
+  desc_.colorAttachments[0].texture = std::move(surfaceTextures.color);
+  desc_.depthAttachment.texture = std::move(surfaceTextures.depth);
+}
+
+void Framebuffer::updateResolveAttachment(std::shared_ptr<igl::ITexture> texture) {
+  desc_.colorAttachments[0].resolveTexture = std::move(texture);
+}
+
+} // namespace iglu::null_backend
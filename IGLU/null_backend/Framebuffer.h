@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/Framebuffer.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Framebuffer which only holds on to its attachments. Read backs are counted and return zeros.
+ */
+class Framebuffer final : public igl::IFramebuffer {
+ public:
+  Framebuffer(std::shared_ptr<Counters> counters, igl::FramebufferDesc desc);
+
+  [[nodiscard]] std::vector<size_t> getColorAttachmentIndices() const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> getColorAttachment(size_t index) const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> getResolveColorAttachment(size_t index) const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> getDepthAttachment() const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> getResolveDepthAttachment() const final;
+  [[nodiscard]] std::shared_ptr<igl::ITexture> getStencilAttachment() const final;
+  [[nodiscard]] igl::FramebufferMode getMode() const final;
+  [[nodiscard]] bool isSwapchainBound() const final;
+  void copyBytesColorAttachment(igl::ICommandQueue& cmdQueue,
+                                size_t index,
+                                void* pixelBytes,
+                                const igl::TextureRangeDesc& range,
+                                size_t bytesPerRow = 0) const final;
+  void copyBytesDepthAttachment(igl::ICommandQueue& cmdQueue,
+                                void* pixelBytes,
+                                const igl::TextureRangeDesc& range,
+                                size_t bytesPerRow = 0) const final;
+  void copyBytesStencilAttachment(igl::ICommandQueue& cmdQueue,
+                                  void* pixelBytes,
+                                  const igl::TextureRangeDesc& range,
+                                  size_t bytesPerRow = 0) const final;
+  void copyTextureColorAttachment(igl::ICommandQueue& cmdQueue,
+                                  size_t index,
+                                  std::shared_ptr<igl::ITexture> destTexture,
+                                  const igl::TextureRangeDesc& range) const final;
+  void updateDrawable(std::shared_ptr<igl::ITexture> texture) final;
+  void updateDrawable(igl::SurfaceTextures surfaceTextures) final;
+  void updateResolveAttachment(std::shared_ptr<igl::ITexture> texture) final;
+
+ private:
+  void readBack(const std::shared_ptr<igl::ITexture>& texture,
+                void* pixelBytes,
+                const igl::TextureRangeDesc& range,
+                size_t bytesPerRow) const;
+
+  std::shared_ptr<Counters> counters_;
+  igl::FramebufferDesc desc_;
+};
+
+} // namespace iglu::null_backend
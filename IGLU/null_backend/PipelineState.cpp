@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/PipelineState.h>
+
+namespace iglu::null_backend {
+
+int NameIndexMap::getIndex(const std::string& name) const {
+  if (name.empty()) {
+    return -1;
+  }
+  return indices_.try_emplace(name, static_cast<int>(indices_.size())).first->second;
+}
+
+RenderPipelineState::RenderPipelineState(igl::RenderPipelineDesc desc) :
+  igl::IRenderPipelineState(std::move(desc)),
+  reflection_(std::make_shared<RenderPipelineReflection>()) {}
+
+std::shared_ptr<igl::IRenderPipelineReflection> RenderPipelineState::renderPipelineReflection() {
+  return reflection_;
+}
+
+void RenderPipelineState::setRenderPipelineReflection(
+    const igl::IRenderPipelineReflection& /*renderPipelineReflection*/) {}
+
+int RenderPipelineState::getIndexByName(const igl::NameHandle& name,
+                                        igl::ShaderStage /*stage*/) const {
+  return indices_.getIndex(name.toString());
+}
+
+int RenderPipelineState::getIndexByName(const std::string& name,
+                                        igl::ShaderStage /*stage*/) const {
+  return indices_.getIndex(name);
+}
+
+ComputePipelineState::ComputePipelineState(igl::ComputePipelineDesc desc) :
+  desc_(std::move(desc)), reflection_(std::make_shared<RenderPipelineReflection>()) {}
+
+std::shared_ptr<igl::IComputePipelineState::IComputePipelineReflection>
+ComputePipelineState::computePipelineReflection() {
+  return reflection_;
+}
+
+int ComputePipelineState::getIndexByName(const igl::NameHandle& name) const {
+  return indices_.getIndex(name.toString());
+}
+
+} // namespace iglu::null_backend
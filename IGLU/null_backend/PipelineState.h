@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <igl/ComputePipelineState.h>
+#include <igl/RenderPipelineReflection.h>
+#include <igl/RenderPipelineState.h>
+
+namespace iglu::null_backend {
+
+/// Reflection without any arguments, there is no compiled shader to reflect.
+class RenderPipelineReflection final : public igl::IRenderPipelineReflection {
+ public:
+  [[nodiscard]] const std::vector<igl::BufferArgDesc>& allUniformBuffers() const final {
+    return uniformBuffers_;
+  }
+  [[nodiscard]] const std::vector<igl::SamplerArgDesc>& allSamplers() const final {
+    return samplers_;
+  }
+  [[nodiscard]] const std::vector<igl::TextureArgDesc>& allTextures() const final {
+    return textures_;
+  }
+
+ private:
+  std::vector<igl::BufferArgDesc> uniformBuffers_;
+  std::vector<igl::SamplerArgDesc> samplers_;
+  std::vector<igl::TextureArgDesc> textures_;
+};
+
+/**
+ * Maps names to binding indices. Every name gets a stable index on first lookup, so clients which
+ * resolve uniform locations by name keep doing their binding work as they would on OpenGL.
+ */
+class NameIndexMap {
+ public:
+  [[nodiscard]] int getIndex(const std::string& name) const;
+
+ private:
+  mutable std::unordered_map<std::string, int> indices_;
+};
+
+class RenderPipelineState final : public igl::IRenderPipelineState {
+ public:
+  explicit RenderPipelineState(igl::RenderPipelineDesc desc);
+
+  [[nodiscard]] std::shared_ptr<igl::IRenderPipelineReflection> renderPipelineReflection() final;
+  void setRenderPipelineReflection(
+      const igl::IRenderPipelineReflection& renderPipelineReflection) final;
+  [[nodiscard]] int getIndexByName(const igl::NameHandle& name, igl::ShaderStage stage) const final;
+  [[nodiscard]] int getIndexByName(const std::string& name, igl::ShaderStage stage) const final;
+
+ private:
+  std::shared_ptr<RenderPipelineReflection> reflection_;
+  NameIndexMap indices_;
+};
+
+class ComputePipelineState final : public igl::IComputePipelineState {
+ public:
+  explicit ComputePipelineState(igl::ComputePipelineDesc desc);
+
+  std::shared_ptr<IComputePipelineReflection> computePipelineReflection() final;
+  [[nodiscard]] int getIndexByName(const igl::NameHandle& name) const final;
+
+  [[nodiscard]] const igl::ComputePipelineDesc& getComputePipelineDesc() const {
+    return desc_;
+  }
+
+ private:
+  igl::ComputePipelineDesc desc_;
+  std::shared_ptr<RenderPipelineReflection> reflection_;
+  NameIndexMap indices_;
+};
+
+} // namespace iglu::null_backend
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/PlatformDevice.h>
+
+namespace iglu::null_backend {
+
+class PlatformDevice final : public igl::IPlatformDevice {
+ public:
+  static constexpr igl::PlatformDeviceType kType = igl::PlatformDeviceType::Unknown;
+
+  [[nodiscard]] bool isType(igl::PlatformDeviceType t) const noexcept final {
+    return t == kType;
+  }
+};
+
+} // namespace iglu::null_backend
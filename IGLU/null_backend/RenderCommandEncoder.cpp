@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/RenderCommandEncoder.h>
+
+#include <igl/Buffer.h>
+#include <igl/CommandBuffer.h>
+
+namespace iglu::null_backend {
+
+RenderCommandEncoder::RenderCommandEncoder(std::shared_ptr<igl::ICommandBuffer> commandBuffer,
+                                           std::shared_ptr<Counters> counters) :
+  igl::IRenderCommandEncoder(std::move(commandBuffer)), counters_(std::move(counters)) {
+  counters_->renderPasses++;
+}
+
+RenderCommandEncoder::~RenderCommandEncoder() {
+  IGL_DEBUG_ASSERT(!isEncoding_, "endEncoding() was not called");
+}
+
+void RenderCommandEncoder::endEncoding() {
+  IGL_DEBUG_ASSERT(isEncoding_, "endEncoding() was already called");
+  IGL_DEBUG_ASSERT(debugGroupDepth_ == 0, "Unbalanced debug group labels");
+  isEncoding_ = false;
+}
+
+void RenderCommandEncoder::pushDebugGroupLabel(const char* IGL_NONNULL label,
+                                               const igl::Color& /*color*/) const {
+  IGL_DEBUG_ASSERT(label != nullptr && *label);
+  debugGroupDepth_++;
+}
+
+void RenderCommandEncoder::insertDebugEventLabel(const char* IGL_NONNULL label,
+                                                 const igl::Color& /*color*/) const {
+  IGL_DEBUG_ASSERT(label != nullptr && *label);
+}
+
+void RenderCommandEncoder::popDebugGroupLabel() const {
+  IGL_DEBUG_ASSERT(debugGroupDepth_ > 0, "No debug group label to pop");
+  debugGroupDepth_--;
+}
+
+void RenderCommandEncoder::bindViewport(const igl::Viewport& /*viewport*/) {
+  counters_->dynamicStateChanges++;
+}
+
+void RenderCommandEncoder::bindScissorRect(const igl::ScissorRect& /*rect*/) {
+  counters_->dynamicStateChanges++;
+}
+
+void RenderCommandEncoder::bindRenderPipelineState(
+    const std::shared_ptr<igl::IRenderPipelineState>& pipelineState) {
+  if (!IGL_DEBUG_VERIFY(pipelineState != nullptr)) {
+    return;
+  }
+  counters_->pipelineBinds++;
+  if (pipelineState.get() == pipelineState_) {
+    counters_->redundantPipelineBinds++;
+  }
+  pipelineState_ = pipelineState.get();
+}
+
+void RenderCommandEncoder::bindDepthStencilState(
+    const std::shared_ptr<igl::IDepthStencilState>& /*depthStencilState*/) {
+  counters_->depthStencilStateBinds++;
+}
+
+void RenderCommandEncoder::bindBuffer(uint32_t index,
+                                      uint8_t /*target*/,
+                                      igl::IBuffer* buffer,
+                                      size_t bufferOffset,
+                                      size_t bufferSize) {
+  bindBuffer(index, buffer, bufferOffset, bufferSize);
+}
+
+void RenderCommandEncoder::bindBuffer(uint32_t index,
+                                      igl::IBuffer* buffer,
+                                      size_t bufferOffset,
+                                      size_t bufferSize) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_BUFFER_BINDINGS_MAX);
+  if (!IGL_DEBUG_VERIFY(buffer != nullptr)) {
+    return;
+  }
+  IGL_DEBUG_ASSERT(bufferOffset + bufferSize <= buffer->getSizeInBytes(),
+                   "Buffer range is out of bounds");
+  counters_->bufferBinds++;
+}
+
+void RenderCommandEncoder::bindVertexBuffer(uint32_t index,
+                                            igl::IBuffer& buffer,
+                                            size_t bufferOffset) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_BUFFER_BINDINGS_MAX);
+  IGL_DEBUG_ASSERT(bufferOffset <= buffer.getSizeInBytes());
+  counters_->bufferBinds++;
+}
+
+void RenderCommandEncoder::bindIndexBuffer(igl::IBuffer& buffer,
+                                           igl::IndexFormat /*format*/,
+                                           size_t bufferOffset) {
+  IGL_DEBUG_ASSERT((buffer.getBufferType() & igl::BufferDesc::BufferTypeBits::Index) != 0);
+  IGL_DEBUG_ASSERT(bufferOffset <= buffer.getSizeInBytes());
+  counters_->bufferBinds++;
+  hasIndexBuffer_ = true;
+}
+
+void RenderCommandEncoder::bindBytes(size_t index,
+                                     uint8_t /*target*/,
+                                     const void* data,
+                                     size_t length) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_BUFFER_BINDINGS_MAX);
+  IGL_DEBUG_ASSERT(data != nullptr || length == 0);
+  counters_->bufferBinds++;
+  counters_->inlineBytes += length;
+}
+
+void RenderCommandEncoder::bindPushConstants(const void* data, size_t length, size_t /*offset*/) {
+  IGL_DEBUG_ASSERT(data != nullptr || length == 0);
+  counters_->inlineBytes += length;
+}
+
+void RenderCommandEncoder::bindSamplerState(size_t index,
+                                            uint8_t /*target*/,
+                                            igl::ISamplerState* /*samplerState*/) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_TEXTURE_SAMPLERS_MAX);
+  counters_->samplerBinds++;
+}
+
+void RenderCommandEncoder::bindTexture(size_t index, uint8_t /*target*/, igl::ITexture* texture) {
+  bindTexture(index, texture);
+}
+
+void RenderCommandEncoder::bindTexture(size_t index, igl::ITexture* /*texture*/) {
+  IGL_DEBUG_ASSERT(index < igl::IGL_TEXTURE_SAMPLERS_MAX);
+  counters_->textureBinds++;
+}
+
+void RenderCommandEncoder::bindUniform(const igl::UniformDesc& uniformDesc, const void* data) {
+  IGL_DEBUG_ASSERT(data != nullptr);
+  if (uniformDesc.location < 0) {
+    return;
+  }
+  counters_->uniformBinds++;
+}
+
+void RenderCommandEncoder::bindBindGroup(igl::BindGroupTextureHandle handle) {
+  IGL_DEBUG_ASSERT(!handle.empty());
+  counters_->bindGroupBinds++;
+}
+
+void RenderCommandEncoder::bindBindGroup(igl::BindGroupBufferHandle handle,
+                                         uint32_t numDynamicOffsets,
+                                         const uint32_t* dynamicOffsets) {
+  IGL_DEBUG_ASSERT(!handle.empty());
+  IGL_DEBUG_ASSERT(numDynamicOffsets == 0 || dynamicOffsets != nullptr);
+  counters_->bindGroupBinds++;
+}
+
+void RenderCommandEncoder::countDraw() {
+  IGL_DEBUG_ASSERT(isEncoding_, "Drawing after endEncoding()");
+  IGL_DEBUG_ASSERT(pipelineState_ != nullptr, "No render pipeline state is bound");
+  counters_->draws++;
+  getCommandBuffer().incrementCurrentDrawCount();
+}
+
+void RenderCommandEncoder::draw(size_t vertexCount,
+                                uint32_t instanceCount,
+                                uint32_t /*firstVertex*/,
+                                uint32_t /*baseInstance*/) {
+  countDraw();
+  counters_->vertices += vertexCount * instanceCount;
+}
+
+void RenderCommandEncoder::drawIndexed(size_t indexCount,
+                                       uint32_t instanceCount,
+                                       uint32_t /*firstIndex*/,
+                                       int32_t /*vertexOffset*/,
+                                       uint32_t /*baseInstance*/) {
+  IGL_DEBUG_ASSERT(hasIndexBuffer_, "No index buffer is bound");
+  countDraw();
+  counters_->indexedDraws++;
+  counters_->vertices += indexCount * instanceCount;
+}
+
+void RenderCommandEncoder::drawMeshTasks(const igl::Dimensions& /*threadgroupsPerGrid*/,
+                                         const igl::Dimensions& /*threadsPerTaskThreadgroup*/,
+                                         const igl::Dimensions& /*threadsPerMeshThreadgroup*/) {
+  countDraw();
+  counters_->meshTaskDraws++;
+}
+
+void RenderCommandEncoder::multiDrawIndirect(igl::IBuffer& indirectBuffer,
+                                             size_t indirectBufferOffset,
+                                             uint32_t drawCount,
+                                             uint32_t /*stride*/) {
+  IGL_DEBUG_ASSERT((indirectBuffer.getBufferType() & igl::BufferDesc::BufferTypeBits::Indirect) !=
+                   0);
+  IGL_DEBUG_ASSERT(indirectBufferOffset < indirectBuffer.getSizeInBytes());
+  countDraw();
+  counters_->indirectDraws += drawCount;
+}
+
+void RenderCommandEncoder::multiDrawIndexedIndirect(igl::IBuffer& indirectBuffer,
+                                                    size_t indirectBufferOffset,
+                                                    uint32_t drawCount,
+                                                    uint32_t /*stride*/) {
+  IGL_DEBUG_ASSERT(hasIndexBuffer_, "No index buffer is bound");
+  IGL_DEBUG_ASSERT((indirectBuffer.getBufferType() & igl::BufferDesc::BufferTypeBits::Indirect) !=
+                   0);
+  IGL_DEBUG_ASSERT(indirectBufferOffset < indirectBuffer.getSizeInBytes());
+  countDraw();
+  counters_->indexedDraws++;
+  counters_->indirectDraws += drawCount;
+}
+
+void RenderCommandEncoder::setStencilReferenceValue(uint32_t /*value*/) {
+  counters_->dynamicStateChanges++;
+}
+
+void RenderCommandEncoder::setBlendColor(const igl::Color& /*color*/) {
+  counters_->dynamicStateChanges++;
+}
+
+void RenderCommandEncoder::setDepthBias(float /*depthBias*/,
+                                        float /*slopeScale*/,
+                                        float /*clamp*/) {
+  counters_->dynamicStateChanges++;
+}
+
+} // namespace iglu::null_backend
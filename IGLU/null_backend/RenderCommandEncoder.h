@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/RenderCommandEncoder.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Render command encoder which validates and counts commands, then discards them.
+ */
+class RenderCommandEncoder final : public igl::IRenderCommandEncoder {
+ public:
+  RenderCommandEncoder(std::shared_ptr<igl::ICommandBuffer> commandBuffer,
+                       std::shared_ptr<Counters> counters);
+  ~RenderCommandEncoder() override;
+
+  void endEncoding() final;
+
+  void pushDebugGroupLabel(const char* IGL_NONNULL label,
+                           const igl::Color& color = igl::Color(1, 1, 1, 1)) const final;
+  void insertDebugEventLabel(const char* IGL_NONNULL label,
+                             const igl::Color& color = igl::Color(1, 1, 1, 1)) const final;
+  void popDebugGroupLabel() const final;
+
+  void bindViewport(const igl::Viewport& viewport) final;
+  void bindScissorRect(const igl::ScissorRect& rect) final;
+  void bindRenderPipelineState(
+      const std::shared_ptr<igl::IRenderPipelineState>& pipelineState) final;
+  void bindDepthStencilState(
+      const std::shared_ptr<igl::IDepthStencilState>& depthStencilState) final;
+  void bindBuffer(uint32_t index,
+                  uint8_t target,
+                  igl::IBuffer* buffer,
+                  size_t bufferOffset = 0,
+                  size_t bufferSize = 0) final;
+  void bindBuffer(uint32_t index,
+                  igl::IBuffer* buffer,
+                  size_t bufferOffset = 0,
+                  size_t bufferSize = 0) final;
+  void bindVertexBuffer(uint32_t index, igl::IBuffer& buffer, size_t bufferOffset = 0) final;
+  void bindIndexBuffer(igl::IBuffer& buffer,
+                       igl::IndexFormat format,
+                       size_t bufferOffset = 0) final;
+  void bindBytes(size_t index, uint8_t target, const void* data, size_t length) final;
+  void bindPushConstants(const void* data, size_t length, size_t offset = 0) final;
+  void bindSamplerState(size_t index, uint8_t target, igl::ISamplerState* samplerState) final;
+  void bindTexture(size_t index, uint8_t target, igl::ITexture* texture) final;
+  void bindTexture(size_t index, igl::ITexture* texture) final;
+  void bindUniform(const igl::UniformDesc& uniformDesc, const void* data) final;
+  void bindBindGroup(igl::BindGroupTextureHandle handle) final;
+  void bindBindGroup(igl::BindGroupBufferHandle handle,
+                     uint32_t numDynamicOffsets = 0,
+                     const uint32_t* dynamicOffsets = nullptr) final;
+
+  void draw(size_t vertexCount,
+            uint32_t instanceCount = 1,
+            uint32_t firstVertex = 0,
+            uint32_t baseInstance = 0) final;
+  void drawIndexed(size_t indexCount,
+                   uint32_t instanceCount = 1,
+                   uint32_t firstIndex = 0,
+                   int32_t vertexOffset = 0,
+                   uint32_t baseInstance = 0) final;
+  void drawMeshTasks(const igl::Dimensions& threadgroupsPerGrid,
+                     const igl::Dimensions& threadsPerTaskThreadgroup,
+                     const igl::Dimensions& threadsPerMeshThreadgroup) final;
+  void multiDrawIndirect(igl::IBuffer& indirectBuffer,
+                         size_t indirectBufferOffset = 0,
+                         uint32_t drawCount = 1,
+                         uint32_t stride = 0) final;
+  void multiDrawIndexedIndirect(igl::IBuffer& indirectBuffer,
+                                size_t indirectBufferOffset = 0,
+                                uint32_t drawCount = 1,
+                                uint32_t stride = 0) final;
+
+  void setStencilReferenceValue(uint32_t value) final;
+  void setBlendColor(const igl::Color& color) final;
+  void setDepthBias(float depthBias, float slopeScale, float clamp) final;
+
+ private:
+  void countDraw();
+
+  std::shared_ptr<Counters> counters_;
+  const igl::IRenderPipelineState* IGL_NULLABLE pipelineState_ = nullptr;
+  bool hasIndexBuffer_ = false;
+  bool isEncoding_ = true;
+  mutable int debugGroupDepth_ = 0;
+};
+
+} // namespace iglu::null_backend
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/Shader.h>
+
+namespace iglu::null_backend {
+
+ShaderModule::ShaderModule(igl::ShaderModuleInfo info) : igl::IShaderModule(std::move(info)) {}
+
+ShaderLibrary::ShaderLibrary(std::vector<std::shared_ptr<igl::IShaderModule>> modules) :
+  igl::IShaderLibrary(std::move(modules)) {}
+
+ShaderStages::ShaderStages(igl::ShaderStagesDesc desc) : igl::IShaderStages(std::move(desc)) {}
+
+} // namespace iglu::null_backend
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <igl/Shader.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Shader module which keeps only its metadata; the shader input is validated but never compiled.
+ */
+class ShaderModule final : public igl::IShaderModule {
+ public:
+  explicit ShaderModule(igl::ShaderModuleInfo info);
+};
+
+class ShaderLibrary final : public igl::IShaderLibrary {
+ public:
+  explicit ShaderLibrary(std::vector<std::shared_ptr<igl::IShaderModule>> modules);
+};
+
+class ShaderStages final : public igl::IShaderStages {
+ public:
+  explicit ShaderStages(igl::ShaderStagesDesc desc);
+};
+
+} // namespace iglu::null_backend
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <igl/DepthStencilState.h>
+#include <igl/SamplerState.h>
+#include <igl/Timer.h>
+#include <igl/VertexInputState.h>
+
+namespace iglu::null_backend {
+
+/// State objects of the null backend only keep their descriptors around.
+
+class SamplerState final : public igl::ISamplerState {
+ public:
+  explicit SamplerState(igl::SamplerStateDesc desc) : desc_(std::move(desc)) {}
+
+  [[nodiscard]] bool isYUV() const noexcept final {
+    return desc_.yuvFormat != igl::TextureFormat::Invalid;
+  }
+
+ private:
+  igl::SamplerStateDesc desc_;
+};
+
+class DepthStencilState final : public igl::IDepthStencilState {
+ public:
+  explicit DepthStencilState(igl::DepthStencilStateDesc desc) : desc_(std::move(desc)) {}
+
+  [[nodiscard]] const igl::DepthStencilStateDesc& getDesc() const {
+    return desc_;
+  }
+
+ private:
+  igl::DepthStencilStateDesc desc_;
+};
+
+class VertexInputState final : public igl::IVertexInputState {
+ public:
+  explicit VertexInputState(igl::VertexInputStateDesc desc) : desc_(std::move(desc)) {}
+
+  [[nodiscard]] const igl::VertexInputStateDesc& getDesc() const {
+    return desc_;
+  }
+
+ private:
+  igl::VertexInputStateDesc desc_;
+};
+
+/// Timer whose results are immediately available and always zero.
+class Timer final : public igl::ITimer {
+ public:
+  [[nodiscard]] uint64_t getElapsedTimeNanos() const final {
+    return 0;
+  }
+  [[nodiscard]] bool resultsAvailable() const final {
+    return true;
+  }
+};
+
+} // namespace iglu::null_backend
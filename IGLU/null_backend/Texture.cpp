@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/null_backend/Texture.h>
+
+namespace iglu::null_backend {
+
+Texture::Texture(std::shared_ptr<Counters> counters, const igl::TextureDesc& desc) :
+  igl::ITexture(desc.format), counters_(std::move(counters)), desc_(desc) {
+  attachmentDesc_.width = desc_.width;
+  attachmentDesc_.height = desc_.height;
+  attachmentDesc_.depth = desc_.depth;
+  attachmentDesc_.numLayers = desc_.numLayers;
+  attachmentDesc_.numSamples = desc_.numSamples;
+  attachmentDesc_.numMipLevels = desc_.numMipLevels;
+  attachmentDesc_.type = desc_.type;
+  attachmentDesc_.format = desc_.format;
+  attachmentDesc_.isSampled = (desc_.usage & igl::TextureDesc::TextureUsageBits::Sampled) != 0;
+
+  sizeInBytes_ = getEstimatedSizeInBytes() * desc_.numSamples;
+  counters_->liveTextures++;
+  counters_->liveTextureBytes += sizeInBytes_;
+}
+
+Texture::~Texture() {
+  counters_->liveTextures--;
+  counters_->liveTextureBytes -= sizeInBytes_;
+}
+
+igl::Result Texture::uploadInternal(igl::TextureType /*type*/,
+                                    const igl::TextureRangeDesc& range,
+                                    const void* IGL_NULLABLE data,
+                                    size_t bytesPerRow,
+                                    const uint32_t* IGL_NULLABLE /*mipLevelBytes*/) const {
+  counters_->textureUploads++;
+  if (data != nullptr) {
+    counters_->textureUploadBytes +=
+        getProperties().getBytesPerRange(range, static_cast<uint32_t>(bytesPerRow));
+  }
+  return igl::Result{};
+}
+
+igl::Dimensions Texture::getDimensions() const {
+  return igl::Dimensions{desc_.width, desc_.height, desc_.depth};
+}
+
+uint32_t Texture::getNumLayers() const {
+  return desc_.numLayers;
+}
+
+igl::TextureType Texture::getType() const {
+  return desc_.type;
+}
+
+igl::TextureDesc::TextureUsage Texture::getUsage() const {
+  return desc_.usage;
+}
+
+uint32_t Texture::getSamples() const {
+  return desc_.numSamples;
+}
+
+void Texture::generateMipmap(igl::ICommandQueue& /*cmdQueue*/,
+                             const igl::TextureRangeDesc* IGL_NULLABLE /*range*/) const {}
+
+void Texture::generateMipmap(igl::ICommandBuffer& /*cmdBuffer*/,
+                             const igl::TextureRangeDesc* IGL_NULLABLE /*range*/) const {}
+
+uint32_t Texture::getNumMipLevels() const {
+  return desc_.numMipLevels;
+}
+
+bool Texture::isRequiredGenerateMipmap() const {
+  return false;
+}
+
+uint64_t Texture::getTextureId() const {
+  return reinterpret_cast<uint64_t>(this);
+}
+
+void* IGL_NULLABLE Texture::getNativeImage() const {
+  return nullptr;
+}
+
+void* IGL_NULLABLE Texture::getNativeImageView() const {
+  return nullptr;
+}
+
+const igl::base::AttachmentInteropDesc& Texture::getDesc() const {
+  return attachmentDesc_;
+}
+
+} // namespace iglu::null_backend
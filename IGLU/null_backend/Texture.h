@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+#include <IGLU/null_backend/Counters.h>
+#include <igl/Texture.h>
+
+namespace iglu::null_backend {
+
+/**
+ * Texture without any storage. Uploads go through the regular ITexture::upload() validation and
+ * are counted, then discarded.
+ */
+class Texture final : public igl::ITexture {
+ public:
+  Texture(std::shared_ptr<Counters> counters, const igl::TextureDesc& desc);
+  ~Texture() override;
+
+  [[nodiscard]] igl::Dimensions getDimensions() const final;
+  [[nodiscard]] uint32_t getNumLayers() const final;
+  [[nodiscard]] igl::TextureType getType() const final;
+  [[nodiscard]] igl::TextureDesc::TextureUsage getUsage() const final;
+  [[nodiscard]] uint32_t getSamples() const final;
+  void generateMipmap(igl::ICommandQueue& cmdQueue,
+                      const igl::TextureRangeDesc* IGL_NULLABLE range = nullptr) const final;
+  void generateMipmap(igl::ICommandBuffer& cmdBuffer,
+                      const igl::TextureRangeDesc* IGL_NULLABLE range = nullptr) const final;
+  [[nodiscard]] uint32_t getNumMipLevels() const final;
+  [[nodiscard]] bool isRequiredGenerateMipmap() const final;
+  [[nodiscard]] uint64_t getTextureId() const final;
+
+  [[nodiscard]] void* IGL_NULLABLE getNativeImage() const final;
+  [[nodiscard]] void* IGL_NULLABLE getNativeImageView() const final;
+  [[nodiscard]] const igl::base::AttachmentInteropDesc& getDesc() const final;
+
+ private:
+  [[nodiscard]] igl::Result uploadInternal(
+      igl::TextureType type,
+      const igl::TextureRangeDesc& range,
+      const void* IGL_NULLABLE data,
+      size_t bytesPerRow = 0,
+      const uint32_t* IGL_NULLABLE mipLevelBytes = nullptr) const final;
+
+  std::shared_ptr<Counters> counters_;
+  igl::TextureDesc desc_;
+  size_t sizeInBytes_ = 0;
+  igl::base::AttachmentInteropDesc attachmentDesc_;
+};
+
+} // namespace iglu::null_backend
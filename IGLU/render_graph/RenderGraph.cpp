@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/render_graph/RenderGraph.h>
+
+#include <algorithm>
+#include <igl/CommandBuffer.h>
+#include <igl/Device.h>
+
+namespace iglu::render_graph {
+
+namespace {
+
+// Transient textures can share an igl::ITexture only if their descriptions are identical, except
+// for the debug name.
+bool isCompatible(const igl::TextureDesc& a, const igl::TextureDesc& b) {
+  return a.type == b.type && a.format == b.format && a.width == b.width && a.height == b.height &&
+         a.depth == b.depth && a.numLayers == b.numLayers && a.numSamples == b.numSamples &&
+         a.usage == b.usage && a.numMipLevels == b.numMipLevels && a.storage == b.storage &&
+         a.tiling == b.tiling && a.exportability == b.exportability;
+}
+
+// A read of a render target is ordered before later writes by the backend, which transitions the
+// texture back to an attachment at the end of the reading pass (see RenderGraph)
+bool isWarSafe(const igl::TextureDesc& desc) {
+  return (desc.usage & igl::TextureDesc::TextureUsageBits::Attachment) != 0;
+}
+
+} // namespace
+
+TextureHandle PassBuilder::createTexture(const igl::TextureDesc& desc) {
+  const auto handle = static_cast<TextureHandle>(graph_.textures_.size());
+  graph_.textures_.push_back({.name = desc.debugName, .desc = desc});
+  return graph_.addAccess(passIndex_, handle, true);
+}
+
+TextureHandle PassBuilder::read(TextureHandle texture) {
+  return graph_.addAccess(passIndex_, texture, false);
+}
+
+TextureHandle PassBuilder::write(TextureHandle texture) {
+  return graph_.addAccess(passIndex_, texture, true);
+}
+
+void PassBuilder::setSideEffect() {
+  graph_.passes_[passIndex_].hasSideEffect = true;
+}
+
+const std::shared_ptr<igl::ITexture>& PassResources::getTexture(TextureHandle texture) const {
+  IGL_DEBUG_ASSERT(texture < graph_.textures_.size());
+
+  const RenderGraph::Texture& t = graph_.textures_[texture];
+
+  if (t.imported) {
+    return t.imported;
+  }
+
+  IGL_DEBUG_ASSERT(t.physicalIndex != RenderGraph::kNone,
+                   "Texture '%s' is not used by any executed pass",
+                   t.name.c_str());
+
+  return graph_.physicalTextures_[t.physicalIndex].texture;
+}
+
+const igl::Dependencies& PassResources::getDependencies() const {
+  return graph_.passes_[passIndex_].dependencies.front();
+}
+
+TextureHandle RenderGraph::importTexture(std::shared_ptr<igl::ITexture> texture, const char* name) {
+  IGL_DEBUG_ASSERT(texture);
+
+  const auto handle = static_cast<TextureHandle>(textures_.size());
+  textures_.push_back({.name = name ? name : "", .imported = std::move(texture)});
+  isCompiled_ = false;
+  return handle;
+}
+
+void RenderGraph::markOutput(TextureHandle texture) {
+  IGL_DEBUG_ASSERT(texture < textures_.size());
+
+  textures_[texture].isOutput = true;
+  isCompiled_ = false;
+}
+
+uint32_t RenderGraph::addPass(const char* name, const SetupFunc& setup, ExecuteFunc execute) {
+  const auto passIndex = static_cast<uint32_t>(passes_.size());
+
+  passes_.push_back({.name = name ? name : "", .execute = std::move(execute)});
+
+  PassBuilder builder(*this, passIndex);
+  if (setup) {
+    setup(builder);
+  }
+
+  isCompiled_ = false;
+
+  return passIndex;
+}
+
+TextureHandle RenderGraph::addAccess(uint32_t passIndex, TextureHandle texture, bool isWrite) {
+  if (!IGL_DEBUG_VERIFY(texture < textures_.size())) {
+    return kInvalidTexture;
+  }
+
+  passes_[passIndex].accesses.push_back({.texture = texture, .isWrite = isWrite});
+
+  return texture;
+}
+
+bool RenderGraph::compile(igl::IDevice& device, igl::Result* outResult) {
+  IGL_PROFILER_FUNCTION();
+
+  stats_ = {};
+
+  cullPasses();
+  computeLifetimes();
+
+  if (!assignPhysicalTextures(device, outResult)) {
+    return false;
+  }
+
+  computeDependencies();
+
+  isCompiled_ = true;
+
+  igl::Result::setOk(outResult);
+
+  return true;
+}
+
+void RenderGraph::cullPasses() {
+  // walk the passes backwards and keep only those which write something needed by a later pass
+  std::vector<bool> isNeeded(textures_.size(), false);
+
+  for (size_t i = 0; i != textures_.size(); i++) {
+    isNeeded[i] = textures_[i].isOutput || textures_[i].imported != nullptr;
+  }
+
+  stats_.numPasses = static_cast<uint32_t>(passes_.size());
+
+  for (size_t i = passes_.size(); i-- > 0;) {
+    Pass& pass = passes_[i];
+
+    pass.isCulled = !pass.hasSideEffect;
+
+    for (const Access& a : pass.accesses) {
+      if (a.isWrite && isNeeded[a.texture]) {
+        pass.isCulled = false;
+        break;
+      }
+    }
+
+    if (pass.isCulled) {
+      stats_.numCulledPasses++;
+      continue;
+    }
+
+    for (const Access& a : pass.accesses) {
+      if (!a.isWrite) {
+        isNeeded[a.texture] = true;
+      }
+    }
+  }
+}
+
+void RenderGraph::computeLifetimes() {
+  for (Texture& t : textures_) {
+    t.firstPass = kNone;
+    t.lastPass = kNone;
+    t.isLastAccessRead = false;
+    t.physicalIndex = kNone;
+  }
+
+  for (uint32_t i = 0; i != passes_.size(); i++) {
+    if (passes_[i].isCulled) {
+      continue;
+    }
+    for (const Access& a : passes_[i].accesses) {
+      Texture& t = textures_[a.texture];
+      if (t.firstPass == kNone) {
+        t.firstPass = i;
+      }
+      // a pass which reads and writes a texture leaves it written
+      t.isLastAccessRead = t.lastPass == i ? t.isLastAccessRead && !a.isWrite : !a.isWrite;
+      t.lastPass = i;
+    }
+  }
+}
+
+bool RenderGraph::assignPhysicalTextures(igl::IDevice& device, igl::Result* outResult) {
+  for (PhysicalTexture& p : physicalTextures_) {
+    p.lastPass = kNone;
+    p.isLastAccessRead = false;
+  }
+
+  std::vector<bool> isUsed(physicalTextures_.size(), false);
+
+  // transient textures are declared in pass order, hence they are sorted by their first pass
+  for (Texture& t : textures_) {
+    if (t.imported || t.firstPass == kNone) {
+      continue;
+    }
+
+    stats_.numTransientTextures++;
+
+    // reuse a pooled texture which is not used by any pass overlapping with this texture
+    for (uint32_t i = 0; i != physicalTextures_.size(); i++) {
+      const PhysicalTexture& p = physicalTextures_[i];
+      if ((p.lastPass == kNone || p.lastPass < t.firstPass) && isCompatible(p.desc, t.desc)) {
+        if (p.isLastAccessRead && !isWarSafe(p.desc)) {
+          stats_.numAliasingRejectedWar++;
+          continue;
+        }
+        t.physicalIndex = i;
+        break;
+      }
+    }
+
+    if (t.physicalIndex == kNone) {
+      igl::Result result;
+      std::shared_ptr<igl::ITexture> texture = device.createTexture(t.desc, &result);
+      if (!result.isOk() || !texture) {
+        IGL_LOG_ERROR("RenderGraph: cannot create transient texture '%s'\n", t.name.c_str());
+        igl::Result::setResult(outResult,
+                               igl::Result::Code::RuntimeError,
+                               "Cannot create transient texture: " + result.message);
+        return false;
+      }
+      t.physicalIndex = static_cast<uint32_t>(physicalTextures_.size());
+      physicalTextures_.push_back({.desc = t.desc, .texture = std::move(texture)});
+      isUsed.push_back(false);
+    }
+
+    PhysicalTexture& p = physicalTextures_[t.physicalIndex];
+    p.lastPass = t.lastPass;
+    p.isLastAccessRead = t.isLastAccessRead;
+    isUsed[t.physicalIndex] = true;
+
+    stats_.transientBytes += p.texture->getEstimatedSizeInBytes();
+  }
+
+  // release pooled textures which were not needed this frame
+  std::vector<uint32_t> remap(physicalTextures_.size(), kNone);
+  uint32_t numUsed = 0;
+  for (uint32_t i = 0; i != physicalTextures_.size(); i++) {
+    if (isUsed[i]) {
+      remap[i] = numUsed;
+      if (i != numUsed) {
+        physicalTextures_[numUsed] = std::move(physicalTextures_[i]);
+      }
+      numUsed++;
+    }
+  }
+  physicalTextures_.resize(numUsed);
+
+  for (Texture& t : textures_) {
+    if (t.physicalIndex != kNone) {
+      t.physicalIndex = remap[t.physicalIndex];
+    }
+  }
+
+  stats_.numPhysicalTextures = numUsed;
+  for (const PhysicalTexture& p : physicalTextures_) {
+    stats_.physicalBytes += p.texture->getEstimatedSizeInBytes();
+  }
+
+  return true;
+}
+
+void RenderGraph::computeDependencies() {
+  // a texture needs a barrier when it is read after being written. Every reader needs its own:
+  // the backend transitions a render target back to an attachment at the end of each pass that
+  // depends on it, so the next reader has to make it readable again.
+  std::vector<bool> isWritten(textures_.size(), false);
+  std::vector<igl::ITexture*> deps;
+
+  for (uint32_t i = 0; i != passes_.size(); i++) {
+    Pass& pass = passes_[i];
+
+    pass.dependencies.clear();
+
+    if (pass.isCulled) {
+      pass.dependencies.emplace_back();
+      continue;
+    }
+
+    deps.clear();
+
+    for (const Access& a : pass.accesses) {
+      if (a.isWrite || !isWritten[a.texture]) {
+        continue;
+      }
+      igl::ITexture* texture = PassResources(*this, i).getTexture(a.texture).get();
+      if (std::find(deps.begin(), deps.end(), texture) == deps.end()) {
+        deps.push_back(texture);
+      }
+    }
+    for (const Access& a : pass.accesses) {
+      if (a.isWrite) {
+        isWritten[a.texture] = true;
+      }
+    }
+
+    stats_.numDependencies += static_cast<uint32_t>(deps.size());
+
+    // chain as many igl::Dependencies as needed
+    constexpr size_t kMaxTextures = igl::Dependencies::kIglMaxTextureDependencies;
+    pass.dependencies.resize(std::max<size_t>(1, (deps.size() + kMaxTextures - 1) / kMaxTextures));
+    for (size_t d = 0; d != deps.size(); d++) {
+      pass.dependencies[d / kMaxTextures].textures[d % kMaxTextures] = deps[d];
+    }
+    for (size_t d = 1; d < pass.dependencies.size(); d++) {
+      pass.dependencies[d - 1].next = &pass.dependencies[d];
+    }
+  }
+}
+
+void RenderGraph::execute(igl::ICommandBuffer& cmdBuffer) const {
+  IGL_PROFILER_FUNCTION();
+
+  if (!IGL_DEBUG_VERIFY(isCompiled_, "RenderGraph::compile() should be called before execute()")) {
+    return;
+  }
+
+  for (uint32_t i = 0; i != passes_.size(); i++) {
+    const Pass& pass = passes_[i];
+    if (pass.isCulled || !pass.execute) {
+      continue;
+    }
+    cmdBuffer.pushDebugGroupLabel(pass.name.c_str());
+    pass.execute(PassResources(*this, i), cmdBuffer);
+    cmdBuffer.popDebugGroupLabel();
+  }
+}
+
+void RenderGraph::reset() {
+  textures_.clear();
+  passes_.clear();
+  stats_ = {};
+  isCompiled_ = false;
+}
+
+void RenderGraph::releaseTextures() {
+  IGL_DEBUG_ASSERT(textures_.empty(), "Call reset() before releasing textures");
+
+  physicalTextures_.clear();
+}
+
+bool RenderGraph::isCulled(uint32_t passIndex) const {
+  IGL_DEBUG_ASSERT(passIndex < passes_.size());
+
+  return passes_[passIndex].isCulled;
+}
+
+} // namespace iglu::render_graph
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <igl/CommandEncoder.h>
+#include <igl/Texture.h>
+
+namespace igl {
+class ICommandBuffer;
+class IDevice;
+} // namespace igl
+
+namespace iglu::render_graph {
+
+/// Identifies a texture inside a RenderGraph. Handles are valid until RenderGraph::reset().
+using TextureHandle = uint32_t;
+constexpr TextureHandle kInvalidTexture = 0xFFFFFFFF;
+
+class RenderGraph;
+
+/// Declares which textures a pass creates, reads and writes. Only valid inside the setup function
+/// passed to RenderGraph::addPass().
+class PassBuilder {
+ public:
+  /// Declares a transient texture which is written by this pass. Transient textures are owned by
+  /// the graph; textures with the same description whose lifetimes do not overlap share the same
+  /// igl::ITexture. The contents of a transient texture are undefined before its first write.
+  TextureHandle createTexture(const igl::TextureDesc& desc);
+  /// The pass samples or loads from `texture`.
+  TextureHandle read(TextureHandle texture);
+  /// The pass renders into or stores to `texture`.
+  TextureHandle write(TextureHandle texture);
+  /// The pass has effects outside of the graph (e.g. readback, present) and is never culled.
+  void setSideEffect();
+
+ private:
+  friend class RenderGraph;
+  PassBuilder(RenderGraph& graph, uint32_t passIndex) : graph_(graph), passIndex_(passIndex) {}
+
+  RenderGraph& graph_;
+  uint32_t passIndex_ = 0;
+};
+
+/// Resources available to a pass during RenderGraph::execute().
+class PassResources {
+ public:
+  [[nodiscard]] const std::shared_ptr<igl::ITexture>& getTexture(TextureHandle texture) const;
+
+  /// Textures written by earlier passes which this pass reads. Pass them to
+  /// ICommandBuffer::createRenderCommandEncoder() so the backend can insert the required barriers
+  /// and layout transitions. Every pass reading a texture written by an earlier pass gets it here,
+  /// even if an earlier reader already depended on it.
+  [[nodiscard]] const igl::Dependencies& getDependencies() const;
+
+ private:
+  friend class RenderGraph;
+  PassResources(const RenderGraph& graph, uint32_t passIndex) :
+    graph_(graph), passIndex_(passIndex) {}
+
+  const RenderGraph& graph_;
+  uint32_t passIndex_ = 0;
+};
+
+struct RenderGraphStats {
+  uint32_t numPasses = 0;
+  uint32_t numCulledPasses = 0;
+  uint32_t numTransientTextures = 0;
+  /// Number of igl::ITexture objects backing the transient textures of executed passes
+  uint32_t numPhysicalTextures = 0;
+  /// Number of times a pooled texture was not reused because its previous contents are read by an
+  /// earlier pass and nothing orders that read before the next write (write-after-read hazard)
+  uint32_t numAliasingRejectedWar = 0;
+  /// Total number of textures in the dependencies of all executed passes
+  uint32_t numDependencies = 0;
+  /// Memory the transient textures would need without aliasing
+  size_t transientBytes = 0;
+  /// Memory actually allocated for the transient textures
+  size_t physicalBytes = 0;
+};
+
+/**
+ * @brief A frame graph which orders work submitted by passes.
+ *
+ * Every frame, passes are added with addPass() and declare the textures they create, read and
+ * write. compile() then:
+ *  - culls passes which do not contribute to an output, an imported texture or a side effect;
+ *  - computes the minimal igl::Dependencies of each pass (read-after-write only);
+ *  - computes the lifetimes of transient textures and assigns them to pooled igl::ITexture
+ *    objects, reusing the same texture for transient textures whose lifetimes do not overlap.
+ *
+ * IGL has no write-after-read barrier, only igl::Dependencies for reads. A render target read by a
+ * pass is transitioned back to an attachment by the backend when that pass ends, which orders the
+ * read before any later write. Other textures whose last access is a read are therefore never
+ * reused by a transient texture written by a later pass.
+ * execute() invokes the execute functions of all remaining passes in the order they were added.
+ * Pooled textures are kept across reset() so steady-state frames do not create any textures.
+ */
+class RenderGraph final {
+ public:
+  using SetupFunc = std::function<void(PassBuilder& builder)>;
+  using ExecuteFunc =
+      std::function<void(const PassResources& resources, igl::ICommandBuffer& cmdBuffer)>;
+
+  /// Registers a texture owned by the caller, e.g. a swapchain image. Passes writing into
+  /// imported textures are never culled.
+  TextureHandle importTexture(std::shared_ptr<igl::ITexture> texture, const char* name = "");
+
+  /// Keeps the passes producing `texture` alive even if no other pass reads it.
+  void markOutput(TextureHandle texture);
+
+  /// Adds a pass. `setup` is invoked immediately; `execute` is invoked by execute() unless the
+  /// pass is culled. Returns the index of the pass.
+  uint32_t addPass(const char* name, const SetupFunc& setup, ExecuteFunc execute);
+
+  bool compile(igl::IDevice& device, igl::Result* outResult = nullptr);
+  void execute(igl::ICommandBuffer& cmdBuffer) const;
+
+  /// Removes all passes and textures. Pooled transient textures are kept for the next frame.
+  void reset();
+
+  /// Releases all pooled transient textures.
+  void releaseTextures();
+
+  [[nodiscard]] bool isCulled(uint32_t passIndex) const;
+  [[nodiscard]] const RenderGraphStats& getStats() const {
+    return stats_;
+  }
+
+ private:
+  friend class PassBuilder;
+  friend class PassResources;
+
+  static constexpr uint32_t kNone = 0xFFFFFFFF;
+
+  struct Texture {
+    std::string name;
+    igl::TextureDesc desc;
+    std::shared_ptr<igl::ITexture> imported;
+    bool isOutput = false;
+    // computed by compile()
+    uint32_t firstPass = kNone;
+    uint32_t lastPass = kNone;
+    bool isLastAccessRead = false;
+    uint32_t physicalIndex = kNone;
+  };
+
+  struct Access {
+    TextureHandle texture = kInvalidTexture;
+    bool isWrite = false;
+  };
+
+  struct Pass {
+    std::string name;
+    ExecuteFunc execute;
+    std::vector<Access> accesses;
+    bool hasSideEffect = false;
+    // computed by compile()
+    bool isCulled = false;
+    std::vector<igl::Dependencies> dependencies;
+  };
+
+  struct PhysicalTexture {
+    igl::TextureDesc desc;
+    std::shared_ptr<igl::ITexture> texture;
+    uint32_t lastPass = kNone; // last pass using this texture during the current frame
+    bool isLastAccessRead = false;
+  };
+
+  TextureHandle addAccess(uint32_t passIndex, TextureHandle texture, bool isWrite);
+  void cullPasses();
+  void computeLifetimes();
+  bool assignPhysicalTextures(igl::IDevice& device, igl::Result* outResult);
+  void computeDependencies();
+
+  std::vector<Texture> textures_;
+  std::vector<Pass> passes_;
+  std::vector<PhysicalTexture> physicalTextures_;
+  RenderGraphStats stats_;
+  bool isCompiled_ = false;
+};
+
+} // namespace iglu::render_graph
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_atlas/RectPacker.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace iglu::texture_atlas {
+
+namespace {
+
+bool overlaps(const PackedRect& a, const PackedRect& b) {
+  return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height &&
+         b.y < a.y + a.height;
+}
+
+bool contains(const PackedRect& outer, const PackedRect& inner) {
+  return inner.x >= outer.x && inner.y >= outer.y &&
+         inner.x + inner.width <= outer.x + outer.width &&
+         inner.y + inner.height <= outer.y + outer.height;
+}
+
+bool isContainedInAny(const std::vector<PackedRect>& rects, const PackedRect& rect) {
+  return std::any_of(
+      rects.begin(), rects.end(), [&rect](const PackedRect& r) { return contains(r, rect); });
+}
+
+// Appends the free rectangles spanning both a and b along one axis, over the range they share on
+// the other axis. Both need to touch or overlap along the spanned axis.
+void appendMerged(const PackedRect& a, const PackedRect& b, std::vector<PackedRect>& out) {
+  const uint32_t x0 = std::max(a.x, b.x);
+  const uint32_t x1 = std::min(a.x + a.width, b.x + b.width);
+  const uint32_t y0 = std::max(a.y, b.y);
+  const uint32_t y1 = std::min(a.y + a.height, b.y + b.height);
+  if (x0 < x1 && y0 <= y1) {
+    const uint32_t top = std::min(a.y, b.y);
+    out.push_back({x0, top, x1 - x0, std::max(a.y + a.height, b.y + b.height) - top});
+  }
+  if (y0 < y1 && x0 <= x1) {
+    const uint32_t left = std::min(a.x, b.x);
+    out.push_back({left, y0, std::max(a.x + a.width, b.x + b.width) - left, y1 - y0});
+  }
+}
+
+} // namespace
+
+RectPacker::RectPacker(uint32_t width, uint32_t height) : width_(width), height_(height) {
+  clear();
+}
+
+std::optional<PackedRect> RectPacker::insert(uint32_t width, uint32_t height) {
+  if (width == 0 || height == 0) {
+    return std::nullopt;
+  }
+
+  const PackedRect* best = nullptr;
+  uint32_t bestShortSide = std::numeric_limits<uint32_t>::max();
+  uint32_t bestLongSide = std::numeric_limits<uint32_t>::max();
+  for (const auto& freeRect : freeRects_) {
+    if (freeRect.width < width || freeRect.height < height) {
+      continue;
+    }
+    const uint32_t leftoverX = freeRect.width - width;
+    const uint32_t leftoverY = freeRect.height - height;
+    const uint32_t shortSide = std::min(leftoverX, leftoverY);
+    const uint32_t longSide = std::max(leftoverX, leftoverY);
+    if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide)) {
+      best = &freeRect;
+      bestShortSide = shortSide;
+      bestLongSide = longSide;
+    }
+  }
+  if (!best) {
+    return std::nullopt;
+  }
+
+  const PackedRect rect{best->x, best->y, width, height};
+  place(rect);
+  usedRects_.push_back(rect);
+  usedArea_ += uint64_t(width) * height;
+  return rect;
+}
+
+bool RectPacker::remove(const PackedRect& rect) {
+  const auto it = std::find(usedRects_.begin(), usedRects_.end(), rect);
+  if (it == usedRects_.end()) {
+    return false;
+  }
+  usedRects_.erase(it);
+  usedArea_ -= uint64_t(rect.width) * rect.height;
+
+  // Adds the freed rectangle, then every rectangle merged from two free ones, until the merges
+  // only produce rectangles which are already covered
+  std::vector<PackedRect> pending(1, rect);
+  std::vector<PackedRect> merged;
+  while (!pending.empty()) {
+    const PackedRect freeRect = pending.back();
+    pending.pop_back();
+    if (isContainedInAny(freeRects_, freeRect)) {
+      continue;
+    }
+    merged.clear();
+    for (const auto& other : freeRects_) {
+      appendMerged(freeRect, other, merged);
+    }
+    for (const auto& candidate : merged) {
+      if (!contains(freeRect, candidate) && !isContainedInAny(pending, candidate)) {
+        pending.push_back(candidate);
+      }
+    }
+    freeRects_.push_back(freeRect);
+  }
+  pruneFreeRects();
+  return true;
+}
+
+void RectPacker::clear() {
+  usedRects_.clear();
+  usedArea_ = 0;
+  freeRects_.assign(1, PackedRect{0, 0, width_, height_});
+}
+
+float RectPacker::getOccupancy() const {
+  const uint64_t area = uint64_t(width_) * height_;
+  return area != 0 ? static_cast<float>(double(usedArea_) / double(area)) : 0.0f;
+}
+
+// Splits every free rectangle overlapping rect into up to 4 maximal rectangles around it
+void RectPacker::place(const PackedRect& rect) {
+  newFreeRects_.clear();
+  for (const auto& freeRect : freeRects_) {
+    if (!overlaps(freeRect, rect)) {
+      newFreeRects_.push_back(freeRect);
+      continue;
+    }
+    const uint32_t freeRight = freeRect.x + freeRect.width;
+    const uint32_t freeBottom = freeRect.y + freeRect.height;
+    const uint32_t right = rect.x + rect.width;
+    const uint32_t bottom = rect.y + rect.height;
+    if (rect.x > freeRect.x) {
+      newFreeRects_.push_back({freeRect.x, freeRect.y, rect.x - freeRect.x, freeRect.height});
+    }
+    if (right < freeRight) {
+      newFreeRects_.push_back({right, freeRect.y, freeRight - right, freeRect.height});
+    }
+    if (rect.y > freeRect.y) {
+      newFreeRects_.push_back({freeRect.x, freeRect.y, freeRect.width, rect.y - freeRect.y});
+    }
+    if (bottom < freeBottom) {
+      newFreeRects_.push_back({freeRect.x, bottom, freeRect.width, freeBottom - bottom});
+    }
+  }
+  freeRects_.swap(newFreeRects_);
+  pruneFreeRects();
+}
+
+void RectPacker::pruneFreeRects() {
+  for (size_t i = 0; i < freeRects_.size(); ++i) {
+    for (size_t j = i + 1; j < freeRects_.size();) {
+      if (contains(freeRects_[i], freeRects_[j])) {
+        freeRects_.erase(freeRects_.begin() + static_cast<ptrdiff_t>(j));
+      } else if (contains(freeRects_[j], freeRects_[i])) {
+        freeRects_.erase(freeRects_.begin() + static_cast<ptrdiff_t>(i));
+        --i;
+        break;
+      } else {
+        ++j;
+      }
+    }
+  }
+}
+
+} // namespace iglu::texture_atlas
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace iglu::texture_atlas {
+
+struct PackedRect {
+  uint32_t x = 0;
+  uint32_t y = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  bool operator==(const PackedRect& other) const = default;
+};
+
+/**
+ * @brief Packs rectangles into a fixed-size area with the MaxRects algorithm.
+ *
+ * The free space is kept as a list of maximal free rectangles, which may overlap. insert() places
+ * a rectangle into the free rectangle which leaves the shortest leftover side (best short side
+ * fit) and splits all free rectangles it overlaps. remove() adds the freed rectangle to the free
+ * list and merges it with the free rectangles it touches, repeating with the merged rectangles, so
+ * neighboring freed space can be used by larger rectangles regardless of the order of removals.
+ */
+class RectPacker final {
+ public:
+  RectPacker(uint32_t width, uint32_t height);
+
+  /// Returns the placement of a width x height rectangle, or std::nullopt if it does not fit.
+  [[nodiscard]] std::optional<PackedRect> insert(uint32_t width, uint32_t height);
+  /// Frees a rectangle returned by insert(). Returns false if it is not in the packer.
+  bool remove(const PackedRect& rect);
+  /// Removes all rectangles.
+  void clear();
+
+  [[nodiscard]] uint32_t getWidth() const {
+    return width_;
+  }
+  [[nodiscard]] uint32_t getHeight() const {
+    return height_;
+  }
+  [[nodiscard]] size_t getNumRects() const {
+    return usedRects_.size();
+  }
+  /// Fraction of the area covered by rectangles
+  [[nodiscard]] float getOccupancy() const;
+  [[nodiscard]] const std::vector<PackedRect>& getFreeRects() const {
+    return freeRects_;
+  }
+
+ private:
+  void place(const PackedRect& rect);
+  void pruneFreeRects();
+
+  uint32_t width_ = 0;
+  uint32_t height_ = 0;
+  uint64_t usedArea_ = 0;
+  std::vector<PackedRect> usedRects_;
+  std::vector<PackedRect> freeRects_;
+  std::vector<PackedRect> newFreeRects_;
+};
+
+} // namespace iglu::texture_atlas
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_atlas/TextureAtlas.h>
+
+#include <algorithm>
+#include <cstring>
+#include <IGLU/texture_loader/MipmapGenerator.h>
+#include <igl/Device.h>
+
+namespace iglu::texture_atlas {
+
+namespace {
+
+uint32_t align(uint32_t value, uint32_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+TextureAtlas::TextureAtlas(igl::IDevice& device, TextureAtlasDesc desc) :
+  device_(device), desc_(std::move(desc)) {
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc_.format);
+  IGL_DEBUG_ASSERT(!properties.isCompressed(), "Texture atlases need an uncompressed format");
+
+  const uint32_t maxMipLevels =
+      igl::TextureDesc::calcNumMipLevels(desc_.pageWidth, desc_.pageHeight);
+  desc_.numMipLevels = std::clamp(desc_.numMipLevels, 1u, maxMipLevels);
+  if (desc_.numMipLevels > 1 && !textureloader::isMipmapGenerationSupported(desc_.format)) {
+    IGL_LOG_ERROR("TextureAtlas: no mipmap generation for format %s, using 1 mip level\n",
+                  properties.name);
+    desc_.numMipLevels = 1;
+  }
+  alignment_ = 1u << (desc_.numMipLevels - 1);
+  padding_ = align(desc_.padding, alignment_);
+}
+
+EntryHandle TextureAtlas::add(uint32_t width,
+                              uint32_t height,
+                              const void* IGL_NONNULL data,
+                              size_t bytesPerRow,
+                              igl::Result* IGL_NULLABLE outResult) {
+  if (width == 0 || height == 0) {
+    igl::Result::setResult(outResult, igl::Result::Code::ArgumentInvalid, "Empty image.");
+    return kInvalidEntry;
+  }
+  const uint32_t paddedWidth = align(width + 2 * padding_, alignment_);
+  const uint32_t paddedHeight = align(height + 2 * padding_, alignment_);
+  if (paddedWidth > desc_.pageWidth || paddedHeight > desc_.pageHeight) {
+    igl::Result::setResult(outResult,
+                           igl::Result::Code::ArgumentOutOfRange,
+                           "Image does not fit on an atlas page.");
+    return kInvalidEntry;
+  }
+
+  uint32_t pageIndex = 0;
+  std::optional<PackedRect> paddedRect;
+  for (uint32_t i = 0; i < pages_.size() && !paddedRect; ++i) {
+    paddedRect = pages_[i].packer.insert(paddedWidth, paddedHeight);
+    pageIndex = i;
+  }
+  if (!paddedRect) {
+    if (pages_.size() >= desc_.maxPages) {
+      igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "Texture atlas is full.");
+      return kInvalidEntry;
+    }
+    auto textureDesc = igl::TextureDesc::new2D(desc_.format,
+                                               desc_.pageWidth,
+                                               desc_.pageHeight,
+                                               igl::TextureDesc::TextureUsageBits::Sampled,
+                                               desc_.debugName.c_str());
+    textureDesc.numMipLevels = desc_.numMipLevels;
+    igl::Result ret;
+    auto texture = device_.createTexture(textureDesc, &ret);
+    if (!texture) {
+      igl::Result::setResult(outResult, std::move(ret));
+      return kInvalidEntry;
+    }
+    pages_.push_back({std::move(texture), RectPacker(desc_.pageWidth, desc_.pageHeight)});
+    pageIndex = getNumPages() - 1;
+    paddedRect = pages_.back().packer.insert(paddedWidth, paddedHeight);
+  }
+
+  auto& page = pages_[pageIndex];
+  if (!upload(page,
+              *paddedRect,
+              width,
+              height,
+              static_cast<const uint8_t*>(data),
+              bytesPerRow,
+              outResult)) {
+    page.packer.remove(*paddedRect);
+    return kInvalidEntry;
+  }
+
+  EntryHandle handle = kInvalidEntry;
+  if (!freeSlots_.empty()) {
+    handle = freeSlots_.back();
+    freeSlots_.pop_back();
+  } else {
+    handle = static_cast<EntryHandle>(slots_.size());
+    slots_.emplace_back();
+  }
+  auto& slot = slots_[handle];
+  slot.paddedRect = *paddedRect;
+  slot.used = true;
+  slot.entry.page = pageIndex;
+  slot.entry.rect = {paddedRect->x + padding_, paddedRect->y + padding_, width, height};
+  slot.entry.u0 = static_cast<float>(slot.entry.rect.x) / static_cast<float>(desc_.pageWidth);
+  slot.entry.v0 = static_cast<float>(slot.entry.rect.y) / static_cast<float>(desc_.pageHeight);
+  slot.entry.u1 =
+      static_cast<float>(slot.entry.rect.x + width) / static_cast<float>(desc_.pageWidth);
+  slot.entry.v1 =
+      static_cast<float>(slot.entry.rect.y + height) / static_cast<float>(desc_.pageHeight);
+  ++numEntries_;
+
+  igl::Result::setOk(outResult);
+  return handle;
+}
+
+// Uploads the image with its padding, and its mip chain when the pages have mipmaps
+bool TextureAtlas::upload(const Page& page,
+                          const PackedRect& paddedRect,
+                          uint32_t width,
+                          uint32_t height,
+                          const uint8_t* IGL_NONNULL data,
+                          size_t bytesPerRow,
+                          igl::Result* IGL_NULLABLE outResult) {
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc_.format);
+  const size_t bytesPerTexel = properties.bytesPerBlock;
+  if (bytesPerRow == 0) {
+    bytesPerRow = width * bytesPerTexel;
+  }
+
+  auto stagingDesc = igl::TextureDesc::new2D(desc_.format,
+                                             paddedRect.width,
+                                             paddedRect.height,
+                                             igl::TextureDesc::TextureUsageBits::Sampled);
+  stagingDesc.numMipLevels = desc_.numMipLevels;
+  const auto stagingRange = stagingDesc.asRange();
+  staging_.resize(properties.getBytesPerRange(stagingRange));
+
+  // Level 0, with the edge rows and columns repeated into the padding
+  const size_t leftBytes = padding_ * bytesPerTexel;
+  const size_t rowBytes = width * bytesPerTexel;
+  const size_t paddedRowBytes = paddedRect.width * bytesPerTexel;
+  for (uint32_t y = 0; y < paddedRect.height; ++y) {
+    const uint32_t sourceY = std::min(y - std::min(y, padding_), height - 1);
+    const uint8_t* src = data + sourceY * bytesPerRow;
+    uint8_t* dst = staging_.data() + y * paddedRowBytes;
+    for (size_t x = 0; x < leftBytes; x += bytesPerTexel) {
+      std::memcpy(dst + x, src, bytesPerTexel);
+    }
+    std::memcpy(dst + leftBytes, src, rowBytes);
+    for (size_t x = leftBytes + rowBytes; x < paddedRowBytes; x += bytesPerTexel) {
+      std::memcpy(dst + x, src + rowBytes - bytesPerTexel, bytesPerTexel);
+    }
+  }
+
+  if (desc_.numMipLevels > 1) {
+    auto result = textureloader::generateMipmaps(stagingDesc, staging_.data(), {.numThreads = 1});
+    if (!result.isOk()) {
+      igl::Result::setResult(outResult, std::move(result));
+      return false;
+    }
+  }
+
+  for (uint32_t mipLevel = 0; mipLevel < desc_.numMipLevels; ++mipLevel) {
+    const auto range = igl::TextureRangeDesc::new2D(paddedRect.x >> mipLevel,
+                                                    paddedRect.y >> mipLevel,
+                                                    paddedRect.width >> mipLevel,
+                                                    paddedRect.height >> mipLevel,
+                                                    mipLevel);
+    const size_t offset =
+        properties.getSubRangeByteOffset(stagingRange, stagingRange.atMipLevel(mipLevel));
+    auto result = page.texture->upload(range, staging_.data() + offset);
+    if (!result.isOk()) {
+      igl::Result::setResult(outResult, std::move(result));
+      return false;
+    }
+  }
+  return true;
+}
+
+void TextureAtlas::remove(EntryHandle handle) {
+  if (handle >= slots_.size() || !slots_[handle].used) {
+    IGL_DEBUG_ASSERT_NOT_REACHED();
+    return;
+  }
+  auto& slot = slots_[handle];
+  pages_[slot.entry.page].packer.remove(slot.paddedRect);
+  slot.used = false;
+  freeSlots_.push_back(handle);
+  --numEntries_;
+}
+
+void TextureAtlas::clear() {
+  for (auto& page : pages_) {
+    page.packer.clear();
+  }
+  slots_.clear();
+  freeSlots_.clear();
+  numEntries_ = 0;
+}
+
+const AtlasEntry* IGL_NULLABLE TextureAtlas::getEntry(EntryHandle handle) const {
+  if (handle >= slots_.size() || !slots_[handle].used) {
+    return nullptr;
+  }
+  return &slots_[handle].entry;
+}
+
+const std::shared_ptr<igl::ITexture>& TextureAtlas::getPage(uint32_t page) const {
+  IGL_DEBUG_ASSERT(page < pages_.size());
+  return pages_[page].texture;
+}
+
+} // namespace iglu::texture_atlas
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <IGLU/texture_atlas/RectPacker.h>
+#include <igl/Texture.h>
+
+namespace igl {
+class IDevice;
+} // namespace igl
+
+namespace iglu::texture_atlas {
+
+/// Identifies an image inside a TextureAtlas. Handles of removed images are reused.
+using EntryHandle = uint32_t;
+constexpr EntryHandle kInvalidEntry = 0xFFFFFFFF;
+
+struct TextureAtlasDesc {
+  /// Uncompressed format of the pages and of the images added to them
+  igl::TextureFormat format = igl::TextureFormat::RGBA_UNorm8;
+  uint32_t pageWidth = 1024;
+  uint32_t pageHeight = 1024;
+  /// Pages are created on demand, up to this number
+  uint32_t maxPages = 4;
+  /// Number of mip levels of the pages. Images are aligned to 2^(numMipLevels - 1) texels so they
+  /// cover whole texels on every level; their mip chains are generated on the CPU.
+  uint32_t numMipLevels = 1;
+  /// Texels around every image filled by repeating its edge texels, so that bilinear filtering and
+  /// lower mip levels do not bleed neighboring images in. Rounded up to the image alignment.
+  uint32_t padding = 1;
+  std::string debugName = "TextureAtlas";
+};
+
+struct AtlasEntry {
+  /// Index of the page texture holding the image
+  uint32_t page = 0;
+  /// Texels of the image on level 0 of the page, without padding
+  PackedRect rect;
+  /// Normalized texture coordinates of the image edges
+  float u0 = 0.0f;
+  float v0 = 0.0f;
+  float u1 = 0.0f;
+  float v1 = 0.0f;
+};
+
+/**
+ * @brief Packs small images, e.g. UI icons and sprites, into a few large textures.
+ *
+ * Images are packed with a RectPacker per page and uploaded into their sub-rectangle of the page
+ * with ITexture::upload(), together with their padding and mip levels. Drawing many images from
+ * the same page needs a single texture bind, with the entry's UV rectangle applied to the
+ * texture coordinates. Images can be added and removed at any time; new pages are created when
+ * the existing ones are full.
+ */
+class TextureAtlas final {
+ public:
+  TextureAtlas(igl::IDevice& device, TextureAtlasDesc desc);
+
+  /// Packs and uploads a width x height image in the atlas format. bytesPerRow of 0 means tightly
+  /// packed rows. Returns kInvalidEntry if the image does not fit on an empty page, if all pages
+  /// are full, or if creating a page or uploading fails.
+  EntryHandle add(uint32_t width,
+                  uint32_t height,
+                  const void* IGL_NONNULL data,
+                  size_t bytesPerRow = 0,
+                  igl::Result* IGL_NULLABLE outResult = nullptr);
+  /// Frees the space of an image. Its texels stay in the page until the space is reused.
+  void remove(EntryHandle handle);
+  /// Removes all images. Pages are kept.
+  void clear();
+
+  /// Returns nullptr for invalid or removed handles.
+  [[nodiscard]] const AtlasEntry* IGL_NULLABLE getEntry(EntryHandle handle) const;
+  [[nodiscard]] const std::shared_ptr<igl::ITexture>& getPage(uint32_t page) const;
+  [[nodiscard]] uint32_t getNumPages() const {
+    return static_cast<uint32_t>(pages_.size());
+  }
+  [[nodiscard]] size_t getNumEntries() const {
+    return numEntries_;
+  }
+  [[nodiscard]] const TextureAtlasDesc& getDesc() const {
+    return desc_;
+  }
+
+ private:
+  struct Page {
+    std::shared_ptr<igl::ITexture> texture;
+    RectPacker packer;
+  };
+  struct Slot {
+    AtlasEntry entry;
+    /// Rectangle in the page packer, including padding
+    PackedRect paddedRect;
+    bool used = false;
+  };
+
+  bool upload(const Page& page,
+              const PackedRect& paddedRect,
+              uint32_t width,
+              uint32_t height,
+              const uint8_t* IGL_NONNULL data,
+              size_t bytesPerRow,
+              igl::Result* IGL_NULLABLE outResult);
+
+  igl::IDevice& device_;
+  TextureAtlasDesc desc_;
+  uint32_t alignment_ = 1;
+  uint32_t padding_ = 0;
+  std::vector<Page> pages_;
+  std::vector<Slot> slots_;
+  std::vector<EntryHandle> freeSlots_;
+  size_t numEntries_ = 0;
+  /// Padded image and its mip chain, reused across add() calls
+  std::vector<uint8_t> staging_;
+};
+
+} // namespace iglu::texture_atlas
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/FloatConversion.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__F16C__) || defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define IGLU_TEXTURE_LOADER_SSE2 1
+#endif
+// GCC and Clang define __F16C__ when the conversion instructions are enabled; MSVC has no such
+// macro, but every CPU with AVX2 also supports F16C
+#if defined(__F16C__) || (defined(_MSC_VER) && !defined(__clang__) && defined(__AVX2__))
+#define IGLU_TEXTURE_LOADER_F16C 1
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define IGLU_TEXTURE_LOADER_NEON 1
+#endif
+
+namespace iglu::textureloader {
+namespace {
+
+constexpr int kE5Bias = 15;
+constexpr int kE5MantissaBits = 9;
+constexpr float kE5MaxValue = 65408.0f; // (2^9 - 1) / 2^9 * 2^(31 - 15)
+
+uint32_t floatBits(float value) noexcept {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+float bitsToFloat(uint32_t bits) noexcept {
+  float value = 0.0f;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+} // namespace
+
+uint16_t floatToHalf(float value) noexcept {
+  uint32_t f = floatBits(value);
+  const auto sign = static_cast<uint16_t>((f >> 16) & 0x8000u);
+  f &= 0x7fffffffu;
+
+  if (f >= 0x7f800000u) {
+    // Inf or NaN
+    return static_cast<uint16_t>(sign | (f > 0x7f800000u ? 0x7e00u : 0x7c00u));
+  }
+  if (f >= 0x477ff000u) {
+    // Rounds to a value above 65504
+    return static_cast<uint16_t>(sign | 0x7c00u);
+  }
+  if (f < 0x38800000u) {
+    // Below the smallest normal half: denormal or zero
+    if (f < 0x33000000u) {
+      return sign;
+    }
+    const uint32_t shift = 126u - (f >> 23);
+    const uint32_t mantissa = (f & 0x7fffffu) | 0x800000u;
+    uint32_t h = mantissa >> shift;
+    const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+    const uint32_t halfway = 1u << (shift - 1u);
+    if (remainder > halfway || (remainder == halfway && (h & 1u))) {
+      h++;
+    }
+    return static_cast<uint16_t>(sign | h);
+  }
+
+  // Rebias the exponent from 127 to 15; a carry out of the mantissa correctly bumps the exponent
+  uint32_t h = (f - 0x38000000u) >> 13;
+  const uint32_t remainder = f & 0x1fffu;
+  if (remainder > 0x1000u || (remainder == 0x1000u && (h & 1u))) {
+    h++;
+  }
+  return static_cast<uint16_t>(sign | h);
+}
+
+float halfToFloat(uint16_t value) noexcept {
+  const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1fu;
+  const uint32_t mantissa = value & 0x3ffu;
+
+  if (exponent == 0) {
+    // Zero or denormal: mantissa * 2^-24
+    const float magnitude = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+    return bitsToFloat(sign | floatBits(magnitude));
+  }
+  if (exponent == 31) {
+    return bitsToFloat(sign | 0x7f800000u | (mantissa << 13));
+  }
+  return bitsToFloat(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+uint32_t packR9G9B9E5(float r, float g, float b) noexcept {
+  // NaN fails the comparison and becomes 0
+  auto clampComponent = [](float v) { return v > 0.0f ? std::min(v, kE5MaxValue) : 0.0f; };
+  const float rc = clampComponent(r);
+  const float gc = clampComponent(g);
+  const float bc = clampComponent(b);
+  const float maxComponent = std::max(rc, std::max(gc, bc));
+
+  // floor(log2(maxComponent)) from the float exponent; denormals and 0 give -127
+  const int exponent = static_cast<int>((floatBits(maxComponent) >> 23) & 0xffu) - 127;
+  int sharedExponent = std::max(-kE5Bias - 1, exponent) + 1 + kE5Bias;
+
+  // All scales are powers of two, so the products below are exact
+  float scale = bitsToFloat(static_cast<uint32_t>(kE5Bias + kE5MantissaBits - sharedExponent + 127)
+                            << 23);
+  if (static_cast<uint32_t>(maxComponent * scale + 0.5f) == (1u << kE5MantissaBits)) {
+    sharedExponent++;
+    scale *= 0.5f;
+  }
+
+  const auto rm = static_cast<uint32_t>(rc * scale + 0.5f);
+  const auto gm = static_cast<uint32_t>(gc * scale + 0.5f);
+  const auto bm = static_cast<uint32_t>(bc * scale + 0.5f);
+  return rm | (gm << 9) | (bm << 18) | (static_cast<uint32_t>(sharedExponent) << 27);
+}
+
+void unpackR9G9B9E5(uint32_t value, float* rgb) noexcept {
+  const int sharedExponent = static_cast<int>(value >> 27);
+  const float scale = bitsToFloat(
+      static_cast<uint32_t>(sharedExponent - kE5Bias - kE5MantissaBits + 127) << 23);
+  rgb[0] = static_cast<float>(value & 0x1ffu) * scale;
+  rgb[1] = static_cast<float>((value >> 9) & 0x1ffu) * scale;
+  rgb[2] = static_cast<float>((value >> 18) & 0x1ffu) * scale;
+}
+
+void convertRgbaF32ToRgbaF16(const float* src, uint16_t* dst, size_t numTexels) noexcept {
+  const size_t numValues = numTexels * 4;
+  size_t i = 0;
+#if IGLU_TEXTURE_LOADER_F16C
+  for (; i + 8 <= numValues; i += 8) {
+    const __m256 v = _mm256_loadu_ps(src + i);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+  }
+#elif IGLU_TEXTURE_LOADER_NEON
+  for (; i + 4 <= numValues; i += 4) {
+    const float16x4_t v = vcvt_f16_f32(vld1q_f32(src + i));
+    vst1_u16(dst + i, vreinterpret_u16_f16(v));
+  }
+#endif
+  for (; i < numValues; ++i) {
+    dst[i] = floatToHalf(src[i]);
+  }
+}
+
+void convertRgbaF32ToR9G9B9E5(const float* src, uint32_t* dst, size_t numTexels) noexcept {
+  size_t i = 0;
+#if IGLU_TEXTURE_LOADER_SSE2
+  // Same arithmetic as packR9G9B9E5() on 4 texels at a time
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 maxValue = _mm_set1_ps(kE5MaxValue);
+  const __m128 half = _mm_set1_ps(0.5f);
+  const __m128i minExponent = _mm_set1_epi32(-kE5Bias - 1);
+  for (; i + 4 <= numTexels; i += 4) {
+    __m128 r = _mm_loadu_ps(src + i * 4);
+    __m128 g = _mm_loadu_ps(src + i * 4 + 4);
+    __m128 b = _mm_loadu_ps(src + i * 4 + 8);
+    __m128 a = _mm_loadu_ps(src + i * 4 + 12);
+    _MM_TRANSPOSE4_PS(r, g, b, a);
+    // _mm_max_ps returns the second operand for NaN
+    r = _mm_min_ps(_mm_max_ps(r, zero), maxValue);
+    g = _mm_min_ps(_mm_max_ps(g, zero), maxValue);
+    b = _mm_min_ps(_mm_max_ps(b, zero), maxValue);
+    const __m128 maxComponent = _mm_max_ps(r, _mm_max_ps(g, b));
+
+    const __m128i exponent = _mm_sub_epi32(
+        _mm_srli_epi32(_mm_castps_si128(maxComponent), 23), _mm_set1_epi32(127));
+    // SSE2 has no _mm_max_epi32
+    const __m128i useMin = _mm_cmplt_epi32(exponent, minExponent);
+    const __m128i clampedExponent =
+        _mm_or_si128(_mm_and_si128(useMin, minExponent), _mm_andnot_si128(useMin, exponent));
+    __m128i sharedExponent = _mm_add_epi32(clampedExponent, _mm_set1_epi32(1 + kE5Bias));
+
+    __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(
+        _mm_sub_epi32(_mm_set1_epi32(kE5Bias + kE5MantissaBits + 127), sharedExponent), 23));
+    const __m128i maxMantissa = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(maxComponent, scale), half));
+    const __m128i overflow = _mm_cmpeq_epi32(maxMantissa, _mm_set1_epi32(1 << kE5MantissaBits));
+    sharedExponent = _mm_sub_epi32(sharedExponent, overflow); // overflow is -1 where set
+    scale = _mm_mul_ps(
+        scale, _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(overflow), half),
+                         _mm_andnot_ps(_mm_castsi128_ps(overflow), _mm_set1_ps(1.0f))));
+
+    const __m128i rm = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(r, scale), half));
+    const __m128i gm = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(g, scale), half));
+    const __m128i bm = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(b, scale), half));
+    const __m128i packed = _mm_or_si128(
+        _mm_or_si128(rm, _mm_slli_epi32(gm, 9)),
+        _mm_or_si128(_mm_slli_epi32(bm, 18), _mm_slli_epi32(sharedExponent, 27)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+  }
+#endif
+  for (; i < numTexels; ++i) {
+    dst[i] = packR9G9B9E5(src[i * 4], src[i * 4 + 1], src[i * 4 + 2]);
+  }
+}
+
+} // namespace iglu::textureloader
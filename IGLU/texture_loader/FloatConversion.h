@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace iglu::textureloader {
+
+/// Converts a float to an IEEE half float, rounding to nearest even.
+[[nodiscard]] uint16_t floatToHalf(float value) noexcept;
+[[nodiscard]] float halfToFloat(uint16_t value) noexcept;
+
+/// Packs an RGB color into the shared exponent format of TextureFormat::R9G9B9E5_F, as specified
+/// by EXT_texture_shared_exponent. Negative and NaN components become 0, large ones are clamped
+/// to the largest representable value (65408).
+[[nodiscard]] uint32_t packR9G9B9E5(float r, float g, float b) noexcept;
+void unpackR9G9B9E5(uint32_t value, float* rgb) noexcept;
+
+/// Converts RGBA float texels to RGBA half float texels. Uses F16C or NEON when available.
+void convertRgbaF32ToRgbaF16(const float* src, uint16_t* dst, size_t numTexels) noexcept;
+
+/// Converts RGBA float texels to R9G9B9E5_F texels, dropping alpha. Uses SSE2 when available.
+void convertRgbaF32ToR9G9B9E5(const float* src, uint32_t* dst, size_t numTexels) noexcept;
+
+} // namespace iglu::textureloader
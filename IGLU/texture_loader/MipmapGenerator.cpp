@@ -0,0 +1,575 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/MipmapGenerator.h>
+
+#include <IGLU/texture_loader/FloatConversion.h>
+#include <IGLU/texture_loader/WorkerPool.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IGLU_MIPMAP_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define IGLU_MIPMAP_NEON 1
+#endif
+
+namespace iglu::textureloader {
+namespace {
+
+// Levels are filtered as RGBA floats, one 4-wide vector per texel
+constexpr size_t kWorkingChannels = 4;
+// Levels with fewer texels are filtered on a single thread
+constexpr size_t kMinTexelsPerThread = 16 * 1024;
+
+enum class Encoding : uint8_t { Invalid, UNorm8, SRGB8, F16, F32, RGB9E5 };
+
+struct FormatInfo {
+  Encoding encoding = Encoding::Invalid;
+  uint32_t numChannels = 0;
+  bool hasAlpha = false;
+};
+
+FormatInfo getFormatInfo(igl::TextureFormat format) noexcept {
+  using igl::TextureFormat;
+  switch (format) {
+  case TextureFormat::R_UNorm8:
+    return {Encoding::UNorm8, 1, false};
+  case TextureFormat::RG_UNorm8:
+    return {Encoding::UNorm8, 2, false};
+  case TextureFormat::RGBX_UNorm8:
+    return {Encoding::UNorm8, 4, false};
+  case TextureFormat::RGBA_UNorm8:
+  case TextureFormat::BGRA_UNorm8:
+    return {Encoding::UNorm8, 4, true};
+  case TextureFormat::RGBA_SRGB:
+  case TextureFormat::BGRA_SRGB:
+    return {Encoding::SRGB8, 4, true};
+  case TextureFormat::R_F16:
+    return {Encoding::F16, 1, false};
+  case TextureFormat::RG_F16:
+    return {Encoding::F16, 2, false};
+  case TextureFormat::RGB_F16:
+    return {Encoding::F16, 3, false};
+  case TextureFormat::RGBA_F16:
+    return {Encoding::F16, 4, true};
+  case TextureFormat::R_F32:
+    return {Encoding::F32, 1, false};
+  case TextureFormat::RG_F32:
+    return {Encoding::F32, 2, false};
+  case TextureFormat::RGB_F32:
+    return {Encoding::F32, 3, false};
+  case TextureFormat::RGBA_F32:
+    return {Encoding::F32, 4, true};
+  case TextureFormat::R9G9B9E5_F:
+    return {Encoding::RGB9E5, 3, false};
+  default:
+    return {};
+  }
+}
+
+// 4-wide float vector for the filter kernels
+#if IGLU_MIPMAP_SSE2
+using Vec4 = __m128;
+inline Vec4 load4(const float* p) noexcept {
+  return _mm_loadu_ps(p);
+}
+inline void store4(float* p, Vec4 v) noexcept {
+  _mm_storeu_ps(p, v);
+}
+inline Vec4 add4(Vec4 a, Vec4 b) noexcept {
+  return _mm_add_ps(a, b);
+}
+inline Vec4 mul4(Vec4 a, float s) noexcept {
+  return _mm_mul_ps(a, _mm_set1_ps(s));
+}
+#elif IGLU_MIPMAP_NEON
+using Vec4 = float32x4_t;
+inline Vec4 load4(const float* p) noexcept {
+  return vld1q_f32(p);
+}
+inline void store4(float* p, Vec4 v) noexcept {
+  vst1q_f32(p, v);
+}
+inline Vec4 add4(Vec4 a, Vec4 b) noexcept {
+  return vaddq_f32(a, b);
+}
+inline Vec4 mul4(Vec4 a, float s) noexcept {
+  return vmulq_n_f32(a, s);
+}
+#else
+struct Vec4 {
+  float v[4];
+};
+inline Vec4 load4(const float* p) noexcept {
+  return {{p[0], p[1], p[2], p[3]}};
+}
+inline void store4(float* p, Vec4 v) noexcept {
+  std::memcpy(p, v.v, sizeof(v.v));
+}
+inline Vec4 add4(Vec4 a, Vec4 b) noexcept {
+  return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+}
+inline Vec4 mul4(Vec4 a, float s) noexcept {
+  return {{a.v[0] * s, a.v[1] * s, a.v[2] * s, a.v[3] * s}};
+}
+#endif
+
+float srgbToLinear(float v) noexcept {
+  return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+}
+
+struct SrgbTables {
+  std::array<float, 256> toLinear{};
+  // Linear value halfway between two consecutive sRGB values, to encode by binary search
+  std::array<float, 255> thresholds{};
+
+  SrgbTables() noexcept {
+    for (size_t i = 0; i < toLinear.size(); ++i) {
+      toLinear[i] = srgbToLinear(static_cast<float>(i) / 255.0f);
+    }
+    for (size_t i = 0; i < thresholds.size(); ++i) {
+      thresholds[i] = srgbToLinear((static_cast<float>(i) + 0.5f) / 255.0f);
+    }
+  }
+};
+
+const SrgbTables& getSrgbTables() noexcept {
+  static const SrgbTables kTables;
+  return kTables;
+}
+
+uint8_t encodeUNorm8(float v) noexcept {
+  return static_cast<uint8_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+uint8_t encodeSrgb8(float v, const SrgbTables& tables) noexcept {
+  const auto it = std::upper_bound(tables.thresholds.begin(), tables.thresholds.end(), v);
+  return static_cast<uint8_t>(it - tables.thresholds.begin());
+}
+
+// Weights of the 6 source texels around a destination texel, at distances 2.5, 1.5, 0.5, 0.5,
+// 1.5 and 2.5 source texels: sinc with the cutoff of a 2x reduction, Kaiser window of radius 3
+std::array<float, 6> makeKaiserWeights() noexcept {
+  constexpr double kPi = 3.14159265358979323846;
+  constexpr double kAlpha = 4.0;
+  constexpr double kRadius = 3.0;
+  auto besselI0 = [](double x) {
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 32; ++k) {
+      term *= (x / (2.0 * k)) * (x / (2.0 * k));
+      sum += term;
+    }
+    return sum;
+  };
+
+  std::array<float, 6> weights{};
+  double total = 0.0;
+  double w[6] = {};
+  for (int i = 0; i < 6; ++i) {
+    const double d = static_cast<double>(i) - 2.5;
+    const double x = d / 2.0;
+    const double sinc = std::sin(kPi * x) / (kPi * x);
+    const double r = d / kRadius;
+    w[i] = sinc * besselI0(kAlpha * std::sqrt(1.0 - r * r)) / besselI0(kAlpha);
+    total += w[i];
+  }
+  for (int i = 0; i < 6; ++i) {
+    weights[i] = static_cast<float>(w[i] / total);
+  }
+  return weights;
+}
+
+const std::array<float, 6>& getKaiserWeights() noexcept {
+  static const auto kWeights = makeKaiserWeights();
+  return kWeights;
+}
+
+// Runs func(begin, end) on bands of [0, numRows) on up to numThreads threads of the worker pool
+template<typename Func>
+void parallelFor(size_t numRows, size_t texelsPerRow, uint32_t numThreads, const Func& func) {
+  const size_t maxBands = std::max<size_t>(numRows * texelsPerRow / kMinTexelsPerThread, 1);
+  const size_t numBands = std::min({static_cast<size_t>(numThreads), maxBands, numRows});
+  if (numBands <= 1) {
+    func(size_t(0), numRows);
+    return;
+  }
+
+  WorkerPool::getDefault().parallelFor(numBands, numThreads, [&](size_t band) {
+    func(numRows * band / numBands, numRows * (band + 1) / numBands);
+  });
+}
+
+void decode(const uint8_t* src,
+            float* dst,
+            size_t numTexels,
+            const FormatInfo& info,
+            bool premultiplyAlpha) noexcept {
+  const uint32_t n = info.numChannels;
+  for (size_t i = 0; i < numTexels; ++i) {
+    float* texel = dst + i * kWorkingChannels;
+    texel[0] = texel[1] = texel[2] = 0.0f;
+    texel[3] = 1.0f;
+    switch (info.encoding) {
+    case Encoding::UNorm8:
+      for (uint32_t c = 0; c < n; ++c) {
+        texel[c] = static_cast<float>(src[i * n + c]) * (1.0f / 255.0f);
+      }
+      break;
+    case Encoding::SRGB8: {
+      const auto& tables = getSrgbTables();
+      for (uint32_t c = 0; c < 3; ++c) {
+        texel[c] = tables.toLinear[src[i * 4 + c]];
+      }
+      texel[3] = static_cast<float>(src[i * 4 + 3]) * (1.0f / 255.0f);
+      break;
+    }
+    case Encoding::F16:
+      for (uint32_t c = 0; c < n; ++c) {
+        uint16_t half = 0;
+        std::memcpy(&half, src + (i * n + c) * sizeof(half), sizeof(half));
+        texel[c] = halfToFloat(half);
+      }
+      break;
+    case Encoding::F32:
+      std::memcpy(texel, src + i * n * sizeof(float), n * sizeof(float));
+      break;
+    case Encoding::RGB9E5: {
+      uint32_t packed = 0;
+      std::memcpy(&packed, src + i * sizeof(packed), sizeof(packed));
+      unpackR9G9B9E5(packed, texel);
+      break;
+    }
+    case Encoding::Invalid:
+      break;
+    }
+    if (premultiplyAlpha) {
+      texel[0] *= texel[3];
+      texel[1] *= texel[3];
+      texel[2] *= texel[3];
+    }
+  }
+}
+
+void encode(const float* src,
+            uint8_t* dst,
+            size_t numTexels,
+            const FormatInfo& info,
+            bool premultiplyAlpha) noexcept {
+  const uint32_t n = info.numChannels;
+  if (!premultiplyAlpha && n == 4 && info.encoding == Encoding::F16) {
+    convertRgbaF32ToRgbaF16(src, reinterpret_cast<uint16_t*>(dst), numTexels);
+    return;
+  }
+  if (info.encoding == Encoding::RGB9E5) {
+    convertRgbaF32ToR9G9B9E5(src, reinterpret_cast<uint32_t*>(dst), numTexels);
+    return;
+  }
+
+  for (size_t i = 0; i < numTexels; ++i) {
+    float texel[kWorkingChannels];
+    std::memcpy(texel, src + i * kWorkingChannels, sizeof(texel));
+    if (premultiplyAlpha) {
+      const float scale = texel[3] > 0.0f ? 1.0f / texel[3] : 0.0f;
+      texel[0] *= scale;
+      texel[1] *= scale;
+      texel[2] *= scale;
+    }
+    switch (info.encoding) {
+    case Encoding::UNorm8:
+      for (uint32_t c = 0; c < n; ++c) {
+        dst[i * n + c] = encodeUNorm8(texel[c]);
+      }
+      break;
+    case Encoding::SRGB8: {
+      const auto& tables = getSrgbTables();
+      for (uint32_t c = 0; c < 3; ++c) {
+        dst[i * 4 + c] = encodeSrgb8(texel[c], tables);
+      }
+      dst[i * 4 + 3] = encodeUNorm8(texel[3]);
+      break;
+    }
+    case Encoding::F16:
+      for (uint32_t c = 0; c < n; ++c) {
+        const uint16_t half = floatToHalf(texel[c]);
+        std::memcpy(dst + (i * n + c) * sizeof(half), &half, sizeof(half));
+      }
+      break;
+    case Encoding::F32:
+      std::memcpy(dst + i * n * sizeof(float), texel, n * sizeof(float));
+      break;
+    case Encoding::RGB9E5:
+    case Encoding::Invalid:
+      break;
+    }
+  }
+}
+
+struct Level {
+  const float* data = nullptr;
+  size_t width = 0;
+  size_t height = 0;
+};
+
+// Destination rows [y0, y1) of a 2x reduction with a 2x2 box filter. Odd edges reuse the last
+// source row or column.
+void boxFilterRows(const Level& src, float* dst, size_t dstWidth, size_t y0, size_t y1) noexcept {
+  const size_t srcStride = src.width * kWorkingChannels;
+  for (size_t y = y0; y < y1; ++y) {
+    const float* row0 = src.data + std::min(2 * y, src.height - 1) * srcStride;
+    const float* row1 = src.data + std::min(2 * y + 1, src.height - 1) * srcStride;
+    float* out = dst + y * dstWidth * kWorkingChannels;
+    for (size_t x = 0; x < dstWidth; ++x) {
+      const size_t x0 = std::min(2 * x, src.width - 1) * kWorkingChannels;
+      const size_t x1 = std::min(2 * x + 1, src.width - 1) * kWorkingChannels;
+      const Vec4 sum = add4(add4(load4(row0 + x0), load4(row0 + x1)),
+                            add4(load4(row1 + x0), load4(row1 + x1)));
+      store4(out + x * kWorkingChannels, mul4(sum, 0.25f));
+    }
+  }
+}
+
+// Horizontal pass of the Kaiser filter on source rows [y0, y1): tmp has dstWidth columns
+void kaiserFilterColumns(const Level& src,
+                         float* tmp,
+                         size_t dstWidth,
+                         size_t y0,
+                         size_t y1) noexcept {
+  const auto& weights = getKaiserWeights();
+  const auto maxX = static_cast<ptrdiff_t>(src.width) - 1;
+  for (size_t y = y0; y < y1; ++y) {
+    const float* row = src.data + y * src.width * kWorkingChannels;
+    float* out = tmp + y * dstWidth * kWorkingChannels;
+    for (size_t x = 0; x < dstWidth; ++x) {
+      const auto first = static_cast<ptrdiff_t>(2 * x) - 2;
+      Vec4 sum = mul4(load4(row + std::clamp<ptrdiff_t>(first, 0, maxX) * 4), weights[0]);
+      for (ptrdiff_t k = 1; k < 6; ++k) {
+        const ptrdiff_t sx = std::clamp<ptrdiff_t>(first + k, 0, maxX);
+        sum = add4(sum, mul4(load4(row + sx * 4), weights[k]));
+      }
+      store4(out + x * kWorkingChannels, sum);
+    }
+  }
+}
+
+// Vertical pass of the Kaiser filter on destination rows [y0, y1)
+void kaiserFilterRows(const Level& tmp, float* dst, size_t y0, size_t y1) noexcept {
+  const auto& weights = getKaiserWeights();
+  const auto maxY = static_cast<ptrdiff_t>(tmp.height) - 1;
+  const size_t stride = tmp.width * kWorkingChannels;
+  for (size_t y = y0; y < y1; ++y) {
+    const float* rows[6];
+    for (ptrdiff_t k = 0; k < 6; ++k) {
+      const ptrdiff_t sy = std::clamp<ptrdiff_t>(static_cast<ptrdiff_t>(2 * y) - 2 + k, 0, maxY);
+      rows[k] = tmp.data + sy * stride;
+    }
+    float* out = dst + y * stride;
+    for (size_t x = 0; x < stride; x += kWorkingChannels) {
+      Vec4 sum = mul4(load4(rows[0] + x), weights[0]);
+      for (size_t k = 1; k < 6; ++k) {
+        sum = add4(sum, mul4(load4(rows[k] + x), weights[k]));
+      }
+      store4(out + x, sum);
+    }
+  }
+}
+
+struct ChainParams {
+  const igl::TextureDesc& desc;
+  const FormatInfo& info;
+  const MipmapGeneratorDesc& generatorDesc;
+  uint32_t numThreads = 1;
+  bool premultiplyAlpha = false;
+  size_t bytesPerTexel = 0;
+};
+
+struct ChainBuffers {
+  std::vector<float> current;
+  std::vector<float> next;
+  std::vector<float> tmp;
+};
+
+// Filters and encodes levels 1 to desc.numMipLevels - 1 of one layer and face from the RGBA float
+// texels of level 0, in working space
+template<typename LevelData>
+void generateChain(const ChainParams& params,
+                   const float* level0,
+                   const LevelData& levelData,
+                   ChainBuffers& buffers) {
+  const auto numThreads = params.numThreads;
+  size_t width = params.desc.width;
+  size_t height = params.desc.height;
+  const float* current = level0;
+
+  for (uint32_t mipLevel = 1; mipLevel < params.desc.numMipLevels; ++mipLevel) {
+    const Level src = {current, width, height};
+    width = std::max<size_t>(width / 2, 1);
+    height = std::max<size_t>(height / 2, 1);
+    auto& next = buffers.next;
+    next.resize(width * height * kWorkingChannels);
+
+    if (params.generatorDesc.filter == MipmapFilter::Kaiser) {
+      auto& tmp = buffers.tmp;
+      tmp.resize(width * src.height * kWorkingChannels);
+      parallelFor(src.height, width, numThreads, [&](size_t y0, size_t y1) {
+        kaiserFilterColumns(src, tmp.data(), width, y0, y1);
+      });
+      const Level columns = {tmp.data(), width, src.height};
+      parallelFor(height, width, numThreads, [&](size_t y0, size_t y1) {
+        kaiserFilterRows(columns, next.data(), y0, y1);
+      });
+    } else {
+      parallelFor(height, width, numThreads, [&](size_t y0, size_t y1) {
+        boxFilterRows(src, next.data(), width, y0, y1);
+      });
+    }
+
+    uint8_t* out = levelData(mipLevel);
+    parallelFor(height, width, numThreads, [&](size_t y0, size_t y1) {
+      encode(next.data() + y0 * width * kWorkingChannels,
+             out + y0 * width * params.bytesPerTexel,
+             (y1 - y0) * width,
+             params.info,
+             params.premultiplyAlpha);
+    });
+    std::swap(buffers.current, next);
+    current = buffers.current.data();
+  }
+}
+
+igl::Result validate(const igl::TextureDesc& desc, const FormatInfo& info) noexcept {
+  if (info.encoding == Encoding::Invalid) {
+    return igl::Result{igl::Result::Code::Unsupported, "Unsupported texture format."};
+  }
+  if (desc.type == igl::TextureType::ThreeD || desc.depth > 1) {
+    return igl::Result{igl::Result::Code::Unsupported, "3D textures are not supported."};
+  }
+  return igl::Result{};
+}
+
+uint32_t getNumThreads(const MipmapGeneratorDesc& generatorDesc) noexcept {
+  return generatorDesc.numThreads != 0 ? generatorDesc.numThreads
+                                       : WorkerPool::getDefault().numWorkers() + 1;
+}
+
+} // namespace
+
+bool isMipmapGenerationSupported(igl::TextureFormat format) noexcept {
+  return getFormatInfo(format).encoding != Encoding::Invalid;
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+igl::Result generateMipmaps(const igl::TextureDesc& desc,
+                            uint8_t* IGL_NONNULL data,
+                            const MipmapGeneratorDesc& generatorDesc) noexcept {
+  const FormatInfo info = getFormatInfo(desc.format);
+  auto result = validate(desc, info);
+  if (!result.isOk() || desc.numMipLevels <= 1) {
+    return result;
+  }
+
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  const ChainParams params = {
+      .desc = desc,
+      .info = info,
+      .generatorDesc = generatorDesc,
+      .numThreads = getNumThreads(generatorDesc),
+      .premultiplyAlpha = generatorDesc.premultiplyAlpha && info.hasAlpha,
+      .bytesPerTexel = properties.bytesPerBlock,
+  };
+  const igl::TextureRangeDesc range = desc.asRange();
+  ChainBuffers buffers;
+  std::vector<float> level0;
+
+  for (uint32_t layer = 0; layer < range.numLayers; ++layer) {
+    for (uint32_t face = 0; face < range.numFaces; ++face) {
+      auto levelData = [&](uint32_t mipLevel) {
+        const auto subRange = range.atMipLevel(mipLevel).atLayer(layer).atFace(face);
+        return data + properties.getSubRangeByteOffset(range, subRange);
+      };
+
+      const size_t width = desc.width;
+      const uint8_t* base = levelData(0);
+      level0.resize(width * desc.height * kWorkingChannels);
+      parallelFor(desc.height, width, params.numThreads, [&](size_t y0, size_t y1) {
+        decode(base + y0 * width * params.bytesPerTexel,
+               level0.data() + y0 * width * kWorkingChannels,
+               (y1 - y0) * width,
+               info,
+               params.premultiplyAlpha);
+      });
+      generateChain(params, level0.data(), levelData, buffers);
+    }
+  }
+
+  return igl::Result{};
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+igl::Result generateMipmaps(const igl::TextureDesc& desc,
+                            const float* IGL_NONNULL level0,
+                            uint8_t* IGL_NONNULL data,
+                            const MipmapGeneratorDesc& generatorDesc) noexcept {
+  const FormatInfo info = getFormatInfo(desc.format);
+  auto result = validate(desc, info);
+  if (!result.isOk()) {
+    return result;
+  }
+  if (desc.numLayers > 1 || desc.type == igl::TextureType::Cube) {
+    return igl::Result{igl::Result::Code::Unsupported, "Only 2D textures are supported."};
+  }
+
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  const ChainParams params = {
+      .desc = desc,
+      .info = info,
+      .generatorDesc = generatorDesc,
+      .numThreads = getNumThreads(generatorDesc),
+      .premultiplyAlpha = generatorDesc.premultiplyAlpha && info.hasAlpha,
+      .bytesPerTexel = properties.bytesPerBlock,
+  };
+  const igl::TextureRangeDesc range = desc.asRange();
+  auto levelData = [&](uint32_t mipLevel) {
+    return data + properties.getSubRangeByteOffset(range, range.atMipLevel(mipLevel));
+  };
+
+  // Level 0 is stored from the straight source texels, so premultiplication only affects filtering
+  const size_t width = desc.width;
+  parallelFor(desc.height, width, params.numThreads, [&](size_t y0, size_t y1) {
+    encode(level0 + y0 * width * kWorkingChannels,
+           data + y0 * width * params.bytesPerTexel,
+           (y1 - y0) * width,
+           info,
+           false);
+  });
+  if (desc.numMipLevels <= 1) {
+    return igl::Result{};
+  }
+
+  ChainBuffers buffers;
+  const float* source = level0;
+  std::vector<float> premultiplied;
+  if (params.premultiplyAlpha) {
+    premultiplied.assign(level0, level0 + width * desc.height * kWorkingChannels);
+    for (size_t i = 0; i < premultiplied.size(); i += kWorkingChannels) {
+      premultiplied[i + 0] *= premultiplied[i + 3];
+      premultiplied[i + 1] *= premultiplied[i + 3];
+      premultiplied[i + 2] *= premultiplied[i + 3];
+    }
+    source = premultiplied.data();
+  }
+  generateChain(params, source, levelData, buffers);
+
+  return igl::Result{};
+}
+
+} // namespace iglu::textureloader
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <igl/Texture.h>
+
+namespace iglu::textureloader {
+
+enum class MipmapFilter : uint8_t {
+  Box, ///< Average of 2x2 texels
+  Kaiser, ///< 6x6 Kaiser-windowed sinc; sharper than Box, may ring on hard edges
+};
+
+struct MipmapGeneratorDesc {
+  MipmapFilter filter = MipmapFilter::Box;
+  /// Filters the color of textures with straight alpha premultiplied by alpha, so that the color
+  /// of transparent texels does not bleed into their neighbors. Levels are stored unpremultiplied.
+  bool premultiplyAlpha = false;
+  /// Maximum number of threads working on one level, including the calling thread; 0 uses all
+  /// threads of the shared WorkerPool. Small levels are always filtered on the calling thread.
+  uint32_t numThreads = 0;
+};
+
+/// Returns true if generateMipmaps() supports the format: 8-bit unorm and sRGB, half float, float
+/// and R9G9B9E5_F color formats.
+[[nodiscard]] bool isMipmapGenerationSupported(igl::TextureFormat format) noexcept;
+
+/**
+ * Builds the mip chain of a texture on the CPU, as an alternative to ITexture::generateMipmap()
+ * for loaders which upload complete mip chains and for formats the GPU cannot generate mipmaps for.
+ *
+ * data holds all mip levels, layers and faces of desc, packed like
+ * TextureFormatProperties::getBytesPerRange(desc.asRange()). Level 0 of every layer and face must
+ * be filled; levels 1 to desc.numMipLevels - 1 are overwritten. Every level is filtered from the
+ * float data of the previous one, sRGB formats in linear space. Filter kernels use SSE2 or NEON
+ * when available. 3D textures are not supported.
+ */
+[[nodiscard]] igl::Result generateMipmaps(const igl::TextureDesc& desc,
+                                          uint8_t* IGL_NONNULL data,
+                                          const MipmapGeneratorDesc& generatorDesc = {}) noexcept;
+
+/**
+ * Same as above for a 2D texture whose level 0 is given as RGBA float texels, e.g. a decoded HDR
+ * image. Every level, level 0 included, is written to data straight from float data, so compact
+ * formats such as RGBA_F16 and R9G9B9E5_F are quantized once rather than once per level.
+ * level0 holds desc.width * desc.height * 4 floats with straight alpha.
+ */
+[[nodiscard]] igl::Result generateMipmaps(const igl::TextureDesc& desc,
+                                          const float* IGL_NONNULL level0,
+                                          uint8_t* IGL_NONNULL data,
+                                          const MipmapGeneratorDesc& generatorDesc = {}) noexcept;
+
+} // namespace iglu::textureloader
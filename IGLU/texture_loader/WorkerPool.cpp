@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/WorkerPool.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace iglu::textureloader {
+
+// Shared by the calling thread and the queue entries of one parallelFor() call. Workers which
+// dequeue a batch after all indices were taken return right away.
+struct WorkerPool::Batch {
+  const std::function<void(size_t)>* func = nullptr;
+  size_t count = 0;
+  std::atomic<size_t> nextIndex = 0;
+  std::atomic<size_t> numCompleted = 0;
+  std::mutex mutex;
+  std::condition_variable completed;
+};
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+WorkerPool::WorkerPool(uint32_t numWorkers) noexcept {
+  workers_.reserve(numWorkers);
+  for (uint32_t i = 0; i < numWorkers; ++i) {
+    workers_.emplace_back([this] { workerLoop(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  condition_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+WorkerPool& WorkerPool::getDefault() noexcept {
+  static WorkerPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+  return pool;
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+void WorkerPool::parallelFor(size_t count,
+                             uint32_t maxThreads,
+                             const std::function<void(size_t)>& func) noexcept {
+  if (count == 0) {
+    return;
+  }
+  const size_t maxHelpers = maxThreads != 0 ? maxThreads - 1 : workers_.size();
+  const size_t numHelpers = std::min({maxHelpers, workers_.size(), count - 1});
+  if (numHelpers == 0) {
+    for (size_t i = 0; i < count; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  auto batch = std::make_shared<Batch>();
+  batch->func = &func;
+  batch->count = count;
+  {
+    const std::lock_guard lock(mutex_);
+    queue_.insert(queue_.end(), numHelpers, batch);
+  }
+  if (numHelpers == 1) {
+    condition_.notify_one();
+  } else {
+    condition_.notify_all();
+  }
+
+  run(*batch);
+
+  std::unique_lock lock(batch->mutex);
+  batch->completed.wait(lock, [&] { return batch->numCompleted == count; });
+}
+
+void WorkerPool::run(Batch& batch) noexcept {
+  for (size_t i = batch.nextIndex++; i < batch.count; i = batch.nextIndex++) {
+    (*batch.func)(i);
+    if (++batch.numCompleted == batch.count) {
+      const std::lock_guard lock(batch.mutex);
+      batch.completed.notify_all();
+    }
+  }
+}
+
+void WorkerPool::workerLoop() noexcept {
+  std::unique_lock lock(mutex_);
+  while (true) {
+    condition_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+    if (stop_) {
+      return;
+    }
+    auto batch = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    run(*batch);
+    batch.reset();
+    lock.lock();
+  }
+}
+
+} // namespace iglu::textureloader
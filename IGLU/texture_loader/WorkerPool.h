@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iglu::textureloader {
+
+/**
+ * Pool of worker threads shared by the CPU stages of texture loaders: mipmap generation, BC7
+ * encoding and KTX2 transcoding. Threads are started once instead of for every texture.
+ *
+ * The calling thread always takes part in parallelFor(), so calls may be nested or issued from
+ * several threads at once without deadlocking; concurrent calls share the workers in FIFO order.
+ */
+class WorkerPool final {
+ public:
+  explicit WorkerPool(uint32_t numWorkers) noexcept;
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /// Returns the pool used by texture loaders, with one worker less than the number of hardware
+  /// threads. It is created on first use.
+  [[nodiscard]] static WorkerPool& getDefault() noexcept;
+
+  [[nodiscard]] uint32_t numWorkers() const noexcept {
+    return static_cast<uint32_t>(workers_.size());
+  }
+
+  /// Calls func(i) for every i in [0, count) and returns once all calls have returned. At most
+  /// maxThreads threads, including the calling thread, run func; 0 means no limit.
+  void parallelFor(size_t count,
+                   uint32_t maxThreads,
+                   const std::function<void(size_t)>& func) noexcept;
+
+ private:
+  struct Batch;
+
+  static void run(Batch& batch) noexcept;
+  void workerLoop() noexcept;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<std::shared_ptr<Batch>> queue_;
+  bool stop_ = false;
+  std::vector<std::thread> workers_;
+};
+
+} // namespace iglu::textureloader
@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/bc7/TextureLoaderFactory.h>
+
+#include <IGLU/texture_loader/MipmapGenerator.h>
+#include <IGLU/texture_loader/WorkerPool.h>
+#include <algorithm>
+#include <bc7enc.h>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ktx.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <igl/DeviceFeatures.h>
+
+namespace iglu::textureloader::bc7 {
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x43374249; // 'IB7C'
+constexpr uint32_t kCacheVersion = 1;
+constexpr uint32_t kBlockSize = 16;
+// Block rows encoded by one thread before it picks the next ones
+constexpr uint32_t kBlockRowsPerJob = 4;
+// ASTC jobs are encoded as separate images by libktx, which sets up an encoder context for each,
+// so they cover more rows
+constexpr uint32_t kAstcBlockRowsPerJob = 32;
+// VkFormat values of the images passed to libktx; ktx.h does not include the Vulkan headers
+constexpr uint32_t kVkFormatR8G8B8A8Unorm = 37;
+constexpr uint32_t kVkFormatR8G8B8A8Srgb = 43;
+
+struct CacheHeader {
+  uint32_t magic = kCacheMagic;
+  uint32_t version = kCacheVersion;
+  uint64_t key = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  uint32_t numMipLevels = 0;
+  uint32_t format = 0;
+  uint32_t length = 0;
+  uint32_t reserved = 0;
+};
+
+// FNV-1a; the cache key covers the source file and everything which changes the encoded data
+uint64_t hashBytes(const void* data, size_t length, uint64_t hash = 0xcbf29ce484222325ull) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+bool isAstc(igl::TextureFormat format) {
+  return format == igl::TextureFormat::RGBA_ASTC_4x4 ||
+         format == igl::TextureFormat::SRGB8_A8_ASTC_4x4;
+}
+
+struct KtxDeleter {
+  void operator()(ktxTexture2* p) const {
+    ktxTexture_Destroy(ktxTexture(p));
+  }
+};
+
+struct Job {
+  const uint8_t* source;
+  uint8_t* blocks;
+  uint32_t width;
+  uint32_t height;
+  uint32_t blockRow;
+};
+
+// Jobs of numBlockRows block rows across all mip levels of a 2D texture
+std::vector<Job> makeJobs(const igl::TextureDesc& desc,
+                          igl::TextureFormat sourceFormat,
+                          const uint8_t* rgba,
+                          uint8_t* blocks,
+                          uint32_t numBlockRows) {
+  std::vector<Job> jobs;
+  const auto range = desc.asRange();
+  const auto sourceProperties = igl::TextureFormatProperties::fromTextureFormat(sourceFormat);
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  for (uint32_t mipLevel = 0; mipLevel < desc.numMipLevels; ++mipLevel) {
+    const auto levelRange = range.atMipLevel(mipLevel);
+    const uint8_t* source = rgba + sourceProperties.getSubRangeByteOffset(range, levelRange);
+    uint8_t* dst = blocks + properties.getSubRangeByteOffset(range, levelRange);
+    const uint32_t numLevelBlockRows = (levelRange.height + 3) / 4;
+    for (uint32_t row = 0; row < numLevelBlockRows; row += numBlockRows) {
+      jobs.push_back({source, dst, levelRange.width, levelRange.height, row});
+    }
+  }
+  return jobs;
+}
+
+ktx_uint32_t getAstcQualityLevel(Quality quality) {
+  switch (quality) {
+  case Quality::Fast:
+    return KTX_PACK_ASTC_QUALITY_LEVEL_FAST;
+  case Quality::Balanced:
+    return KTX_PACK_ASTC_QUALITY_LEVEL_MEDIUM;
+  case Quality::Best:
+    return KTX_PACK_ASTC_QUALITY_LEVEL_THOROUGH;
+  }
+  return KTX_PACK_ASTC_QUALITY_LEVEL_MEDIUM;
+}
+
+// Encodes the rows of one job as a separate image. ASTC blocks do not depend on each other, so
+// the blocks are the same as when encoding the whole level; partial blocks at the bottom and
+// right edges are padded by the encoder.
+igl::Result encodeAstcJob(const Job& job, bool srgb, Quality quality) noexcept {
+  const uint32_t y0 = job.blockRow * 4;
+  const uint32_t height = std::min(job.height - y0, kAstcBlockRowsPerJob * 4);
+
+  ktxTextureCreateInfo createInfo = {};
+  createInfo.vkFormat = srgb ? kVkFormatR8G8B8A8Srgb : kVkFormatR8G8B8A8Unorm;
+  createInfo.baseWidth = job.width;
+  createInfo.baseHeight = height;
+  createInfo.baseDepth = 1;
+  createInfo.numDimensions = 2;
+  createInfo.numLevels = 1;
+  createInfo.numLayers = 1;
+  createInfo.numFaces = 1;
+  createInfo.isArray = false;
+  createInfo.generateMipmaps = false;
+
+  ktxTexture2* rawTexture = nullptr;
+  auto ktxResult =
+      ktxTexture2_Create(&createInfo, KTX_TEXTURE_CREATE_ALLOC_STORAGE, &rawTexture);
+  if (ktxResult != KTX_SUCCESS) {
+    return igl::Result{igl::Result::Code::RuntimeError, ktxErrorString(ktxResult)};
+  }
+  const auto texture = std::unique_ptr<ktxTexture2, KtxDeleter>(rawTexture);
+
+  ktxResult = ktxTexture_SetImageFromMemory(ktxTexture(texture.get()),
+                                            0,
+                                            0,
+                                            0,
+                                            job.source + static_cast<size_t>(y0) * job.width * 4,
+                                            static_cast<size_t>(job.width) * height * 4);
+  if (ktxResult == KTX_SUCCESS) {
+    ktxAstcParams params = {};
+    params.structSize = sizeof(params);
+    params.threadCount = 1; // jobs run on the worker pool
+    params.blockDimension = KTX_PACK_ASTC_BLOCK_DIMENSION_4x4;
+    params.mode = KTX_PACK_ASTC_ENCODER_MODE_LDR;
+    params.qualityLevel = getAstcQualityLevel(quality);
+    params.perceptual = srgb;
+    ktxResult = ktxTexture2_CompressAstcEx(texture.get(), &params);
+  }
+  ktx_size_t offset = 0;
+  if (ktxResult == KTX_SUCCESS) {
+    ktxResult = ktxTexture_GetImageOffset(ktxTexture(texture.get()), 0, 0, 0, &offset);
+  }
+  if (ktxResult != KTX_SUCCESS) {
+    return igl::Result{igl::Result::Code::RuntimeError, ktxErrorString(ktxResult)};
+  }
+
+  const size_t numBlocksX = (job.width + 3) / 4;
+  const size_t length = numBlocksX * ((height + 3) / 4) * kBlockSize;
+  if (offset + length > texture->dataSize) {
+    return igl::Result{igl::Result::Code::RuntimeError, "Unexpected ASTC image size."};
+  }
+  std::memcpy(job.blocks + job.blockRow * numBlocksX * kBlockSize,
+              texture->pData + offset,
+              length);
+  return igl::Result{};
+}
+
+std::filesystem::path cachePath(const std::string& directory, uint64_t key) {
+  char name[32];
+  snprintf(name, sizeof(name), "%016llx.bc7", static_cast<unsigned long long>(key));
+  return std::filesystem::path(directory) / name;
+}
+
+class TextureLoader : public ITextureLoader {
+  using Super = ITextureLoader;
+
+ public:
+  TextureLoader(DataReader reader,
+                std::unique_ptr<ITextureLoader> loader,
+                igl::TextureFormat format,
+                const EncoderDesc& desc) noexcept;
+
+  [[nodiscard]] bool shouldGenerateMipmaps() const noexcept final {
+    return false;
+  }
+
+ private:
+  [[nodiscard]] std::unique_ptr<IData> loadInternal(
+      igl::Result* IGL_NULLABLE outResult) const noexcept final;
+
+  [[nodiscard]] std::unique_ptr<IData> readCache(uint64_t key) const noexcept;
+  void writeCache(uint64_t key, const uint8_t* data, uint32_t length) const noexcept;
+  void encodeBc7(const uint8_t* rgba, uint8_t* blocks) const noexcept;
+  [[nodiscard]] igl::Result encodeAstc(const uint8_t* rgba, uint8_t* blocks) const noexcept;
+
+  std::unique_ptr<ITextureLoader> loader_;
+  EncoderDesc desc_;
+};
+
+TextureLoader::TextureLoader(DataReader reader,
+                             std::unique_ptr<ITextureLoader> loader,
+                             igl::TextureFormat format,
+                             const EncoderDesc& desc) noexcept :
+  Super(reader), loader_(std::move(loader)), desc_(desc) {
+  auto& descriptor = mutableDescriptor();
+  descriptor = loader_->descriptor();
+  descriptor.format = format;
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+std::unique_ptr<IData> TextureLoader::loadInternal(
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  const auto& desc = descriptor();
+  const uint32_t length = memorySizeInBytes();
+
+  uint64_t key = 0;
+  if (!desc_.cacheDirectory.empty()) {
+    const uint32_t params[] = {static_cast<uint32_t>(desc.format),
+                               static_cast<uint32_t>(desc_.quality),
+                               desc.numMipLevels,
+                               kCacheVersion};
+    key = hashBytes(reader().data(), reader().size());
+    key = hashBytes(params, sizeof(params), key);
+    if (auto data = readCache(key)) {
+      return data;
+    }
+  }
+
+  auto rgba = loader_->load(outResult);
+  if (!rgba) {
+    return nullptr;
+  }
+
+  // The wrapped loader may leave mipmaps to the GPU, which cannot generate them for BC7 or ASTC
+  std::unique_ptr<uint8_t[]> chain;
+  const uint8_t* source = rgba->data();
+  if (desc.numMipLevels > 1 && loader_->shouldGenerateMipmaps()) {
+    const auto& sourceDesc = loader_->descriptor();
+    const auto properties = igl::TextureFormatProperties::fromTextureFormat(sourceDesc.format);
+    const size_t chainLength = properties.getBytesPerRange(sourceDesc.asRange());
+    chain = std::make_unique<uint8_t[]>(chainLength);
+    std::memcpy(
+        chain.get(), source, properties.getBytesPerRange(sourceDesc.asRange().atMipLevel(0)));
+    auto result = generateMipmaps(sourceDesc, chain.get());
+    if (!result.isOk()) {
+      igl::Result::setResult(outResult, std::move(result));
+      return nullptr;
+    }
+    source = chain.get();
+  }
+
+  auto data = std::make_unique<uint8_t[]>(length);
+  if (!data) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "out of memory.");
+    return nullptr;
+  }
+  if (isAstc(desc.format)) {
+    auto result = encodeAstc(source, data.get());
+    if (!result.isOk()) {
+      igl::Result::setResult(outResult, std::move(result));
+      return nullptr;
+    }
+  } else {
+    encodeBc7(source, data.get());
+  }
+
+  if (!desc_.cacheDirectory.empty()) {
+    writeCache(key, data.get(), length);
+  }
+  return IData::tryCreate(std::move(data), length, outResult);
+}
+
+// Encodes all mip levels; pool threads pick jobs of a few block rows across the whole chain
+void TextureLoader::encodeBc7(const uint8_t* rgba, uint8_t* blocks) const noexcept {
+  static std::once_flag initFlag;
+  std::call_once(initFlag, [] { bc7enc_compress_block_init(); });
+
+  const auto& desc = descriptor();
+  const bool srgb = desc.format == igl::TextureFormat::RGBA_BC7_SRGB_4x4;
+  bc7enc_compress_block_params params;
+  if (srgb) {
+    bc7enc_compress_block_params_init(&params); // perceptual error metric
+  } else {
+    bc7enc_compress_block_params_init_linear_weights(&params);
+  }
+  params.m_max_partitions_mode = desc_.quality == Quality::Fast ? 16 : BC7ENC_MAX_PARTITIONS1;
+  params.m_uber_level = desc_.quality == Quality::Best ? BC7ENC_MAX_UBER_LEVEL : 0;
+
+  const auto jobs =
+      makeJobs(desc, loader_->descriptor().format, rgba, blocks, kBlockRowsPerJob);
+  WorkerPool::getDefault().parallelFor(jobs.size(), desc_.numThreads, [&](size_t i) {
+    uint8_t pixels[16 * 4];
+    const Job& job = jobs[i];
+    const uint32_t numBlocksX = (job.width + 3) / 4;
+    const uint32_t endRow = std::min(job.blockRow + kBlockRowsPerJob, (job.height + 3) / 4);
+    for (uint32_t by = job.blockRow; by < endRow; ++by) {
+      for (uint32_t bx = 0; bx < numBlocksX; ++bx) {
+        // Levels smaller than a block repeat their last row and column
+        for (uint32_t y = 0; y < 4; ++y) {
+          const uint32_t sy = std::min(by * 4 + y, job.height - 1);
+          for (uint32_t x = 0; x < 4; ++x) {
+            const uint32_t sx = std::min(bx * 4 + x, job.width - 1);
+            std::memcpy(pixels + (y * 4 + x) * 4, job.source + (sy * job.width + sx) * 4, 4);
+          }
+        }
+        uint8_t* block = job.blocks + (static_cast<size_t>(by) * numBlocksX + bx) * kBlockSize;
+        bc7enc_compress_block(block, pixels, &params);
+      }
+    }
+  });
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+igl::Result TextureLoader::encodeAstc(const uint8_t* rgba, uint8_t* blocks) const noexcept {
+  const auto& desc = descriptor();
+  const bool srgb = desc.format == igl::TextureFormat::SRGB8_A8_ASTC_4x4;
+  const auto jobs =
+      makeJobs(desc, loader_->descriptor().format, rgba, blocks, kAstcBlockRowsPerJob);
+
+  std::mutex mutex;
+  igl::Result result;
+  WorkerPool::getDefault().parallelFor(jobs.size(), desc_.numThreads, [&](size_t i) {
+    auto jobResult = encodeAstcJob(jobs[i], srgb, desc_.quality);
+    if (!jobResult.isOk()) {
+      const std::lock_guard lock(mutex);
+      if (result.isOk()) {
+        result = std::move(jobResult);
+      }
+    }
+  });
+  return result;
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+std::unique_ptr<IData> TextureLoader::readCache(uint64_t key) const noexcept {
+  std::ifstream file(cachePath(desc_.cacheDirectory, key), std::ios::binary);
+  if (!file) {
+    return nullptr;
+  }
+
+  const auto& desc = descriptor();
+  CacheHeader header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!file || header.magic != kCacheMagic || header.version != kCacheVersion ||
+      header.key != key || header.width != desc.width || header.height != desc.height ||
+      header.numMipLevels != desc.numMipLevels ||
+      header.format != static_cast<uint32_t>(desc.format) ||
+      header.length != memorySizeInBytes()) {
+    return nullptr;
+  }
+
+  auto data = std::make_unique<uint8_t[]>(header.length);
+  file.read(reinterpret_cast<char*>(data.get()), header.length);
+  if (!file) {
+    return nullptr;
+  }
+  return IData::tryCreate(std::move(data), header.length, nullptr);
+}
+
+// Writes to a temporary file first, so concurrent loads never read a partial file
+// NOLINTNEXTLINE(bugprone-exception-escape)
+void TextureLoader::writeCache(uint64_t key, const uint8_t* data, uint32_t length) const noexcept {
+  std::error_code ec;
+  std::filesystem::create_directories(desc_.cacheDirectory, ec);
+
+  const auto& desc = descriptor();
+  const CacheHeader header = {
+      .key = key,
+      .width = static_cast<uint32_t>(desc.width),
+      .height = static_cast<uint32_t>(desc.height),
+      .numMipLevels = desc.numMipLevels,
+      .format = static_cast<uint32_t>(desc.format),
+      .length = length,
+  };
+
+  const auto path = cachePath(desc_.cacheDirectory, key);
+  auto tmpPath = path;
+  tmpPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(data), length);
+    if (!file) {
+      IGL_LOG_ERROR("Could not write BC7 cache file %s\n", tmpPath.string().c_str());
+      file.close();
+      std::filesystem::remove(tmpPath, ec);
+      return;
+    }
+  }
+  std::filesystem::rename(tmpPath, path, ec);
+  if (ec) {
+    std::filesystem::remove(tmpPath, ec);
+  }
+}
+
+} // namespace
+
+TextureLoaderFactory::TextureLoaderFactory(std::unique_ptr<ITextureLoaderFactory> factory,
+                                           EncoderDesc desc) noexcept :
+  factory_(std::move(factory)), desc_(std::move(desc)) {}
+
+uint32_t TextureLoaderFactory::minHeaderLength() const noexcept {
+  return factory_->minHeaderLength();
+}
+
+uint32_t TextureLoaderFactory::maxHeaderLength() const noexcept {
+  return factory_->maxHeaderLength();
+}
+
+bool TextureLoaderFactory::isSupported(const igl::ICapabilities& capabilities) noexcept {
+  return (capabilities.getTextureFormatCapabilities(igl::TextureFormat::RGBA_BC7_UNORM_4x4) &
+          igl::ICapabilities::TextureFormatCapabilityBits::Sampled) != 0;
+}
+
+bool TextureLoaderFactory::isAstcSupported(const igl::ICapabilities& capabilities) noexcept {
+  return (capabilities.getTextureFormatCapabilities(igl::TextureFormat::RGBA_ASTC_4x4) &
+          igl::ICapabilities::TextureFormatCapabilityBits::Sampled) != 0;
+}
+
+bool TextureLoaderFactory::canCreateInternal(DataReader headerReader,
+                                             igl::Result* IGL_NULLABLE outResult) const noexcept {
+  return factory_->canCreate(headerReader, outResult);
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
+    DataReader reader,
+    igl::TextureFormat preferredFormat,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  igl::TextureFormat sourceFormat = igl::TextureFormat::Invalid;
+  if (preferredFormat == igl::TextureFormat::RGBA_BC7_UNORM_4x4 ||
+      preferredFormat == igl::TextureFormat::RGBA_ASTC_4x4) {
+    sourceFormat = igl::TextureFormat::RGBA_UNorm8;
+  } else if (preferredFormat == igl::TextureFormat::RGBA_BC7_SRGB_4x4 ||
+             preferredFormat == igl::TextureFormat::SRGB8_A8_ASTC_4x4) {
+    sourceFormat = igl::TextureFormat::RGBA_SRGB;
+  } else if (preferredFormat != igl::TextureFormat::Invalid) {
+    // An uncompressed format was requested explicitly
+    return factory_->tryCreate(reader, preferredFormat, outResult);
+  }
+
+  auto loader = factory_->tryCreate(reader, sourceFormat, outResult);
+  if (!loader) {
+    return nullptr;
+  }
+
+  const auto& desc = loader->descriptor();
+  const bool canEncode = (desc.format == igl::TextureFormat::RGBA_UNorm8 ||
+                          desc.format == igl::TextureFormat::RGBA_SRGB) &&
+                         desc.type == igl::TextureType::TwoD && desc.numLayers == 1 &&
+                         desc.width % 4 == 0 && desc.height % 4 == 0;
+  if (!canEncode) {
+    return loader;
+  }
+
+  const bool srgb = desc.format == igl::TextureFormat::RGBA_SRGB;
+  igl::TextureFormat format = srgb ? igl::TextureFormat::RGBA_BC7_SRGB_4x4
+                                   : igl::TextureFormat::RGBA_BC7_UNORM_4x4;
+  if (isAstc(preferredFormat)) {
+    format = srgb ? igl::TextureFormat::SRGB8_A8_ASTC_4x4 : igl::TextureFormat::RGBA_ASTC_4x4;
+  }
+  return std::make_unique<TextureLoader>(reader, std::move(loader), format, desc_);
+}
+
+} // namespace iglu::textureloader::bc7
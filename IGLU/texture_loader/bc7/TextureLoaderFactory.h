@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_loader/ITextureLoaderFactory.h>
+#include <string>
+
+namespace igl {
+class ICapabilities;
+} // namespace igl
+
+namespace iglu::textureloader::bc7 {
+
+/// Encoder presets; for ASTC they map to the fast, medium and thorough astcenc quality levels
+enum class Quality : uint8_t {
+  Fast, ///< Fewer partitions searched, for textures loaded at runtime without a cache
+  Balanced,
+  Best, ///< Exhaustive search, several times slower than Balanced
+};
+
+struct EncoderDesc {
+  Quality quality = Quality::Balanced;
+  /// Number of threads encoding one texture; 0 uses all threads of the shared WorkerPool
+  uint32_t numThreads = 0;
+  /// Directory where encoded textures are cached by content hash, so repeated loads of the same
+  /// image only read a file. Empty disables the cache.
+  std::string cacheDirectory;
+};
+
+/**
+ * @brief ITextureLoaderFactory which encodes the RGBA images of another factory to BC7 or ASTC
+ *
+ * Wraps a factory for uncompressed images, e.g. PNG or JPEG, and encodes the loaded images to
+ * RGBA_BC7_UNORM_4x4 or RGBA_BC7_SRGB_4x4 on the CPU, including their full mip chain. Images are
+ * encoded when the wrapped loader produces RGBA_UNorm8 or RGBA_SRGB 2D textures with dimensions
+ * divisible by 4 and the preferred format is Invalid or a BC7 format; other loaders are returned
+ * as they are. Passing RGBA_ASTC_4x4 or SRGB8_A8_ASTC_4x4 as preferred format encodes to ASTC
+ * 4x4 instead, with the astcenc encoder of libktx.
+ *
+ * Only wrap factories with this one on devices where isSupported() returns true, and only request
+ * ASTC where isAstcSupported() does.
+ */
+class TextureLoaderFactory final : public ITextureLoaderFactory {
+ public:
+  explicit TextureLoaderFactory(std::unique_ptr<ITextureLoaderFactory> factory,
+                                EncoderDesc desc = {}) noexcept;
+
+  [[nodiscard]] uint32_t minHeaderLength() const noexcept final;
+  [[nodiscard]] uint32_t maxHeaderLength() const noexcept final;
+
+  /// Returns true if the device can sample BC7 textures
+  [[nodiscard]] static bool isSupported(const igl::ICapabilities& capabilities) noexcept;
+  /// Returns true if the device can sample ASTC 4x4 textures
+  [[nodiscard]] static bool isAstcSupported(const igl::ICapabilities& capabilities) noexcept;
+
+ private:
+  [[nodiscard]] bool canCreateInternal(DataReader headerReader,
+                                       igl::Result* IGL_NULLABLE outResult) const noexcept final;
+
+  [[nodiscard]] std::unique_ptr<ITextureLoader> tryCreateInternal(
+      DataReader reader,
+      igl::TextureFormat preferredFormat,
+      igl::Result* IGL_NULLABLE outResult) const noexcept final;
+
+  std::unique_ptr<ITextureLoaderFactory> factory_;
+  EncoderDesc desc_;
+};
+
+} // namespace iglu::textureloader::bc7
@@ -30,12 +30,19 @@ class TextureLoader : public ITextureLoader {
   TextureLoader(DataReader reader,
                 const igl::TextureRangeDesc& range,
                 igl::TextureFormat format,
-                std::unique_ptr<ktxTexture, KtxDeleter> texture) noexcept;
+                std::unique_ptr<ktxTexture, KtxDeleter> texture,
+                bool needsTranscoding,
+                ktx2::TranscoderDesc transcoderDesc) noexcept;
 
   [[nodiscard]] bool canUploadSourceData() const noexcept final;
   [[nodiscard]] bool shouldGenerateMipmaps() const noexcept final;
 
   [[nodiscard]] size_t getMemorySizeInBytesFromFile(uint32_t miplevel) const noexcept final {
+    if (needsTranscoding_) {
+      return igl::TextureFormatProperties::fromTextureFormat(descriptor().format)
+          .getBytesPerRange(descriptor().asRange().atMipLevel(miplevel));
+    }
+
     // Structure to hold the data for the callback function
     struct Data {
       uint32_t mipLevel = 0;
@@ -87,13 +94,21 @@ class TextureLoader : public ITextureLoader {
                                     igl::Result* IGL_NULLABLE outResult) const noexcept final;
 
   std::unique_ptr<ktxTexture, KtxDeleter> texture_;
+  // Basis Universal images are transcoded when the texture is loaded or uploaded
+  bool needsTranscoding_ = false;
+  ktx2::TranscoderDesc transcoderDesc_;
 };
 
 TextureLoader::TextureLoader(DataReader reader,
                              const igl::TextureRangeDesc& range,
                              igl::TextureFormat format,
-                             std::unique_ptr<ktxTexture, KtxDeleter> texture) noexcept :
-  Super(reader), texture_(std::move(texture)) {
+                             std::unique_ptr<ktxTexture, KtxDeleter> texture,
+                             bool needsTranscoding,
+                             ktx2::TranscoderDesc transcoderDesc) noexcept :
+  Super(reader),
+  texture_(std::move(texture)),
+  needsTranscoding_(needsTranscoding),
+  transcoderDesc_(std::move(transcoderDesc)) {
   auto& desc = mutableDescriptor();
   desc.format = format;
   desc.numLayers = range.numLayers;
@@ -128,6 +143,31 @@ void TextureLoader::uploadInternal(igl::ITexture& texture,
                                    igl::Result* IGL_NULLABLE outResult) const noexcept {
   const auto& desc = descriptor();
 
+  if (needsTranscoding_) {
+    const uint32_t length = memorySizeInBytes();
+    auto data = std::make_unique<uint8_t[]>(length);
+    if (!data) {
+      igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "out of memory.");
+      return;
+    }
+    // Levels are uploaded on this thread as soon as they are transcoded, smallest first
+    igl::Result uploadResult;
+    auto transcoderDesc = transcoderDesc_;
+    transcoderDesc.onLevelTranscoded =
+        [&](uint32_t mipLevel, const uint8_t* IGL_NONNULL levelData, uint32_t levelLength) {
+          auto result = texture.upload(texture.getFullRange(mipLevel), levelData);
+          if (!result.isOk() && uploadResult.isOk()) {
+            uploadResult = std::move(result);
+          }
+          if (transcoderDesc_.onLevelTranscoded) {
+            transcoderDesc_.onLevelTranscoded(mipLevel, levelData, levelLength);
+          }
+        };
+    auto result = ktx2::transcode(reader(), desc, data.get(), transcoderDesc);
+    igl::Result::setResult(outResult, result.isOk() ? std::move(uploadResult) : std::move(result));
+    return;
+  }
+
   size_t offset = 0;
   for (uint32_t mipLevel = 0; mipLevel < desc.numMipLevels && mipLevel < texture_->numLevels;
        ++mipLevel) {
@@ -152,6 +192,11 @@ void TextureLoader::loadToExternalMemoryInternal(uint8_t* IGL_NONNULL data,
                                                      outResult) const noexcept {
   const auto& desc = descriptor();
 
+  if (needsTranscoding_) {
+    igl::Result::setResult(outResult, ktx2::transcode(reader(), desc, data, transcoderDesc_));
+    return;
+  }
+
   size_t offsetDestination = 0;
   size_t offsetSource = 0;
   for (uint32_t mipLevel = 0; mipLevel < desc.numMipLevels && mipLevel < texture_->numLevels;
@@ -206,6 +251,9 @@ void TextureLoader::loadToExternalMemoryInternal(uint8_t* IGL_NONNULL data,
 }
 } // namespace
 
+TextureLoaderFactory::TextureLoaderFactory(ktx2::TranscoderDesc transcoderDesc) noexcept :
+  transcoderDesc_(std::move(transcoderDesc)) {}
+
 // NOLINTNEXTLINE(bugprone-exception-escape)
 std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
     DataReader reader,
@@ -222,9 +270,10 @@ std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
     return nullptr;
   }
 
+  // Image data is loaded below, unless it needs transcoding, which is deferred to load time
   ktxTexture* rawTexture = nullptr;
-  const auto ktxResult = ktxTexture_CreateFromMemory(
-      reader.data(), reader.size(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &rawTexture);
+  auto ktxResult = ktxTexture_CreateFromMemory(
+      reader.data(), reader.size(), KTX_TEXTURE_CREATE_NO_FLAGS, &rawTexture);
 
   if (ktxResult != KTX_SUCCESS || rawTexture == nullptr) {
     IGL_LOG_ERROR("Error loading KTX texture: %d %s\n", ktxResult, ktxErrorString(ktxResult));
@@ -238,25 +287,22 @@ std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
 
   auto texture = std::unique_ptr<ktxTexture, KtxDeleter>(rawTexture);
 
-  if (ktxTexture_NeedsTranscoding(rawTexture)) {
-#if IGL_PLATFORM_ANDROID || IGL_PLATFORM_IOS
-    constexpr ktx_transcode_fmt_e transcodeFormat = KTX_TTF_ASTC_4x4_RGBA;
-#else
-    constexpr ktx_transcode_fmt_e transcodeFormat = KTX_TTF_BC7_RGBA;
-#endif
-    const auto transcodingResult =
-        ktxTexture2_TranscodeBasis(reinterpret_cast<ktxTexture2*>(rawTexture), transcodeFormat, 0);
-    if (transcodingResult != KTX_SUCCESS) {
-      IGL_LOG_ERROR("Error transcoding KTX texture: %d %s\n",
-                    transcodingResult,
-                    ktxErrorString(transcodingResult));
+  const bool needsTranscoding = ktxTexture_NeedsTranscoding(rawTexture);
+  auto format = igl::TextureFormat::Invalid;
+  if (needsTranscoding) {
+    const auto* texture2 = reinterpret_cast<const ktxTexture2*>(rawTexture);
+    format = ktx2::transcodedFormat(KHR_DFDVAL(texture2->pDfd + 1, TRANSFER) ==
+                                    KHR_DF_TRANSFER_SRGB);
+  } else {
+    ktxResult = ktxTexture_LoadImageData(rawTexture, nullptr, 0);
+    if (ktxResult != KTX_SUCCESS) {
+      IGL_LOG_ERROR("Error loading KTX texture: %d %s\n", ktxResult, ktxErrorString(ktxResult));
       igl::Result::setResult(
-          outResult, igl::Result::Code::RuntimeError, "Error transcoding KTX texture.");
+          outResult, igl::Result::Code::RuntimeError, "Error loading KTX texture.");
       return nullptr;
     }
+    format = textureFormat(rawTexture);
   }
-
-  const auto format = textureFormat(rawTexture);
   if (format == igl::TextureFormat::Invalid) {
     igl::Result::setResult(
         outResult, igl::Result::Code::RuntimeError, "Unsupported KTX texture format.");
@@ -293,6 +339,7 @@ std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
     return nullptr;
   }
 
-  return std::make_unique<TextureLoader>(reader, range, format, std::move(texture));
+  return std::make_unique<TextureLoader>(
+      reader, range, format, std::move(texture), needsTranscoding, transcoderDesc_);
 }
 } // namespace iglu::textureloader::ktx
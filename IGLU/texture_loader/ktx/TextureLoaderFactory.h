@@ -8,6 +8,7 @@
 #pragma once
 
 #include <IGLU/texture_loader/ITextureLoaderFactory.h>
+#include <IGLU/texture_loader/ktx2/Transcoder.h>
 
 struct ktxTexture;
 
@@ -19,6 +20,8 @@ namespace iglu::textureloader::ktx {
 class TextureLoaderFactory : public ITextureLoaderFactory {
  protected:
   TextureLoaderFactory() noexcept = default;
+  explicit TextureLoaderFactory(ktx2::TranscoderDesc transcoderDesc) noexcept;
+
   [[nodiscard]] virtual igl::TextureRangeDesc textureRange(DataReader reader) const noexcept = 0;
 
   [[nodiscard]] virtual bool validate(DataReader reader,
@@ -33,6 +36,8 @@ class TextureLoaderFactory : public ITextureLoaderFactory {
       DataReader reader,
       igl::TextureFormat preferredFormat, // Ignored for KTX textures
       igl::Result* IGL_NULLABLE outResult) const noexcept final;
+
+  ktx2::TranscoderDesc transcoderDesc_;
 };
 
 } // namespace iglu::textureloader::ktx
@@ -33,6 +33,9 @@ T align(T offset, T alignment) {
 }
 } // namespace
 
+TextureLoaderFactory::TextureLoaderFactory(TranscoderDesc transcoderDesc) noexcept :
+  ktx::TextureLoaderFactory(std::move(transcoderDesc)) {}
+
 uint32_t TextureLoaderFactory::minHeaderLength() const noexcept {
   return kHeaderLength;
 }
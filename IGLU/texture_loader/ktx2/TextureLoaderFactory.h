@@ -19,6 +19,8 @@ namespace iglu::textureloader::ktx2 {
 class TextureLoaderFactory final : public ktx::TextureLoaderFactory {
  public:
   explicit TextureLoaderFactory() noexcept = default;
+  /// Basis Universal textures are transcoded in parallel as described by transcoderDesc
+  explicit TextureLoaderFactory(TranscoderDesc transcoderDesc) noexcept;
 
   [[nodiscard]] uint32_t minHeaderLength() const noexcept final;
 
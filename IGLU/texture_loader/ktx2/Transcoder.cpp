@@ -0,0 +1,495 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/texture_loader/ktx2/Transcoder.h>
+
+#include <IGLU/texture_loader/WorkerPool.h>
+#include <IGLU/texture_loader/ktx2/Header.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <ktx.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iglu::textureloader::ktx2 {
+namespace {
+
+constexpr uint32_t kLevelIndexLength = 24;
+
+struct LevelIndex {
+  uint64_t byteOffset;
+  uint64_t byteLength;
+  uint64_t uncompressedByteLength;
+};
+static_assert(sizeof(LevelIndex) == kLevelIndexLength);
+
+// BasisLZ supercompression global data: this header, one ImageDesc per image of every level, then
+// the codebooks shared by all images
+struct BasisLzGlobalHeader {
+  uint16_t endpointCount;
+  uint16_t selectorCount;
+  uint32_t endpointsByteLength;
+  uint32_t selectorsByteLength;
+  uint32_t tablesByteLength;
+  uint32_t extendedByteLength;
+};
+static_assert(sizeof(BasisLzGlobalHeader) == 20);
+
+struct BasisLzImageDesc {
+  uint32_t imageFlags;
+  uint32_t rgbSliceByteOffset;
+  uint32_t rgbSliceByteLength;
+  uint32_t alphaSliceByteOffset;
+  uint32_t alphaSliceByteLength;
+};
+static_assert(sizeof(BasisLzImageDesc) == 20);
+
+template<typename T>
+T align(T offset, T alignment) {
+  return (offset + (alignment - 1)) & ~(alignment - 1);
+}
+
+struct KtxDeleter {
+  void operator()(ktxTexture2* p) const {
+    ktxTexture_Destroy(ktxTexture(p));
+  }
+};
+
+struct Job {
+  uint32_t mipLevel = 0;
+  uint32_t layer = 0;
+  uint32_t face = 0;
+};
+
+// The data of the single level of a container, and the metadata describing it
+struct ContainerLevel {
+  const uint8_t* data = nullptr;
+  uint64_t byteLength = 0;
+  uint64_t uncompressedByteLength = 0;
+  uint32_t supercompressionScheme = KTX_SS_NONE;
+  // Starts with dfdTotalSize
+  const uint32_t* dfd = nullptr;
+  // BasisLZ descriptors of the images of the level
+  const BasisLzImageDesc* imageDescs = nullptr;
+};
+
+// The parts of a Basis Universal KTX2 file needed to transcode its images independently
+class File {
+ public:
+  explicit File(DataReader reader) noexcept : reader_(reader) {}
+
+  igl::Result parse(const igl::TextureDesc& desc) noexcept;
+
+  // Writes a KTX2 file holding the whole supercompressed level, for libktx to inflate it
+  void makeLevelContainer(uint32_t mipLevel, std::vector<uint8_t>& container) const noexcept;
+
+  // Writes a KTX2 file holding only the image of job. inflatedLevel is the level of job inflated
+  // by libktx for zstd and zlib supercompressed files, and nullptr otherwise.
+  void makeImageContainer(const Job& job,
+                          const ktxTexture2* IGL_NULLABLE inflatedLevel,
+                          std::vector<uint8_t>& container) const noexcept;
+
+  [[nodiscard]] bool isSupercompressedPerLevel() const noexcept {
+    return header_.supercompressionScheme == KTX_SS_ZSTD ||
+           header_.supercompressionScheme == KTX_SS_ZLIB;
+  }
+  [[nodiscard]] uint32_t numLevels() const noexcept {
+    return numLevels_;
+  }
+
+ private:
+  [[nodiscard]] const BasisLzImageDesc& imageDesc(uint32_t mipLevel,
+                                                  uint32_t layer,
+                                                  uint32_t face) const noexcept;
+
+  void writeContainer(uint32_t mipLevel,
+                      bool wholeLevel,
+                      const ContainerLevel& level,
+                      std::vector<uint8_t>& container) const noexcept;
+
+  DataReader reader_;
+  Header header_ = {};
+  const LevelIndex* levels_ = nullptr;
+  uint32_t numLevels_ = 0;
+  uint32_t numLayers_ = 0;
+  uint32_t numFaces_ = 0;
+  // Offset of the BasisLZ codebooks, shared by all images, in the global data
+  uint32_t codebooksOffset_ = 0;
+};
+
+igl::Result File::parse(const igl::TextureDesc& desc) noexcept {
+  if (reader_.size() < kHeaderLength) {
+    return igl::Result{igl::Result::Code::InvalidOperation, "Not enough data for header."};
+  }
+  header_ = reader_.read<Header>();
+  numLayers_ = std::max(header_.layerCount, 1u);
+  numFaces_ = header_.faceCount;
+  const uint32_t numFileLevels = std::max(header_.levelCount, 1u);
+  numLevels_ = std::min(numFileLevels, desc.numMipLevels);
+
+  if (header_.pixelDepth > 1) {
+    return igl::Result{igl::Result::Code::Unsupported,
+                       "3D Basis Universal textures are not supported."};
+  }
+  if (header_.supercompressionScheme != KTX_SS_NONE &&
+      header_.supercompressionScheme != KTX_SS_BASIS_LZ && !isSupercompressedPerLevel()) {
+    return igl::Result{igl::Result::Code::Unsupported, "Unsupported supercompression scheme."};
+  }
+  if (numLayers_ != desc.numLayers ||
+      numFaces_ != (desc.type == igl::TextureType::Cube ? 6u : 1u)) {
+    return igl::Result{igl::Result::Code::InvalidOperation, "Texture descriptor mismatch."};
+  }
+
+  const uint64_t length = reader_.size();
+  if (kHeaderLength + uint64_t(numFileLevels) * kLevelIndexLength > length ||
+      uint64_t(header_.dfdByteOffset) + header_.dfdByteLength > length ||
+      header_.dfdByteLength < sizeof(uint32_t) || header_.sgdByteLength > length ||
+      header_.sgdByteOffset > length - header_.sgdByteLength) {
+    return igl::Result{igl::Result::Code::InvalidOperation, "Length is too short."};
+  }
+  levels_ = reader_.asAt<LevelIndex>(kHeaderLength);
+
+  const uint32_t numImagesPerLevel = numLayers_ * numFaces_;
+  for (uint32_t mipLevel = 0; mipLevel < numLevels_; ++mipLevel) {
+    const auto& level = levels_[mipLevel];
+    if (level.byteLength > length || level.byteOffset > length - level.byteLength) {
+      return igl::Result{igl::Result::Code::InvalidOperation, "Length is too short."};
+    }
+    if (header_.supercompressionScheme == KTX_SS_NONE &&
+        level.byteLength % numImagesPerLevel != 0) {
+      return igl::Result{igl::Result::Code::InvalidOperation, "Unexpected byteLength."};
+    }
+  }
+
+  if (header_.supercompressionScheme == KTX_SS_BASIS_LZ) {
+    const uint64_t numImages = uint64_t(numFileLevels) * numImagesPerLevel;
+    if (header_.sgdByteLength <
+        sizeof(BasisLzGlobalHeader) + numImages * sizeof(BasisLzImageDesc)) {
+      return igl::Result{igl::Result::Code::InvalidOperation, "Length is too short."};
+    }
+    codebooksOffset_ =
+        static_cast<uint32_t>(sizeof(BasisLzGlobalHeader) + numImages * sizeof(BasisLzImageDesc));
+    for (uint32_t mipLevel = 0; mipLevel < numLevels_; ++mipLevel) {
+      for (uint32_t layer = 0; layer < numLayers_; ++layer) {
+        for (uint32_t face = 0; face < numFaces_; ++face) {
+          const auto& image = imageDesc(mipLevel, layer, face);
+          const uint64_t levelLength = levels_[mipLevel].byteLength;
+          if (uint64_t(image.rgbSliceByteOffset) + image.rgbSliceByteLength > levelLength ||
+              uint64_t(image.alphaSliceByteOffset) + image.alphaSliceByteLength > levelLength) {
+            return igl::Result{igl::Result::Code::InvalidOperation, "Unexpected slice length."};
+          }
+        }
+      }
+    }
+  }
+
+  return igl::Result{};
+}
+
+const BasisLzImageDesc& File::imageDesc(uint32_t mipLevel,
+                                        uint32_t layer,
+                                        uint32_t face) const noexcept {
+  // Images are ordered by mip level, then layer, then face
+  const uint32_t index = (mipLevel * numLayers_ + layer) * numFaces_ + face;
+  return *reader_.asAt<BasisLzImageDesc>(static_cast<uint32_t>(header_.sgdByteOffset) +
+                                         sizeof(BasisLzGlobalHeader) +
+                                         index * sizeof(BasisLzImageDesc));
+}
+
+void File::makeLevelContainer(uint32_t mipLevel,
+                              std::vector<uint8_t>& container) const noexcept {
+  const auto& level = levels_[mipLevel];
+  writeContainer(mipLevel,
+                 true,
+                 {.data = reader_.at(static_cast<uint32_t>(level.byteOffset)),
+                  .byteLength = level.byteLength,
+                  .uncompressedByteLength = level.uncompressedByteLength,
+                  .supercompressionScheme = header_.supercompressionScheme,
+                  .dfd = reader_.asAt<uint32_t>(header_.dfdByteOffset)},
+                 container);
+}
+
+void File::makeImageContainer(const Job& job,
+                              const ktxTexture2* IGL_NULLABLE inflatedLevel,
+                              std::vector<uint8_t>& container) const noexcept {
+  const auto& level = levels_[job.mipLevel];
+  const uint32_t numImagesPerLevel = numLayers_ * numFaces_;
+  const uint32_t imageIndex = job.layer * numFaces_ + job.face;
+
+  if (inflatedLevel != nullptr) {
+    // libktx updated the DFD of the inflated level for the uncompressed data
+    const uint64_t imageLength = inflatedLevel->dataSize / numImagesPerLevel;
+    writeContainer(job.mipLevel,
+                   false,
+                   {.data = inflatedLevel->pData + imageIndex * imageLength,
+                    .byteLength = imageLength,
+                    .uncompressedByteLength = imageLength,
+                    .dfd = inflatedLevel->pDfd},
+                   container);
+  } else if (header_.supercompressionScheme == KTX_SS_BASIS_LZ) {
+    // Only the slices of the image are copied, so their offsets become relative to them. The
+    // codebooks are copied from the global data of this file.
+    BasisLzImageDesc image = imageDesc(job.mipLevel, job.layer, job.face);
+    uint32_t begin = image.rgbSliceByteOffset;
+    uint32_t end = image.rgbSliceByteOffset + image.rgbSliceByteLength;
+    if (image.alphaSliceByteLength != 0) {
+      begin = std::min(begin, image.alphaSliceByteOffset);
+      end = std::max(end, image.alphaSliceByteOffset + image.alphaSliceByteLength);
+      image.alphaSliceByteOffset -= begin;
+    }
+    image.rgbSliceByteOffset -= begin;
+    writeContainer(job.mipLevel,
+                   false,
+                   {.data = reader_.at(static_cast<uint32_t>(level.byteOffset) + begin),
+                    .byteLength = end - begin,
+                    .supercompressionScheme = KTX_SS_BASIS_LZ,
+                    .dfd = reader_.asAt<uint32_t>(header_.dfdByteOffset),
+                    .imageDescs = &image},
+                   container);
+  } else {
+    const uint64_t imageLength = level.byteLength / numImagesPerLevel;
+    writeContainer(
+        job.mipLevel,
+        false,
+        {.data = reader_.at(static_cast<uint32_t>(level.byteOffset + imageIndex * imageLength)),
+         .byteLength = imageLength,
+         .uncompressedByteLength = imageLength,
+         .dfd = reader_.asAt<uint32_t>(header_.dfdByteOffset)},
+        container);
+  }
+}
+
+// Writes a KTX2 file with one level holding either the image of layer 0 and face 0 or, when
+// wholeLevel is set, all images of mipLevel
+// NOLINTNEXTLINE(bugprone-exception-escape)
+void File::writeContainer(uint32_t mipLevel,
+                          bool wholeLevel,
+                          const ContainerLevel& level,
+                          std::vector<uint8_t>& container) const noexcept {
+  const uint32_t numImages = wholeLevel ? numLayers_ * numFaces_ : 1;
+  const uint32_t imagesLength = numImages * sizeof(BasisLzImageDesc);
+  const uint32_t codebooksLength = static_cast<uint32_t>(header_.sgdByteLength) - codebooksOffset_;
+  const uint32_t sgdLength = level.imageDescs != nullptr
+                                 ? sizeof(BasisLzGlobalHeader) + imagesLength + codebooksLength
+                                 : 0;
+
+  Header header = header_;
+  header.pixelWidth = std::max(header_.pixelWidth >> mipLevel, 1u);
+  header.pixelHeight = header_.pixelHeight != 0 ? std::max(header_.pixelHeight >> mipLevel, 1u)
+                                                : 0;
+  header.layerCount = wholeLevel ? header_.layerCount : 0;
+  header.faceCount = wholeLevel ? header_.faceCount : 1;
+  header.levelCount = 1;
+  header.supercompressionScheme = level.supercompressionScheme;
+  header.dfdByteOffset = kHeaderLength + kLevelIndexLength;
+  header.dfdByteLength = level.dfd[0];
+  header.kvdByteOffset = 0;
+  header.kvdByteLength = 0;
+  const uint32_t dfdEnd = header.dfdByteOffset + header.dfdByteLength;
+  header.sgdByteOffset = sgdLength != 0 ? align(dfdEnd, 8u) : 0;
+  header.sgdByteLength = sgdLength;
+  const LevelIndex levelIndex = {
+      .byteOffset = align(sgdLength != 0 ? header.sgdByteOffset + sgdLength : uint64_t(dfdEnd),
+                          uint64_t(16)),
+      .byteLength = level.byteLength,
+      .uncompressedByteLength = level.uncompressedByteLength,
+  };
+
+  container.assign(static_cast<size_t>(levelIndex.byteOffset + levelIndex.byteLength), 0);
+  uint8_t* dst = container.data();
+  std::memcpy(dst, &header, sizeof(header));
+  std::memcpy(dst + kHeaderLength, &levelIndex, sizeof(levelIndex));
+  std::memcpy(dst + header.dfdByteOffset, level.dfd, header.dfdByteLength);
+  if (sgdLength != 0) {
+    // The global header, the descriptors of the images, then the codebooks
+    const uint32_t sgdOffset = static_cast<uint32_t>(header_.sgdByteOffset);
+    uint8_t* sgd = dst + header.sgdByteOffset;
+    std::memcpy(sgd, reader_.at(sgdOffset), sizeof(BasisLzGlobalHeader));
+    std::memcpy(sgd + sizeof(BasisLzGlobalHeader), level.imageDescs, imagesLength);
+    std::memcpy(sgd + sizeof(BasisLzGlobalHeader) + imagesLength,
+                reader_.at(sgdOffset + codebooksOffset_),
+                codebooksLength);
+  }
+  std::memcpy(dst + levelIndex.byteOffset, level.data, static_cast<size_t>(level.byteLength));
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+igl::Result loadContainer(const std::vector<uint8_t>& container,
+                          std::unique_ptr<ktxTexture2, KtxDeleter>& texture) noexcept {
+  ktxTexture2* rawTexture = nullptr;
+  const auto ktxResult = ktxTexture2_CreateFromMemory(
+      container.data(), container.size(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &rawTexture);
+  texture.reset(rawTexture);
+  if (ktxResult != KTX_SUCCESS || rawTexture == nullptr) {
+    IGL_LOG_ERROR("Error loading KTX texture: %d %s\n", ktxResult, ktxErrorString(ktxResult));
+    return igl::Result{igl::Result::Code::RuntimeError, "Error loading KTX texture."};
+  }
+  return igl::Result{};
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+igl::Result transcodeJob(const File& file,
+                         const Job& job,
+                         const ktxTexture2* IGL_NULLABLE inflatedLevel,
+                         const igl::TextureDesc& desc,
+                         ktx_transcode_fmt_e format,
+                         std::vector<uint8_t>& container,
+                         uint8_t* IGL_NONNULL data) noexcept {
+  file.makeImageContainer(job, inflatedLevel, container);
+
+  std::unique_ptr<ktxTexture2, KtxDeleter> texture;
+  auto result = loadContainer(container, texture);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  auto ktxResult = ktxTexture2_TranscodeBasis(texture.get(), format, 0);
+  if (ktxResult != KTX_SUCCESS) {
+    IGL_LOG_ERROR("Error transcoding KTX texture: %d %s\n", ktxResult, ktxErrorString(ktxResult));
+    return igl::Result{igl::Result::Code::RuntimeError, "Error transcoding KTX texture."};
+  }
+
+  const auto range = desc.asRange();
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  const auto imageRange = range.atMipLevel(job.mipLevel).atLayer(job.layer).atFace(job.face);
+  const size_t imageLength = properties.getBytesPerRange(imageRange);
+  size_t offset = 0;
+  ktxResult = ktxTexture_GetImageOffset(ktxTexture(texture.get()), 0, 0, 0, &offset);
+  if (ktxResult != KTX_SUCCESS || offset + imageLength > texture->dataSize) {
+    return igl::Result{igl::Result::Code::RuntimeError, "Error getting KTX texture data."};
+  }
+  std::memcpy(data + properties.getSubRangeByteOffset(range, imageRange),
+              texture->pData + offset,
+              imageLength);
+
+  return igl::Result{};
+}
+
+} // namespace
+
+igl::TextureFormat transcodedFormat(bool srgb) noexcept {
+#if IGL_PLATFORM_ANDROID || IGL_PLATFORM_IOS
+  return srgb ? igl::TextureFormat::SRGB8_A8_ASTC_4x4 : igl::TextureFormat::RGBA_ASTC_4x4;
+#else
+  return srgb ? igl::TextureFormat::RGBA_BC7_SRGB_4x4 : igl::TextureFormat::RGBA_BC7_UNORM_4x4;
+#endif
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+igl::Result transcode(DataReader reader,
+                      const igl::TextureDesc& desc,
+                      uint8_t* IGL_NONNULL data,
+                      const TranscoderDesc& transcoderDesc) noexcept {
+  ktx_transcode_fmt_e format = KTX_TTF_BC7_RGBA;
+  if (desc.format == igl::TextureFormat::RGBA_ASTC_4x4 ||
+      desc.format == igl::TextureFormat::SRGB8_A8_ASTC_4x4) {
+    format = KTX_TTF_ASTC_4x4_RGBA;
+  } else if (desc.format != igl::TextureFormat::RGBA_BC7_UNORM_4x4 &&
+             desc.format != igl::TextureFormat::RGBA_BC7_SRGB_4x4) {
+    return igl::Result{igl::Result::Code::Unsupported, "Unsupported transcoding format."};
+  }
+
+  File file(reader);
+  auto result = file.parse(desc);
+  if (!result.isOk()) {
+    return result;
+  }
+
+  // Zstd and zlib supercompress whole levels: inflate each level once, on the workers, so that its
+  // images can be transcoded as separate jobs below
+  std::vector<std::unique_ptr<ktxTexture2, KtxDeleter>> inflatedLevels(file.numLevels());
+  if (file.isSupercompressedPerLevel()) {
+    std::mutex mutex;
+    WorkerPool::getDefault().parallelFor(
+        file.numLevels(), transcoderDesc.numThreads, [&](size_t i) {
+          const auto mipLevel = static_cast<uint32_t>(file.numLevels() - i - 1);
+          std::vector<uint8_t> container;
+          file.makeLevelContainer(mipLevel, container);
+          auto levelResult = loadContainer(container, inflatedLevels[mipLevel]);
+          if (!levelResult.isOk()) {
+            const std::lock_guard lock(mutex);
+            result = std::move(levelResult);
+          }
+        });
+    if (!result.isOk()) {
+      return result;
+    }
+  }
+
+  // One job per image, smallest levels first, so they are ready early
+  std::vector<Job> jobs;
+  std::vector<uint32_t> numRemainingJobs(file.numLevels());
+  for (uint32_t i = 0; i < file.numLevels(); ++i) {
+    const uint32_t mipLevel = file.numLevels() - i - 1;
+    for (uint32_t layer = 0; layer < desc.numLayers; ++layer) {
+      for (uint32_t face = 0; face < (desc.type == igl::TextureType::Cube ? 6u : 1u); ++face) {
+        jobs.push_back({.mipLevel = mipLevel, .layer = layer, .face = face});
+        ++numRemainingJobs[mipLevel];
+      }
+    }
+  }
+
+  const auto range = desc.asRange();
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  auto reportLevel = [&](uint32_t mipLevel) {
+    if (transcoderDesc.onLevelTranscoded) {
+      const auto levelRange = range.atMipLevel(mipLevel);
+      transcoderDesc.onLevelTranscoded(
+          mipLevel,
+          data + properties.getSubRangeByteOffset(range, levelRange),
+          static_cast<uint32_t>(properties.getBytesPerRange(levelRange)));
+    }
+  };
+
+  // Levels completed on workers are reported by the calling thread between its own jobs, or once
+  // all jobs are done
+  const auto callingThread = std::this_thread::get_id();
+  std::mutex mutex;
+  std::vector<uint32_t> completedLevels;
+  std::atomic<bool> failed = false;
+  auto reportCompletedLevels = [&]() {
+    std::unique_lock lock(mutex);
+    while (!completedLevels.empty() && !failed) {
+      const uint32_t mipLevel = completedLevels.front();
+      completedLevels.erase(completedLevels.begin());
+      lock.unlock();
+      reportLevel(mipLevel);
+      lock.lock();
+    }
+  };
+
+  WorkerPool::getDefault().parallelFor(jobs.size(), transcoderDesc.numThreads, [&](size_t i) {
+    if (failed) {
+      return;
+    }
+    std::vector<uint8_t> container;
+    const Job& job = jobs[i];
+    auto jobResult = transcodeJob(
+        file, job, inflatedLevels[job.mipLevel].get(), desc, format, container, data);
+    {
+      const std::lock_guard lock(mutex);
+      if (!jobResult.isOk()) {
+        if (!failed) {
+          result = std::move(jobResult);
+          failed = true;
+        }
+      } else if (--numRemainingJobs[job.mipLevel] == 0) {
+        completedLevels.push_back(job.mipLevel);
+      }
+    }
+    if (std::this_thread::get_id() == callingThread) {
+      reportCompletedLevels();
+    }
+  });
+  reportCompletedLevels();
+
+  return result;
+}
+
+} // namespace iglu::textureloader::ktx2
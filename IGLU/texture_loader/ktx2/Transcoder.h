@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/texture_loader/DataReader.h>
+#include <functional>
+#include <igl/Texture.h>
+
+namespace iglu::textureloader::ktx2 {
+
+/// Called with the data of one mip level, laid out as in ITextureLoader::load(), as soon as all of
+/// its images are transcoded
+using LevelCallback =
+    std::function<void(uint32_t mipLevel, const uint8_t* IGL_NONNULL data, uint32_t length)>;
+
+struct TranscoderDesc {
+  /// Number of threads transcoding one texture; 0 uses all threads of the shared WorkerPool
+  uint32_t numThreads = 0;
+  /// Optional; called on the thread which loads the texture between its own transcoding jobs,
+  /// while the workers keep transcoding.
+  /// Levels complete smallest first, so the small mips can be uploaded and sampled before the
+  /// largest level is ready.
+  LevelCallback onLevelTranscoded;
+};
+
+/// Returns the format Basis Universal textures are transcoded to on this platform
+[[nodiscard]] igl::TextureFormat transcodedFormat(bool srgb) noexcept;
+
+/**
+ * @brief Transcodes the Basis Universal images of a KTX2 file to desc.format
+ *
+ * The work is split into one job per (mip level, layer, face). Zstd and zlib supercompressed
+ * files are first inflated level by level on the workers; the images of BasisLZ files are
+ * transcoded with the codebooks shared by the whole file. data must hold desc.asRange() in
+ * desc.format.
+ */
+[[nodiscard]] igl::Result transcode(DataReader reader,
+                                    const igl::TextureDesc& desc,
+                                    uint8_t* IGL_NONNULL data,
+                                    const TranscoderDesc& transcoderDesc) noexcept;
+
+} // namespace iglu::textureloader::ktx2
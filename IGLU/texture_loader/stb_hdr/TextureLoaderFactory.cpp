@@ -8,6 +8,7 @@
 #include <IGLU/texture_loader/stb_hdr/TextureLoaderFactory.h>
 
 #include <IGLU/texture_loader/stb_hdr/Header.h>
+#include <igl/DeviceFeatures.h>
 
 namespace iglu::textureloader::stb::hdr {
 
@@ -17,6 +18,17 @@ uint32_t TextureLoaderFactory::minHeaderLength() const noexcept {
   return kHeaderLength;
 }
 
+igl::TextureFormat TextureLoaderFactory::preferredFormat(
+    const igl::ICapabilities& capabilities) noexcept {
+  for (const auto format : {igl::TextureFormat::R9G9B9E5_F, igl::TextureFormat::RGBA_F16}) {
+    if (capabilities.getTextureFormatCapabilities(format) &
+        igl::ICapabilities::TextureFormatCapabilityBits::SampledFiltered) {
+      return format;
+    }
+  }
+  return igl::TextureFormat::RGBA_F32;
+}
+
 bool TextureLoaderFactory::isIdentifierValid(DataReader headerReader) const noexcept {
   const Header* header = headerReader.as<Header>();
   return header->tagIsValid();
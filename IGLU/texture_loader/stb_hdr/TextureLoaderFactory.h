@@ -9,12 +9,18 @@
 
 #include <IGLU/texture_loader/stb_image/TextureLoaderFactory.h>
 
+namespace igl {
+class ICapabilities;
+} // namespace igl
+
 namespace iglu::textureloader::stb::hdr {
 
 /**
  * @brief ITextureLoaderFactory implementation for Radiance HDR files
  * @note File format specification:
  *   https://radsite.lbl.gov/radiance/refer/filefmts.pdf
+ * @note Images are converted to RGBA_F32 unless RGBA_F16 or R9G9B9E5_F is passed as preferred
+ * format, and always come with a full mip chain filtered on the CPU.
  */
 
 class TextureLoaderFactory final : public image::TextureLoaderFactory {
@@ -23,6 +29,11 @@ class TextureLoaderFactory final : public image::TextureLoaderFactory {
 
   [[nodiscard]] uint32_t minHeaderLength() const noexcept final;
 
+  /// Returns the most compact format which the device can sample with filtering: R9G9B9E5_F,
+  /// RGBA_F16 or RGBA_F32. Pass it as preferred format to tryCreate().
+  [[nodiscard]] static igl::TextureFormat preferredFormat(
+      const igl::ICapabilities& capabilities) noexcept;
+
  private:
   [[nodiscard]] bool isIdentifierValid(DataReader headerReader) const noexcept final;
 };
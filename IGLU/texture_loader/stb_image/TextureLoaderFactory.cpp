@@ -7,6 +7,9 @@
 
 #include <IGLU/texture_loader/stb_image/TextureLoaderFactory.h>
 
+#include <IGLU/texture_loader/MipmapGenerator.h>
+#include <cstring>
+
 #ifdef WIN32
 #define STBI_MSC_SECURE_CRT
 #endif
@@ -65,6 +68,7 @@ class TextureLoader : public ITextureLoader {
                          int width,
                          int height,
                          bool isFloatFormat,
+                         std::optional<MipmapGeneratorDesc> mipmapDesc,
                          igl::TextureFormat preferredFormat) noexcept;
 
   [[nodiscard]] bool canUploadSourceData() const noexcept final;
@@ -73,37 +77,58 @@ class TextureLoader : public ITextureLoader {
  private:
   std::unique_ptr<IData> loadInternal(igl::Result* IGL_NULLABLE outResult) const noexcept final;
 
+  [[nodiscard]] std::unique_ptr<IData> loadFloat(
+      igl::Result* IGL_NULLABLE outResult) const noexcept;
+  [[nodiscard]] std::unique_ptr<IData> loadMipChain(
+      const uint8_t* IGL_NONNULL level0,
+      igl::Result* IGL_NULLABLE outResult) const noexcept;
+
   bool isFloatFormat_;
+  std::optional<MipmapGeneratorDesc> mipmapDesc_;
 };
 
+[[nodiscard]] bool isSupportedFloatFormat(igl::TextureFormat format) noexcept {
+  return format == igl::TextureFormat::RGBA_F32 || format == igl::TextureFormat::RGBA_F16 ||
+         format == igl::TextureFormat::R9G9B9E5_F;
+}
+
 TextureLoader::TextureLoader(DataReader reader,
                              int width,
                              int height,
                              bool isFloatFormat,
+                             std::optional<MipmapGeneratorDesc> mipmapDesc,
                              igl::TextureFormat preferredFormat) noexcept :
-  Super(reader), isFloatFormat_(isFloatFormat) {
+  Super(reader), isFloatFormat_(isFloatFormat), mipmapDesc_(mipmapDesc) {
   auto& desc = mutableDescriptor();
-  desc.format =
-      preferredFormat != igl::TextureFormat::Invalid
-          ? preferredFormat
-          : (isFloatFormat ? igl::TextureFormat::RGBA_F32 : igl::TextureFormat::RGBA_UNorm8);
+  if (isFloatFormat) {
+    // Float images are converted on the CPU, so only formats with a conversion can be requested
+    desc.format = isSupportedFloatFormat(preferredFormat) ? preferredFormat
+                                                          : igl::TextureFormat::RGBA_F32;
+  } else {
+    desc.format = preferredFormat != igl::TextureFormat::Invalid ? preferredFormat
+                                                                 : igl::TextureFormat::RGBA_UNorm8;
+  }
   desc.numLayers = 1;
   desc.width = static_cast<size_t>(width);
   desc.height = static_cast<size_t>(height);
   desc.depth = 1;
   desc.type = igl::TextureType::TwoD;
-
-  // Floating point mipmaps not always supported
-  desc.numMipLevels = isFloatFormat ? 1
-                                    : igl::TextureDesc::calcNumMipLevels(desc.width, desc.height);
+  desc.numMipLevels = igl::TextureDesc::calcNumMipLevels(desc.width, desc.height);
 }
 
 bool TextureLoader::canUploadSourceData() const noexcept {
   return false;
 }
 
+// Float images are always filtered on the CPU, since the GPU may not generate mipmaps for float
+// formats. 8-bit images are when the factory opted in and the decoded texels can be stored as is.
 bool TextureLoader::shouldGenerateMipmaps() const noexcept {
-  return descriptor().numMipLevels > 1;
+  const auto format = descriptor().format;
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(format);
+  const bool cpuMipmaps =
+      isFloatFormat_ || (mipmapDesc_.has_value() && isMipmapGenerationSupported(format) &&
+                         properties.bytesPerBlock == 4);
+  return descriptor().numMipLevels > 1 && !cpuMipmaps;
 }
 
 // NOLINTNEXTLINE(bugprone-exception-escape)
@@ -113,25 +138,88 @@ std::unique_ptr<IData> TextureLoader::loadInternal(
   const int length = r.size() > std::numeric_limits<int>::max() ? std::numeric_limits<int>::max()
                                                                 : static_cast<int>(r.size());
 
-  int x = 0, y = 0, comp = 0;
-  void* data = nullptr;
-  // Pass 4 for desired_channels to force RGBA instead of RGB.
   if (isFloatFormat_) {
-    data = stbi_loadf_from_memory(r.data(), static_cast<int>(length), &x, &y, &comp, 4);
-  } else {
-    data = stbi_load_from_memory(r.data(), static_cast<int>(length), &x, &y, &comp, 4);
+    return loadFloat(outResult);
   }
+
+  int x = 0, y = 0, comp = 0;
+  // Pass 4 for desired_channels to force RGBA instead of RGB.
+  void* data = stbi_load_from_memory(r.data(), static_cast<int>(length), &x, &y, &comp, 4);
   if (data == nullptr) {
     igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "Could not load image daa.");
     return nullptr;
   }
 
-  return std::make_unique<StbImageData>(reinterpret_cast<uint8_t*>(data), memorySizeInBytes());
+  auto image = std::make_unique<StbImageData>(reinterpret_cast<uint8_t*>(data),
+                                              memorySizeInBytes());
+  if (shouldGenerateMipmaps() || descriptor().numMipLevels == 1) {
+    return image;
+  }
+  return loadMipChain(image->data(), outResult);
+}
+
+// Copies level 0 into a buffer for the full mip chain and generates the other levels
+// NOLINTNEXTLINE(bugprone-exception-escape)
+std::unique_ptr<IData> TextureLoader::loadMipChain(
+    const uint8_t* IGL_NONNULL level0,
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  const auto& desc = descriptor();
+  const uint32_t numBytes = memorySizeInBytes();
+  auto data = std::make_unique<uint8_t[]>(numBytes);
+  if (!data) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "out of memory.");
+    return nullptr;
+  }
+
+  const auto properties = igl::TextureFormatProperties::fromTextureFormat(desc.format);
+  std::memcpy(data.get(), level0, properties.getBytesPerRange(desc.asRange().atMipLevel(0)));
+  auto result = generateMipmaps(desc, data.get(), mipmapDesc_.value_or(MipmapGeneratorDesc{}));
+  if (!result.isOk()) {
+    igl::Result::setResult(outResult, std::move(result));
+    return nullptr;
+  }
+
+  return IData::tryCreate(std::move(data), numBytes, outResult);
+}
+
+// Decodes to RGBA float and builds every level of the mip chain from the float data, so compact
+// formats are quantized once
+// NOLINTNEXTLINE(bugprone-exception-escape)
+std::unique_ptr<IData> TextureLoader::loadFloat(
+    igl::Result* IGL_NULLABLE outResult) const noexcept {
+  const auto r = reader();
+  const int length = r.size() > std::numeric_limits<int>::max() ? std::numeric_limits<int>::max()
+                                                                : static_cast<int>(r.size());
+
+  int x = 0, y = 0, comp = 0;
+  std::unique_ptr<float, StbImageDeleter> image(
+      stbi_loadf_from_memory(r.data(), length, &x, &y, &comp, 4));
+  if (image == nullptr) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "Could not load image daa.");
+    return nullptr;
+  }
+
+  const uint32_t numBytes = memorySizeInBytes();
+  auto data = std::make_unique<uint8_t[]>(numBytes);
+  if (!data) {
+    igl::Result::setResult(outResult, igl::Result::Code::RuntimeError, "out of memory.");
+    return nullptr;
+  }
+
+  auto result = generateMipmaps(
+      descriptor(), image.get(), data.get(), mipmapDesc_.value_or(MipmapGeneratorDesc{}));
+  if (!result.isOk()) {
+    igl::Result::setResult(outResult, std::move(result));
+    return nullptr;
+  }
+
+  return IData::tryCreate(std::move(data), numBytes, outResult);
 }
 } // namespace
 
-TextureLoaderFactory::TextureLoaderFactory(bool isFloatFormat) noexcept :
-  isFloatFormat_(isFloatFormat) {}
+TextureLoaderFactory::TextureLoaderFactory(bool isFloatFormat,
+                                           std::optional<MipmapGeneratorDesc> mipmapDesc) noexcept :
+  isFloatFormat_(isFloatFormat), mipmapDesc_(mipmapDesc) {}
 
 // NOLINTNEXTLINE(bugprone-exception-escape)
 bool TextureLoaderFactory::canCreateInternal(DataReader headerReader,
@@ -178,7 +266,8 @@ std::unique_ptr<ITextureLoader> TextureLoaderFactory::tryCreateInternal(
     return nullptr;
   }
 
-  return std::make_unique<TextureLoader>(reader, x, y, isFloatFormat_, preferredFormat);
+  return std::make_unique<TextureLoader>(
+      reader, x, y, isFloatFormat_, mipmapDesc_, preferredFormat);
 }
 
 } // namespace iglu::textureloader::stb::image
@@ -8,15 +8,23 @@
 #pragma once
 
 #include <IGLU/texture_loader/ITextureLoaderFactory.h>
+#include <IGLU/texture_loader/MipmapGenerator.h>
+#include <optional>
 
 namespace iglu::textureloader::stb::image {
 
 /**
  * @brief ITextureLoaderFactory base class for loading textures with STB Image
+ *
+ * Float images always come with a full mip chain filtered on the CPU. 8-bit images come with one
+ * only when a MipmapGeneratorDesc is passed, and leave mipmaps to ITexture::generateMipmap()
+ * otherwise.
  */
 class TextureLoaderFactory : public ITextureLoaderFactory {
  protected:
-  explicit TextureLoaderFactory(bool isFloatFormat = false) noexcept;
+  explicit TextureLoaderFactory(
+      bool isFloatFormat = false,
+      std::optional<MipmapGeneratorDesc> mipmapDesc = std::nullopt) noexcept;
 
   [[nodiscard]] virtual bool isIdentifierValid(DataReader headerReader) const noexcept = 0;
 
@@ -30,6 +38,7 @@ class TextureLoaderFactory : public ITextureLoaderFactory {
       igl::Result* IGL_NULLABLE outResult) const noexcept final;
 
   bool isFloatFormat_;
+  std::optional<MipmapGeneratorDesc> mipmapDesc_;
 };
 
 } // namespace iglu::textureloader::stb::image
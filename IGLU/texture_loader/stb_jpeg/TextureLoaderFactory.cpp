@@ -11,6 +11,9 @@
 
 namespace iglu::textureloader::stb::jpeg {
 
+TextureLoaderFactory::TextureLoaderFactory(MipmapGeneratorDesc mipmapDesc) noexcept :
+  image::TextureLoaderFactory(false, mipmapDesc) {}
+
 uint32_t TextureLoaderFactory::minHeaderLength() const noexcept {
   return kHeaderLength;
 }
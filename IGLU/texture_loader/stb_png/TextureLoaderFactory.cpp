@@ -11,6 +11,9 @@
 
 namespace iglu::textureloader::stb::png {
 
+TextureLoaderFactory::TextureLoaderFactory(MipmapGeneratorDesc mipmapDesc) noexcept :
+  image::TextureLoaderFactory(false, mipmapDesc) {}
+
 uint32_t TextureLoaderFactory::minHeaderLength() const noexcept {
   // Require enough bytes for the full minimal PNG structure used by tests:
   // - 8-byte file signature
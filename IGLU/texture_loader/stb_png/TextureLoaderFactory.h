@@ -18,6 +18,8 @@ namespace iglu::textureloader::stb::png {
 class TextureLoaderFactory final : public image::TextureLoaderFactory {
  public:
   TextureLoaderFactory() noexcept = default;
+  /// Loaded images come with a full mip chain filtered on the CPU with mipmapDesc
+  explicit TextureLoaderFactory(MipmapGeneratorDesc mipmapDesc) noexcept;
 
   [[nodiscard]] uint32_t minHeaderLength() const noexcept final;
 
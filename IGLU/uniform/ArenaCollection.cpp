@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <IGLU/uniform/ArenaCollection.h>
+
+#include <algorithm>
+
+namespace iglu::uniform {
+
+namespace {
+
+size_t alignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+std::vector<ArenaCollection::Entry>::const_iterator lowerBound(
+    const std::vector<ArenaCollection::Entry>& entries,
+    uint32_t crc32) {
+  return std::lower_bound(
+      entries.begin(), entries.end(), crc32, [](const ArenaCollection::Entry& entry, uint32_t crc) {
+        return entry.crc32 < crc;
+      });
+}
+
+} // namespace
+
+ArenaLayout getArenaLayout(igl::BackendType backendType) noexcept {
+  return backendType == igl::BackendType::Metal ? ArenaLayout::Metal : ArenaLayout::Std140;
+}
+
+std::vector<ArenaCollection::Entry>::const_iterator ArenaCollection::findEntry(
+    const igl::NameHandle& name) const noexcept {
+  const uint32_t crc32 = name.getCrc32();
+  // Entries with colliding CRC32s are adjacent
+  for (auto it = lowerBound(entries_, crc32); it != entries_.end() && it->crc32 == crc32; ++it) {
+    if (names_[it->nameIndex] == name) {
+      return it;
+    }
+  }
+  return entries_.end();
+}
+
+const ArenaCollection::Entry* ArenaCollection::find(const igl::NameHandle& name) const noexcept {
+  auto it = findEntry(name);
+  return it != entries_.end() ? &*it : nullptr;
+}
+
+const ArenaCollection::Entry& ArenaCollection::findOrAppend(const igl::NameHandle& name,
+                                                            igl::UniformType type,
+                                                            size_t alignment,
+                                                            size_t size,
+                                                            size_t stride,
+                                                            uint32_t count) {
+  auto found = findEntry(name);
+  if (found != entries_.end()) {
+    // A uniform cannot change its type once it has been added
+    IGL_DEBUG_ASSERT(found->type == type);
+    return *found;
+  }
+
+  Entry entry;
+  entry.crc32 = name.getCrc32();
+  entry.offset = static_cast<uint32_t>(alignUp(end_, alignment));
+  entry.size = static_cast<uint32_t>(size);
+  entry.stride = static_cast<uint32_t>(stride);
+  entry.count = count;
+  entry.nameIndex = static_cast<uint32_t>(names_.size());
+  entry.type = type;
+
+  end_ = entry.offset + size;
+  // New bytes, including padding, are zero so that collections can be compared with memcmp
+  arena_.resize(alignUp(end_, 16), 0);
+  names_.push_back(name);
+  // Insert after the entries with the same CRC32
+  auto it = std::upper_bound(
+      entries_.begin(), entries_.end(), entry.crc32, [](uint32_t crc, const Entry& other) {
+        return crc < other.crc32;
+      });
+  return *entries_.insert(it, entry);
+}
+
+void ArenaCollection::update(const ArenaCollection& changes) noexcept {
+  if (!IGL_DEBUG_VERIFY(layout_ == changes.layout_, "Collections must use the same layout")) {
+    return;
+  }
+  if (hasSameLayout(changes)) {
+    std::memcpy(arena_.data(), changes.arena_.data(), arena_.size());
+    return;
+  }
+  for (const Entry& change : changes.entries_) {
+    auto it = findEntry(changes.names_[change.nameIndex]);
+    // Update should only modify values already in receiver; catch caller error otherwise
+    if (!IGL_DEBUG_VERIFY(it != entries_.end()) || !IGL_DEBUG_VERIFY(it->type == change.type)) {
+      continue;
+    }
+    // Arrays with a different element count share their first elements
+    std::memcpy(arena_.data() + it->offset,
+                changes.arena_.data() + change.offset,
+                std::min(it->size, change.size));
+  }
+}
+
+void ArenaCollection::clear() noexcept {
+  arena_.clear();
+  entries_.clear();
+  names_.clear();
+  end_ = 0;
+}
+
+bool ArenaCollection::operator==(const ArenaCollection& rhs) const noexcept {
+  return hasSameLayout(rhs) && arena_ == rhs.arena_;
+}
+
+bool ArenaCollection::operator!=(const ArenaCollection& rhs) const noexcept {
+  return !operator==(rhs);
+}
+
+} // namespace iglu::uniform
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/uniform/Trait.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <igl/Common.h>
+#include <igl/NameHandle.h>
+
+namespace iglu::uniform {
+
+// ----------------------------------------------------------------------------
+
+// Std140<T>
+//
+// Size, base alignment and conversion of a T value in a std140 uniform block. Array elements are
+// additionally rounded up to a multiple of 16 bytes (Std140Array).
+template<typename T>
+struct Std140 {
+  static_assert(Trait<T>::kPadding == 0, "Types which need padding must be specialized");
+  static constexpr size_t kAlignment = sizeof(T) <= 4 ? 4 : (sizeof(T) <= 8 ? 8 : 16);
+  static constexpr size_t kSize = sizeof(T);
+
+  static void write(uint8_t* dst, const T& value) noexcept {
+    std::memcpy(dst, &value, sizeof(T));
+  }
+  static void read(T& value, const uint8_t* src) noexcept {
+    std::memcpy(&value, src, sizeof(T));
+  }
+};
+
+// bool is stored as a 32-bit value
+template<>
+struct Std140<bool> {
+  static constexpr size_t kAlignment = 4;
+  static constexpr size_t kSize = 4;
+
+  static void write(uint8_t* dst, const bool& value) noexcept {
+    const uint32_t v = value ? 1u : 0u;
+    std::memcpy(dst, &v, sizeof(v));
+  }
+  static void read(bool& value, const uint8_t* src) noexcept {
+    uint32_t v = 0;
+    std::memcpy(&v, src, sizeof(v));
+    value = v != 0;
+  }
+};
+
+// 3-component vectors are aligned like 4-component vectors, but the next member can be placed in
+// their last 4 bytes
+template<typename V>
+struct Std140Vec3 {
+  static constexpr size_t kAlignment = 16;
+  static constexpr size_t kSize = sizeof(V);
+
+  static void write(uint8_t* dst, const V& value) noexcept {
+    std::memcpy(dst, &value, sizeof(V));
+  }
+  static void read(V& value, const uint8_t* src) noexcept {
+    std::memcpy(&value, src, sizeof(V));
+  }
+};
+template<>
+struct Std140<glm::vec3> : Std140Vec3<glm::vec3> {};
+template<>
+struct Std140<glm::ivec3> : Std140Vec3<glm::ivec3> {};
+
+// Matrices are stored as arrays of column vectors, each of them padded to 16 bytes
+template<typename M, int Columns>
+struct Std140Matrix {
+  static constexpr size_t kAlignment = 16;
+  static constexpr size_t kSize = 16 * Columns;
+  static constexpr size_t kColumnSize = sizeof(M) / Columns;
+
+  static void write(uint8_t* dst, const M& value) noexcept {
+    for (int i = 0; i < Columns; ++i) {
+      std::memcpy(dst + 16 * i, &value[i], kColumnSize);
+    }
+  }
+  static void read(M& value, const uint8_t* src) noexcept {
+    for (int i = 0; i < Columns; ++i) {
+      std::memcpy(&value[i], src + 16 * i, kColumnSize);
+    }
+  }
+};
+template<>
+struct Std140<glm::mat2> : Std140Matrix<glm::mat2, 2> {};
+template<>
+struct Std140<glm::mat3> : Std140Matrix<glm::mat3, 3> {};
+template<>
+struct Std140<glm::mat4> : Std140Matrix<glm::mat4, 4> {};
+
+template<typename T>
+struct Std140Array {
+  static constexpr size_t kAlignment = 16;
+  static constexpr size_t kStride = (Std140<T>::kSize + 15) & ~size_t(15);
+};
+
+// ----------------------------------------------------------------------------
+
+// MetalLayout<T>
+//
+// Size, alignment and conversion of a T value in a Metal Shading Language struct, as bound with
+// bindBytes(). Unlike std140, 3-component vectors always occupy 16 bytes, bool is 1 byte, and
+// array elements are placed kSize bytes apart.
+template<typename T>
+struct MetalLayout {
+  static_assert(Trait<T>::kPadding == 0, "Types which need padding must be specialized");
+  static constexpr size_t kAlignment = sizeof(T) <= 4 ? sizeof(T) : (sizeof(T) <= 8 ? 8 : 16);
+  static constexpr size_t kSize = sizeof(T);
+
+  static void write(uint8_t* dst, const T& value) noexcept {
+    std::memcpy(dst, &value, sizeof(T));
+  }
+  static void read(T& value, const uint8_t* src) noexcept {
+    std::memcpy(&value, src, sizeof(T));
+  }
+};
+
+template<typename V>
+struct MetalVec3 : Std140Vec3<V> {
+  static constexpr size_t kSize = 16;
+};
+template<>
+struct MetalLayout<glm::vec3> : MetalVec3<glm::vec3> {};
+template<>
+struct MetalLayout<glm::ivec3> : MetalVec3<glm::ivec3> {};
+
+// float2x2 is 2 columns of 8 bytes
+template<>
+struct MetalLayout<glm::mat2> {
+  static constexpr size_t kAlignment = 8;
+  static constexpr size_t kSize = sizeof(glm::mat2);
+
+  static void write(uint8_t* dst, const glm::mat2& value) noexcept {
+    std::memcpy(dst, &value, sizeof(glm::mat2));
+  }
+  static void read(glm::mat2& value, const uint8_t* src) noexcept {
+    std::memcpy(&value, src, sizeof(glm::mat2));
+  }
+};
+template<>
+struct MetalLayout<glm::mat3> : Std140Matrix<glm::mat3, 3> {};
+
+// ----------------------------------------------------------------------------
+
+// Memory layout of an ArenaCollection
+enum class ArenaLayout : uint8_t {
+  Std140, ///< std140 uniform block, used by the OpenGL and Vulkan backends
+  Metal, ///< Metal Shading Language struct
+};
+
+// Returns the layout which uniform::Encoder expects for a backend
+[[nodiscard]] ArenaLayout getArenaLayout(igl::BackendType backendType) noexcept;
+
+// ----------------------------------------------------------------------------
+
+// ArenaCollection
+//
+// Alternative to Collection which stores all uniform values in one contiguous byte arena laid out
+// like a std140 uniform block or a Metal struct (see ArenaLayout), plus a small index sorted by
+// name CRC32. Members are placed in the order they were first set, so the arena matches a uniform
+// block which declares its members in the same order. Names with colliding CRC32s are told apart
+// by comparing the names.
+//
+// Copying and updating collections with the same layout is a single memcpy, and uniform::Encoder
+// submits the whole arena with one bindBytes() call or one buffer upload.
+//
+// The element count of an array uniform is fixed by the first set(); later calls with more
+// elements are truncated.
+class ArenaCollection {
+ public:
+  struct Entry {
+    uint32_t crc32 = 0;
+    uint32_t offset = 0;
+    uint32_t size = 0; ///< bytes in the arena, without padding after the last element
+    uint32_t stride = 0; ///< distance between array elements, 0 for single values
+    uint32_t count = 1;
+    uint32_t nameIndex = 0; ///< index in names()
+    igl::UniformType type = igl::UniformType::Invalid;
+
+    bool operator==(const Entry& rhs) const noexcept = default;
+  };
+
+  explicit ArenaCollection(ArenaLayout layout = ArenaLayout::Std140) : layout_(layout) {}
+
+  template<typename T>
+  void set(const igl::NameHandle& name, const T& value) {
+    static_assert(Trait<T>::kValue != igl::UniformType::Invalid, "Unsupported uniform type");
+    if (layout_ == ArenaLayout::Metal) {
+      const Entry& entry = findOrAppend(
+          name, Trait<T>::kValue, MetalLayout<T>::kAlignment, MetalLayout<T>::kSize, 0, 1);
+      MetalLayout<T>::write(arena_.data() + entry.offset, value);
+    } else {
+      const Entry& entry =
+          findOrAppend(name, Trait<T>::kValue, Std140<T>::kAlignment, Std140<T>::kSize, 0, 1);
+      Std140<T>::write(arena_.data() + entry.offset, value);
+    }
+  }
+
+  template<typename T>
+  void set(const igl::NameHandle& name, const std::vector<T>& values) {
+    setArray(name, values.data(), values.size());
+  }
+
+  // std::vector<bool> does not store bools contiguously
+  void set(const igl::NameHandle& name, const std::vector<bool>& values) {
+    setElements<bool>(name, values, values.size());
+  }
+
+  template<typename T>
+  void setArray(const igl::NameHandle& name, const T* values, size_t count) {
+    setElements<T>(name, values, count);
+  }
+
+  // Reads back a value; returns false if there is no uniform with this name and type
+  template<typename T>
+  bool get(const igl::NameHandle& name, T& outValue, size_t element = 0) const noexcept {
+    const Entry* entry = find(name);
+    if (!entry || entry->type != Trait<T>::kValue || element >= entry->count) {
+      return false;
+    }
+    const uint8_t* src = arena_.data() + entry->offset + element * entry->stride;
+    if (layout_ == ArenaLayout::Metal) {
+      MetalLayout<T>::read(outValue, src);
+    } else {
+      Std140<T>::read(outValue, src);
+    }
+    return true;
+  }
+
+  // Copies the values of all uniforms in changes which also exist in this collection. This is a
+  // single memcpy if both collections have the same layout. Both collections must use the same
+  // ArenaLayout.
+  void update(const ArenaCollection& changes) noexcept;
+
+  void clear() noexcept;
+
+  [[nodiscard]] bool contains(const igl::NameHandle& name) const noexcept {
+    return find(name) != nullptr;
+  }
+  [[nodiscard]] const Entry* find(const igl::NameHandle& name) const noexcept;
+
+  [[nodiscard]] ArenaLayout layout() const noexcept {
+    return layout_;
+  }
+
+  [[nodiscard]] bool hasSameLayout(const ArenaCollection& other) const noexcept {
+    return layout_ == other.layout_ && entries_ == other.entries_;
+  }
+
+  [[nodiscard]] const void* data() const noexcept {
+    return arena_.data();
+  }
+  // Size of the arena, rounded up to 16 bytes like the size of a std140 uniform block
+  [[nodiscard]] size_t numBytes() const noexcept {
+    return arena_.size();
+  }
+
+  // Entries sorted by CRC32
+  [[nodiscard]] const std::vector<Entry>& entries() const noexcept {
+    return entries_;
+  }
+  // Names in the order they were added
+  [[nodiscard]] const std::vector<igl::NameHandle>& names() const noexcept {
+    return names_;
+  }
+
+  bool operator==(const ArenaCollection& rhs) const noexcept;
+  bool operator!=(const ArenaCollection& rhs) const noexcept;
+
+ private:
+  template<typename T, typename Values>
+  void setElements(const igl::NameHandle& name, const Values& values, size_t count) {
+    static_assert(Trait<T>::kValue != igl::UniformType::Invalid, "Unsupported uniform type");
+    IGL_DEBUG_ASSERT(count > 0);
+    const bool isMetal = layout_ == ArenaLayout::Metal;
+    const size_t stride = isMetal ? MetalLayout<T>::kSize : Std140Array<T>::kStride;
+    const Entry& entry = findOrAppend(name,
+                                      Trait<T>::kValue,
+                                      isMetal ? MetalLayout<T>::kAlignment
+                                              : Std140Array<T>::kAlignment,
+                                      stride * count,
+                                      stride,
+                                      static_cast<uint32_t>(count));
+    IGL_DEBUG_ASSERT(count <= entry.count, "Array uniforms cannot grow");
+    const size_t numElements = count < entry.count ? count : entry.count;
+    uint8_t* dst = arena_.data() + entry.offset;
+    for (size_t i = 0; i < numElements; ++i) {
+      const T& value = values[i];
+      if (isMetal) {
+        MetalLayout<T>::write(dst + i * entry.stride, value);
+      } else {
+        Std140<T>::write(dst + i * entry.stride, value);
+      }
+    }
+  }
+
+  [[nodiscard]] std::vector<Entry>::const_iterator findEntry(
+      const igl::NameHandle& name) const noexcept;
+
+  const Entry& findOrAppend(const igl::NameHandle& name,
+                            igl::UniformType type,
+                            size_t alignment,
+                            size_t size,
+                            size_t stride,
+                            uint32_t count);
+
+  std::vector<uint8_t> arena_;
+  std::vector<Entry> entries_;
+  std::vector<igl::NameHandle> names_;
+  size_t end_ = 0; ///< end of the last member, before rounding the arena size up
+  ArenaLayout layout_ = ArenaLayout::Std140;
+};
+
+} // namespace iglu::uniform
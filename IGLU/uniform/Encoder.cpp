@@ -7,6 +7,7 @@
 
 #include <IGLU/uniform/Encoder.h>
 
+#include <IGLU/uniform/ArenaCollection.h>
 #include <IGLU/uniform/Descriptor.h>
 #include <igl/IGL.h> // IWYU pragma: keep
 
@@ -62,6 +63,24 @@ void encodeAlignedCompute(igl::IComputeCommandEncoder& encoder,
   encoder.bindBytes(bufferIndex, data, static_cast<int>(numBytes));
 }
 
+// Uploads the arena of the collection to buffer at offset, returns false if it does not fit
+bool uploadArena(igl::IBuffer* buffer, const ArenaCollection& collection, size_t offset) {
+  if (!IGL_DEBUG_VERIFY(buffer, "A uniform buffer is required for this backend") ||
+      !IGL_DEBUG_VERIFY(offset % Encoder::kBufferOffsetAlignment == 0) ||
+      !IGL_DEBUG_VERIFY(buffer->getSizeInBytes() >= offset + collection.numBytes())) {
+    return false;
+  }
+  buffer->upload(collection.data(), {collection.numBytes(), offset});
+  return true;
+}
+
+size_t getNextBufferOffset(const ArenaCollection& collection, size_t offset) {
+  const size_t end = offset + collection.numBytes();
+  return (end + Encoder::kBufferOffsetAlignment - 1) & ~(Encoder::kBufferOffsetAlignment - 1);
+}
+
+constexpr size_t kMaxBindBytesLength = 4 * 1024;
+
 } // namespace
 
 // ----------------------------------------------------------------------------
@@ -117,4 +136,51 @@ void Encoder::operator()(igl::IComputeCommandEncoder& encoder,
   }
 }
 
+size_t Encoder::operator()(igl::IRenderCommandEncoder& encoder,
+                           uint8_t bindTarget,
+                           int bufferIndex,
+                           const ArenaCollection& collection,
+                           igl::IBuffer* buffer,
+                           size_t bufferOffset) const noexcept {
+  if (!IGL_DEBUG_VERIFY(bufferIndex >= 0) || collection.numBytes() == 0 ||
+      !IGL_DEBUG_VERIFY(collection.layout() == getArenaLayout(backendType_),
+                        "The layout of the collection does not match the backend")) {
+    return bufferOffset;
+  }
+
+  if (backendType_ == igl::BackendType::Metal && collection.numBytes() <= kMaxBindBytesLength) {
+    encoder.bindBytes(bufferIndex, bindTarget, collection.data(), collection.numBytes());
+  } else if (uploadArena(buffer, collection, bufferOffset)) {
+    encoder.bindBuffer(static_cast<uint32_t>(bufferIndex),
+                       bindTarget,
+                       buffer,
+                       bufferOffset,
+                       collection.numBytes());
+    return getNextBufferOffset(collection, bufferOffset);
+  }
+  return bufferOffset;
+}
+
+size_t Encoder::operator()(igl::IComputeCommandEncoder& encoder,
+                           int bufferIndex,
+                           const ArenaCollection& collection,
+                           igl::IBuffer* buffer,
+                           size_t bufferOffset) const noexcept {
+  if (!IGL_DEBUG_VERIFY(bufferIndex >= 0) || collection.numBytes() == 0 ||
+      !IGL_DEBUG_VERIFY(collection.layout() == getArenaLayout(backendType_),
+                        "The layout of the collection does not match the backend")) {
+    return bufferOffset;
+  }
+
+  if (backendType_ == igl::BackendType::Metal && collection.numBytes() <= kMaxBindBytesLength) {
+    encoder.bindBytes(
+        static_cast<uint32_t>(bufferIndex), collection.data(), collection.numBytes());
+  } else if (uploadArena(buffer, collection, bufferOffset)) {
+    encoder.bindBuffer(
+        static_cast<uint32_t>(bufferIndex), buffer, bufferOffset, collection.numBytes());
+    return getNextBufferOffset(collection, bufferOffset);
+  }
+  return bufferOffset;
+}
+
 } // namespace iglu::uniform
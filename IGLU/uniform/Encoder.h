@@ -13,11 +13,13 @@
 
 namespace igl {
 
+class IBuffer;
 class IComputeCommandEncoder;
 } // namespace igl
 
 namespace iglu::uniform {
 
+class ArenaCollection;
 struct Descriptor;
 
 // Encoder submits an uniform described by Descriptor.
@@ -27,8 +29,20 @@ struct Descriptor;
 // igl::IComputeCommandEncoder::bindBytes()
 // * For OpenGL, it calls igl::RenderCommandEncoder::bindUniform() or
 // igl::IComputeCommandEncoder::bindUniform()
+//
+// An ArenaCollection is submitted as a single uniform block at bufferIndex. Its layout must be
+// getArenaLayout() of the backend, other collections are not submitted:
+// * For Metal, blocks up to 4KB are submitted with a single bindBytes() call
+// * Otherwise, the arena is uploaded to the given uniform buffer at bufferOffset, and that range
+//   is bound. The return value is the offset at which the next block can be uploaded to the same
+//   buffer, so that all draws of a command buffer can share one buffer. A range must not be
+//   uploaded again before the command buffer which reads it has completed.
 class Encoder {
  public:
+  // Alignment of the buffer offsets returned by the ArenaCollection overloads; the largest
+  // uniform buffer offset alignment which Vulkan allows a device to require
+  static constexpr size_t kBufferOffsetAlignment = 256;
+
   explicit Encoder(igl::BackendType backendType);
   void operator()(igl::IRenderCommandEncoder& encoder,
                   uint8_t bindTarget,
@@ -36,6 +50,18 @@ class Encoder {
 
   void operator()(igl::IComputeCommandEncoder& encoder, const Descriptor& uniform) const noexcept;
 
+  size_t operator()(igl::IRenderCommandEncoder& encoder,
+                    uint8_t bindTarget,
+                    int bufferIndex,
+                    const ArenaCollection& collection,
+                    igl::IBuffer* buffer = nullptr,
+                    size_t bufferOffset = 0) const noexcept;
+  size_t operator()(igl::IComputeCommandEncoder& encoder,
+                    int bufferIndex,
+                    const ArenaCollection& collection,
+                    igl::IBuffer* buffer = nullptr,
+                    size_t bufferOffset = 0) const noexcept;
+
  private:
   igl::BackendType backendType_;
 };
@@ -855,7 +855,11 @@ bool TinyRenderer::render(float displayScale) {
 #endif
 
   // Return true if the application should exit (e.g., benchmark timeout)
-  return session_->appParams().exitRequested;
+  if (session_->appParams().exitRequested) {
+    session_->logFinalBenchmarkReport(false);
+    return true;
+  }
+  return false;
 }
 
 void TinyRenderer::onSurfacesChanged(ANativeWindow* /*surface*/, int width, int height) {
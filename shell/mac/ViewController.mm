@@ -110,6 +110,7 @@ using namespace igl;
 
 - (void)teardown {
   if (_session) {
+    _session->logFinalBenchmarkReport(false);
     _session->teardown();
   }
   _session = nullptr;
@@ -196,6 +197,7 @@ using namespace igl;
   _session->runUpdate(std::move(surfaceTextures));
 
   if (_session->appParams().exitRequested) {
+    _session->logFinalBenchmarkReport(false);
     dispatch_async(dispatch_get_main_queue(), ^{
       [[NSApplication sharedApplication] terminate:nil];
     });
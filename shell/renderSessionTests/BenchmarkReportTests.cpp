@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <shell/shared/renderSession/AppParams.h>
+#include <shell/shared/renderSession/ShellParams.h>
+#include <shell/shared/testShell/TestShell.h>
+#include <igl/Device.h>
+
+namespace igl::shell {
+namespace {
+
+bool fileExists(const std::string& path) {
+  return std::ifstream(path).good();
+}
+
+std::string readFile(const std::string& path) {
+  std::stringstream contents;
+  contents << std::ifstream(path).rdbuf();
+  return contents.str();
+}
+
+} // namespace
+
+class BenchmarkReportTests : public TestShell {};
+
+// A run with a fixed number of frames is ended by the platform code, not by the benchmark duration;
+// the report has to be written by the shutdown path all platforms go through.
+TEST_F(BenchmarkReportTests, FixedFrameRunWritesReport) {
+  const std::string reportFile = ::testing::TempDir() + "igl_benchmark_report_fixed_frames";
+  std::remove((reportFile + ".json").c_str());
+  std::remove((reportFile + ".csv").c_str());
+
+  ShellParams shellParams;
+  shellParams.benchmarkParams = BenchmarkRenderSessionParams{};
+  shellParams.benchmarkParams->benchmarkDurationMs = 0;
+  shellParams.benchmarkParams->numFrames = 3;
+  shellParams.benchmarkParams->reportFile = reportFile;
+
+  RenderSession session(platform_);
+  session.setShellParams(shellParams);
+  session.initialize();
+  for (size_t i = 0; i < shellParams.benchmarkParams->numFrames; ++i) {
+    const igl::DeviceScope scope(platform_->getDevice());
+    session.runUpdate({.color = offscreenTexture_, .depth = offscreenDepthTexture_},
+                      /* throttle */ false);
+  }
+
+  // The expired duration neither ends the run nor writes the report early
+  EXPECT_FALSE(session.appParams().exitRequested);
+  EXPECT_FALSE(fileExists(reportFile + ".json"));
+
+  session.logFinalBenchmarkReport(false);
+  session.teardown();
+
+  ASSERT_TRUE(fileExists(reportFile + ".json"));
+  ASSERT_TRUE(fileExists(reportFile + ".csv"));
+  EXPECT_NE(readFile(reportFile + ".json").find("cpu_encode"), std::string::npos);
+
+  // Later calls from other shutdown paths do not write the report again
+  std::remove((reportFile + ".json").c_str());
+  session.logFinalBenchmarkReport(false);
+  EXPECT_FALSE(fileExists(reportFile + ".json"));
+
+  std::remove((reportFile + ".csv").c_str());
+}
+
+} // namespace igl::shell
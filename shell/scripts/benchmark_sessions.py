@@ -0,0 +1,200 @@
+#!/usr/bin/python3
+# Copyright (c) Meta Platforms, Inc. and affiliates.
+#
+# This source code is licensed under the MIT license found in the
+# LICENSE file in the root directory of this source tree.
+
+"""Run every shell render session headlessly and compare the timings against a baseline.
+
+Each session is built as its own executable named <Session>_<backend>. Every executable found in
+the build directory is run for a fixed number of frames with a fixed animation time step, and the
+per-frame CPU encode, submit and queue drain times it reports are collected into one JSON file.
+
+Example:
+    python3 shell/scripts/benchmark_sessions.py --build-dir build --backend vulkan \\
+        --software --output results.json --baseline baseline.json --threshold 10
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+BACKENDS = ["vulkan", "opengl", "opengles"]
+METRICS = ["encode_ms", "submit_ms", "queue_drain_ms"]
+
+
+def find_sessions(build_dir: str, backends: list[str], filters: list[str]) -> list[str]:
+    """Returns the paths of all session executables for the given backends"""
+    pattern = re.compile(r"^(\w+Session)_({})(\.exe)?$".format("|".join(backends)))
+    sessions = []
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            match = pattern.match(name)
+            if not match:
+                continue
+            if filters and match.group(1) not in filters:
+                continue
+            path = os.path.abspath(os.path.join(root, name))
+            if os.access(path, os.X_OK):
+                sessions.append(path)
+    return sorted(sessions, key=os.path.basename)
+
+
+def software_env(lavapipe_icd: str | None) -> dict[str, str]:
+    """Environment which forces Mesa software rasterizers (llvmpipe/lavapipe)"""
+    env = dict(os.environ)
+    env["LIBGL_ALWAYS_SOFTWARE"] = "1"
+    env["GALLIUM_DRIVER"] = "llvmpipe"
+    if lavapipe_icd:
+        env["VK_ICD_FILENAMES"] = lavapipe_icd
+        env["VK_DRIVER_FILES"] = lavapipe_icd
+    return env
+
+
+def run_session(
+    path: str, args: argparse.Namespace, env: dict[str, str]
+) -> dict[str, object] | None:
+    """Runs a single session executable and returns its parsed report"""
+    with tempfile.TemporaryDirectory() as tmp:
+        output = os.path.join(tmp, "report.json")
+        cmd = [
+            path,
+            "--headless",
+            "--disable-vulkan-validation-layers",
+            "--benchmark",
+            "--benchmark-frames",
+            str(args.frames),
+            "--benchmark-output",
+            output,
+            "--fixed-time-step",
+            str(args.time_step),
+            "--viewport-size",
+            args.viewport_size,
+        ]
+        try:
+            result = subprocess.run(
+                cmd,
+                cwd=os.path.dirname(path),
+                env=env,
+                capture_output=True,
+                text=True,
+                timeout=args.timeout,
+            )
+        except subprocess.TimeoutExpired:
+            print(f"  TIMEOUT after {args.timeout}s")
+            return None
+        if result.returncode != 0 or not os.path.exists(output):
+            print(f"  FAILED with exit code {result.returncode}")
+            if args.verbose:
+                print(result.stdout)
+                print(result.stderr)
+            return None
+        with open(output) as f:
+            return json.load(f)
+
+
+def compare(
+    results: dict[str, dict], baseline: dict[str, dict], stat: str, threshold: float
+) -> list[str]:
+    """Returns a description of every metric which regressed by more than threshold percent"""
+    regressions = []
+    for name, report in sorted(results.items()):
+        if name not in baseline:
+            print(f"{name}: no baseline")
+            continue
+        for metric in METRICS:
+            old = baseline[name]["metrics"][metric][stat]
+            new = report["metrics"][metric][stat]
+            change = (new - old) / old * 100.0 if old > 0 else 0.0
+            line = f"{name} {metric} {stat}: {old:.3f} -> {new:.3f} ms ({change:+.1f}%)"
+            print(line)
+            if change > threshold:
+                regressions.append(line)
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--build-dir", required=True, help="directory to search for sessions")
+    parser.add_argument(
+        "--backend", action="append", choices=BACKENDS, help="backends to run (default: all)"
+    )
+    parser.add_argument("--session", action="append", help="only run these sessions")
+    parser.add_argument("--frames", type=int, default=300, help="frames to render per session")
+    parser.add_argument(
+        "--time-step", type=float, default=1000.0 / 60.0, help="animation time step in ms"
+    )
+    parser.add_argument("--viewport-size", default="1024x768", help="offscreen surface size")
+    parser.add_argument("--timeout", type=int, default=300, help="per-session timeout in seconds")
+    parser.add_argument(
+        "--software", action="store_true", help="force llvmpipe (GL) and lavapipe (Vulkan)"
+    )
+    parser.add_argument("--lavapipe-icd", help="path to the lavapipe ICD json for --software")
+    parser.add_argument("--output", help="write the collected results to this JSON file")
+    parser.add_argument("--baseline", help="JSON file written by a previous --output run")
+    parser.add_argument(
+        "--threshold", type=float, default=10.0, help="allowed regression in percent"
+    )
+    parser.add_argument(
+        "--stat", default="p50", choices=["min", "mean", "p50", "p95", "p99"], help="compared stat"
+    )
+    parser.add_argument("--verbose", action="store_true", help="print output of failed sessions")
+    args = parser.parse_args()
+
+    sessions = find_sessions(args.build_dir, args.backend or BACKENDS, args.session or [])
+    if not sessions:
+        print(f"No session executables found in {args.build_dir}")
+        return 1
+
+    env = software_env(args.lavapipe_icd) if args.software else dict(os.environ)
+
+    results = {}
+    failures = []
+    for path in sessions:
+        name = os.path.splitext(os.path.basename(path))[0]
+        print(f"Running {name}...")
+        report = run_session(path, args, env)
+        if report is None:
+            failures.append(name)
+            continue
+        results[name] = report
+        metrics = report["metrics"]
+        print(
+            "  encode {:.3f} ms, submit {:.3f} ms, queue drain {:.3f} ms (p50, {} frames)".format(
+                metrics["encode_ms"]["p50"],
+                metrics["submit_ms"]["p50"],
+                metrics["queue_drain_ms"]["p50"],
+                report["frames"],
+            )
+        )
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+
+    status = 0
+    if failures:
+        print(f"Failed sessions: {', '.join(failures)}")
+        status = 1
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(results, baseline, args.stat, args.threshold)
+        if regressions:
+            print(f"Regressions beyond {args.threshold}%:")
+            for line in regressions:
+                print(f"  {line}")
+            status = 1
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
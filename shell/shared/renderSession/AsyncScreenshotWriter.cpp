@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <shell/shared/renderSession/AsyncScreenshotWriter.h>
+
+#include <algorithm>
+#include <chrono>
+#include <shell/shared/imageWriter/ImageWriter.h>
+#include <igl/Framebuffer.h>
+
+namespace igl::shell {
+
+AsyncScreenshotWriter::AsyncScreenshotWriter(const ImageWriter& imageWriter,
+                                             AsyncScreenshotWriterDesc desc) :
+  imageWriter_(imageWriter), desc_(desc) {
+  const uint32_t numThreads = desc_.numThreads > 0 ? desc_.numThreads : 1;
+  threads_.reserve(numThreads);
+  for (uint32_t i = 0; i != numThreads; ++i) {
+    threads_.emplace_back([this]() { run(); });
+  }
+}
+
+AsyncScreenshotWriter::~AsyncScreenshotWriter() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  jobAvailable_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+bool AsyncScreenshotWriter::capture(std::string absoluteFilename,
+                                    IFramebuffer& framebuffer,
+                                    ICommandQueue& commandQueue) {
+  const auto size = framebuffer.getColorAttachment(0)->getDimensions();
+  const size_t numBytes = size.width * size.height * 4;
+
+  {
+    // Reserve the budget before reading back, so waiting happens before the buffer is allocated.
+    // A screenshot larger than the whole budget is still written once nothing else is in flight.
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto fits = [this, numBytes]() {
+      return bytesInFlight_ == 0 || bytesInFlight_ + numBytes <= desc_.maxBytesInFlight;
+    };
+    if (!fits()) {
+      if (desc_.dropWhenBusy) {
+        stats_.dropped++;
+        return false;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      jobFinished_.wait(lock, fits);
+      stats_.waitSeconds +=
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    bytesInFlight_ += numBytes;
+    numJobsInFlight_++;
+    stats_.peakBytesInFlight = std::max(stats_.peakBytesInFlight, bytesInFlight_);
+  }
+
+  Job job{.filename = std::move(absoluteFilename),
+          .pixels = readFramebufferPixels(framebuffer, commandQueue)};
+  IGL_DEBUG_ASSERT(job.pixels.numBytes == numBytes);
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stats_.captured++;
+    jobs_.push_back(std::move(job));
+  }
+  jobAvailable_.notify_one();
+  return true;
+}
+
+void AsyncScreenshotWriter::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  jobFinished_.wait(lock, [this]() { return numJobsInFlight_ == 0; });
+}
+
+AsyncScreenshotWriterStats AsyncScreenshotWriter::getStats() const {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void AsyncScreenshotWriter::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    // Queued screenshots are written before the workers stop
+    jobAvailable_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+    if (jobs_.empty()) {
+      return;
+    }
+    Job job = std::move(jobs_.front());
+    jobs_.pop_front();
+    lock.unlock();
+
+    const size_t numBytes = job.pixels.numBytes;
+    {
+      const ImageData imageData = toImageWriterData(std::move(job.pixels));
+      IGLLog(IGLLogInfo, "Writing screenshot to: '%s'\n", job.filename.c_str());
+      imageWriter_.writeImage(job.filename, imageData);
+    }
+
+    lock.lock();
+    bytesInFlight_ -= numBytes;
+    numJobsInFlight_--;
+    stats_.written++;
+    jobFinished_.notify_all();
+  }
+}
+
+} // namespace igl::shell
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <shell/shared/renderSession/ScreenshotTestRenderSessionHelper.h>
+
+namespace igl {
+class ICommandQueue;
+class IFramebuffer;
+} // namespace igl
+
+namespace igl::shell {
+
+class ImageWriter;
+
+struct AsyncScreenshotWriterDesc {
+  uint32_t numThreads = 2;
+  /// Budget for the readback buffers of screenshots which are not written yet
+  size_t maxBytesInFlight = size_t(256) * 1024 * 1024;
+  /// Drop screenshots which do not fit into the budget instead of waiting for the workers
+  bool dropWhenBusy = false;
+};
+
+struct AsyncScreenshotWriterStats {
+  uint64_t captured = 0;
+  uint64_t written = 0;
+  uint64_t dropped = 0;
+  size_t peakBytesInFlight = 0;
+  double waitSeconds = 0.0; ///< time capture() spent waiting for the budget
+};
+
+/**
+ * Writes screenshots on worker threads.
+ *
+ * capture() reads the color attachment back on the calling thread and queues the pixels; format
+ * conversion, encoding and file I/O run on the workers. The readback buffers of queued
+ * screenshots are bounded by AsyncScreenshotWriterDesc::maxBytesInFlight: once the budget is
+ * exhausted, capture() waits for the workers (or drops the screenshot with dropWhenBusy).
+ *
+ * The image writer is called concurrently from all worker threads.
+ */
+class AsyncScreenshotWriter final {
+ public:
+  explicit AsyncScreenshotWriter(const ImageWriter& imageWriter,
+                                 AsyncScreenshotWriterDesc desc = {});
+  /// Waits until all queued screenshots are written
+  ~AsyncScreenshotWriter();
+
+  AsyncScreenshotWriter(const AsyncScreenshotWriter&) = delete;
+  AsyncScreenshotWriter& operator=(const AsyncScreenshotWriter&) = delete;
+
+  /// Returns false if the screenshot was dropped
+  bool capture(std::string absoluteFilename,
+               IFramebuffer& framebuffer,
+               ICommandQueue& commandQueue);
+
+  /// Waits until all queued screenshots are written
+  void flush();
+
+  [[nodiscard]] AsyncScreenshotWriterStats getStats() const;
+
+ private:
+  struct Job {
+    std::string filename;
+    FramebufferPixels pixels;
+  };
+
+  void run();
+
+  const ImageWriter& imageWriter_;
+  const AsyncScreenshotWriterDesc desc_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable jobAvailable_;
+  std::condition_variable jobFinished_;
+  std::deque<Job> jobs_;
+  size_t bytesInFlight_ = 0; ///< queued and being written
+  size_t numJobsInFlight_ = 0;
+  bool stopping_ = false;
+  AsyncScreenshotWriterStats stats_;
+  std::vector<std::thread> threads_;
+};
+
+} // namespace igl::shell
@@ -13,6 +13,37 @@
 #include <sstream>
 
 namespace igl::shell {
+namespace {
+
+void appendJsonSeries(std::ostringstream& oss,
+                      const std::array<LatencySummary, kBenchmarkSeriesCount>& series,
+                      const char* indent) {
+  oss << "{\n";
+  for (size_t i = 0; i < kBenchmarkSeriesCount; ++i) {
+    oss << indent << "  \"" << getBenchmarkSeriesName(static_cast<BenchmarkSeries>(i)) << "\": ";
+    oss << formatLatencySummaryJson(series[i]);
+    oss << (i + 1 < kBenchmarkSeriesCount ? ",\n" : "\n");
+  }
+  oss << indent << "}";
+}
+
+} // namespace
+
+const char* getBenchmarkSeriesName(BenchmarkSeries series) {
+  switch (series) {
+  case BenchmarkSeries::FrameTime:
+    return "frame_time";
+  case BenchmarkSeries::CpuEncode:
+    return "cpu_encode";
+  case BenchmarkSeries::SubmitToPresent:
+    return "submit_to_present";
+  case BenchmarkSeries::QueueDrain:
+    return "queue_drain";
+  case BenchmarkSeries::Count:
+    break;
+  }
+  return "unknown";
+}
 
 BenchmarkTracker::BenchmarkTracker(size_t bufferSize) : bufferCapacity_(bufferSize) {
   circularBuffer_.resize(bufferCapacity_, 0.0);
@@ -28,6 +59,11 @@ void BenchmarkTracker::recordRenderTime(double renderTimeMs) {
     lastFrameWasHiccup_ = false;
   }
   lastRenderTimeMs_ = renderTimeMs;
+  if (lastFrameWasHiccup_) {
+    jankCount_++;
+    intervalJankCount_++;
+  }
+  recordSeriesTime(BenchmarkSeries::FrameTime, renderTimeMs);
 
   // Check if buffer is full and needs to overflow
   if (bufferCount_ >= bufferCapacity_) {
@@ -46,6 +82,15 @@ void BenchmarkTracker::recordRenderTime(double renderTimeMs) {
   totalSampleCount_++;
 }
 
+void BenchmarkTracker::recordSeriesTime(BenchmarkSeries series, double timeMs) {
+  if (series == BenchmarkSeries::Count) {
+    return;
+  }
+  const auto index = static_cast<size_t>(series);
+  histograms_[index].record(timeMs);
+  intervalHistograms_[index].record(timeMs);
+}
+
 void BenchmarkTracker::flushBufferToOverflow() {
   if (bufferCount_ == 0) {
     return;
@@ -75,6 +120,20 @@ bool BenchmarkTracker::shouldGeneratePeriodicReport() const {
 
 void BenchmarkTracker::markPeriodicReportGenerated() {
   lastReportTime_ = std::chrono::steady_clock::now();
+
+  BenchmarkIntervalRecord record;
+  record.elapsedTimeMs = getElapsedTimeMs();
+  record.jankCount = intervalJankCount_;
+  for (size_t i = 0; i < kBenchmarkSeriesCount; ++i) {
+    record.series[i] = intervalHistograms_[i].summarize();
+    intervalHistograms_[i].reset();
+  }
+  // the oldest interval is dropped so that long runs use bounded memory
+  if (intervalRecords_.size() == kMaxIntervalRecords) {
+    intervalRecords_.pop_front();
+  }
+  intervalRecords_.push_back(record);
+  intervalJankCount_ = 0;
 }
 
 RenderTimeStats BenchmarkTracker::computeStats() const {
@@ -115,6 +174,14 @@ RenderTimeStats BenchmarkTracker::computeStats() const {
   // Determine hiccup threshold
   stats.hiccupThresholdMs = stats.avgRenderTimeMs * hiccupMultiplier_;
   stats.hasHiccup = lastFrameWasHiccup_;
+  stats.jankCount = jankCount_;
+
+  // Percentiles cover every frame, including the ones flushed to overflow records
+  const auto& histogram = getHistogram(BenchmarkSeries::FrameTime);
+  stats.p50RenderTimeMs = histogram.getValueAtPercentile(50.0);
+  stats.p95RenderTimeMs = histogram.getValueAtPercentile(95.0);
+  stats.p99RenderTimeMs = histogram.getValueAtPercentile(99.0);
+  stats.p999RenderTimeMs = histogram.getValueAtPercentile(99.9);
 
   return stats;
 }
@@ -191,6 +258,13 @@ void BenchmarkTracker::reset() {
   totalSampleCount_ = 0;
   lastFrameWasHiccup_ = false;
   lastRenderTimeMs_ = 0.0;
+  for (size_t i = 0; i < kBenchmarkSeriesCount; ++i) {
+    histograms_[i].reset();
+    intervalHistograms_[i].reset();
+  }
+  intervalRecords_.clear();
+  jankCount_ = 0;
+  intervalJankCount_ = 0;
   startTime_ = std::chrono::steady_clock::now();
   lastReportTime_ = startTime_;
 }
@@ -214,13 +288,33 @@ double BenchmarkTracker::getRunningAverageMs() const {
   return runningSum_ / static_cast<double>(totalSampleCount_);
 }
 
+const LatencyHistogram& BenchmarkTracker::getHistogram(BenchmarkSeries series) const {
+  return histograms_[std::min(static_cast<size_t>(series), kBenchmarkSeriesCount - 1)];
+}
+
+const LatencyHistogram& BenchmarkTracker::getIntervalHistogram(BenchmarkSeries series) const {
+  return intervalHistograms_[std::min(static_cast<size_t>(series), kBenchmarkSeriesCount - 1)];
+}
+
+size_t BenchmarkTracker::getJankCount() const {
+  return jankCount_;
+}
+
+size_t BenchmarkTracker::getIntervalJankCount() const {
+  return intervalJankCount_;
+}
+
+const std::deque<BenchmarkIntervalRecord>& BenchmarkTracker::getIntervalRecords() const {
+  return intervalRecords_;
+}
+
 std::string formatBenchmarkStats(const RenderTimeStats& stats, const char* prefix) {
   char buffer[512];
   snprintf(buffer,
            sizeof(buffer),
            "%sFPS: avg=%.1f, min=%.1f, max=%.1f | "
-           "Frame time (ms): avg=%.2f, min=%.2f, max=%.2f | "
-           "Samples: %zu%s",
+           "Frame time (ms): avg=%.2f, min=%.2f, max=%.2f, p95=%.2f, p99=%.2f | "
+           "Samples: %zu, Janks: %zu%s",
            prefix,
            stats.avgFps,
            stats.minFps,
@@ -228,7 +322,10 @@ std::string formatBenchmarkStats(const RenderTimeStats& stats, const char* prefi
            stats.avgRenderTimeMs,
            stats.minRenderTimeMs,
            stats.maxRenderTimeMs,
+           stats.p95RenderTimeMs,
+           stats.p99RenderTimeMs,
            stats.totalSamples,
+           stats.jankCount,
            stats.hasHiccup ? " [HICCUP DETECTED]" : "");
   return {buffer};
 }
@@ -309,6 +406,28 @@ std::string generateFinalBenchmarkReport(const BenchmarkTracker& tracker, bool w
            stats.maxRenderTimeMs);
   oss << line << "║\n";
 
+  snprintf(line,
+           sizeof(line),
+           "║    Percentiles (ms): p50=%.2f, p95=%.2f, p99=%.2f, p99.9=%.2f",
+           stats.p50RenderTimeMs,
+           stats.p95RenderTimeMs,
+           stats.p99RenderTimeMs,
+           stats.p999RenderTimeMs);
+  oss << line;
+  len = strlen(line);
+  for (size_t i = len; i < 80; ++i) {
+    oss << " ";
+  }
+  oss << "║\n";
+
+  snprintf(line, sizeof(line), "║    Janks: %zu", stats.jankCount);
+  oss << line;
+  len = strlen(line);
+  for (size_t i = len; i < 80; ++i) {
+    oss << " ";
+  }
+  oss << "║\n";
+
   oss << "╠══════════════════════════════════════════════════════════════════════════════╣\n";
 
   snprintf(line,
@@ -323,4 +442,68 @@ std::string generateFinalBenchmarkReport(const BenchmarkTracker& tracker, bool w
   return oss.str();
 }
 
+std::string exportBenchmarkJson(const BenchmarkTracker& tracker) {
+  std::array<LatencySummary, kBenchmarkSeriesCount> total;
+  for (size_t i = 0; i < kBenchmarkSeriesCount; ++i) {
+    total[i] = tracker.getHistogram(static_cast<BenchmarkSeries>(i)).summarize();
+  }
+
+  std::ostringstream oss;
+  oss << "{\n";
+  oss << "  \"elapsed_ms\": " << tracker.getElapsedTimeMs() << ",\n";
+  oss << "  \"total_frames\": " << tracker.getTotalFrameCount() << ",\n";
+  oss << "  \"janks\": " << tracker.getJankCount() << ",\n";
+  oss << "  \"series\": ";
+  appendJsonSeries(oss, total, "  ");
+  oss << ",\n";
+  oss << "  \"intervals\": [";
+  const auto& intervals = tracker.getIntervalRecords();
+  for (size_t i = 0; i < intervals.size(); ++i) {
+    oss << (i ? ",\n" : "\n");
+    oss << "    {\n";
+    oss << "      \"elapsed_ms\": " << intervals[i].elapsedTimeMs << ",\n";
+    oss << "      \"janks\": " << intervals[i].jankCount << ",\n";
+    oss << "      \"series\": ";
+    appendJsonSeries(oss, intervals[i].series, "      ");
+    oss << "\n    }";
+  }
+  oss << (intervals.empty() ? "]\n" : "\n  ]\n");
+  oss << "}\n";
+  return oss.str();
+}
+
+std::string exportBenchmarkCsv(const BenchmarkTracker& tracker) {
+  std::ostringstream oss;
+  oss << "elapsed_ms,janks";
+  for (size_t i = 0; i < kBenchmarkSeriesCount; ++i) {
+    const char* name = getBenchmarkSeriesName(static_cast<BenchmarkSeries>(i));
+    for (const char* stat : {"count", "min", "max", "mean", "p50", "p95", "p99", "p999"}) {
+      oss << "," << name << "_" << stat;
+    }
+  }
+  oss << "\n";
+
+  char buffer[128];
+  for (const auto& record : tracker.getIntervalRecords()) {
+    snprintf(buffer, sizeof(buffer), "%.0f,%zu", record.elapsedTimeMs, record.jankCount);
+    oss << buffer;
+    for (const auto& s : record.series) {
+      snprintf(buffer,
+               sizeof(buffer),
+               ",%zu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f",
+               s.count,
+               s.minMs,
+               s.maxMs,
+               s.meanMs,
+               s.p50Ms,
+               s.p95Ms,
+               s.p99Ms,
+               s.p999Ms);
+      oss << buffer;
+    }
+    oss << "\n";
+  }
+  return oss.str();
+}
+
 } // namespace igl::shell
@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <deque>
 #include <limits>
 #include <string>
 #include <vector>
+#include <shell/shared/renderSession/LatencyHistogram.h>
 
 namespace igl::shell {
 
@@ -32,6 +36,32 @@ struct RenderTimeStats {
   size_t totalSamples = 0;
   bool hasHiccup = false;
   double hiccupThresholdMs = 0.0;
+  double p50RenderTimeMs = 0.0;
+  double p95RenderTimeMs = 0.0;
+  double p99RenderTimeMs = 0.0;
+  double p999RenderTimeMs = 0.0;
+  size_t jankCount = 0; ///< number of frames detected as hiccups
+};
+
+/// @brief Timing series recorded by BenchmarkTracker
+enum class BenchmarkSeries : uint8_t {
+  FrameTime = 0, ///< wall-clock interval between frames, see recordRenderTime()
+  CpuEncode, ///< CPU time spent recording the frame
+  SubmitToPresent, ///< CPU time from the end of recording until the frame was presented
+  QueueDrain, ///< CPU time spent waiting for the command queue to finish the frame
+  Count,
+};
+
+constexpr size_t kBenchmarkSeriesCount = static_cast<size_t>(BenchmarkSeries::Count);
+
+/// @brief Returns a short snake_case name of the series, used as a key in exported reports
+const char* getBenchmarkSeriesName(BenchmarkSeries series);
+
+/// @brief Percentiles of every series over one report interval
+struct BenchmarkIntervalRecord {
+  double elapsedTimeMs = 0.0; ///< time since the benchmark started at the end of the interval
+  std::array<LatencySummary, kBenchmarkSeriesCount> series = {};
+  size_t jankCount = 0;
 };
 
 /// @brief Tracks render times and provides benchmark statistics for IGL shell
@@ -39,6 +69,8 @@ struct RenderTimeStats {
 /// This class maintains a circular buffer of render times and computes
 /// performance statistics including FPS metrics. When the buffer overflows,
 /// min/max values are preserved in overflow records to maintain historical data.
+/// Every sample is also recorded in a constant-size LatencyHistogram, both for the whole run and
+/// for the current report interval, so that tail percentiles are never lost.
 class BenchmarkTracker {
  public:
   static constexpr size_t kDefaultBufferSize = 1000;
@@ -46,6 +78,7 @@ class BenchmarkTracker {
       3.0; // Frame is a hiccup if > 3x average frame time
   static constexpr size_t kDefaultReportIntervalMs = 60000; // 1 minute
   static constexpr size_t kDefaultBenchmarkDurationMs = 30 * 60 * 1000; // 30 minutes
+  static constexpr size_t kMaxIntervalRecords = 24 * 60; // 1 day of 1 minute intervals
 
   explicit BenchmarkTracker(size_t bufferSize = kDefaultBufferSize);
 
@@ -53,11 +86,18 @@ class BenchmarkTracker {
   /// @param renderTimeMs The time in milliseconds for the render call
   void recordRenderTime(double renderTimeMs);
 
+  /// @brief Records a sample of one of the per-frame timing series
+  /// @param series The series to record; BenchmarkSeries::FrameTime is equivalent to
+  /// recordRenderTime() without hiccup detection
+  /// @param timeMs The time in milliseconds
+  void recordSeriesTime(BenchmarkSeries series, double timeMs);
+
   /// @brief Checks if it's time to generate a periodic report
   /// @return true if a report should be generated
   [[nodiscard]] bool shouldGeneratePeriodicReport() const;
 
   /// @brief Marks that a periodic report was generated
+  /// Stores the percentiles of the current interval and starts a new interval.
   void markPeriodicReportGenerated();
 
   /// @brief Computes current statistics from all available data
@@ -108,6 +148,22 @@ class BenchmarkTracker {
   /// @brief Gets the current running average (for hiccup detection)
   [[nodiscard]] double getRunningAverageMs() const;
 
+  /// @brief Gets the histogram of all samples of a series since the benchmark started
+  [[nodiscard]] const LatencyHistogram& getHistogram(BenchmarkSeries series) const;
+
+  /// @brief Gets the histogram of the samples of a series in the current report interval
+  [[nodiscard]] const LatencyHistogram& getIntervalHistogram(BenchmarkSeries series) const;
+
+  /// @brief Gets the number of hiccups since the benchmark started
+  [[nodiscard]] size_t getJankCount() const;
+
+  /// @brief Gets the number of hiccups in the current report interval
+  [[nodiscard]] size_t getIntervalJankCount() const;
+
+  /// @brief Gets the records of the last kMaxIntervalRecords completed report intervals, oldest
+  /// first
+  [[nodiscard]] const std::deque<BenchmarkIntervalRecord>& getIntervalRecords() const;
+
  private:
   void flushBufferToOverflow();
   [[nodiscard]] RenderTimeStats computeStatsFromBuffer(const std::vector<double>& buffer) const;
@@ -122,6 +178,12 @@ class BenchmarkTracker {
   double runningSum_ = 0.0;
   size_t totalSampleCount_ = 0;
 
+  std::array<LatencyHistogram, kBenchmarkSeriesCount> histograms_;
+  std::array<LatencyHistogram, kBenchmarkSeriesCount> intervalHistograms_;
+  std::deque<BenchmarkIntervalRecord> intervalRecords_;
+  size_t jankCount_ = 0;
+  size_t intervalJankCount_ = 0;
+
   double hiccupMultiplier_ = kDefaultHiccupMultiplier;
   bool lastFrameWasHiccup_ = false;
   double lastRenderTimeMs_ = 0.0;
@@ -144,4 +206,14 @@ std::string formatBenchmarkStats(const RenderTimeStats& stats, const char* prefi
 /// @return Formatted multi-line string for the final report
 std::string generateFinalBenchmarkReport(const BenchmarkTracker& tracker, bool wasTimeout);
 
+/// @brief Exports the percentiles of every series, for the whole run and per report interval
+/// @param tracker The benchmark tracker with all data
+/// @return JSON object
+std::string exportBenchmarkJson(const BenchmarkTracker& tracker);
+
+/// @brief Exports the per-interval percentiles of every series with one row per report interval
+/// @param tracker The benchmark tracker with all data
+/// @return CSV with a header row
+std::string exportBenchmarkCsv(const BenchmarkTracker& tracker);
+
 } // namespace igl::shell
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <shell/shared/renderSession/LatencyHistogram.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+
+namespace igl::shell {
+namespace {
+
+uint64_t toMicroseconds(double valueMs) {
+  if (!(valueMs > 0.0)) {
+    return 0;
+  }
+  const double valueUs = std::round(valueMs * 1000.0);
+  return valueUs >= static_cast<double>(LatencyHistogram::kMaxValueUs)
+             ? LatencyHistogram::kMaxValueUs
+             : static_cast<uint64_t>(valueUs);
+}
+
+double toMilliseconds(uint64_t valueUs) {
+  return static_cast<double>(valueUs) / 1000.0;
+}
+
+} // namespace
+
+std::string formatLatencySummaryJson(const LatencySummary& summary) {
+  char buffer[256];
+  snprintf(buffer,
+           sizeof(buffer),
+           "{\"count\": %zu, \"min\": %.3f, \"max\": %.3f, \"mean\": %.3f, \"p50\": %.3f, "
+           "\"p95\": %.3f, \"p99\": %.3f, \"p999\": %.3f}",
+           summary.count,
+           summary.minMs,
+           summary.maxMs,
+           summary.meanMs,
+           summary.p50Ms,
+           summary.p95Ms,
+           summary.p99Ms,
+           summary.p999Ms);
+  return buffer;
+}
+
+LatencyHistogram::LatencyHistogram() {
+  reset();
+}
+
+size_t LatencyHistogram::getBucketIndex(uint64_t valueUs) {
+  if (valueUs < kSubBucketCount) {
+    return static_cast<size_t>(valueUs);
+  }
+  // Values in [2^n, 2^(n+1)) share a power-of-two range split into kSubBucketHalfCount buckets
+  const uint32_t msb = static_cast<uint32_t>(std::bit_width(valueUs)) - 1;
+  const uint32_t shift = msb - (kSubBucketBits - 1);
+  return static_cast<size_t>(kSubBucketHalfCount * shift + (valueUs >> shift));
+}
+
+uint64_t LatencyHistogram::getBucketLowestValue(size_t index) {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  const size_t shift = index / kSubBucketHalfCount - 1;
+  const uint64_t subBucket = index % kSubBucketHalfCount + kSubBucketHalfCount;
+  return subBucket << shift;
+}
+
+uint64_t LatencyHistogram::getBucketHighestValue(size_t index) {
+  if (index < kSubBucketCount) {
+    return index;
+  }
+  const size_t shift = index / kSubBucketHalfCount - 1;
+  return getBucketLowestValue(index) + (uint64_t(1) << shift) - 1;
+}
+
+void LatencyHistogram::record(double valueMs) {
+  const uint64_t valueUs = toMicroseconds(valueMs);
+  counts_[getBucketIndex(valueUs)]++;
+  totalCount_++;
+  minValueUs_ = std::min(minValueUs_, valueUs);
+  maxValueUs_ = std::max(maxValueUs_, valueUs);
+  sumMs_ += toMilliseconds(valueUs);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  totalCount_ += other.totalCount_;
+  minValueUs_ = std::min(minValueUs_, other.minValueUs_);
+  maxValueUs_ = std::max(maxValueUs_, other.maxValueUs_);
+  sumMs_ += other.sumMs_;
+}
+
+void LatencyHistogram::reset() {
+  counts_.fill(0);
+  totalCount_ = 0;
+  minValueUs_ = std::numeric_limits<uint64_t>::max();
+  maxValueUs_ = 0;
+  sumMs_ = 0.0;
+}
+
+size_t LatencyHistogram::getCount() const {
+  return totalCount_;
+}
+
+double LatencyHistogram::getMinMs() const {
+  return totalCount_ ? toMilliseconds(minValueUs_) : 0.0;
+}
+
+double LatencyHistogram::getMaxMs() const {
+  return toMilliseconds(maxValueUs_);
+}
+
+double LatencyHistogram::getMeanMs() const {
+  return totalCount_ ? sumMs_ / static_cast<double>(totalCount_) : 0.0;
+}
+
+double LatencyHistogram::getValueAtPercentile(double percentile) const {
+  if (totalCount_ == 0) {
+    return 0.0;
+  }
+  const double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+  const auto target = std::max<size_t>(
+      1, static_cast<size_t>(std::ceil(fraction * static_cast<double>(totalCount_))));
+
+  size_t cumulative = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    cumulative += counts_[i];
+    if (cumulative >= target) {
+      // Report the highest value of the bucket, but never more than what was actually recorded
+      return toMilliseconds(std::min(getBucketHighestValue(i), maxValueUs_));
+    }
+  }
+  return getMaxMs();
+}
+
+size_t LatencyHistogram::getCountAbove(double thresholdMs) const {
+  const uint64_t thresholdUs = toMicroseconds(thresholdMs);
+  size_t count = 0;
+  for (size_t i = getBucketIndex(thresholdUs); i < kBucketCount; ++i) {
+    if (getBucketLowestValue(i) > thresholdUs) {
+      count += counts_[i];
+    }
+  }
+  return count;
+}
+
+LatencySummary LatencyHistogram::summarize() const {
+  LatencySummary summary;
+  summary.count = totalCount_;
+  summary.minMs = getMinMs();
+  summary.maxMs = getMaxMs();
+  summary.meanMs = getMeanMs();
+  summary.p50Ms = getValueAtPercentile(50.0);
+  summary.p95Ms = getValueAtPercentile(95.0);
+  summary.p99Ms = getValueAtPercentile(99.0);
+  summary.p999Ms = getValueAtPercentile(99.9);
+  return summary;
+}
+
+} // namespace igl::shell
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace igl::shell {
+
+/// @brief Percentiles and extremes of a LatencyHistogram
+struct LatencySummary {
+  size_t count = 0;
+  double minMs = 0.0;
+  double maxMs = 0.0;
+  double meanMs = 0.0;
+  double p50Ms = 0.0;
+  double p95Ms = 0.0;
+  double p99Ms = 0.0;
+  double p999Ms = 0.0;
+};
+
+/// @brief Formats a summary as a JSON object with the keys count, min, max, mean, p50, p95, p99 and
+/// p999; all values except count are in milliseconds
+std::string formatLatencySummaryJson(const LatencySummary& summary);
+
+/// @brief Log-linear (HDR-style) histogram of latencies with constant memory
+///
+/// Values are recorded in microseconds. Values below 2^kSubBucketBits are stored exactly; larger
+/// values are grouped into power-of-two ranges which are each split into 2^(kSubBucketBits - 1)
+/// linear buckets, so the relative error of any reported value is below 1 / 2^(kSubBucketBits - 1)
+/// (~1.6%). Values above kMaxValueUs (~71 minutes) are clamped.
+class LatencyHistogram {
+ public:
+  static constexpr uint32_t kSubBucketBits = 7;
+  static constexpr uint64_t kMaxValueUs = std::numeric_limits<uint32_t>::max();
+
+  LatencyHistogram();
+
+  void record(double valueMs);
+  void merge(const LatencyHistogram& other);
+  void reset();
+
+  [[nodiscard]] size_t getCount() const;
+  [[nodiscard]] double getMinMs() const;
+  [[nodiscard]] double getMaxMs() const;
+  [[nodiscard]] double getMeanMs() const;
+
+  /// @brief Returns the smallest value which is >= the given percentage of recorded values
+  /// @param percentile Percentile in the range [0, 100]
+  [[nodiscard]] double getValueAtPercentile(double percentile) const;
+
+  /// @brief Returns the number of recorded values which are larger than thresholdMs
+  [[nodiscard]] size_t getCountAbove(double thresholdMs) const;
+
+  [[nodiscard]] LatencySummary summarize() const;
+
+ private:
+  static constexpr uint32_t kSubBucketCount = 1u << kSubBucketBits;
+  static constexpr uint32_t kSubBucketHalfCount = kSubBucketCount / 2;
+  static constexpr size_t kBucketCount = (32 - kSubBucketBits + 2) * kSubBucketHalfCount;
+
+  static size_t getBucketIndex(uint64_t valueUs);
+  static uint64_t getBucketLowestValue(size_t index);
+  static uint64_t getBucketHighestValue(size_t index);
+
+  std::array<uint64_t, kBucketCount> counts_;
+  size_t totalCount_ = 0;
+  uint64_t minValueUs_ = std::numeric_limits<uint64_t>::max();
+  uint64_t maxValueUs_ = 0;
+  double sumMs_ = 0.0;
+};
+
+} // namespace igl::shell
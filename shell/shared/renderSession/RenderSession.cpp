@@ -8,7 +8,9 @@
 #include <shell/shared/renderSession/RenderSession.h>
 
 #include <chrono>
+#include <cstdio>
 #include <cstdlib>
+#include <string>
 #include <thread>
 #include <shell/shared/platform/DisplayContext.h>
 #include <shell/shared/renderSession/AppParams.h>
@@ -20,6 +22,18 @@
 #endif
 
 namespace igl::shell {
+namespace {
+
+bool writeTextFile(const std::string& path, const std::string& contents) {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  const bool ok = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+  return fclose(file) == 0 && ok;
+}
+
+} // namespace
 
 RenderSession::RenderSession(std::shared_ptr<Platform> platform) :
   platform_(std::move(platform)), appParams_(std::make_shared<AppParams>()) {}
@@ -63,6 +77,10 @@ const std::shared_ptr<Platform>& RenderSession::platform() const noexcept {
 }
 
 float RenderSession::getDeltaSeconds() noexcept {
+  if (shellParams_ && shellParams_->benchmarkParams.has_value() &&
+      shellParams_->benchmarkParams->fixedTimeStepMs > 0.0) {
+    return static_cast<float>(shellParams_->benchmarkParams->fixedTimeStepMs / 1000.0);
+  }
   const double newTime = getSeconds();
   const float deltaSeconds = float(newTime - lastTime_);
   lastTime_ = newTime;
@@ -122,6 +140,12 @@ void RenderSession::recordBenchmarkFrame(double renderTimeMs) noexcept {
   }
 }
 
+void RenderSession::recordBenchmarkSeriesTime(BenchmarkSeries series, double timeMs) noexcept {
+  if (benchmarkTracker_) {
+    benchmarkTracker_->recordSeriesTime(series, timeMs);
+  }
+}
+
 void RenderSession::checkBenchmarkPeriodicReport() noexcept {
   if (!benchmarkTracker_) {
     return;
@@ -140,7 +164,23 @@ void RenderSession::checkBenchmarkPeriodicReport() noexcept {
                  stats.avgRenderTimeMs,
                  stats.minRenderTimeMs,
                  stats.maxRenderTimeMs);
-    IGL_LOG_INFO("[IGL Benchmark] Total frames: %zu\n", stats.totalSamples);
+    IGL_LOG_INFO("[IGL Benchmark] Total frames: %zu, janks in interval: %zu\n",
+                 stats.totalSamples,
+                 benchmarkTracker_->getIntervalJankCount());
+    for (size_t i = 0; i < kBenchmarkSeriesCount; ++i) {
+      const auto series = static_cast<BenchmarkSeries>(i);
+      const auto summary = benchmarkTracker_->getIntervalHistogram(series).summarize();
+      if (summary.count == 0) {
+        continue;
+      }
+      IGL_LOG_INFO("[IGL Benchmark] %s (ms): p50=%.2f, p95=%.2f, p99=%.2f, p99.9=%.2f, max=%.2f\n",
+                   getBenchmarkSeriesName(series),
+                   summary.p50Ms,
+                   summary.p95Ms,
+                   summary.p99Ms,
+                   summary.p999Ms,
+                   summary.maxMs);
+    }
 
     // Suppress unused variable warnings when logging is disabled
     (void)stats;
@@ -158,9 +198,10 @@ bool RenderSession::isBenchmarkExpired() const noexcept {
 }
 
 void RenderSession::logFinalBenchmarkReport(bool wasTimeout) noexcept {
-  if (!benchmarkTracker_) {
+  if (!benchmarkTracker_ || finalBenchmarkReportLogged_) {
     return;
   }
+  finalBenchmarkReportLogged_ = true;
 
   // Log the final report line by line to ensure it appears in logcat
   const auto stats = benchmarkTracker_->computeStats();
@@ -183,10 +224,25 @@ void RenderSession::logFinalBenchmarkReport(bool wasTimeout) noexcept {
   IGL_LOG_INFO("[IGL Benchmark] Average: %.2f ms\n", stats.avgRenderTimeMs);
   IGL_LOG_INFO("[IGL Benchmark] Minimum: %.2f ms\n", stats.minRenderTimeMs);
   IGL_LOG_INFO("[IGL Benchmark] Maximum: %.2f ms\n", stats.maxRenderTimeMs);
+  IGL_LOG_INFO("[IGL Benchmark] Percentiles: p50=%.2f, p95=%.2f, p99=%.2f, p99.9=%.2f ms\n",
+               stats.p50RenderTimeMs,
+               stats.p95RenderTimeMs,
+               stats.p99RenderTimeMs,
+               stats.p999RenderTimeMs);
+  IGL_LOG_INFO("[IGL Benchmark] Janks: %zu\n", stats.jankCount);
   IGL_LOG_INFO("[IGL Benchmark] Overflow Records: %zu\n",
                benchmarkTracker_->getOverflowRecordCount());
   IGL_LOG_INFO("[IGL Benchmark] ===============================================\n");
 
+  // Machine-readable exports of the percentiles of every series
+  const std::string& reportFile = shellParams_->benchmarkParams->reportFile;
+  if (!reportFile.empty()) {
+    if (!writeTextFile(reportFile + ".json", exportBenchmarkJson(*benchmarkTracker_)) ||
+        !writeTextFile(reportFile + ".csv", exportBenchmarkCsv(*benchmarkTracker_))) {
+      IGL_LOG_ERROR("[IGL Benchmark] Failed to write %s.json/.csv\n", reportFile.c_str());
+    }
+  }
+
   // Suppress unused variable warnings when logging is disabled
   (void)stats;
   (void)elapsedSec;
@@ -194,7 +250,7 @@ void RenderSession::logFinalBenchmarkReport(bool wasTimeout) noexcept {
   (void)wasTimeout;
 }
 
-void RenderSession::runUpdate(SurfaceTextures surfaceTextures) noexcept {
+void RenderSession::runUpdate(SurfaceTextures surfaceTextures, bool throttle) noexcept {
   // Check if frozen (frame gate)
   if (frozen_) {
     return;
@@ -243,8 +299,12 @@ void RenderSession::runUpdate(SurfaceTextures surfaceTextures) noexcept {
     // Check for periodic benchmark reporting
     checkBenchmarkPeriodicReport();
 
-    // Check if benchmark has expired (only log once)
-    if (benchmarkTracker_->hasBenchmarkExpired() && !benchmarkExpiredLogged_) {
+    // Check if benchmark has expired (only log once). A run with a fixed number of frames is ended
+    // by the platform code once its report is written, so the duration does not cut it short.
+    const bool hasFixedFrameCount = shellParams_ && shellParams_->benchmarkParams &&
+                                    shellParams_->benchmarkParams->numFrames > 0;
+    if (!hasFixedFrameCount && benchmarkTracker_->hasBenchmarkExpired() &&
+        !benchmarkExpiredLogged_) {
       IGL_LOG_INFO("[IGL Benchmark] Benchmark duration expired, requesting exit\n");
       logFinalBenchmarkReport(true);
       appParamsRef().exitRequested = true;
@@ -265,23 +325,33 @@ void RenderSession::runUpdate(SurfaceTextures surfaceTextures) noexcept {
     update(std::move(surfaceTextures));
     IGL_PROFILER_ZONE_END();
   }
+  if (benchmarkTracker_) {
+    benchmarkTracker_->recordSeriesTime(BenchmarkSeries::CpuEncode,
+                                        (getSeconds() - startTime) * 1000.0);
+  }
 
   // FPS throttling — sleep is captured in the NEXT frame's wall-clock interval
-  if (shellParams_ && shellParams_->fpsThrottleMs > 0) {
-    const double endTime = getSeconds();
-    const double frameTimeMs = (endTime - startTime) * 1000.0;
-    const double targetMs =
-        shellParams_->fpsThrottleRandom
-            // NOLINTNEXTLINE(cert-msc50-cpp, clang-analyzer-security.insecureAPI.rand)
-            ? static_cast<double>(1 + (std::rand() % shellParams_->fpsThrottleMs))
-            : static_cast<double>(shellParams_->fpsThrottleMs);
-    if (frameTimeMs < targetMs) {
-      std::this_thread::sleep_for(
-          std::chrono::milliseconds(static_cast<int>(targetMs - frameTimeMs)));
-    }
+  if (throttle) {
+    throttleFrame(startTime);
   }
 
   frameCount_++;
 }
 
+void RenderSession::throttleFrame(double frameStartTime) noexcept {
+  if (!shellParams_ || shellParams_->fpsThrottleMs == 0) {
+    return;
+  }
+  const double frameTimeMs = (getSeconds() - frameStartTime) * 1000.0;
+  const double targetMs =
+      shellParams_->fpsThrottleRandom
+          // NOLINTNEXTLINE(cert-msc50-cpp, clang-analyzer-security.insecureAPI.rand)
+          ? static_cast<double>(1 + (std::rand() % shellParams_->fpsThrottleMs))
+          : static_cast<double>(shellParams_->fpsThrottleMs);
+  if (frameTimeMs < targetMs) {
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(static_cast<int>(targetMs - frameTimeMs)));
+  }
+}
+
 } // namespace igl::shell
@@ -39,8 +39,16 @@ class RenderSession {
   /// 1. Measures the time taken by update()
   /// 2. Records the frame time for benchmarking
   /// 3. Checks for periodic reporting
-  /// 4. Checks for benchmark expiration and sets exitRequested if needed
-  void runUpdate(SurfaceTextures surfaceTextures) noexcept;
+  /// 4. Checks for benchmark expiration and sets exitRequested if needed, unless a fixed number of
+  ///    benchmark frames was requested: the platform code ends such runs after writing its report
+  /// 5. Applies FPS throttling if `throttle` is true
+  /// Platform code which presents the frame after runUpdate() should pass `throttle` = false and
+  /// call throttleFrame() once the frame was presented.
+  void runUpdate(SurfaceTextures surfaceTextures, bool throttle = true) noexcept;
+
+  /// @brief Sleeps for the rest of the frame time requested by ShellParams::fpsThrottleMs
+  /// @param frameStartTime getSeconds() at the start of the frame
+  void throttleFrame(double frameStartTime) noexcept;
   virtual void teardown() noexcept {}
 
   void updateDisplayScale(float scale) noexcept;
@@ -64,7 +72,7 @@ class RenderSession {
     currentQuadLayer_ = layer;
   }
 
-  /// return the number of seconds since the last call
+  /// return the number of seconds since the last call, or the fixed benchmark time step if set
   float getDeltaSeconds() noexcept;
 
   static double getSeconds() noexcept;
@@ -92,6 +100,12 @@ class RenderSession {
   /// @param renderTimeMs The time in milliseconds for the update call
   void recordBenchmarkFrame(double renderTimeMs) noexcept;
 
+  /// @brief Records a sample of a per-frame timing series measured by the platform code
+  /// @param series Typically BenchmarkSeries::SubmitToPresent or BenchmarkSeries::QueueDrain; the
+  /// CPU encode time is recorded by runUpdate()
+  /// @param timeMs The time in milliseconds
+  void recordBenchmarkSeriesTime(BenchmarkSeries series, double timeMs) noexcept;
+
   /// @brief Checks and handles periodic benchmark reporting
   /// Logs stats every minute if benchmark mode is enabled
   void checkBenchmarkPeriodicReport() noexcept;
@@ -100,7 +114,8 @@ class RenderSession {
   /// @return true if benchmark duration exceeded
   [[nodiscard]] bool isBenchmarkExpired() const noexcept;
 
-  /// @brief Generates and logs the final benchmark report
+  /// @brief Generates and logs the final benchmark report and writes the reportFile exports
+  /// Only the first call has an effect, so every path that ends a run may call it.
   /// @param wasTimeout true if the benchmark ended due to timeout
   void logFinalBenchmarkReport(bool wasTimeout) noexcept;
 
@@ -131,6 +146,7 @@ class RenderSession {
   std::unique_ptr<BenchmarkTracker> benchmarkTracker_;
   uint32_t frameCount_ = 0;
   bool benchmarkExpiredLogged_ = false;
+  bool finalBenchmarkReportLogged_ = false;
   bool loggedMissingParams_ = false;
   bool frozen_ = false;
   double prevFrameStartTime_ = 0.0;
@@ -12,43 +12,56 @@
 
 namespace igl::shell {
 
-void saveFrameBufferToPng(const char* absoluteFilename,
-                          const std::shared_ptr<IFramebuffer>& framebuffer,
-                          Platform& platform) {
-  auto drawableSurface = framebuffer->getColorAttachment(0);
-  auto frameBufferSize = drawableSurface->getDimensions();
-  const int bytesPerPixel = 4;
-  const auto rangeDesc =
-      TextureRangeDesc::new2D(0, 0, frameBufferSize.width, frameBufferSize.height);
-  ImageData imageData;
-  imageData.desc.format = drawableSurface->getFormat();
-  imageData.desc.width = frameBufferSize.width;
-  imageData.desc.height = frameBufferSize.height;
-  auto buffer =
-      std::make_unique<uint8_t[]>(frameBufferSize.width * frameBufferSize.height * bytesPerPixel);
+FramebufferPixels readFramebufferPixels(IFramebuffer& framebuffer, ICommandQueue& commandQueue) {
+  auto drawableSurface = framebuffer.getColorAttachment(0);
+  const auto frameBufferSize = drawableSurface->getDimensions();
+  const size_t bytesPerPixel = 4;
 
-  // Per IGL Error Handling rule #24, every resource creation call must pass a
-  // Result* and check it; passing nullptr silently swallows errors.
-  Result result;
-  const auto commandQueue = platform.getDevice().createCommandQueue({}, &result);
-  IGL_DEBUG_ASSERT(result.isOk(), "createCommandQueue() failed: %s", result.message.c_str());
-  IGL_DEBUG_ASSERT(commandQueue != nullptr);
-  framebuffer->copyBytesColorAttachment(*commandQueue, 0, buffer.get(), rangeDesc);
+  FramebufferPixels pixels;
+  pixels.format = drawableSurface->getFormat();
+  pixels.width = static_cast<uint32_t>(frameBufferSize.width);
+  pixels.height = static_cast<uint32_t>(frameBufferSize.height);
+  pixels.numBytes = static_cast<size_t>(pixels.width) * pixels.height * bytesPerPixel;
+  pixels.bytes = std::make_unique<uint8_t[]>(pixels.numBytes);
 
-  const size_t numPixels = frameBufferSize.width * frameBufferSize.height * bytesPerPixel;
+  const auto rangeDesc =
+      TextureRangeDesc::new2D(0, 0, frameBufferSize.width, frameBufferSize.height);
+  framebuffer.copyBytesColorAttachment(commandQueue, 0, pixels.bytes.get(), rangeDesc);
+  return pixels;
+}
 
+ImageData toImageWriterData(FramebufferPixels pixels) {
 #if IGL_PLATFORM_WINDOWS
-  if (imageData.desc.format == TextureFormat::BGRA_UNorm8) {
+  if (pixels.format == TextureFormat::BGRA_UNorm8) {
     // Swap B and R channels, as image writer expects RGBA.
     // Note that this is only defined for the Windows platform, as in practice
     // BGRA might only be used there for render targets.
-    for (size_t i = 0; i < numPixels; i += bytesPerPixel) {
-      std::swap(buffer.get()[i], buffer.get()[i + 2]);
+    for (size_t i = 0; i < pixels.numBytes; i += 4) {
+      std::swap(pixels.bytes[i], pixels.bytes[i + 2]);
     }
   }
 #endif
 
-  imageData.data = iglu::textureloader::IData::tryCreate(std::move(buffer), numPixels, nullptr);
+  ImageData imageData;
+  imageData.desc.format = pixels.format;
+  imageData.desc.width = pixels.width;
+  imageData.desc.height = pixels.height;
+  imageData.data =
+      iglu::textureloader::IData::tryCreate(std::move(pixels.bytes), pixels.numBytes, nullptr);
+  return imageData;
+}
+
+void saveFrameBufferToPng(const char* absoluteFilename,
+                          const std::shared_ptr<IFramebuffer>& framebuffer,
+                          Platform& platform) {
+  // Per IGL Error Handling rule #24, every resource creation call must pass a
+  // Result* and check it; passing nullptr silently swallows errors.
+  Result result;
+  const auto commandQueue = platform.getDevice().createCommandQueue({}, &result);
+  IGL_DEBUG_ASSERT(result.isOk(), "createCommandQueue() failed: %s", result.message.c_str());
+  IGL_DEBUG_ASSERT(commandQueue != nullptr);
+
+  const ImageData imageData = toImageWriterData(readFramebufferPixels(*framebuffer, *commandQueue));
 
   IGLLog(IGLLogInfo, "Writing screenshot to: '%s'\n", absoluteFilename);
   platform.getImageWriter().writeImage(absoluteFilename, imageData);
@@ -8,13 +8,31 @@
 #pragma once
 
 #include <memory>
+#include <shell/shared/imageLoader/ImageLoader.h>
 #include <shell/shared/platform/Platform.h>
 
 namespace igl {
+class ICommandQueue;
 class IFramebuffer;
 } // namespace igl
 
 namespace igl::shell {
+
+/// Tightly packed 4 bytes per pixel copy of a color attachment
+struct FramebufferPixels {
+  TextureFormat format = TextureFormat::Invalid;
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::unique_ptr<uint8_t[]> bytes;
+  size_t numBytes = 0;
+};
+
+/// Copies color attachment 0 of the framebuffer into CPU memory. This only performs the GPU copy.
+FramebufferPixels readFramebufferPixels(IFramebuffer& framebuffer, ICommandQueue& commandQueue);
+
+/// Converts pixels to the RGBA layout image writers expect and wraps them into ImageData
+ImageData toImageWriterData(FramebufferPixels pixels);
+
 void saveFrameBufferToPng(const char* absoluteFilename,
                           const std::shared_ptr<IFramebuffer>& framebuffer,
                           Platform& platform);
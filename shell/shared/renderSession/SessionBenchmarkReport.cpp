@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <shell/shared/renderSession/SessionBenchmarkReport.h>
+
+#include <cstdio>
+
+namespace igl::shell {
+namespace {
+
+std::string escapeJson(const std::string& str) {
+  std::string result;
+  result.reserve(str.size());
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result;
+}
+
+} // namespace
+
+SessionBenchmarkReport::SessionBenchmarkReport(std::string sessionName, std::string backendName) :
+  sessionName_(std::move(sessionName)), backendName_(std::move(backendName)) {}
+
+void SessionBenchmarkReport::recordFrame(const FrameTimingSample& sample) {
+  encodeMs_.record(sample.encodeMs);
+  submitMs_.record(sample.submitMs);
+  queueDrainMs_.record(sample.queueDrainMs);
+}
+
+size_t SessionBenchmarkReport::getFrameCount() const {
+  return encodeMs_.getCount();
+}
+
+const LatencyHistogram& SessionBenchmarkReport::getEncodeHistogram() const {
+  return encodeMs_;
+}
+
+const LatencyHistogram& SessionBenchmarkReport::getSubmitHistogram() const {
+  return submitMs_;
+}
+
+const LatencyHistogram& SessionBenchmarkReport::getQueueDrainHistogram() const {
+  return queueDrainMs_;
+}
+
+std::string SessionBenchmarkReport::toJson() const {
+  std::string json = "{\n";
+  json += "  \"session\": \"" + escapeJson(sessionName_) + "\",\n";
+  json += "  \"backend\": \"" + escapeJson(backendName_) + "\",\n";
+  json += "  \"frames\": " + std::to_string(getFrameCount()) + ",\n";
+  json += "  \"metrics\": {\n";
+  json += "    \"encode_ms\": " + formatLatencySummaryJson(encodeMs_.summarize()) + ",\n";
+  json += "    \"submit_ms\": " + formatLatencySummaryJson(submitMs_.summarize()) + ",\n";
+  json += "    \"queue_drain_ms\": " + formatLatencySummaryJson(queueDrainMs_.summarize()) + "\n";
+  json += "  }\n}\n";
+  return json;
+}
+
+bool SessionBenchmarkReport::writeJson(const std::string& path) const {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+  const std::string json = toJson();
+  const bool ok = fwrite(json.data(), 1, json.size(), file) == json.size();
+  return fclose(file) == 0 && ok;
+}
+
+} // namespace igl::shell
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <string>
+#include <shell/shared/renderSession/LatencyHistogram.h>
+
+namespace igl::shell {
+
+/// @brief Timings of a single frame of a headless benchmark run
+struct FrameTimingSample {
+  double encodeMs = 0.0; ///< CPU time spent in RenderSession::update(), including its submits
+  double submitMs = 0.0; ///< CPU time from the end of update() until the frame was presented
+  double queueDrainMs = 0.0; ///< CPU time spent waiting for the command queue to drain afterwards
+};
+
+/// @brief Collects per-frame timings of a fixed-length headless run and writes them as JSON
+///
+/// Every series is recorded in a LatencyHistogram. The JSON output is consumed by
+/// shell/scripts/benchmark_sessions.py, which runs every session executable and compares the
+/// results against a stored baseline.
+class SessionBenchmarkReport {
+ public:
+  SessionBenchmarkReport(std::string sessionName, std::string backendName);
+
+  void recordFrame(const FrameTimingSample& sample);
+
+  [[nodiscard]] size_t getFrameCount() const;
+
+  [[nodiscard]] const LatencyHistogram& getEncodeHistogram() const;
+  [[nodiscard]] const LatencyHistogram& getSubmitHistogram() const;
+  [[nodiscard]] const LatencyHistogram& getQueueDrainHistogram() const;
+
+  /// @brief Formats the report as a JSON object with the session and backend names, the number of
+  /// frames and a "metrics" object with the summary of every series (see
+  /// formatLatencySummaryJson())
+  [[nodiscard]] std::string toJson() const;
+
+  /// @brief Writes toJson() to the given path
+  /// @return false if the file could not be written
+  bool writeJson(const std::string& path) const;
+
+ private:
+  std::string sessionName_;
+  std::string backendName_;
+  LatencyHistogram encodeMs_;
+  LatencyHistogram submitMs_;
+  LatencyHistogram queueDrainMs_;
+};
+
+} // namespace igl::shell
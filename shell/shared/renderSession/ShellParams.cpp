@@ -69,6 +69,18 @@ std::optional<BenchmarkRenderSessionParams> parseBenchmarkRenderSessionParams(
     } else if (arg == "--render-buffer-size" && tryConsumeNext(args, i)) {
       p.renderTimeBufferSize = std::stoul(args[i]);
       found = true;
+    } else if (arg == "--benchmark-frames" && tryConsumeNext(args, i)) {
+      p.numFrames = std::stoul(args[i]);
+      found = true;
+    } else if (arg == "--benchmark-output" && tryConsumeNext(args, i)) {
+      p.outputFile = args[i];
+      found = true;
+    } else if (arg == "--benchmark-report" && tryConsumeNext(args, i)) {
+      p.reportFile = args[i];
+      found = true;
+    } else if (arg == "--fixed-time-step" && tryConsumeNext(args, i)) {
+      p.fixedTimeStepMs = std::stod(args[i]);
+      found = true;
     } else if (arg == "--force-multiview") {
       // handled in parseShellParams; skip here
     } else if (arg.rfind("--", 0) == 0) {
@@ -118,6 +130,8 @@ void parseShellParams(const std::vector<std::string>& args, ShellParams& shellPa
       shellParams.screenshotFileName = args[i];
     } else if (arg == "--screenshot-number" && tryConsumeNext(args, i)) {
       shellParams.screenshotNumber = static_cast<uint32_t>(std::stoi(args[i]));
+    } else if (arg == "--screenshot-interval" && tryConsumeNext(args, i)) {
+      shellParams.screenshotInterval = static_cast<uint32_t>(std::stoi(args[i]));
     } else if (arg == "--viewport-size" && tryConsumeNext(args, i)) {
       unsigned int w = 0;
       unsigned int h = 0;
@@ -38,6 +38,21 @@ struct BenchmarkRenderSessionParams {
 
   /// @brief Size of the circular buffer for storing render times
   size_t renderTimeBufferSize = 1000;
+
+  /// @brief Number of frames to render before exiting (default: 0, run for benchmarkDurationMs)
+  /// When set, per-frame CPU encode, submit and queue drain times are collected for the whole run.
+  size_t numFrames = 0;
+
+  /// @brief Path of the JSON file the per-frame timing summary is written to when numFrames is set
+  std::string outputFile;
+
+  /// @brief Path prefix of the <prefix>.json and <prefix>.csv percentile reports written with the
+  /// final benchmark report. Set to an empty string to disable the export.
+  std::string reportFile;
+
+  /// @brief Fixed time step in milliseconds returned by RenderSession::getDeltaSeconds()
+  /// Makes animations deterministic so that runs are comparable. Set to 0 to use wall-clock time.
+  double fixedTimeStepMs = 0.0;
 };
 
 struct ShellParams {
@@ -54,6 +69,8 @@ struct ShellParams {
   std::array<HandTracking, 2> handTracking = {};
   std::string screenshotFileName = "screenshot.png";
   uint32_t screenshotNumber = ~0u; // frame number to save as a screenshot in headless more
+  // save every Nth frame as "<screenshotFileName stem>_<frame><ext>" on worker threads (0 = off)
+  uint32_t screenshotInterval = 0;
   bool isHeadless = false;
   bool enableVulkanValidationLayers = true;
   std::optional<BenchmarkRenderSessionParams> benchmarkParams = {};
@@ -10,7 +10,6 @@
 #include <shell/windows/common/GlfwShell.h>
 
 #include <cmath>
-#include <cstdlib>
 #include <thread>
 #include <shell/shared/input/InputDispatcher.h>
 #include <shell/shared/renderSession/AppParams.h>
@@ -18,7 +17,10 @@
 #include <shell/shared/renderSession/IRenderSessionFactory.h>
 #include <shell/shared/renderSession/RenderSession.h>
 #include <shell/shared/renderSession/ScreenshotTestRenderSessionHelper.h>
+#include <shell/shared/renderSession/SessionBenchmarkReport.h>
 #include <shell/shared/renderSession/ShellParams.h>
+#include <igl/CommandBuffer.h>
+#include <igl/CommandQueue.h>
 #include <igl/Framebuffer.h>
 
 namespace igl::shell {
@@ -38,6 +40,26 @@ MouseButton getIGLMouseButton(int button) {
 
   return igl::shell::MouseButton::Middle;
 }
+
+std::string getExecutableName(const char* path) {
+  const std::string str = path ? path : "";
+  const size_t pos = str.find_last_of("/\\");
+  std::string name = pos == std::string::npos ? str : str.substr(pos + 1);
+  const size_t ext = name.rfind(".exe");
+  if (ext != std::string::npos && ext + 4 == name.size()) {
+    name.resize(ext);
+  }
+  return name;
+}
+
+// Submits an empty command buffer and waits for it so that all GPU work of the frame is finished.
+void drainCommandQueue(ICommandQueue& queue) {
+  auto commandBuffer = queue.createCommandBuffer({}, nullptr);
+  if (commandBuffer) {
+    queue.submit(*commandBuffer);
+    commandBuffer->waitUntilCompleted();
+  }
+}
 } // namespace
 
 GlfwShell::GlfwShell() : window_(nullptr, &glfwDestroyWindow) {}
@@ -196,6 +218,7 @@ bool GlfwShell::initialize(int argc,
                            RenderSessionWindowConfig suggestedWindowConfig,
                            const RenderSessionConfig& suggestedSessionConfig) noexcept {
   igl::shell::Platform::initializeCommandLineArgs(argc, argv);
+  executableName_ = getExecutableName(argc > 0 ? argv[0] : nullptr);
 
   // Use the comprehensive parser
   auto args = shell::convertArgvToParams(argc, argv);
@@ -242,6 +265,16 @@ bool GlfwShell::initialize(int argc,
 void GlfwShell::run() noexcept {
   uint64_t frameNumber = 0;
   bool frozen = false;
+
+  // A fixed frame count turns the run into a headless benchmark which reports per-frame timings
+  const auto& benchmarkParams = shellParams_.benchmarkParams;
+  const size_t numBenchmarkFrames = benchmarkParams ? benchmarkParams->numFrames : 0;
+  std::unique_ptr<SessionBenchmarkReport> benchmarkReport;
+  if (numBenchmarkFrames > 0) {
+    benchmarkReport =
+        std::make_unique<SessionBenchmarkReport>(executableName_, sessionConfig_.displayName);
+  }
+
   while ((!window_ || !glfwWindowShouldClose(window_.get())) &&
          !session_->appParams().exitRequested) {
     if (frozen) {
@@ -267,25 +300,46 @@ void GlfwShell::run() noexcept {
       continue;
     }
 
+    // runUpdate() feeds the benchmark tracker; FPS throttling is applied below, once the frame has
+    // been presented, so that it is not part of the measured encode time
     const double startTime = RenderSession::getSeconds();
-    session_->update(std::move(surfaceTextures));
+    session_->runUpdate(std::move(surfaceTextures), /* throttle */ false);
+    const double encodeEndTime = RenderSession::getSeconds();
     postUpdate();
+    const double submitEndTime = RenderSession::getSeconds();
+    session_->recordBenchmarkSeriesTime(BenchmarkSeries::SubmitToPresent,
+                                        (submitEndTime - encodeEndTime) * 1000.0);
 
-    if (params.fpsThrottleMs > 0) {
-      const double endTime = RenderSession::getSeconds();
-      const double frameTimeMs = (endTime - startTime) * 1000.0;
-      const double targetMs = params.fpsThrottleRandom
-                                  ? static_cast<double>(1 + (std::rand() % params.fpsThrottleMs))
-                                  : static_cast<double>(params.fpsThrottleMs);
-      if (frameTimeMs < targetMs) {
-        std::this_thread::sleep_for(
-            std::chrono::milliseconds(static_cast<int>(targetMs - frameTimeMs)));
+    if (benchmarkReport) {
+      if (auto* commandQueue = session_->getCommandQueue()) {
+        drainCommandQueue(*commandQueue);
       }
+      const double queueDrainMs = (RenderSession::getSeconds() - submitEndTime) * 1000.0;
+      session_->recordBenchmarkSeriesTime(BenchmarkSeries::QueueDrain, queueDrainMs);
+      benchmarkReport->recordFrame({
+          .encodeMs = (encodeEndTime - startTime) * 1000.0,
+          .submitMs = (submitEndTime - encodeEndTime) * 1000.0,
+          .queueDrainMs = queueDrainMs,
+      });
     }
 
+    session_->throttleFrame(startTime);
+
     if (window_) {
       glfwPollEvents();
     }
+    const uint32_t screenshotInterval = session_->shellParams().screenshotInterval;
+    if (screenshotInterval > 0 && frameNumber % screenshotInterval == 0) {
+      captureScreenshot(colorTexture, frameNumber);
+    }
+    if (benchmarkReport) {
+      if (benchmarkReport->getFrameCount() >= numBenchmarkFrames) {
+        writeBenchmarkReport(*benchmarkReport);
+        break;
+      }
+      frameNumber++;
+      continue;
+    }
     if (frameNumber == session_->shellParams().screenshotNumber) {
       IGL_LOG_INFO("\nWe are running screenshot test - breaking after %u frame\n",
                    static_cast<uint32_t>(frameNumber));
@@ -299,6 +353,64 @@ void GlfwShell::run() noexcept {
     }
     frameNumber++;
   }
+
+  // Every way out of the loop ends the run, so the final report is written here exactly once
+  session_->logFinalBenchmarkReport(false);
+
+  if (screenshotWriter_) {
+    screenshotWriter_->flush();
+    const auto stats = screenshotWriter_->getStats();
+    IGL_LOG_INFO("[IGL Shell] Screenshots: %llu written, %llu dropped, %.1f ms waited\n",
+                 static_cast<unsigned long long>(stats.written),
+                 static_cast<unsigned long long>(stats.dropped),
+                 stats.waitSeconds * 1000.0);
+  }
+}
+
+void GlfwShell::captureScreenshot(const std::shared_ptr<ITexture>& colorTexture,
+                                  uint64_t frameNumber) noexcept {
+  const std::string& fileName = session_->shellParams().screenshotFileName;
+  ICommandQueue* commandQueue = session_->getCommandQueue();
+  if (fileName.empty() || !commandQueue) {
+    return;
+  }
+  if (!screenshotWriter_) {
+    screenshotWriter_ = std::make_unique<AsyncScreenshotWriter>(platform_->getImageWriter());
+  }
+
+  Result result;
+  const auto framebuffer = platform_->getDevice().createFramebuffer(
+      {.colorAttachments = {{.texture = colorTexture}}}, &result);
+  if (!IGL_DEBUG_VERIFY(result.isOk() && framebuffer)) {
+    return;
+  }
+
+  // "screenshot.png" -> "screenshot_<frame>.png"
+  const size_t ext = fileName.rfind('.');
+  const std::string suffix = "_" + std::to_string(frameNumber);
+  std::string path = ext == std::string::npos
+                         ? fileName + suffix
+                         : fileName.substr(0, ext) + suffix + fileName.substr(ext);
+  screenshotWriter_->capture(std::move(path), *framebuffer, *commandQueue);
+}
+
+void GlfwShell::writeBenchmarkReport(const SessionBenchmarkReport& report) noexcept {
+  [[maybe_unused]] const auto encode = report.getEncodeHistogram().summarize();
+  [[maybe_unused]] const auto submit = report.getSubmitHistogram().summarize();
+  [[maybe_unused]] const auto queueDrain = report.getQueueDrainHistogram().summarize();
+  IGL_LOG_INFO("[IGL Benchmark] %s (%s): %zu frames\n",
+               executableName_.c_str(),
+               sessionConfig_.displayName.c_str(),
+               report.getFrameCount());
+  IGL_LOG_INFO("[IGL Benchmark] Median (ms): encode=%.3f, submit=%.3f, queue drain=%.3f\n",
+               encode.p50Ms,
+               submit.p50Ms,
+               queueDrain.p50Ms);
+
+  const std::string& outputFile = shellParams_.benchmarkParams->outputFile;
+  if (!outputFile.empty() && !report.writeJson(outputFile)) {
+    IGL_LOG_ERROR("[IGL Benchmark] Failed to write %s\n", outputFile.c_str());
+  }
 }
 
 void GlfwShell::teardown() noexcept {
@@ -306,6 +418,7 @@ void GlfwShell::teardown() noexcept {
   // whatever else global destructors may there, will be called after these. One
   // example is a graphics resource tracker in the client code, which otherwise
   // would not be guaranteed to be called after the graphics resources release.
+  screenshotWriter_.reset();
   session_.reset();
   platform_.reset();
   window_.reset();
@@ -33,6 +33,7 @@
 
 #include <GLFW/glfw3.h>
 #include <GLFW/glfw3native.h>
+#include <shell/shared/renderSession/AsyncScreenshotWriter.h>
 #include <shell/shared/renderSession/RenderSession.h>
 #include <shell/shared/renderSession/RenderSessionConfig.h>
 #include <shell/shared/renderSession/RenderSessionWindowConfig.h>
@@ -40,6 +41,8 @@
 
 namespace igl::shell {
 
+class SessionBenchmarkReport;
+
 class GlfwShell {
  public:
   GlfwShell();
@@ -74,6 +77,9 @@ class GlfwShell {
 
  private:
   bool createWindow() noexcept;
+  void writeBenchmarkReport(const SessionBenchmarkReport& report) noexcept;
+  void captureScreenshot(const std::shared_ptr<ITexture>& colorTexture,
+                         uint64_t frameNumber) noexcept;
 
   std::shared_ptr<Platform> platform_;
   ShellParams shellParams_;
@@ -81,6 +87,9 @@ class GlfwShell {
   RenderSessionConfig sessionConfig_;
   std::unique_ptr<GLFWwindow, decltype(&glfwDestroyWindow)> window_;
   std::unique_ptr<RenderSession> session_;
+  std::string executableName_;
+  // declared after platform_, as it uses the image writer of the platform
+  std::unique_ptr<AsyncScreenshotWriter> screenshotWriter_;
 };
 
 } // namespace igl::shell
@@ -143,6 +143,12 @@ void OpenGlShell::willTick() noexcept {
 } // namespace igl::shell
 
 int main(int argc, char* argv[]) {
+#if IGL_PLATFORM_LINUX
+  // must precede any other Xlib call: the shared GLX context of igl::opengl::TextureUploader is
+  // made current on its worker thread and uses the same X connection
+  XInitThreads();
+#endif
+
   igl::shell::OpenGlShell shell;
 
   uint32_t majorVersion = 4;
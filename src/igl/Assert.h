@@ -99,6 +99,7 @@ inline void iglDebugAbortV([[maybe_unused]] const char* IGL_NONNULL category,
   IGLLog(IGLLogError, "[%s] %s in '%s' (%s:%d): ", category, reason, func, file, line);
   IGLLogV(IGLLogError, format, ap);
   IGLLog(IGLLogError, IGL_NEWLINE);
+  IGLLogFlush();
   iglDebugBreak();
 #endif // IGL_DEBUG_ABORT_ENABLED
 }
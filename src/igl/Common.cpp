@@ -7,6 +7,7 @@
 
 #include <igl/Common.h>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -38,6 +39,11 @@ std::string BackendTypeToString(BackendType backendType) {
   IGL_UNREACHABLE_RETURN(std::string())
 }
 
+uint64_t generatePipelineStateId() {
+  static std::atomic<uint64_t> nextId{1};
+  return nextId.fetch_add(1, std::memory_order_relaxed);
+}
+
 void optimizedMemcpy(void* IGL_NULLABLE dst, const void* IGL_NULLABLE src, size_t size) {
   // Add null check for both dst and src
   IGL_DEBUG_ASSERT(dst != nullptr && src != nullptr, "dst and src must not be null");
@@ -277,6 +277,13 @@ ScopeGuard<T> operator+(ScopeGuardOnExit /*guard*/, T&& fn) {
 // have a proper alignment for data!
 void optimizedMemcpy(void* IGL_NULLABLE dst, const void* IGL_NULLABLE src, size_t size);
 
+///--------------------------------------
+/// MARK: - Pipeline state ids
+
+// Returns a process-unique id, starting at 1, for a new render or compute pipeline state. Unlike
+// the address of a pipeline state, it is never reused once the pipeline state is destroyed.
+[[nodiscard]] uint64_t generatePipelineStateId();
+
 ///--------------------------------------
 /// MARK: - Handle
 
@@ -57,6 +57,15 @@ class IComputePipelineState {
   [[nodiscard]] virtual int getIndexByName(const NameHandle& /* name */) const {
     return -1;
   }
+
+  /// Process-unique id of this pipeline state. Unlike its address, the id is never reused, so it
+  /// can key caches which outlive the pipeline state.
+  [[nodiscard]] uint64_t getId() const {
+    return id_;
+  }
+
+ private:
+  const uint64_t id_ = generatePipelineStateId();
 };
 
 } // namespace igl
@@ -7,10 +7,16 @@
 
 #define IGL_COMMON_SKIP_CHECK
 
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
 #include <cstdio>
+#include <cstdlib>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <igl/Core.h>
 
@@ -35,6 +41,209 @@ IGLLogHandlerFunc* getHandle() {
 #endif
   return &sHandler;
 }
+
+int callHandler(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ...) {
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  va_list ap;
+  va_start(ap, format);
+  const int result = (*getHandle())(logLevel, format, ap);
+  va_end(ap);
+  return result;
+}
+
+struct AsyncStats {
+  std::atomic<uint64_t> logged = 0;
+  std::atomic<uint64_t> droppedQueueFull = 0;
+  std::atomic<uint64_t> droppedRateLimited = 0;
+  std::atomic<uint64_t> truncated = 0;
+};
+
+AsyncStats& getAsyncStats() {
+  // NOLINTNEXTLINE(facebook-static-object-destructor-check)
+  static AsyncStats sStats;
+  return sStats;
+}
+
+// Bounded multi-producer ring buffer of formatted messages. Every slot has a sequence number which
+// tells producers and consumers whether the slot is free or holds a record of the current lap, so
+// producers only need a CAS on the enqueue position and never take a lock. Consumers (the drain
+// thread and IGLLogFlush()) are serialized by a mutex.
+class AsyncLog {
+ public:
+  explicit AsyncLog(const IGLLogAsyncConfig& config) :
+    capacity_(roundUpToPowerOfTwo(config.capacity)),
+    recordLength_(config.maxRecordLength > 1 ? config.maxRecordLength : 2),
+    maxMessagesPerSecond_(config.maxMessagesPerSecond),
+    slots_(std::make_unique<Slot[]>(capacity_)),
+    text_(std::make_unique<char[]>(static_cast<size_t>(capacity_) * recordLength_)) {
+    for (uint32_t i = 0; i != capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    thread_ = std::thread([this]() { run(); });
+  }
+
+  ~AsyncLog() {
+    stopping_.store(true, std::memory_order_release);
+    wake();
+    thread_.join();
+    drain();
+  }
+
+  AsyncLog(const AsyncLog&) = delete;
+  AsyncLog& operator=(const AsyncLog&) = delete;
+
+  int push(IGLLogLevel logLevel, const char* IGL_RESTRICT format, va_list ap) {
+    AsyncStats& stats = getAsyncStats();
+    if (isRateLimited()) {
+      stats.droppedRateLimited.fetch_add(1, std::memory_order_relaxed);
+      return 0;
+    }
+
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;) {
+      slot = &slots_[pos & (capacity_ - 1)];
+      const size_t seq = slot->sequence.load(std::memory_order_acquire);
+      if (seq == pos) {
+        if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (seq < pos) {
+        stats.droppedQueueFull.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+      } else {
+        pos = enqueuePos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    char* text = textOf(pos);
+    FOLLY_PUSH_WARNING
+    FOLLY_GNU_DISABLE_WARNING("-Wformat-nonliteral")
+    const int result = vsnprintf(text, recordLength_, format, ap);
+    FOLLY_POP_WARNING
+    if (result < 0) {
+      text[0] = '\0';
+    } else if (static_cast<uint32_t>(result) >= recordLength_) {
+      stats.truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+    slot->level = logLevel;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    wake();
+    return result;
+  }
+
+  void drain() {
+    const std::lock_guard<std::mutex> guard(consumerMutex_);
+    AsyncStats& stats = getAsyncStats();
+    for (;;) {
+      Slot& slot = slots_[dequeuePos_ & (capacity_ - 1)];
+      if (slot.sequence.load(std::memory_order_acquire) != dequeuePos_ + 1) {
+        return;
+      }
+      callHandler(slot.level, "%s", textOf(dequeuePos_));
+      slot.sequence.store(dequeuePos_ + capacity_, std::memory_order_release);
+      dequeuePos_++;
+      stats.logged.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  [[nodiscard]] bool isDrainThread() const {
+    return std::this_thread::get_id() == thread_.get_id();
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence = 0;
+    IGLLogLevel level = IGLLogInfo;
+  };
+
+  static uint32_t roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 2;
+    while (result < value && result < (1u << 31)) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  char* textOf(size_t pos) {
+    return text_.get() + (pos & (capacity_ - 1)) * recordLength_;
+  }
+
+  // Allows maxMessagesPerSecond_ messages per one-second window. The window reset races with
+  // concurrent producers, which can let a few extra messages through at a window boundary.
+  bool isRateLimited() {
+    if (maxMessagesPerSecond_ == 0) {
+      return false;
+    }
+    const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    int64_t window = window_.load(std::memory_order_relaxed);
+    if (now != window && window_.compare_exchange_strong(window, now)) {
+      messagesInWindow_.store(0, std::memory_order_relaxed);
+    }
+    return messagesInWindow_.fetch_add(1, std::memory_order_relaxed) >= maxMessagesPerSecond_;
+  }
+
+  void wake() {
+    signal_.fetch_add(1, std::memory_order_release);
+    signal_.notify_one();
+  }
+
+  void run() {
+    for (;;) {
+      const uint32_t signal = signal_.load(std::memory_order_acquire);
+      drain();
+      if (stopping_.load(std::memory_order_acquire)) {
+        return;
+      }
+      signal_.wait(signal, std::memory_order_acquire);
+    }
+  }
+
+  const uint32_t capacity_;
+  const uint32_t recordLength_;
+  const uint32_t maxMessagesPerSecond_;
+  std::unique_ptr<Slot[]> slots_;
+  std::unique_ptr<char[]> text_;
+  std::atomic<size_t> enqueuePos_ = 0;
+  size_t dequeuePos_ = 0; // guarded by consumerMutex_
+  std::mutex consumerMutex_;
+  std::atomic<int64_t> window_ = 0;
+  std::atomic<uint32_t> messagesInWindow_ = 0;
+  std::atomic<uint32_t> signal_ = 0;
+  std::atomic<bool> stopping_ = false;
+  std::thread thread_;
+};
+
+std::atomic<AsyncLog*> gAsyncLog = nullptr;
+// Number of threads which may be using gAsyncLog; IGLLogAsyncStop() waits for them before deleting
+std::atomic<uint32_t> gAsyncLogUsers = 0;
+std::mutex gAsyncLogStartStopMutex;
+
+// Pins the asynchronous log while it is used, so IGLLogAsyncStop() cannot delete it
+class AsyncLogRef {
+ public:
+  AsyncLogRef() {
+    gAsyncLogUsers.fetch_add(1);
+    log_ = gAsyncLog.load();
+  }
+  ~AsyncLogRef() {
+    gAsyncLogUsers.fetch_sub(1);
+  }
+  AsyncLogRef(const AsyncLogRef&) = delete;
+  AsyncLogRef& operator=(const AsyncLogRef&) = delete;
+
+  AsyncLog* operator->() const {
+    return log_;
+  }
+  explicit operator bool() const {
+    return log_ != nullptr;
+  }
+
+ private:
+  AsyncLog* log_ = nullptr;
+};
 } // namespace
 
 IGL_API int IGLLog(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ...) {
@@ -48,7 +257,7 @@ IGL_API int IGLLog(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ...) {
 
 IGL_API int IGLLogOnce(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ...) {
   // NOLINTNEXTLINE(facebook-static-object-destructor-check)
-  static std::mutex sLoggedMessagesMutex;
+  static std::shared_mutex sLoggedMessagesMutex;
   // NOLINTNEXTLINE(facebook-static-object-destructor-check)
   static std::unordered_set<std::string> sLoggedMessages;
 
@@ -66,13 +275,19 @@ IGL_API int IGLLogOnce(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ..
   FOLLY_POP_WARNING
   va_end(ap);
 
-  const std::string msg(buffer);
+  // Repeated messages only take the shared lock
+  std::string msg(buffer);
+  bool isNew = false;
   {
-    const std::lock_guard<std::mutex> guard(sLoggedMessagesMutex);
-    if (sLoggedMessages.count(msg) == 0) {
-      result = IGLLogV(logLevel, format, apCopy);
-      sLoggedMessages.insert(msg);
-    }
+    const std::shared_lock<std::shared_mutex> guard(sLoggedMessagesMutex);
+    isNew = sLoggedMessages.count(msg) == 0;
+  }
+  if (isNew) {
+    const std::lock_guard<std::shared_mutex> guard(sLoggedMessagesMutex);
+    isNew = sLoggedMessages.insert(std::move(msg)).second;
+  }
+  if (isNew) {
+    result = IGLLogV(logLevel, format, apCopy);
   }
   va_end(apCopy);
 
@@ -80,6 +295,12 @@ IGL_API int IGLLogOnce(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ..
 }
 
 IGL_API int IGLLogV(IGLLogLevel logLevel, const char* IGL_RESTRICT format, va_list ap) {
+  if (gAsyncLog.load(std::memory_order_relaxed) != nullptr) {
+    const AsyncLogRef asyncLog;
+    if (asyncLog) {
+      return asyncLog->push(logLevel, format, ap);
+    }
+  }
   return (*getHandle())(logLevel, format, ap);
 }
 
@@ -99,3 +320,60 @@ IGL_API void IGLLogSetHandler(IGLLogHandlerFunc handler) {
 IGL_API IGLLogHandlerFunc IGLLogGetHandler() {
   return *getHandle();
 }
+
+IGL_API bool IGLLogAsyncStart(const IGLLogAsyncConfig& config) {
+  const std::lock_guard<std::mutex> guard(gAsyncLogStartStopMutex);
+  if (gAsyncLog.load() != nullptr) {
+    return false;
+  }
+  AsyncStats& stats = getAsyncStats();
+  stats.logged = 0;
+  stats.droppedQueueFull = 0;
+  stats.droppedRateLimited = 0;
+  stats.truncated = 0;
+
+  // Log pending messages and join the drain thread before static destructors run
+  static const bool sRegisteredAtExit = std::atexit(IGLLogAsyncStop) == 0;
+  (void)sRegisteredAtExit;
+  gAsyncLog.store(new AsyncLog(config));
+  return true;
+}
+
+IGL_API void IGLLogAsyncStop() {
+  const std::lock_guard<std::mutex> guard(gAsyncLogStartStopMutex);
+  AsyncLog* asyncLog = gAsyncLog.exchange(nullptr);
+  if (asyncLog == nullptr) {
+    return;
+  }
+  // New messages are logged synchronously now; wait for producers which still hold a reference
+  while (gAsyncLogUsers.load() != 0) {
+    std::this_thread::yield();
+  }
+  delete asyncLog;
+}
+
+IGL_API bool IGLLogAsyncIsRunning() {
+  return gAsyncLog.load() != nullptr;
+}
+
+IGL_API IGLLogAsyncStats IGLLogAsyncGetStats() {
+  const AsyncStats& stats = getAsyncStats();
+  IGLLogAsyncStats result;
+  result.logged = stats.logged.load(std::memory_order_relaxed);
+  result.droppedQueueFull = stats.droppedQueueFull.load(std::memory_order_relaxed);
+  result.droppedRateLimited = stats.droppedRateLimited.load(std::memory_order_relaxed);
+  result.truncated = stats.truncated.load(std::memory_order_relaxed);
+  return result;
+}
+
+IGL_API void IGLLogFlush() {
+  if (gAsyncLog.load(std::memory_order_relaxed) == nullptr) {
+    return;
+  }
+  const AsyncLogRef asyncLog;
+  // The drain thread cannot flush from inside the log handler, as it already holds the consumer
+  // lock
+  if (asyncLog && !asyncLog->isDrainThread()) {
+    asyncLog->drain();
+  }
+}
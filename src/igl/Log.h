@@ -12,6 +12,7 @@
 #endif
 
 #include <cstdarg>
+#include <cstdint>
 #include <igl/Macros.h>
 
 enum IGLLogLevel {
@@ -43,6 +44,36 @@ using IGLLogHandlerFunc = int (*)(IGLLogLevel logLevel,
 IGL_API void IGLLogSetHandler(IGLLogHandlerFunc handler);
 IGL_API IGLLogHandlerFunc IGLLogGetHandler(void);
 
+///--------------------------------------
+/// MARK: - Asynchronous logging
+
+// While asynchronous logging is running, IGLLogV() formats messages into a lock-free ring buffer
+// and returns immediately; a background thread passes them to the log handler as "%s". Messages
+// are dropped when the ring buffer is full or when the rate limit is exceeded.
+struct IGLLogAsyncConfig {
+  uint32_t capacity = 1024; ///< number of records, rounded up to a power of two
+  uint32_t maxRecordLength = 512; ///< bytes including the terminating null; longer are truncated
+  uint32_t maxMessagesPerSecond = 0; ///< 0 disables rate limiting
+};
+
+struct IGLLogAsyncStats {
+  uint64_t logged = 0; ///< messages passed to the log handler
+  uint64_t droppedQueueFull = 0;
+  uint64_t droppedRateLimited = 0;
+  uint64_t truncated = 0;
+};
+
+// Returns false if asynchronous logging is already running
+IGL_API bool IGLLogAsyncStart(const IGLLogAsyncConfig& config);
+// Logs all pending messages and stops the background thread
+IGL_API void IGLLogAsyncStop(void);
+IGL_API bool IGLLogAsyncIsRunning(void);
+// Counters since the last IGLLogAsyncStart()
+IGL_API IGLLogAsyncStats IGLLogAsyncGetStats(void);
+
+// Logs all pending messages on the calling thread; a no-op without asynchronous logging
+IGL_API void IGLLogFlush(void);
+
 ///--------------------------------------
 /// MARK: - Macros
 
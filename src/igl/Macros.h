@@ -204,6 +204,8 @@
 #define IGL_PROFILER_ZONE_END() }
 #define IGL_PROFILER_THREAD(name) tracy::SetThreadName(name)
 #define IGL_PROFILER_FRAME(name) FrameMarkNamed(name)
+// name must stay valid for the lifetime of the profiler
+#define IGL_PROFILER_PLOT(name, value) TracyPlot(name, static_cast<int64_t>(value))
 
 #elif defined(IGL_WITH_PERFETTO) && defined(__cplusplus)
 // Perfetto backend for standalone Android capture (barebone perfetto CLI).
@@ -263,6 +265,7 @@ struct ATraceGuard {
     ATrace_beginSection(name);   \
     ATrace_endSection();         \
   } while (0)
+#define IGL_PROFILER_PLOT(name, value) ATrace_setCounter(name, static_cast<int64_t>(value))
 
 #else // !__ANDROID__ — no-ops for Linux/Mac/Windows builds
 
@@ -272,6 +275,7 @@ struct ATraceGuard {
 #define IGL_PROFILER_ZONE_END() }
 #define IGL_PROFILER_THREAD(name)
 #define IGL_PROFILER_FRAME(name)
+#define IGL_PROFILER_PLOT(name, value)
 
 #endif // __ANDROID__
 #else
@@ -291,6 +295,7 @@ struct ATraceGuard {
 #define IGL_PROFILER_ZONE_END() }
 #define IGL_PROFILER_THREAD(name)
 #define IGL_PROFILER_FRAME(name)
+#define IGL_PROFILER_PLOT(name, value)
 #endif // IGL_WITH_TRACY
 
 #define IGL_ENUM_TO_STRING(enum, res) \
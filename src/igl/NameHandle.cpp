@@ -7,6 +7,11 @@
 
 #include <igl/NameHandle.h>
 
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace igl {
 namespace {
 
@@ -78,19 +83,61 @@ uint32_t iglCrc32(const char* data, size_t /*length*/) {
 
 #endif
 
-#if IGL_DEBUG_ABORT_ENABLED
-bool NameHandle::checkIsValidCrcCompare(const NameHandle& nh) const {
-  const bool res = nh.crc32_ == crc32_ && nh.name_ != name_;
-  IGL_DEBUG_ASSERT(!res,
-                   "NameHandle CRC check fails: name1 (%s %x) name2 (%s %x)\n",
-                   name_.c_str(),
-                   crc32_,
-                   nh.name_.c_str(),
-                   nh.crc32_);
-
-  return res;
+namespace {
+
+struct InternTable {
+  std::shared_mutex mutex;
+  // Keyed by CRC32; names with colliding CRC32s share a key
+  std::unordered_multimap<uint32_t, const NameHandle::Entry*> entries;
+  // Never shrinks, so entries keep their addresses
+  std::deque<NameHandle::Entry> storage;
+
+  [[nodiscard]] const NameHandle::Entry* find(std::string_view name, uint32_t crc32) const {
+    const auto [begin, end] = entries.equal_range(crc32);
+    for (auto it = begin; it != end; ++it) {
+      if (it->second->name == name) {
+        return it->second;
+      }
+    }
+    return nullptr;
+  }
+};
+
+InternTable& getInternTable() {
+  // Intentionally leaked: handles in static objects must stay valid during static destruction
+  static auto* table = new InternTable();
+  return *table;
+}
+
+} // namespace
+
+const NameHandle::Entry* NameHandle::intern(std::string_view name, uint32_t crc32) {
+  if (name.empty() && crc32 == 0) {
+    return nullptr;
+  }
+
+  InternTable& table = getInternTable();
+  {
+    const std::shared_lock lock(table.mutex);
+    if (const Entry* entry = table.find(name, crc32)) {
+      return entry;
+    }
+  }
+
+  const std::unique_lock lock(table.mutex);
+  // Another thread may have added the name since the shared lock was released
+  if (const Entry* entry = table.find(name, crc32)) {
+    return entry;
+  }
+  const Entry* entry = &table.storage.emplace_back(Entry{crc32, std::string(name)});
+  table.entries.emplace(crc32, entry);
+  return entry;
+}
+
+const std::string& NameHandle::getEmptyString() {
+  static const std::string kEmpty;
+  return kEmpty;
 }
-#endif // IGL_DEBUG_ABORT_ENABLED
 } // namespace igl
 
 size_t std::hash<std::vector<igl::NameHandle>>::operator()(
@@ -94,35 +94,34 @@ uint32_t iglCrc32(const char* data, size_t length);
 ///--------------------------------------
 /// MARK: - NameHandle
 
-#if IGL_DEBUG_ABORT_ENABLED
-#define CHECK_VALID_CRC(a) (void)checkIsValidCrcCompare(a)
-#else
-#define CHECK_VALID_CRC(a)
-#endif
-
 /**
  * @brief Creates a mapping between a string and its equivalent CRC32 handle
  * This way when we need to check if a uniform exists or if it matches another
  * uniform, we can do an integer comparison rather than a string comparison.
+ *
+ * Names are interned in a process-wide, thread-safe table which is never freed, so a NameHandle
+ * is a single pointer to a stable entry holding the name and its CRC32. Copies do not allocate,
+ * and two handles are equal if and only if they have the same name and CRC32.
  */
 class NameHandle {
  public:
-  NameHandle() = default;
-  ~NameHandle() = default;
+  struct Entry {
+    uint32_t crc32 = 0;
+    std::string name;
+  };
 
-  NameHandle(const NameHandle& other) = default;
-  NameHandle(NameHandle&& other) noexcept = default;
+  NameHandle() = default;
 
-  NameHandle(std::string name, uint32_t crc32) : crc32_(crc32), name_(std::move(name)) {}
-  NameHandle(const char* name, uint32_t crc32) : crc32_(crc32), name_(name) {}
-  NameHandle(std::string_view name, uint32_t crc32) : crc32_(crc32), name_(name) {}
+  NameHandle(const std::string& name, uint32_t crc32) : entry_(intern(name, crc32)) {}
+  NameHandle(const char* name, uint32_t crc32) : entry_(intern(name, crc32)) {}
+  NameHandle(std::string_view name, uint32_t crc32) : entry_(intern(name, crc32)) {}
 
   /**
    * @brief Returns a null terminated character array version of the name
    * @returns null terminated character array
    */
   [[nodiscard]] const char* c_str() const {
-    return name_.c_str();
+    return entry_ ? entry_->name.c_str() : "";
   }
 
   /**
@@ -130,7 +129,7 @@ class NameHandle {
    * @returns Reference to the actual name string
    */
   [[nodiscard]] const std::string& toString() const {
-    return name_;
+    return entry_ ? entry_->name : getEmptyString();
   }
 
   /**
@@ -138,12 +137,11 @@ class NameHandle {
    * @returns crc32 handle
    */
   [[nodiscard]] uint32_t getCrc32() const {
-    return crc32_;
+    return entry_ ? entry_->crc32 : 0;
   }
 
   bool operator==(const NameHandle& other) const {
-    CHECK_VALID_CRC(other);
-    return crc32_ == other.crc32_;
+    return entry_ == other.entry_;
   }
 
   bool operator!=(const NameHandle& other) const {
@@ -151,8 +149,11 @@ class NameHandle {
   }
 
   bool operator<(const NameHandle& other) const {
-    CHECK_VALID_CRC(other);
-    return (crc32_ < other.crc32_);
+    if (getCrc32() != other.getCrc32()) {
+      return getCrc32() < other.getCrc32();
+    }
+    // Only reached for different names with colliding CRC32s
+    return entry_ != other.entry_ && toString() < other.toString();
   }
 
   bool operator>=(const NameHandle& other) const {
@@ -160,38 +161,28 @@ class NameHandle {
   }
 
   bool operator>(const NameHandle& other) const {
-    CHECK_VALID_CRC(other);
-    return (crc32_ > other.crc32_);
+    return other < *this;
   }
 
   bool operator<=(const NameHandle& other) const {
     return !(*this > other);
   }
 
-  NameHandle& operator=(const NameHandle& other) {
-    if (crc32_ == other.crc32_) {
-      return *this;
-    }
-
-    crc32_ = other.crc32_;
-    name_ = other.name_;
-    return *this;
-  }
-
-  NameHandle& operator=(NameHandle&& other) noexcept = default;
-
   operator const char*() const {
-    return name_.c_str();
+    return c_str();
   }
 
  private:
-#if IGL_DEBUG_ABORT_ENABLED
-  [[nodiscard]] bool checkIsValidCrcCompare(const NameHandle& nh) const;
-#endif
-  uint32_t crc32_ = 0;
-  std::string name_;
+  /// Returns the interned entry for the name, adding it on first use. Returns nullptr for the
+  /// empty name.
+  static const Entry* intern(std::string_view name, uint32_t crc32);
+  static const std::string& getEmptyString();
+
+  const Entry* entry_ = nullptr;
 };
 
+static_assert(sizeof(NameHandle) == sizeof(void*));
+
 /**
  * @brief Helper function to convert a string to a NameHandle
  * @param name String to convert
@@ -213,8 +204,14 @@ inline NameHandle genNameHandle(const std::string& name) {
 /// @def IGL_NAMEHANDLE(str)
 /// @brief Creates an igl::NameHandle instance.
 /// @param str The name the handle represents (e.g., uniform name). Must be a const char*.
-#define IGL_NAMEHANDLE(str) \
-  igl::NameHandle(str, std::integral_constant<uint32_t, igl::iglCrc32ConstExpr(str)>::value)
+///
+/// The name is interned once per call site; later evaluations only copy the handle.
+#define IGL_NAMEHANDLE(str)                                                           \
+  ([]() {                                                                             \
+    static const igl::NameHandle kNameHandle(                                         \
+        str, std::integral_constant<uint32_t, igl::iglCrc32ConstExpr(str)>::value);   \
+    return kNameHandle;                                                               \
+  }())
 
 /// @def IGL_NAMEHANDLE_ACCESSOR(name)
 /// @brief Declares a function returning a const igl::NameHandle& instance.
@@ -249,8 +249,23 @@ class IRenderPipelineState {
     return desc_;
   }
 
+  /// Returns false while the shader program is still being compiled or linked asynchronously.
+  /// Drawing with a pipeline which is not ready blocks until it is.
+  [[nodiscard]] virtual bool isReady() const {
+    return true;
+  }
+
+  /// Process-unique id of this pipeline state. Unlike its address, the id is never reused, so it
+  /// can key caches which outlive the pipeline state.
+  [[nodiscard]] uint64_t getId() const {
+    return id_;
+  }
+
  protected:
   const RenderPipelineDesc desc_{};
+
+ private:
+  const uint64_t id_ = generatePipelineStateId();
 };
 
 } // namespace igl
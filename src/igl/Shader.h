@@ -412,6 +412,16 @@ class IShaderStages : public ITrackedResource<IShaderStages> {
    */
   [[nodiscard]] bool isValid() const noexcept;
 
+  /**
+   * @brief Checks if the shader modules finished compiling and linking.
+   * Backends which compile asynchronously return false until the program can be used without
+   * blocking. The result of a failed compile or link is reported once this returns true.
+   * @return True if ready; false otherwise.
+   */
+  [[nodiscard]] virtual bool isReady() const {
+    return true;
+  }
+
  protected:
   ShaderStagesDesc desc_;
 };
@@ -292,6 +292,7 @@ TextureFormatProperties TextureFormatProperties::fromTextureFormat(TextureFormat
     COLOR(BGR10_A2_Unorm, 4, 4, Flags::HDR)
     COLOR(R_F32, 1, 4, Flags::HDR)
     COLOR(R_UInt32, 1, 4, Flags::Integer | Flags::HDR)
+    COLOR(R9G9B9E5_F, 3, 4, Flags::HDR)
     COLOR(RGB_F16, 3, 6, Flags::HDR)
     COLOR(RGBA_UNorm16, 4, 8, Flags::HDR)
     COLOR(RGBA_F16, 4, 8, Flags::HDR)
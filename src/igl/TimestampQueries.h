@@ -13,6 +13,9 @@ namespace igl {
 
 class ITimestampQueries : public ITrackedResource<ITimestampQueries> {
  public:
+  /// Returned by getParentSlot() for timing slots which are not nested in another slot
+  static constexpr uint32_t kNoParentSlot = UINT32_MAX;
+
   ~ITimestampQueries() override = default;
 
   /// Maximum number of timing slots this object can hold
@@ -36,6 +39,19 @@ class ITimestampQueries : public ITrackedResource<ITimestampQueries> {
     return 0;
   }
 
+  /// Get the GPU time in nanoseconds at which a timing slot started, relative to the start of
+  /// slot 0. Only valid once resultsAvailable() returns true.
+  /// Default returns 0; override in backends that record absolute timestamps.
+  [[nodiscard]] virtual uint64_t getStartNanos(uint32_t /*slotIndex*/) const {
+    return 0;
+  }
+
+  /// Get the timing slot which was open when a timing slot started, or kNoParentSlot.
+  /// Backends which time nested debug groups use this to expose the nesting.
+  [[nodiscard]] virtual uint32_t getParentSlot(uint32_t /*slotIndex*/) const {
+    return kNoParentSlot;
+  }
+
   /// Get the label associated with a timing slot, if the backend records one.
   /// Returns a stable C string owned by the queries object (valid until reset()
   /// or destruction); empty string if the backend records no label.
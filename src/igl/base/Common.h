@@ -150,6 +150,7 @@ enum class TextureFormat : uint8_t {
   BGR10_A2_Unorm,
   R_F32,
   R_UInt32,
+  R9G9B9E5_F,
   // 48 bpp
   RGB_F16,
 
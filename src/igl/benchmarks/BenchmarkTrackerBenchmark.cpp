@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <shell/shared/renderSession/BenchmarkTracker.h>
+
+namespace igl::benchmarks {
+
+//
+// BenchmarkTracker::recordRenderTime
+//
+// Called by the shell once per frame. The buffer size is varied so that some runs include the
+// overflow path which flushes the circular buffer.
+//
+void BM_BenchmarkTrackerRecordRenderTime(benchmark::State& state) {
+  shell::BenchmarkTracker tracker(static_cast<size_t>(state.range(0)));
+  double renderTimeMs = 16.0;
+  for (auto _ : state) {
+    // deterministic jitter with an occasional hiccup
+    renderTimeMs = renderTimeMs > 60.0 ? 16.0 : renderTimeMs + 0.37;
+    tracker.recordRenderTime(renderTimeMs);
+  }
+  benchmark::DoNotOptimize(tracker.getTotalFrameCount());
+}
+BENCHMARK(BM_BenchmarkTrackerRecordRenderTime)
+    ->Arg(shell::BenchmarkTracker::kDefaultBufferSize)
+    ->Arg(64);
+
+//
+// BenchmarkTracker::computeStats
+//
+// Cost of a periodic report over a full buffer.
+//
+void BM_BenchmarkTrackerComputeStats(benchmark::State& state) {
+  shell::BenchmarkTracker tracker;
+  for (size_t i = 0; i != shell::BenchmarkTracker::kDefaultBufferSize * 4; ++i) {
+    tracker.recordRenderTime(16.0 + static_cast<double>(i % 7));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(tracker.computeStats());
+  }
+}
+BENCHMARK(BM_BenchmarkTrackerComputeStats);
+
+//
+// LatencyHistogram::getValueAtPercentile
+//
+// Percentile lookups walk the constant-size bucket array, independently of the number of samples.
+//
+void BM_LatencyHistogramPercentile(benchmark::State& state) {
+  shell::LatencyHistogram histogram;
+  for (int64_t i = 0; i != state.range(0); ++i) {
+    histogram.record(16.0 + static_cast<double>(i % 97) * 0.5);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(histogram.getValueAtPercentile(99.9));
+  }
+}
+BENCHMARK(BM_LatencyHistogramPercentile)->Arg(1000)->Arg(1000000);
+
+} // namespace igl::benchmarks
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "Common.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <igl/RenderPass.h>
+#include <igl/ShaderCreator.h>
+
+namespace {
+std::atomic<size_t> gAllocationCount{0};
+} // namespace
+
+// Replacing the global allocation functions counts every allocation made by the benchmarks,
+// including the ones made by IGL and the standard library
+void* operator new(size_t size) {
+  gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+
+namespace igl::benchmarks {
+
+size_t getAllocationCount() {
+  return gAllocationCount.load(std::memory_order_relaxed);
+}
+
+NullRenderContext::NullRenderContext(BackendType reportedBackendType) :
+  device(std::make_unique<iglu::null_backend::Device>(reportedBackendType)) {
+  queue = device->createCommandQueue({}, nullptr);
+
+  FramebufferDesc framebufferDesc;
+  framebufferDesc.colorAttachments[0].texture = device->createTexture(
+      TextureDesc::new2D(
+          TextureFormat::RGBA_UNorm8, 1920, 1080, TextureDesc::TextureUsageBits::Attachment),
+      nullptr);
+  framebuffer = device->createFramebuffer(framebufferDesc, nullptr);
+
+  beginFrame();
+}
+
+NullRenderContext::~NullRenderContext() {
+  encoder->endEncoding();
+}
+
+std::shared_ptr<IRenderPipelineState> NullRenderContext::createPipeline() {
+  RenderPipelineDesc desc;
+  desc.shaderStages = ShaderStagesCreator::fromModuleStringInput(
+      *device, kNullShaderSource, "main", "", kNullShaderSource, "main", "", nullptr);
+  desc.targetDesc.colorAttachments.resize(1);
+  desc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+  return device->createRenderPipeline(desc, nullptr);
+}
+
+void NullRenderContext::nextFrame() {
+  encoder->endEncoding();
+  queue->submit(*commandBuffer, true);
+  device->resetCounters();
+  beginFrame();
+}
+
+void NullRenderContext::beginFrame() {
+  RenderPassDesc renderPass;
+  renderPass.colorAttachments.resize(1);
+  commandBuffer = queue->createCommandBuffer({}, nullptr);
+  encoder = commandBuffer->createRenderCommandEncoder(renderPass, framebuffer, {}, nullptr);
+}
+
+} // namespace igl::benchmarks
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <IGLU/null_backend/Device.h>
+#include <memory>
+#include <igl/CommandBuffer.h>
+#include <igl/CommandQueue.h>
+#include <igl/Framebuffer.h>
+#include <igl/RenderCommandEncoder.h>
+#include <igl/RenderPipelineState.h>
+
+namespace igl::benchmarks {
+
+/// Never compiled by the null backend, so the contents do not matter.
+inline constexpr const char* kNullShaderSource = "void main() {}";
+
+/// Number of calls to the global operator new since the start of the process. Benchmarks which
+/// must not allocate in steady state report the difference as the "allocs/iter" counter.
+[[nodiscard]] size_t getAllocationCount();
+
+/**
+ * A null device with an open render pass, for benchmarks of code which records commands.
+ * The null device only counts commands, so nothing but the CPU cost of the client and of IGL's
+ * front end is measured.
+ */
+struct NullRenderContext {
+  explicit NullRenderContext(BackendType reportedBackendType = BackendType::Custom);
+  ~NullRenderContext();
+
+  std::shared_ptr<IRenderPipelineState> createPipeline();
+
+  /// Ends the current render pass, submits it and starts a new one.
+  void nextFrame();
+
+  std::unique_ptr<iglu::null_backend::Device> device;
+  std::shared_ptr<ICommandQueue> queue;
+  std::shared_ptr<IFramebuffer> framebuffer;
+  std::shared_ptr<ICommandBuffer> commandBuffer;
+  std::unique_ptr<IRenderCommandEncoder> encoder;
+
+ private:
+  void beginFrame();
+};
+
+} // namespace igl::benchmarks
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Common.h"
+
+#include <IGLU/managedUniformBuffer/ManagedUniformBuffer.h>
+#include <utility>
+
+namespace igl::benchmarks {
+
+namespace {
+
+// A typical set of per-draw uniforms, bound as individual uniforms on OpenGL
+iglu::ManagedUniformBufferInfo makeUniformBufferInfo() {
+  const std::pair<const char*, UniformType> uniforms[] = {
+      {"modelMatrix", UniformType::Mat4x4},
+      {"viewProjectionMatrix", UniformType::Mat4x4},
+      {"normalMatrix", UniformType::Mat3x3},
+      {"color", UniformType::Float4},
+      {"lightDirection", UniformType::Float3},
+      {"time", UniformType::Float},
+      {"flags", UniformType::Int},
+  };
+
+  iglu::ManagedUniformBufferInfo info;
+  info.index = 0;
+  for (const auto& [name, type] : uniforms) {
+    info.uniforms.push_back({.name = name,
+                             .location = -1,
+                             .type = type,
+                             .numElements = 1,
+                             .offset = info.length,
+                             .elementStride = 0});
+    info.length += sizeForUniformType(type);
+  }
+  return info;
+}
+
+} // namespace
+
+#if IGL_BACKEND_OPENGL
+//
+// iglu::ManagedUniformBuffer::bind
+//
+// Binds all uniforms of a buffer on OpenGL, as done once per draw call. Uniform locations are
+// resolved by name on the first bind with a pipeline state only.
+//
+void BM_ManagedUniformBufferBind(benchmark::State& state) {
+  NullRenderContext context(BackendType::OpenGL);
+  const auto pipeline = context.createPipeline();
+  iglu::ManagedUniformBuffer buffer(*context.device, makeUniformBufferInfo());
+  buffer.bind(*context.device, *pipeline, *context.encoder);
+
+  const size_t allocationCount = getAllocationCount();
+  for (auto _ : state) {
+    buffer.bind(*context.device, *pipeline, *context.encoder);
+  }
+  state.SetItemsProcessed(
+      static_cast<int64_t>(state.iterations() * buffer.uniformInfo.uniforms.size()));
+  state.counters["allocs/iter"] =
+      benchmark::Counter(static_cast<double>(getAllocationCount() - allocationCount),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ManagedUniformBufferBind);
+#endif // IGL_BACKEND_OPENGL
+
+//
+// iglu::ManagedUniformBuffer::updateData
+//
+// Updates an int uniform by name (linear search or LUT) or by slot.
+//
+void BM_ManagedUniformBufferUpdateData(benchmark::State& state) {
+  enum Mode : int64_t { kName = 0, kNameLUT = 1, kSlot = 2 };
+  const auto mode = static_cast<Mode>(state.range(0));
+
+  NullRenderContext context;
+  iglu::ManagedUniformBuffer buffer(*context.device, makeUniformBufferInfo());
+  if (mode == kNameLUT) {
+    buffer.buildUniformLUT();
+  }
+  const char* name = "flags";
+  const int slot = buffer.getIndex(name);
+  const int value = 1;
+
+  const size_t allocationCount = getAllocationCount();
+  for (auto _ : state) {
+    if (mode == kSlot) {
+      buffer.updateData(slot, &value, sizeof(value));
+    } else {
+      buffer.updateData(name, &value, sizeof(value));
+    }
+  }
+  state.counters["allocs/iter"] =
+      benchmark::Counter(static_cast<double>(getAllocationCount() - allocationCount),
+                         benchmark::Counter::kAvgIterations);
+  state.SetLabel(mode == kSlot ? "slot" : mode == kNameLUT ? "name, LUT" : "name");
+}
+BENCHMARK(BM_ManagedUniformBufferUpdateData)->Arg(0)->Arg(1)->Arg(2);
+
+} // namespace igl::benchmarks
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <igl/NameHandle.h>
+
+namespace igl::benchmarks {
+
+namespace {
+
+std::vector<std::string> makeUniformNames(size_t count) {
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (size_t i = 0; i != count; ++i) {
+    names.push_back("uniformBlock.member" + std::to_string(i));
+  }
+  return names;
+}
+
+} // namespace
+
+//
+// iglCrc32
+//
+// Raw CRC32 throughput over strings of increasing length.
+//
+void BM_IglCrc32(benchmark::State& state) {
+  const std::string data(static_cast<size_t>(state.range(0)), 'x');
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(iglCrc32(data.data(), data.size()));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_IglCrc32)->RangeMultiplier(4)->Range(8, 1024);
+
+//
+// genNameHandle
+//
+// Creating a NameHandle at runtime: CRC32 plus a lookup in the intern table.
+//
+void BM_GenNameHandle(benchmark::State& state) {
+  const std::string name = "perFrameUniforms.modelViewProjectionMatrix";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(genNameHandle(name));
+  }
+}
+BENCHMARK(BM_GenNameHandle);
+
+//
+// IGL_NAMEHANDLE
+//
+// Creating a NameHandle whose CRC32 is computed at compile time. The name is interned on the
+// first evaluation only.
+//
+void BM_NameHandleMacro(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(IGL_NAMEHANDLE("perFrameUniforms.modelViewProjectionMatrix"));
+  }
+}
+BENCHMARK(BM_NameHandleMacro);
+
+//
+// NameHandle copy
+//
+void BM_NameHandleCopy(benchmark::State& state) {
+  const NameHandle handle = IGL_NAMEHANDLE("perFrameUniforms.modelViewProjectionMatrix");
+  for (auto _ : state) {
+    NameHandle copy(handle);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_NameHandleCopy);
+
+//
+// NameHandle lookup
+//
+// Looking up uniforms by NameHandle in a hash map, as uniform collections and pipelines do.
+//
+void BM_NameHandleMapLookup(benchmark::State& state) {
+  const auto names = makeUniformNames(static_cast<size_t>(state.range(0)));
+  std::unordered_map<NameHandle, int> map;
+  std::vector<NameHandle> handles;
+  for (const auto& name : names) {
+    handles.push_back(genNameHandle(name));
+    map.emplace(handles.back(), static_cast<int>(map.size()));
+  }
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(map.find(handles[i]));
+    i = (i + 1) % handles.size();
+  }
+}
+BENCHMARK(BM_NameHandleMapLookup)->Arg(8)->Arg(64)->Arg(512);
+
+} // namespace igl::benchmarks
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Common.h"
+
+#include <IGLU/null_backend/Device.h>
+#include <IGLU/state_pool/RenderPipelineStatePool.h>
+#include <memory>
+#include <vector>
+#include <igl/RenderPipelineState.h>
+#include <igl/ShaderCreator.h>
+#include <igl/VertexInputState.h>
+
+namespace igl::benchmarks {
+
+namespace {
+
+// Creates `count` distinct pipeline descriptors which share shader stages and vertex input state,
+// like the variants of a material. Variants differ in their blend state.
+std::vector<RenderPipelineDesc> makePipelineDescs(IDevice& device, size_t count) {
+  std::shared_ptr<IShaderStages> stages = ShaderStagesCreator::fromModuleStringInput(
+      device, kNullShaderSource, "main", "", kNullShaderSource, "main", "", nullptr);
+
+  VertexInputStateDesc inputDesc;
+  inputDesc.numAttributes = 3;
+  inputDesc.attributes[0] = {0, VertexAttributeFormat::Float3, 0, "position", 0};
+  inputDesc.attributes[1] = {0, VertexAttributeFormat::Float3, 12, "normal", 1};
+  inputDesc.attributes[2] = {0, VertexAttributeFormat::Float2, 24, "uv", 2};
+  inputDesc.numInputBindings = 1;
+  inputDesc.inputBindings[0].stride = 32;
+  std::shared_ptr<IVertexInputState> vertexInput =
+      device.createVertexInputState(inputDesc, nullptr);
+
+  std::vector<RenderPipelineDesc> descs(count);
+  for (size_t i = 0; i != count; ++i) {
+    auto& desc = descs[i];
+    desc.shaderStages = stages;
+    desc.vertexInputState = vertexInput;
+    desc.targetDesc.colorAttachments.resize(2);
+    desc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+    desc.targetDesc.colorAttachments[0].blendEnabled = true;
+    desc.targetDesc.colorAttachments[0].srcRGBBlendFactor = static_cast<BlendFactor>(i % 16);
+    desc.targetDesc.colorAttachments[0].dstRGBBlendFactor = static_cast<BlendFactor>(i / 16 % 16);
+    desc.targetDesc.colorAttachments[1].textureFormat = TextureFormat::RGBA_F16;
+    desc.targetDesc.depthAttachmentFormat = TextureFormat::Z_UNorm24;
+    desc.cullMode = CullMode::Back;
+    desc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE("albedoTexture");
+    desc.fragmentUnitSamplerMap[1] = IGL_NAMEHANDLE("normalTexture");
+  }
+  return descs;
+}
+
+} // namespace
+
+//
+// std::hash<RenderPipelineDesc>
+//
+void BM_RenderPipelineDescHash(benchmark::State& state) {
+  iglu::null_backend::Device device;
+  const auto descs = makePipelineDescs(device, 1);
+  const std::hash<RenderPipelineDesc> hasher;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hasher(descs[0]));
+  }
+}
+BENCHMARK(BM_RenderPipelineDescHash);
+
+//
+// RenderPipelineDesc equality
+//
+// Compares two equal descriptors, which is what every hash map hit has to do after hashing.
+//
+void BM_RenderPipelineDescEquals(benchmark::State& state) {
+  iglu::null_backend::Device device;
+  const auto descs = makePipelineDescs(device, 1);
+  const RenderPipelineDesc copy = descs[0];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(descs[0] == copy);
+  }
+}
+BENCHMARK(BM_RenderPipelineDescEquals);
+
+//
+// LRUStatePool::getOrCreate, cache hits
+//
+// Cycles through a working set of pipelines which fits into the cache. Pipeline creation is
+// free on the null backend, so this measures the pool itself.
+//
+void BM_StatePoolGetOrCreateHit(benchmark::State& state) {
+  iglu::null_backend::Device device;
+  const auto descs = makePipelineDescs(device, static_cast<size_t>(state.range(0)));
+  iglu::state_pool::RenderPipelineStatePool pool;
+  for (const auto& desc : descs) {
+    pool.getOrCreate(device, desc, nullptr);
+  }
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pool.getOrCreate(device, descs[i], nullptr));
+    i = (i + 1) % descs.size();
+  }
+}
+BENCHMARK(BM_StatePoolGetOrCreateHit)->Arg(1)->Arg(16)->Arg(256);
+
+//
+// LRUStatePool::getOrCreate, cache misses
+//
+// The working set is twice the cache size, so every lookup evicts the least recently used
+// pipeline and creates a new one.
+//
+void BM_StatePoolGetOrCreateMiss(benchmark::State& state) {
+  constexpr uint32_t kCacheSize = 16;
+  iglu::null_backend::Device device;
+  const auto descs = makePipelineDescs(device, kCacheSize * 2);
+  iglu::state_pool::RenderPipelineStatePool pool;
+  pool.setCacheSize(kCacheSize);
+
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pool.getOrCreate(device, descs[i], nullptr));
+    i = (i + 1) % descs.size();
+  }
+}
+BENCHMARK(BM_StatePoolGetOrCreateMiss);
+
+} // namespace igl::benchmarks
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Common.h"
+
+#include <array>
+#include <vector>
+
+namespace igl::benchmarks {
+
+//
+// Frame encoding
+//
+// Records a frame of `state.range(0)` indexed draws, each with its own vertex buffer, texture and
+// inline uniforms, on the null backend. This is the CPU cost of command submission through IGL
+// without a driver underneath.
+//
+void BM_EncodeFrame(benchmark::State& state) {
+  const auto numDraws = static_cast<size_t>(state.range(0));
+  NullRenderContext context;
+  auto& device = *context.device;
+
+  const auto pipeline = context.createPipeline();
+  const std::array<float, 4 * 8> vertices{};
+  const std::array<uint16_t, 6> indices{0, 1, 2, 2, 3, 0};
+  auto indexBuffer = device.createBuffer(
+      BufferDesc(BufferDesc::BufferTypeBits::Index, indices.data(), sizeof(indices)), nullptr);
+
+  std::vector<std::unique_ptr<IBuffer>> vertexBuffers;
+  std::vector<std::shared_ptr<ITexture>> textures;
+  for (size_t i = 0; i != numDraws; ++i) {
+    vertexBuffers.push_back(device.createBuffer(
+        BufferDesc(BufferDesc::BufferTypeBits::Vertex, vertices.data(), sizeof(vertices)),
+        nullptr));
+    textures.push_back(device.createTexture(
+        TextureDesc::new2D(
+            TextureFormat::RGBA_UNorm8, 64, 64, TextureDesc::TextureUsageBits::Sampled),
+        nullptr));
+  }
+  const std::array<float, 16> modelMatrix{};
+
+  for (auto _ : state) {
+    auto& encoder = *context.encoder;
+    encoder.bindRenderPipelineState(pipeline);
+    encoder.bindViewport({0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f});
+    encoder.bindIndexBuffer(*indexBuffer, IndexFormat::UInt16);
+    for (size_t i = 0; i != numDraws; ++i) {
+      encoder.bindVertexBuffer(0, *vertexBuffers[i]);
+      encoder.bindTexture(0, BindTarget::kFragment, textures[i].get());
+      encoder.bindBytes(1, BindTarget::kVertex, modelMatrix.data(), sizeof(modelMatrix));
+      encoder.drawIndexed(indices.size());
+    }
+    context.nextFrame();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numDraws));
+}
+BENCHMARK(BM_EncodeFrame)->Arg(1)->Arg(100)->Arg(1000);
+
+} // namespace igl::benchmarks
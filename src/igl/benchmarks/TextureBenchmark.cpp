@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+#include <igl/Texture.h>
+
+namespace igl::benchmarks {
+
+namespace {
+
+constexpr uint32_t kMipChainSize = 1024;
+
+} // namespace
+
+//
+// getBytesPerRange
+//
+// Size of a full mip chain for an uncompressed and a block compressed format.
+//
+void BM_GetBytesPerRange(benchmark::State& state) {
+  const auto format = static_cast<TextureFormat>(state.range(0));
+  const auto properties = TextureFormatProperties::fromTextureFormat(format);
+  const uint32_t numMipLevels = TextureDesc::calcNumMipLevels(kMipChainSize, kMipChainSize);
+  const auto range = TextureRangeDesc::new2D(0, 0, kMipChainSize, kMipChainSize, 0, numMipLevels);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(properties.getBytesPerRange(range));
+  }
+  state.SetLabel(properties.name);
+}
+BENCHMARK(BM_GetBytesPerRange)
+    ->Arg(static_cast<int64_t>(TextureFormat::RGBA_UNorm8))
+    ->Arg(static_cast<int64_t>(TextureFormat::RGBA_BC7_UNORM_4x4));
+
+//
+// getBytesPerRange, single level
+//
+void BM_GetBytesPerRangeSingleLevel(benchmark::State& state) {
+  const auto properties = TextureFormatProperties::fromTextureFormat(TextureFormat::RGBA_UNorm8);
+  const auto range = TextureRangeDesc::new2D(0, 0, kMipChainSize, kMipChainSize);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(properties.getBytesPerRange(range));
+  }
+}
+BENCHMARK(BM_GetBytesPerRangeSingleLevel);
+
+//
+// repackData
+//
+// Repack a padded RGBA8 image into tightly packed rows, with and without a vertical flip.
+//
+void BM_RepackData(benchmark::State& state) {
+  const auto size = static_cast<uint32_t>(state.range(0));
+  const bool flipVertical = state.range(1) != 0;
+  const auto properties = TextureFormatProperties::fromTextureFormat(TextureFormat::RGBA_UNorm8);
+  const auto range = TextureRangeDesc::new2D(0, 0, size, size);
+
+  const size_t packedBytesPerRow = size_t(size) * 4;
+  const size_t paddedBytesPerRow = packedBytesPerRow + 256;
+  const std::vector<uint8_t> original(paddedBytesPerRow * size, 0x7f);
+  std::vector<uint8_t> repacked(packedBytesPerRow * size);
+
+  for (auto _ : state) {
+    ITexture::repackData(properties,
+                         range,
+                         original.data(),
+                         paddedBytesPerRow,
+                         repacked.data(),
+                         0,
+                         flipVertical);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * repacked.size()));
+}
+BENCHMARK(BM_RepackData)->ArgsProduct({{64, 512, 2048}, {0, 1}})->ArgNames({"size", "flip"});
+
+} // namespace igl::benchmarks
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "Common.h"
+
+#include <IGLU/uniform/ArenaCollection.h>
+#include <IGLU/uniform/Collection.h>
+#include <IGLU/uniform/CollectionEncoder.h>
+#include <IGLU/uniform/Encoder.h>
+#include <string>
+#include <vector>
+#include <igl/Buffer.h>
+
+namespace igl::benchmarks {
+
+namespace {
+
+// A typical set of per-draw uniforms
+iglu::uniform::Collection makeCollection(std::vector<NameHandle>& outNames) {
+  iglu::uniform::Collection collection;
+  collection.set(IGL_NAMEHANDLE("modelMatrix"), glm::mat4(1.0f));
+  collection.set(IGL_NAMEHANDLE("viewProjectionMatrix"), glm::mat4(1.0f));
+  collection.set(IGL_NAMEHANDLE("normalMatrix"), glm::mat3(1.0f));
+  collection.set(IGL_NAMEHANDLE("color"), glm::vec4(1.0f));
+  collection.set(IGL_NAMEHANDLE("lightDirection"), glm::vec3(0.0f, 1.0f, 0.0f));
+  collection.set(IGL_NAMEHANDLE("time"), 0.5f);
+  collection.set(IGL_NAMEHANDLE("flags"), 3);
+  collection.set(IGL_NAMEHANDLE("bones"), std::vector<glm::mat4>(16, glm::mat4(1.0f)));
+
+  outNames = collection.names();
+  int index = 0;
+  for (const auto& name : outNames) {
+    collection.get(name).setIndex(ShaderStage::Vertex, index++);
+  }
+  return collection;
+}
+
+// The same uniforms as makeCollection() in a single arena
+iglu::uniform::ArenaCollection makeArenaCollection(
+    iglu::uniform::ArenaLayout layout = iglu::uniform::ArenaLayout::Std140) {
+  iglu::uniform::ArenaCollection collection(layout);
+  collection.set(IGL_NAMEHANDLE("modelMatrix"), glm::mat4(1.0f));
+  collection.set(IGL_NAMEHANDLE("viewProjectionMatrix"), glm::mat4(1.0f));
+  collection.set(IGL_NAMEHANDLE("normalMatrix"), glm::mat3(1.0f));
+  collection.set(IGL_NAMEHANDLE("color"), glm::vec4(1.0f));
+  collection.set(IGL_NAMEHANDLE("lightDirection"), glm::vec3(0.0f, 1.0f, 0.0f));
+  collection.set(IGL_NAMEHANDLE("time"), 0.5f);
+  collection.set(IGL_NAMEHANDLE("flags"), 3);
+  collection.set(IGL_NAMEHANDLE("bones"), std::vector<glm::mat4>(16, glm::mat4(1.0f)));
+  return collection;
+}
+
+// Backends for which iglu::uniform::Encoder has an implementation in this build
+void uniformBackends(benchmark::internal::Benchmark* b) {
+  b->Arg(static_cast<int64_t>(BackendType::Metal));
+#if IGL_BACKEND_OPENGL
+  b->Arg(static_cast<int64_t>(BackendType::OpenGL));
+#endif
+}
+
+const char* backendName(BackendType backendType) {
+  return backendType == BackendType::OpenGL ? "OpenGL" : "Metal";
+}
+
+} // namespace
+
+//
+// iglu::uniform::Encoder
+//
+// Encodes a single mat4 uniform.
+//
+void BM_UniformEncoder(benchmark::State& state) {
+  const auto backendType = static_cast<BackendType>(state.range(0));
+  NullRenderContext context(backendType);
+
+  iglu::uniform::DescriptorValue<glm::mat4> uniform(glm::mat4(1.0f));
+  uniform.setIndex(ShaderStage::Vertex, 0);
+  const iglu::uniform::Encoder encoder(backendType);
+
+  for (auto _ : state) {
+    encoder(*context.encoder, BindTarget::kVertex, uniform);
+  }
+  state.SetLabel(backendName(backendType));
+}
+BENCHMARK(BM_UniformEncoder)->Apply(uniformBackends);
+
+//
+// iglu::uniform::CollectionEncoder
+//
+// Encodes all uniforms of a collection, as done once per draw call.
+//
+void BM_UniformCollectionEncoder(benchmark::State& state) {
+  const auto backendType = static_cast<BackendType>(state.range(0));
+  NullRenderContext context(backendType);
+
+  std::vector<NameHandle> names;
+  const auto collection = makeCollection(names);
+  const iglu::uniform::CollectionEncoder encoder(backendType);
+
+  const size_t allocationCount = getAllocationCount();
+  for (auto _ : state) {
+    encoder(collection, *context.encoder, BindTarget::kVertex, names);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * names.size()));
+  state.counters["allocs/iter"] =
+      benchmark::Counter(static_cast<double>(getAllocationCount() - allocationCount),
+                         benchmark::Counter::kAvgIterations);
+  state.SetLabel(backendName(backendType));
+}
+BENCHMARK(BM_UniformCollectionEncoder)->Apply(uniformBackends);
+
+//
+// iglu::uniform::Collection::set
+//
+// Updates a uniform which already exists in the collection.
+//
+void BM_UniformCollectionSet(benchmark::State& state) {
+  std::vector<NameHandle> names;
+  auto collection = makeCollection(names);
+  const NameHandle name = IGL_NAMEHANDLE("modelMatrix");
+  glm::mat4 value(1.0f);
+
+  const size_t allocationCount = getAllocationCount();
+  for (auto _ : state) {
+    value[3][0] += 1.0f;
+    collection.set(name, value);
+  }
+  state.counters["allocs/iter"] =
+      benchmark::Counter(static_cast<double>(getAllocationCount() - allocationCount),
+                         benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_UniformCollectionSet);
+
+//
+// iglu::uniform::ArenaCollection encoding
+//
+// Encodes all uniforms of an arena collection as one block: a single bindBytes() call on Metal,
+// or a single buffer upload and bind on other backends.
+//
+void BM_UniformArenaCollectionEncoder(benchmark::State& state) {
+  const auto backendType = static_cast<BackendType>(state.range(0));
+  NullRenderContext context(backendType);
+
+  const auto collection = makeArenaCollection(iglu::uniform::getArenaLayout(backendType));
+  BufferDesc bufferDesc(BufferDesc::BufferTypeBits::Uniform, nullptr, collection.numBytes());
+  const auto buffer = context.device->createBuffer(bufferDesc, nullptr);
+  const iglu::uniform::Encoder encoder(backendType);
+
+  for (auto _ : state) {
+    encoder(*context.encoder, BindTarget::kVertex, 0, collection, buffer.get());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * collection.names().size()));
+  state.SetLabel(backendType == BackendType::Metal ? "Metal" : "Vulkan");
+}
+BENCHMARK(BM_UniformArenaCollectionEncoder)
+    ->Arg(static_cast<int64_t>(BackendType::Metal))
+    ->Arg(static_cast<int64_t>(BackendType::Vulkan));
+
+//
+// iglu::uniform::ArenaCollection::set
+//
+// Updates a uniform which already exists in the arena.
+//
+void BM_UniformArenaCollectionSet(benchmark::State& state) {
+  auto collection = makeArenaCollection();
+  const NameHandle name = IGL_NAMEHANDLE("modelMatrix");
+  glm::mat4 value(1.0f);
+
+  for (auto _ : state) {
+    value[3][0] += 1.0f;
+    collection.set(name, value);
+  }
+}
+BENCHMARK(BM_UniformArenaCollectionSet);
+
+//
+// iglu::uniform::ArenaCollection::update
+//
+// Copies all values of a collection with the same layout, as when applying per-draw overrides.
+//
+void BM_UniformArenaCollectionUpdate(benchmark::State& state) {
+  auto collection = makeArenaCollection();
+  const auto changes = makeArenaCollection();
+
+  for (auto _ : state) {
+    collection.update(changes);
+    benchmark::DoNotOptimize(collection.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * collection.numBytes()));
+}
+BENCHMARK(BM_UniformArenaCollectionUpdate);
+
+} // namespace igl::benchmarks
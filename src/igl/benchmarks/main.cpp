@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/*
+ * Benchmark entrypoint. Accepts all google-benchmark flags, e.g.
+ *   IGLBenchmarks --benchmark_filter=NameHandle --benchmark_out=results.json
+ *                 --benchmark_out_format=json
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <igl/Common.h>
+
+int main(int argc, char** argv) {
+  // Same as the unit tests: a failed assert must not stop a benchmark run in the debugger
+  igl::setDebugBreakEnabled(false);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
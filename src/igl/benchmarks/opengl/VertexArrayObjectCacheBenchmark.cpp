@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "../../tests/data/ShaderData.h"
+#include "../../tests/data/VertexIndexData.h"
+#include "../../tests/util/device/opengl/TestDevice.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <igl/CommandBuffer.h>
+#include <igl/CommandQueue.h>
+#include <igl/Framebuffer.h>
+#include <igl/RenderCommandEncoder.h>
+#include <igl/RenderPass.h>
+#include <igl/RenderPipelineState.h>
+#include <igl/SamplerState.h>
+#include <igl/ShaderCreator.h>
+#include <igl/VertexInputState.h>
+#include <igl/opengl/Device.h>
+#include <igl/opengl/IContext.h>
+
+namespace igl::benchmarks {
+
+namespace {
+
+namespace shader = tests::data::shader;
+namespace vertex_index = tests::data::vertex_index;
+
+/// Meshes with their own vertex, UV and index buffers, drawn into a 2x2 offscreen framebuffer so
+/// that rasterization on software drivers such as llvmpipe does not dominate the measurement.
+struct GlDrawContext {
+  explicit GlDrawContext(size_t numMeshes) {
+    device = tests::util::device::opengl::createTestDevice();
+    if (!device) {
+      return;
+    }
+    queue = device->createCommandQueue({}, nullptr);
+
+    auto texture = device->createTexture(
+        TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                           2,
+                           2,
+                           TextureDesc::TextureUsageBits::Sampled |
+                               TextureDesc::TextureUsageBits::Attachment),
+        nullptr);
+    FramebufferDesc framebufferDesc;
+    framebufferDesc.colorAttachments[0].texture = texture;
+    framebuffer = device->createFramebuffer(framebufferDesc, nullptr);
+    inputTexture = device->createTexture(
+        TextureDesc::new2D(
+            TextureFormat::RGBA_UNorm8, 2, 2, TextureDesc::TextureUsageBits::Sampled),
+        nullptr);
+    sampler = device->createSamplerState(SamplerStateDesc::newLinear(), nullptr);
+
+    renderPass.colorAttachments.resize(1);
+    renderPass.colorAttachments[0].loadAction = LoadAction::Clear;
+    renderPass.colorAttachments[0].storeAction = StoreAction::Store;
+
+    VertexInputStateDesc inputDesc;
+    inputDesc.attributes[0].format = VertexAttributeFormat::Float4;
+    inputDesc.attributes[0].bufferIndex = shader::kSimplePosIndex;
+    inputDesc.attributes[0].name = shader::kSimplePos;
+    inputDesc.attributes[0].location = 0;
+    inputDesc.inputBindings[0].stride = sizeof(float) * 4;
+    inputDesc.attributes[1].format = VertexAttributeFormat::Float2;
+    inputDesc.attributes[1].bufferIndex = shader::kSimpleUvIndex;
+    inputDesc.attributes[1].name = shader::kSimpleUv;
+    inputDesc.attributes[1].location = 1;
+    inputDesc.inputBindings[1].stride = sizeof(float) * 2;
+    inputDesc.numAttributes = inputDesc.numInputBindings = 2;
+
+    const std::string vertexSource(shader::kOglSimpleVertShader);
+    const std::string fragmentSource(shader::kOglSimpleFragShader);
+    RenderPipelineDesc pipelineDesc;
+    pipelineDesc.vertexInputState = device->createVertexInputState(inputDesc, nullptr);
+    pipelineDesc.shaderStages = ShaderStagesCreator::fromModuleStringInput(*device,
+                                                                           vertexSource.c_str(),
+                                                                           "main",
+                                                                           "",
+                                                                           fragmentSource.c_str(),
+                                                                           "main",
+                                                                           "",
+                                                                           nullptr);
+    pipelineDesc.targetDesc.colorAttachments.resize(1);
+    pipelineDesc.targetDesc.colorAttachments[0].textureFormat = texture->getFormat();
+    pipelineDesc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE("inputImage");
+    pipelineDesc.cullMode = CullMode::Disabled;
+    pipeline = device->createRenderPipeline(pipelineDesc, nullptr);
+
+    for (size_t i = 0; i != numMeshes; ++i) {
+      meshes.push_back({
+          .positions = device->createBuffer(BufferDesc(BufferDesc::BufferTypeBits::Vertex,
+                                                       vertex_index::kQuadVert.data(),
+                                                       sizeof(vertex_index::kQuadVert)),
+                                            nullptr),
+          .uvs = device->createBuffer(BufferDesc(BufferDesc::BufferTypeBits::Vertex,
+                                                 vertex_index::kQuadUv.data(),
+                                                 sizeof(vertex_index::kQuadUv)),
+                                      nullptr),
+          .indices = device->createBuffer(BufferDesc(BufferDesc::BufferTypeBits::Index,
+                                                     vertex_index::kQuadInd.data(),
+                                                     sizeof(vertex_index::kQuadInd)),
+                                          nullptr),
+      });
+    }
+  }
+
+  [[nodiscard]] bool isValid() const {
+    return device && queue && framebuffer && pipeline;
+  }
+
+  void drawFrame() {
+    auto commandBuffer = queue->createCommandBuffer({}, nullptr);
+    auto encoder = commandBuffer->createRenderCommandEncoder(renderPass, framebuffer);
+    encoder->bindRenderPipelineState(pipeline);
+    encoder->bindTexture(0, BindTarget::kFragment, inputTexture.get());
+    encoder->bindSamplerState(0, BindTarget::kFragment, sampler.get());
+    for (const auto& mesh : meshes) {
+      encoder->bindVertexBuffer(shader::kSimplePosIndex, *mesh.positions);
+      encoder->bindVertexBuffer(shader::kSimpleUvIndex, *mesh.uvs);
+      encoder->bindIndexBuffer(*mesh.indices, IndexFormat::UInt16);
+      encoder->drawIndexed(vertex_index::kQuadInd.size());
+    }
+    encoder->endEncoding();
+    queue->submit(*commandBuffer);
+    commandBuffer->waitUntilCompleted();
+  }
+
+  struct Mesh {
+    std::unique_ptr<IBuffer> positions;
+    std::unique_ptr<IBuffer> uvs;
+    std::unique_ptr<IBuffer> indices;
+  };
+
+  std::unique_ptr<opengl::Device> device;
+  std::shared_ptr<ICommandQueue> queue;
+  std::shared_ptr<IFramebuffer> framebuffer;
+  std::shared_ptr<ITexture> inputTexture;
+  std::shared_ptr<ISamplerState> sampler;
+  std::shared_ptr<IRenderPipelineState> pipeline;
+  RenderPassDesc renderPass;
+  std::vector<Mesh> meshes;
+};
+
+} // namespace
+
+//
+// GL draw loop with the vertex array object cache
+//
+// Draws `state.range(1)` meshes per frame, each with its own buffers, with the VAO cache off
+// (state.range(0) == 0: vertex attributes are specified on every draw) and on (one
+// glBindVertexArray() per mesh). Runs on the default offscreen GL context, e.g. llvmpipe with
+// LIBGL_ALWAYS_SOFTWARE=1, and reports the GL calls saved as CPU time per draw.
+//
+void BM_GlDrawVertexArrayObjectCache(benchmark::State& state) {
+  const bool cacheEnabled = state.range(0) != 0;
+  const auto numMeshes = static_cast<size_t>(state.range(1));
+  GlDrawContext context(numMeshes);
+  if (!context.isValid()) {
+    state.SkipWithError("No OpenGL context");
+    return;
+  }
+  auto& glContext = context.device->getContext();
+  if (cacheEnabled &&
+      !glContext.deviceFeatures().hasInternalFeature(opengl::InternalFeatures::VertexArrayObject)) {
+    state.SkipWithError("VertexArrayObject not supported");
+    return;
+  }
+  glContext.setVertexArrayObjectCacheEnabled(cacheEnabled);
+
+  // Creates the cached VAOs outside of the measurement
+  context.drawFrame();
+
+  for (auto _ : state) {
+    context.drawFrame();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numMeshes));
+  glContext.setVertexArrayObjectCacheEnabled(false);
+}
+BENCHMARK(BM_GlDrawVertexArrayObjectCache)
+    ->ArgNames({"cache", "meshes"})
+    ->ArgsProduct({{0, 1}, {1, 100, 1000}})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace igl::benchmarks
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <igl/vulkan/util/SpvReflection.h>
+
+#include "../../tests/util/SpvModules.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace igl::benchmarks {
+
+namespace {
+
+const std::vector<uint32_t>& getSpvWords(int64_t index) {
+  switch (index) {
+  case 0:
+    return tests::getUniformBufferSpvWords();
+  case 1:
+    return tests::getTextureSpvWords();
+  default:
+    return tests::getTinyMeshFragmentShaderSpvWords();
+  }
+}
+
+} // namespace
+
+//
+// util::getReflectionData
+//
+// Reflects the SPIR-V modules used by the unit tests: uniform buffers, textures, and the tiny mesh
+// fragment shader which has both.
+//
+void BM_SpvGetReflectionData(benchmark::State& state) {
+  const auto& spvWords = getSpvWords(state.range(0));
+  const size_t numBytes = spvWords.size() * sizeof(uint32_t);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vulkan::util::getReflectionData(spvWords.data(), numBytes));
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * numBytes));
+}
+BENCHMARK(BM_SpvGetReflectionData)->DenseRange(0, 2)->ArgName("module");
+
+//
+// util::mergeReflectionData
+//
+void BM_SpvMergeReflectionData(benchmark::State& state) {
+  const auto& vertWords = tests::getUniformBufferSpvWords();
+  const auto& fragWords = tests::getTinyMeshFragmentShaderSpvWords();
+  const auto vertInfo =
+      vulkan::util::getReflectionData(vertWords.data(), vertWords.size() * sizeof(uint32_t));
+  const auto fragInfo =
+      vulkan::util::getReflectionData(fragWords.data(), fragWords.size() * sizeof(uint32_t));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vulkan::util::mergeReflectionData(vertInfo, fragInfo));
+  }
+}
+BENCHMARK(BM_SpvMergeReflectionData);
+
+} // namespace igl::benchmarks
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <igl/vulkan/VulkanRetirementQueue.h>
+
+#include <deque>
+#include <future>
+
+namespace igl::benchmarks {
+
+using igl::vulkan::VulkanRetirementQueue;
+
+namespace {
+
+// Same retirement rule as VulkanContext::processDeferredTasks()
+constexpr uint64_t kNumWaitFrames = 3u;
+
+bool canRetire(uint64_t currentFrameId, uint64_t frameId) {
+  return currentFrameId > frameId + kNumWaitFrames;
+}
+
+VulkanRetirementQueue::SubmitHandle makeHandle(uint64_t frameId) {
+  return VulkanRetirementQueue::SubmitHandle((frameId + 1) << 32);
+}
+
+// Mirrors VulkanContext::DeferredTask, the path used for object destruction before
+// VulkanRetirementQueue was introduced
+struct DeferredTask {
+  DeferredTask(std::packaged_task<void()>&& task, VulkanRetirementQueue::SubmitHandle handle) :
+    task(std::move(task)), handle(handle) {}
+  std::packaged_task<void()> task;
+  VulkanRetirementQueue::SubmitHandle handle;
+  uint64_t frameId = 0;
+};
+
+} // namespace
+
+//
+// Deferred destruction with std::packaged_task
+//
+// Each iteration is one frame which retires `state.range(0)` objects and destroys the objects
+// retired kNumWaitFrames frames earlier. Every object allocates a closure.
+//
+void BM_DeferredDestroyPackagedTask(benchmark::State& state) {
+  const auto objectsPerFrame = static_cast<uint64_t>(state.range(0));
+  std::deque<DeferredTask> deferredTasks;
+  uint64_t numDestroyed = 0;
+  uint64_t frameId = 0;
+
+  for (auto _ : state) {
+    for (uint64_t i = 0; i != objectsPerFrame; ++i) {
+      const uint64_t handle = frameId * objectsPerFrame + i;
+      deferredTasks.emplace_back(std::packaged_task<void()>([handle, &numDestroyed]() {
+                                   numDestroyed += handle != 0 ? 1 : 0;
+                                 }),
+                                 makeHandle(frameId));
+      deferredTasks.back().frameId = frameId;
+    }
+    while (!deferredTasks.empty() && canRetire(frameId, deferredTasks.front().frameId)) {
+      deferredTasks.front().task();
+      deferredTasks.pop_front();
+    }
+    frameId++;
+  }
+  benchmark::DoNotOptimize(numDestroyed);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * objectsPerFrame));
+}
+BENCHMARK(BM_DeferredDestroyPackagedTask)->Arg(1)->Arg(16)->Arg(256);
+
+//
+// Deferred destruction with VulkanRetirementQueue
+//
+// Same workload as above. Once warmed up, the queue reuses its buckets and does not allocate.
+//
+void BM_DeferredDestroyRetirementQueue(benchmark::State& state) {
+  const auto objectsPerFrame = static_cast<uint64_t>(state.range(0));
+  VulkanRetirementQueue queue;
+  uint64_t numDestroyed = 0;
+  uint64_t frameId = 0;
+
+  for (auto _ : state) {
+    for (uint64_t i = 0; i != objectsPerFrame; ++i) {
+      queue.push(makeHandle(frameId),
+                 frameId,
+                 {.type = VulkanRetirementQueue::Type::Buffer,
+                  .handle = frameId * objectsPerFrame + i,
+                  .allocation = 0});
+    }
+    queue.process(
+        [frameId](VulkanRetirementQueue::SubmitHandle /*handle*/, uint64_t retiredFrameId) {
+          return canRetire(frameId, retiredFrameId);
+        },
+        [&numDestroyed](const VulkanRetirementQueue::Entry& entry) {
+          numDestroyed += entry.handle != 0 ? 1 : 0;
+        });
+    frameId++;
+  }
+  benchmark::DoNotOptimize(numDestroyed);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * objectsPerFrame));
+}
+BENCHMARK(BM_DeferredDestroyRetirementQueue)->Arg(1)->Arg(16)->Arg(256);
+
+} // namespace igl::benchmarks
@@ -52,6 +52,8 @@ DXGI_FORMAT textureFormatToDXGIFormat(TextureFormat format) {
     return DXGI_FORMAT_R32_FLOAT;
   case TextureFormat::R_UInt32:
     return DXGI_FORMAT_R32_UINT;
+  case TextureFormat::R9G9B9E5_F:
+    return DXGI_FORMAT_R9G9B9E5_SHAREDEXP;
   case TextureFormat::RG_F32:
     return DXGI_FORMAT_R32G32_FLOAT;
   case TextureFormat::RGB_F16:
@@ -173,6 +175,8 @@ TextureFormat dxgiFormatToTextureFormat(DXGI_FORMAT format) {
     return TextureFormat::BGRA_SRGB;
   case DXGI_FORMAT_R16G16B16A16_FLOAT:
     return TextureFormat::RGBA_F16;
+  case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
+    return TextureFormat::R9G9B9E5_F;
   case DXGI_FORMAT_R32G32B32A32_FLOAT:
     return TextureFormat::RGBA_F32;
   case DXGI_FORMAT_D16_UNORM:
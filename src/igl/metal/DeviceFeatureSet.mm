@@ -441,6 +441,8 @@ ICapabilities::TextureFormatCapabilities DeviceFeatureSet::getTextureFormatCapab
            (supports32BitFloatFiltering_ ? sampledFiltered : 0);
   case TextureFormat::R_UInt32:
     return sampled | storage | attachment | sampledAttachment;
+  case TextureFormat::R9G9B9E5_F:
+    return sampled | sampledFiltered;
 
     // 64 bpp
   case TextureFormat::RGBA_UNorm16:
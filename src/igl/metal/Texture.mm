@@ -449,6 +449,9 @@ MTLPixelFormat Texture::textureFormatToMTLPixelFormat(TextureFormat value) {
   case TextureFormat::R_UInt32:
     return MTLPixelFormatR32Uint;
 
+  case TextureFormat::R9G9B9E5_F:
+    return MTLPixelFormatRGB9E5Float;
+
   case TextureFormat::RG_F32:
     return MTLPixelFormatRG32Float;
 
@@ -875,6 +878,8 @@ TextureFormat Texture::mtlPixelFormatToTextureFormat(MTLPixelFormat value) {
     return TextureFormat::R_F32;
   case MTLPixelFormatR32Uint:
     return TextureFormat::R_UInt32;
+  case MTLPixelFormatRGB9E5Float:
+    return TextureFormat::R9G9B9E5_F;
   case MTLPixelFormatRG32Float:
     return TextureFormat::RG_F32;
   case MTLPixelFormatRGBA32Uint:
@@ -7,11 +7,30 @@
 
 #include <igl/opengl/Buffer.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <igl/Buffer.h>
 #include <igl/DeviceFeatures.h>
 
 namespace igl::opengl {
 
+namespace {
+
+constexpr uint64_t kRegionNeverUsed = std::numeric_limits<uint64_t>::max();
+constexpr GLbitfield kPersistentMapFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+void extendRange(std::pair<size_t, size_t>& range, size_t begin, size_t end) {
+  if (range.first >= range.second) {
+    range = {begin, end};
+  } else {
+    range = {std::min(range.first, begin), std::max(range.second, end)};
+  }
+}
+
+} // namespace
+
 // ********************************
 // ****  ArrayBuffer
 // ********************************
@@ -90,8 +109,26 @@ void ArrayBuffer::initialize(const BufferDesc& desc, Result* IGL_NULLABLE outRes
 
   size_ = desc.length;
 
+  // storage buffers are written by the GPU and indirect buffers are bound without an offset, so
+  // only vertex, index and uniform buffers can stream
+  if (isDynamic_ && (desc.hint & BufferDesc::BufferAPIHintBits::Ring) != 0 &&
+      (target_ == GL_ARRAY_BUFFER || target_ == GL_ELEMENT_ARRAY_BUFFER ||
+       target_ == GL_UNIFORM_BUFFER)) {
+    streamingMode_ = StreamingMode::Orphaning;
+    shadow_.resize(size_);
+    if (desc.data != nullptr) {
+      std::memcpy(shadow_.data(), desc.data, size_);
+    }
+    usage = GL_STREAM_DRAW;
+  }
+
   getContext().bindBuffer(target_, iD_);
-  getContext().bufferData(target_, size_, desc.data, usage);
+  size_t allocatedSize = size_;
+  if (streamingMode_ != StreamingMode::None && initializePersistentStorage()) {
+    allocatedSize = regionSize_ * IContext::kMaxFramesInFlight;
+  } else {
+    getContext().bufferData(target_, size_, desc.data, usage);
+  }
 
   // make sure the buffer was fully allocated
   GLint bufferSize = 0;
@@ -108,9 +145,10 @@ void ArrayBuffer::initialize(const BufferDesc& desc, Result* IGL_NULLABLE outRes
 
   getContext().bindBuffer(target_, 0);
 
-  if (bufferSize != size_) {
+  if (bufferSize != allocatedSize) {
     getContext().deleteBuffers(1, &iD_);
     iD_ = 0;
+    persistentData_ = nullptr;
     Result::setResult(outResult, Result::Code::ArgumentOutOfRange, "bufferSize != dataSize");
     return;
   }
@@ -118,6 +156,46 @@ void ArrayBuffer::initialize(const BufferDesc& desc, Result* IGL_NULLABLE outRes
   Result::setOk(outResult);
 }
 
+// allocate IContext::kMaxFramesInFlight regions of immutable storage, mapped for the lifetime of
+// the buffer; the buffer must be bound to target_
+bool ArrayBuffer::initializePersistentStorage() {
+  const auto& features = getContext().deviceFeatures();
+  if (!features.hasInternalFeature(InternalFeatures::BufferStorage) ||
+      !features.hasInternalFeature(InternalFeatures::Sync) ||
+      !features.hasFeature(DeviceFeatures::MapBufferRange)) {
+    return false;
+  }
+
+  // each region starts at an offset which is valid for glBindBufferRange()
+  size_t alignment = 16;
+  features.getFeatureLimits(DeviceFeatureLimits::BufferAlignment, alignment);
+  alignment = std::max<size_t>(alignment, 1);
+  regionSize_ = (size_ + alignment - 1) / alignment * alignment;
+  const size_t totalSize = regionSize_ * IContext::kMaxFramesInFlight;
+
+  getContext().bufferStorage(
+      target_, static_cast<GLsizeiptr>(totalSize), nullptr, kPersistentMapFlags);
+  persistentData_ = static_cast<uint8_t*>(getContext().mapBufferRange(
+      target_, 0, static_cast<GLsizeiptr>(totalSize), kPersistentMapFlags));
+  if (persistentData_ == nullptr) {
+    // immutable storage cannot be respecified, so start over with a new buffer object
+    IGL_LOG_ERROR("Failed to map streaming buffer persistently, falling back to orphaning\n");
+    getContext().deleteBuffers(1, &iD_);
+    getContext().genBuffers(1, &iD_);
+    getContext().bindBuffer(target_, iD_);
+    regionSize_ = 0;
+    return false;
+  }
+
+  for (size_t region = 0; region < IContext::kMaxFramesInFlight; ++region) {
+    std::memcpy(persistentData_ + region * regionSize_, shadow_.data(), size_);
+    regionLastFrameIndex_[region] = kRegionNeverUsed;
+  }
+  regionIndex_ = 0;
+  streamingMode_ = StreamingMode::Persistent;
+  return true;
+}
+
 // upload data to the buffer at the given offset with the given size
 Result ArrayBuffer::upload(const void* data, const BufferRange& range) {
   // static buffers can only upload data once during creation
@@ -125,6 +203,15 @@ Result ArrayBuffer::upload(const void* data, const BufferRange& range) {
     return Result(Result::Code::InvalidOperation, "Can't upload to static buffers");
   }
 
+  if (streamingMode_ != StreamingMode::None) {
+    if (data == nullptr || range.offset + range.size > size_) {
+      return Result(Result::Code::ArgumentOutOfRange,
+                    "upload() size + offset must be <= buffer size");
+    }
+    uploadStreaming(data, range);
+    return Result();
+  }
+
   getContext().bindBuffer(target_, iD_);
 
   getContext().bufferSubData(target_, range.offset, range.size, data);
@@ -134,6 +221,56 @@ Result ArrayBuffer::upload(const void* data, const BufferRange& range) {
   return Result();
 }
 
+size_t ArrayBuffer::acquireBindOffset() noexcept {
+  if (streamingMode_ != StreamingMode::None) {
+    isRegionInUse_ = true;
+    regionLastFrameIndex_[regionIndex_] = getContext().getFrameIndex();
+  }
+  return getBindOffset();
+}
+
+void ArrayBuffer::uploadStreaming(const void* IGL_NONNULL data, const BufferRange& range) {
+  IContext& ctx = getContext();
+
+  // memmove(), as copyBuffer() may pass a pointer into shadow_
+  std::memmove(shadow_.data() + range.offset, data, range.size);
+
+  // commands issued since the last upload may still read the current region or storage
+  const bool isInUse = isRegionInUse_;
+  isRegionInUse_ = false;
+
+  if (streamingMode_ == StreamingMode::Orphaning) {
+    ctx.bindBuffer(target_, iD_);
+    if (isInUse) {
+      // give the storage in use back to the driver instead of stalling on it
+      ctx.bufferData(target_, static_cast<GLsizeiptr>(size_), shadow_.data(), GL_STREAM_DRAW);
+    } else {
+      ctx.bufferSubData(target_, range.offset, range.size, data);
+    }
+    ctx.bindBuffer(target_, 0);
+    return;
+  }
+
+  if (isInUse) {
+    regionIndex_ = (regionIndex_ + 1) % IContext::kMaxFramesInFlight;
+    if (regionLastFrameIndex_[regionIndex_] != kRegionNeverUsed) {
+      // falls back to glFinish() if the region was used earlier in the current frame
+      ctx.waitForFrame(regionLastFrameIndex_[regionIndex_]);
+      regionLastFrameIndex_[regionIndex_] = kRegionNeverUsed;
+    }
+  }
+
+  for (auto& staleRange : regionStaleRanges_) {
+    extendRange(staleRange, range.offset, range.offset + range.size);
+  }
+  // bring the whole region up to date, as it may have missed updates of other frames
+  auto& staleRange = regionStaleRanges_[regionIndex_];
+  std::memcpy(persistentData_ + getBindOffset() + staleRange.first,
+              shadow_.data() + staleRange.first,
+              staleRange.second - staleRange.first);
+  staleRange = {0, 0};
+}
+
 void* FOLLY_NULLABLE ArrayBuffer::map(const BufferRange& range, Result* IGL_NULLABLE outResult) {
   if ((range.size + range.offset) > getSizeInBytes()) {
     Result::setResult(
@@ -141,6 +278,12 @@ void* FOLLY_NULLABLE ArrayBuffer::map(const BufferRange& range, Result* IGL_NULL
     return nullptr;
   }
 
+  if (streamingMode_ != StreamingMode::None) {
+    // streaming buffers are only written by the CPU
+    Result::setOk(outResult);
+    return shadow_.data() + range.offset;
+  }
+
   bind();
 
   void* srcData = nullptr;
@@ -156,6 +299,9 @@ void* FOLLY_NULLABLE ArrayBuffer::map(const BufferRange& range, Result* IGL_NULL
 }
 
 void ArrayBuffer::unmap() {
+  if (streamingMode_ != StreamingMode::None) {
+    return;
+  }
   bind();
   getContext().unmapBuffer(target_);
 }
@@ -197,7 +343,13 @@ void UniformBlockBuffer::bindBase(size_t index, Result* IGL_NULLABLE outResult)
       Result::setResult(outResult, Result::Code::InvalidOperation, kErrorMsg);
       return;
     }
-    getContext().bindBufferBase(target_, (GLuint)index, iD_);
+    const size_t bindOffset = acquireBindOffset();
+    if (isPersistentlyMapped()) {
+      getContext().bindBufferRange(
+          target_, (GLuint)index, iD_, (GLintptr)bindOffset, (GLsizeiptr)getSizeInBytes());
+    } else {
+      getContext().bindBufferBase(target_, (GLuint)index, iD_);
+    }
     Result::setOk(outResult);
   } else {
     static constexpr const char* kErrorMsg = "Uniform Blocks are not supported";
@@ -223,8 +375,11 @@ void UniformBlockBuffer::bindRange(size_t index,
                      offset,
                      size,
                      getSizeInBytes());
-    getContext().bindBufferRange(
-        target_, (GLuint)index, iD_, (GLintptr)offset, size ? size : getSizeInBytes() - offset);
+    getContext().bindBufferRange(target_,
+                                 (GLuint)index,
+                                 iD_,
+                                 (GLintptr)(acquireBindOffset() + offset),
+                                 size ? size : getSizeInBytes() - offset);
     Result::setOk(outResult);
   } else {
     static constexpr const char* kErrorMsg = "Uniform Blocks are not supported";
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
 #include <igl/Buffer.h>
 #include <igl/opengl/IContext.h>
 #include <igl/opengl/WithContext.h>
@@ -45,6 +47,18 @@ class Buffer : public WithContext, public IBuffer {
   BufferDesc::BufferType bufferType_ = 0;
 };
 
+/**
+ * @brief A GL buffer object.
+ *
+ * Shared buffers created with BufferDesc::BufferAPIHintBits::Ring are streaming buffers. As on
+ * Metal and Vulkan, they are meant to be updated about once per frame. When glBufferStorage() is
+ * supported, a streaming buffer holds IContext::kMaxFramesInFlight regions of a single
+ * persistently and coherently mapped buffer object, and upload() becomes a memcpy(). An upload
+ * after the current region was bound moves to the next region, after waiting on the fence of the
+ * frame that last used it (see IContext::getFrameIndex()); more uploads than regions in one frame
+ * therefore stall. Bindings and copies of the buffer have to add acquireBindOffset(). Without
+ * glBufferStorage(), such an upload orphans the buffer storage with glBufferData() instead.
+ */
 class ArrayBuffer : public Buffer {
  public:
   ArrayBuffer(IContext& context,
@@ -62,7 +76,7 @@ class ArrayBuffer : public Buffer {
   void unmap() override;
 
   [[nodiscard]] BufferDesc::BufferAPIHint acceptedApiHints() const noexcept override {
-    return 0;
+    return isStreaming() ? BufferDesc::BufferAPIHintBits::Ring : 0;
   }
 
   [[nodiscard]] ResourceStorage storage() const noexcept override {
@@ -81,6 +95,26 @@ class ArrayBuffer : public Buffer {
     return target_;
   }
 
+  /// Offset of the current region of a persistently mapped streaming buffer, 0 otherwise.
+  IGL_INLINE size_t getBindOffset() const noexcept {
+    return regionIndex_ * regionSize_;
+  }
+
+  /// Returns getBindOffset(), which has to be added to the offsets of all bindings and copies of
+  /// the buffer, and marks the current region as used by GPU commands so that the next upload()
+  /// does not overwrite it.
+  size_t acquireBindOffset() noexcept;
+
+  /// True for Shared buffers created with BufferDesc::BufferAPIHintBits::Ring
+  [[nodiscard]] bool isStreaming() const noexcept {
+    return streamingMode_ != StreamingMode::None;
+  }
+
+  /// True if the streaming buffer is persistently mapped, false if it is orphaned on updates
+  [[nodiscard]] bool isPersistentlyMapped() const noexcept {
+    return streamingMode_ == StreamingMode::Persistent;
+  }
+
   void initialize(const BufferDesc& desc, Result* IGL_NULLABLE outResult) override;
 
   void bind();
@@ -103,9 +137,27 @@ class ArrayBuffer : public Buffer {
   GLenum target_{};
 
  private:
+  enum class StreamingMode : uint8_t { None, Persistent, Orphaning };
+
+  bool initializePersistentStorage();
+  void uploadStreaming(const void* IGL_NONNULL data, const BufferRange& range);
+
   size_t size_;
 
   bool isDynamic_;
+
+  StreamingMode streamingMode_ = StreamingMode::None;
+  // latest contents of a streaming buffer, used to bring regions up to date and for map()
+  std::vector<uint8_t> shadow_;
+  uint8_t* IGL_NULLABLE persistentData_ = nullptr;
+  size_t regionSize_ = 0;
+  size_t regionIndex_ = 0;
+  // the current region (or the orphaned storage) was bound since the last upload
+  bool isRegionInUse_ = false;
+  // last frame which may have read each region
+  std::array<uint64_t, IContext::kMaxFramesInFlight> regionLastFrameIndex_{};
+  // [begin, end) byte range of each region which is older than shadow_
+  std::array<std::pair<size_t, size_t>, IContext::kMaxFramesInFlight> regionStaleRanges_{};
 };
 
 class UniformBlockBuffer : public ArrayBuffer {
@@ -124,7 +176,7 @@ class UniformBlockBuffer : public ArrayBuffer {
   void bindRange(size_t index, size_t offset, size_t size, Result* IGL_NULLABLE outResult);
 
   [[nodiscard]] BufferDesc::BufferAPIHint acceptedApiHints() const noexcept override {
-    return BufferDesc::BufferAPIHintBits::UniformBlock;
+    return BufferDesc::BufferAPIHintBits::UniformBlock | ArrayBuffer::acceptedApiHints();
   }
 };
 
@@ -34,6 +34,7 @@ std::unique_ptr<IComputeCommandEncoder> CommandBuffer::createComputeCommandEncod
 
 void CommandBuffer::present(const std::shared_ptr<ITexture>& surface) const {
   context_->present(surface);
+  hasPresented_ = true;
 }
 
 void CommandBuffer::waitUntilScheduled() {
@@ -73,12 +74,34 @@ void CommandBuffer::copyBuffer(IBuffer& src,
     return;
   }
 
+  // uniform buffers are the only buffers which are not ArrayBuffers
+  if (!IGL_DEBUG_VERIFY(static_cast<Buffer&>(src).getType() != Buffer::Type::Uniform &&
+                        static_cast<Buffer&>(dst).getType() != Buffer::Type::Uniform)) {
+    return;
+  }
   auto& srcBuffer = static_cast<ArrayBuffer&>(src);
   auto& dstBuffer = static_cast<ArrayBuffer&>(dst);
 
+  if (dstBuffer.isStreaming()) {
+    // streaming buffers are only written by the CPU; upload() keeps their shadow copy and regions
+    // up to date
+    Result result;
+    const void* data = srcBuffer.map(BufferRange(size, srcOffset), &result);
+    if (IGL_DEBUG_VERIFY(data != nullptr, "%s", result.message.c_str())) {
+      result = dstBuffer.upload(data, BufferRange(size, dstOffset));
+      IGL_DEBUG_ASSERT(result.isOk(), "%s", result.message.c_str());
+      srcBuffer.unmap();
+    }
+    return;
+  }
+
   ctx.bindBuffer(GL_COPY_READ_BUFFER, srcBuffer.getId());
   ctx.bindBuffer(GL_COPY_WRITE_BUFFER, dstBuffer.getId());
-  ctx.copyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, dstOffset, size);
+  ctx.copyBufferSubData(GL_COPY_READ_BUFFER,
+                        GL_COPY_WRITE_BUFFER,
+                        static_cast<GLintptr>(srcOffset + srcBuffer.acquireBindOffset()),
+                        static_cast<GLintptr>(dstOffset + dstBuffer.acquireBindOffset()),
+                        size);
   ctx.bindBuffer(GL_COPY_READ_BUFFER, 0);
   ctx.bindBuffer(GL_COPY_WRITE_BUFFER, 0);
 }
@@ -50,8 +50,14 @@ class CommandBuffer final : public ICommandBuffer,
 
   IContext& getContext() const;
 
+  /// True if present() was called, i.e. submitting this command buffer ends the frame
+  [[nodiscard]] bool hasPresented() const {
+    return hasPresented_;
+  }
+
  private:
   std::shared_ptr<IContext> context_;
+  mutable bool hasPresented_ = false;
 };
 
 } // namespace igl::opengl
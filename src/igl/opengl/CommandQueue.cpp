@@ -34,12 +34,15 @@ std::shared_ptr<ICommandBuffer> CommandQueue::createCommandBuffer(const CommandB
   return commandBuffer;
 }
 
-SubmitHandle CommandQueue::submit(const ICommandBuffer& commandBuffer, bool /* endOfFrame */) {
+SubmitHandle CommandQueue::submit(const ICommandBuffer& commandBuffer, bool endOfFrame) {
   const auto& cb = static_cast<const CommandBuffer&>(commandBuffer);
   incrementDrawCount(cb.getCurrentDrawCount());
   if (commandBuffer.desc.timer) {
     static_cast<Timer&>(*commandBuffer.desc.timer).end();
   }
+  if (endOfFrame || cb.hasPresented()) {
+    cb.getContext().endFrame();
+  }
 
   activeCommandBuffers_--;
 
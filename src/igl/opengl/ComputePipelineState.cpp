@@ -30,6 +30,10 @@ Result ComputePipelineState::create(const ComputePipelineDesc& desc) {
     return result;
   }
   shaderStages_ = std::static_pointer_cast<ShaderStages>(desc.shaderStages);
+  result = shaderStages_->waitForLink();
+  if (!result.isOk()) {
+    return result;
+  }
   reflection_ = std::make_shared<ComputePipelineReflection>(getContext(), *shaderStages_);
 
   for (const auto& unitSampler : desc.imagesMap) {
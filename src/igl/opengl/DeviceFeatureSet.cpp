@@ -314,6 +314,8 @@ bool DeviceFeatureSet::isExtensionSupported(Extensions extension) const {
     return hasDesktopExtension(*this, "GL_ARB_bindless_texture");
   case Extensions::BindlessTextureNv:
     return hasDesktopOrESExtension(*this, "GL_NV_bindless_texture");
+  case Extensions::BufferStorage:
+    return hasESExtension(*this, "GL_EXT_buffer_storage");
   case Extensions::Debug:
     return hasDesktopOrESExtension(*this, "GL_KHR_debug");
   case Extensions::DebugLabel:
@@ -352,6 +354,8 @@ bool DeviceFeatureSet::isExtensionSupported(Extensions extension) const {
     return hasESExtension(*this, "GL_IMG_multisampled_render_to_texture");
   case Extensions::MultiViewMultiSample:
     return hasESExtension(*this, "GL_OVR_multiview_multisampled_render_to_texture");
+  case Extensions::ParallelShaderCompile:
+    return hasDesktopOrESExtension(*this, "GL_KHR_parallel_shader_compile");
   case Extensions::PolygonOffsetClamp:
     return hasDesktopOrESExtension(*this, "GL_ARB_polygon_offset_clamp");
   case Extensions::RequiredInternalFormat:
@@ -747,6 +751,10 @@ bool DeviceFeatureSet::isInternalFeatureSupported(InternalFeatures feature) cons
            hasExtension(Extensions::InvalidateSubdata) ||
            hasExtension(Extensions::DiscardFramebuffer);
 
+  case InternalFeatures::ParallelShaderCompile:
+    return hasExtension(Extensions::ParallelShaderCompile) ||
+           hasDesktopExtension(*this, "GL_ARB_parallel_shader_compile");
+
   case InternalFeatures::PolygonFillMode:
     return hasDesktopVersion(*this, GLVersion::v2_0);
 
@@ -757,6 +765,10 @@ bool DeviceFeatureSet::isInternalFeatureSupported(InternalFeatures feature) cons
   case InternalFeatures::SeamlessCubeMap:
     return hasDesktopVersionOrExtension(*this, GLVersion::v3_2, "GL_ARB_seamless_cube_map");
 
+  case InternalFeatures::BufferStorage:
+    return hasDesktopVersionOrExtension(*this, GLVersion::v4_4, "GL_ARB_buffer_storage") ||
+           hasExtension(Extensions::BufferStorage);
+
   case InternalFeatures::Sync:
     return hasDesktopOrESVersion(*this, GLVersion::v3_2, GLVersion::v3_0_ES) ||
            hasDesktopExtension(*this, "GL_ARB_sync") || hasExtension(Extensions::Sync);
@@ -928,6 +940,9 @@ bool DeviceFeatureSet::isColorTexImageFeatureSupported(TextureFeatures feature)
     return hasTextureFeature(TextureFeatures::ColorRenderbufferRgb10A2) ||
            hasExtension(Extensions::TextureType2101010Rev);
 
+  case TextureFeatures::ColorTexImageRgb9E5:
+    return hasDesktopOrESVersion(*this, GLVersion::v3_0, GLVersion::v3_0_ES);
+
   case TextureFeatures::ColorTexImageRgba8:
     return hasDesktopOrESVersion(*this, GLVersion::v2_0, GLVersion::v3_0_ES) ||
            hasExtension(Extensions::RequiredInternalFormat);
@@ -1219,6 +1234,7 @@ bool DeviceFeatureSet::isTextureFeatureSupported(TextureFeatures feature) const
   case TextureFeatures::ColorTexImageLa8:
   case TextureFeatures::ColorTexImageRg8:
   case TextureFeatures::ColorTexImageRgb10A2:
+  case TextureFeatures::ColorTexImageRgb9E5:
   case TextureFeatures::ColorTexImageRgba8:
   case TextureFeatures::ColorTexImageSrgba8:
     return isColorTexImageFeatureSupported(feature);
@@ -1466,6 +1482,10 @@ bool DeviceFeatureSet::hasInternalRequirementMiscGroup(InternalRequirement requi
 // NOLINTNEXTLINE(misc-no-recursion)
 bool DeviceFeatureSet::hasInternalRequirement(InternalRequirement requirement) const {
   switch (requirement) {
+  case InternalRequirement::BufferStorageExtReq:
+    // OpenGL ES only has glBufferStorage through GL_EXT_buffer_storage
+    return usesOpenGLES();
+
   case InternalRequirement::DebugMessageExtReq:
     return !hasDesktopOrESVersion(*this, GLVersion::v4_3, GLVersion::v3_2_ES);
 
@@ -1972,6 +1992,15 @@ ICapabilities::TextureFormatCapabilities DeviceFeatureSet::getSpecialColorTextur
       capabilities |= sampled | sampledFiltered;
     }
     break;
+  case TextureFormat::R9G9B9E5_F:
+    // RGB9_E5 is not color-renderable
+    if (hasTextureFeature(TextureFeatures::ColorTexImageRgb9E5)) {
+      capabilities |= sampled | sampledFiltered;
+      if (hasInternalFeature(InternalFeatures::TexStorage)) {
+        capabilities |= storage;
+      }
+    }
+    break;
   case TextureFormat::RGB10_A2_UNorm_Rev:
     if (hasTextureFeature(TextureFeatures::ColorTexImageRgb10A2)) {
       capabilities |= sampled | sampledFiltered;
@@ -2287,6 +2316,7 @@ ICapabilities::TextureFormatCapabilities DeviceFeatureSet::getTextureFormatCapab
   case TextureFormat::R4G2B2_UNorm_Rev_Apple:
   case TextureFormat::R5G5B5A1_UNorm:
   case TextureFormat::BGR10_A2_Unorm:
+  case TextureFormat::R9G9B9E5_F:
   case TextureFormat::RGB10_A2_UNorm_Rev:
   case TextureFormat::RGB10_A2_Uint_Rev:
   case TextureFormat::BGRA_UNorm8_Rev:
@@ -23,6 +23,7 @@ enum class Extensions {
   AppleRgb422,                // GL_APPLE_rgb_422 is supported
   BindlessTextureArb,         // GL_ARB_bindless_texture is supported
   BindlessTextureNv,          // GL_NV_bindless_texture is supported
+  BufferStorage,              // GL_EXT_buffer_storage is supported
   Debug,                      // GL_KHR_debug is supported
   DebugLabel,                 // GL_EXT_debug_label is supported
   DebugMarker,                // GL_EXT_debug_marker is supported
@@ -42,6 +43,7 @@ enum class Extensions {
   MultiSampleExt2,            // GL_EXT_multisampled_render_to_texture2 is supported
   MultiSampleImg,             // GL_IMG_multisampled_render_to_texture is supported
   MultiViewMultiSample,       // GL_OVR_multiview_multisampled_render_to_texture is supported
+  ParallelShaderCompile,      // GL_KHR_parallel_shader_compile is supported
   PolygonOffsetClamp,         // GL_ARB_polygon_offset_clamp is supported
   RequiredInternalFormat,     // GL_OES_required_internalformat is supported
   ShaderImageLoadStore,       // GL_EXT_shader_image_load_store is supported
@@ -66,6 +68,7 @@ enum class Extensions {
 
 // clang-format off
 enum class InternalFeatures {
+  BufferStorage,             // glBufferStorage is supported
   ClearBufferfv,             // glClearBufferfv is supported
   ClearDepthf,               // glClearDepthf is supported
   DebugLabel,                // Debug labels on objects are supported
@@ -79,6 +82,7 @@ enum class InternalFeatures {
   InvalidateFramebuffer,     // glInvalidateFramebuffer is supported
   MapBuffer,                 // glMapBuffer is supported
   PackRowLength,             // GL_PACK_ROW_LENGTH is supported with glPixelStorei
+  ParallelShaderCompile,     // GL_COMPLETION_STATUS_KHR can be polled for shaders and programs
   PixelBufferObject,         // PBOs are available
   PolygonFillMode,           // glPolygonFillMode is supported
   ProgramInterfaceQuery,     // Querying info about shader program interfaces is supported
@@ -124,6 +128,7 @@ enum class TextureFeatures {
   ColorTexImageLa8,             // TexImage supports LUMINANCE8 and LUMINANCE8_ALPHA8
   ColorTexImageRg8,             // TexImage supports R8 and RG8
   ColorTexImageRgb10A2,         // TexImage supports RGB10_A2 or RGBA + UNSIGNED_INT_2_10_10_10_REV
+  ColorTexImageRgb9E5,          // TexImage supports RGB9_E5
   ColorTexImageRgba8,           // TexImage supports RGB8 and RGBA8
   ColorTexImageSrgba8,          // TexImage supports SRGBA
   ColorTexStorage16f,           // TexStorage supports XXX16F for color targets
@@ -162,6 +167,7 @@ enum class TextureFeatures {
 // clang-format on
 
 enum class InternalRequirement {
+  BufferStorageExtReq,
   ColorTexImageRgb10A2Unsized,
   ColorTexImageRgb5A1Unsized,
   ColorTexImageRgba4Unsized,
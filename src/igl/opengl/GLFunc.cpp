@@ -478,15 +478,29 @@ void iglRenderbufferStorageMultisampleAPPLE(GLenum target,
 /// MARK: - GL_APPLE_sync
 
 #if defined(GL_APPLE_sync)
+#define CAN_CALL_glClientWaitSyncAPPLE CAN_CALL_OPENGL_ES
 #define CAN_CALL_glDeleteSyncAPPLE CAN_CALL_OPENGL_ES
 #define CAN_CALL_glFenceSyncAPPLE CAN_CALL_OPENGL_ES
 #define CAN_CALL_glGetSyncivAPPLE CAN_CALL_OPENGL_ES
+#define CAN_CALL_glWaitSyncAPPLE CAN_CALL_OPENGL_ES
 #else
+#define CAN_CALL_glClientWaitSyncAPPLE 0
 #define CAN_CALL_glDeleteSyncAPPLE 0
 #define CAN_CALL_glFenceSyncAPPLE 0
 #define CAN_CALL_glGetSyncivAPPLE 0
+#define CAN_CALL_glWaitSyncAPPLE 0
 #endif
 
+GLenum iglClientWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  GLEXTENSION_METHOD_BODY_WITH_RETURN(CAN_CALL_glClientWaitSyncAPPLE,
+                                      glClientWaitSyncAPPLE,
+                                      PFNIGLCLIENTWAITSYNCPROC,
+                                      GL_WAIT_FAILED,
+                                      sync,
+                                      flags,
+                                      timeout);
+}
+
 void iglDeleteSyncAPPLE(GLsync sync) {
   GLEXTENSION_METHOD_BODY(
       CAN_CALL_glDeleteSyncAPPLE, glDeleteSyncAPPLE, PFNIGLDELETESYNCPROC, sync);
@@ -508,6 +522,11 @@ void iglGetSyncivAPPLE(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* leng
                           values);
 }
 
+void iglWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  GLEXTENSION_METHOD_BODY(
+      CAN_CALL_glWaitSyncAPPLE, glWaitSyncAPPLE, PFNIGLWAITSYNCPROC, sync, flags, timeout);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_bindless_texture
 
@@ -543,6 +562,25 @@ void iglMakeTextureHandleNonResidentARB(GLuint64 handle) {
                           handle);
 }
 
+///--------------------------------------
+/// MARK: - GL_ARB_buffer_storage
+
+#if defined(GL_VERSION_4_4) || defined(GL_ARB_buffer_storage)
+#define CAN_CALL_glBufferStorage CAN_CALL_OPENGL
+#else
+#define CAN_CALL_glBufferStorage 0
+#endif
+
+void iglBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glBufferStorage,
+                          glBufferStorage,
+                          PFNIGLBUFFERSTORAGEPROC,
+                          target,
+                          size,
+                          data,
+                          flags);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_compute_shader
 
@@ -909,6 +947,22 @@ void* iglMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbit
                                       access);
 }
 
+///--------------------------------------
+/// MARK: - GL_ARB_parallel_shader_compile
+
+#if defined(GL_ARB_parallel_shader_compile)
+#define CAN_CALL_glMaxShaderCompilerThreadsARB CAN_CALL_OPENGL
+#else
+#define CAN_CALL_glMaxShaderCompilerThreadsARB 0
+#endif
+
+void iglMaxShaderCompilerThreadsARB(GLuint count) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMaxShaderCompilerThreadsARB,
+                          glMaxShaderCompilerThreadsARB,
+                          PFNIGLMAXSHADERCOMPILERTHREADSPROC,
+                          count);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_program_interface_query
 
@@ -1022,15 +1076,29 @@ void iglMemoryBarrier(GLbitfield barriers) {
 /// MARK: - GL_ARB_sync
 
 #if defined(GL_VERSION_3_2) || defined(GL_ES_VERSION_3_0) || defined(GL_ARB_sync)
+#define CAN_CALL_glClientWaitSync CAN_CALL
 #define CAN_CALL_glDeleteSync CAN_CALL
 #define CAN_CALL_glFenceSync CAN_CALL
 #define CAN_CALL_glGetSynciv CAN_CALL
+#define CAN_CALL_glWaitSync CAN_CALL
 #else
+#define CAN_CALL_glClientWaitSync 0
 #define CAN_CALL_glDeleteSync 0
 #define CAN_CALL_glFenceSync 0
 #define CAN_CALL_glGetSynciv 0
+#define CAN_CALL_glWaitSync 0
 #endif
 
+GLenum iglClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  GLEXTENSION_METHOD_BODY_WITH_RETURN(CAN_CALL_glClientWaitSync,
+                                      glClientWaitSync,
+                                      PFNIGLCLIENTWAITSYNCPROC,
+                                      GL_WAIT_FAILED,
+                                      sync,
+                                      flags,
+                                      timeout);
+}
+
 void iglDeleteSync(GLsync sync) {
   GLEXTENSION_METHOD_BODY(CAN_CALL_glDeleteSync, glDeleteSync, PFNIGLDELETESYNCPROC, sync);
 }
@@ -1045,6 +1113,11 @@ void iglGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, G
       CAN_CALL_glGetSynciv, glGetSynciv, PFNIGLGETSYNCIVPROC, sync, pname, bufSize, length, values);
 }
 
+void iglWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+  GLEXTENSION_METHOD_BODY(
+      CAN_CALL_glWaitSync, glWaitSync, PFNIGLWAITSYNCPROC, sync, flags, timeout);
+}
+
 ///--------------------------------------
 /// MARK: - GL_ARB_texture_storage
 
@@ -1240,6 +1313,25 @@ void iglPolygonOffsetClamp(float factor, float units, float clamp) {
                           clamp);
 }
 
+///--------------------------------------
+/// MARK: - GL_EXT_buffer_storage
+
+#if defined(GL_EXT_buffer_storage)
+#define CAN_CALL_glBufferStorageEXT CAN_CALL_OPENGL_ES
+#else
+#define CAN_CALL_glBufferStorageEXT 0
+#endif
+
+void iglBufferStorageEXT(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glBufferStorageEXT,
+                          glBufferStorageEXT,
+                          PFNIGLBUFFERSTORAGEPROC,
+                          target,
+                          size,
+                          data,
+                          flags);
+}
+
 ///--------------------------------------
 /// MARK: - GL_EXT_debug_label
 
@@ -1743,6 +1835,22 @@ void iglPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar
                           message);
 }
 
+///--------------------------------------
+/// MARK: - GL_KHR_parallel_shader_compile
+
+#if defined(GL_KHR_parallel_shader_compile)
+#define CAN_CALL_glMaxShaderCompilerThreadsKHR CAN_CALL
+#else
+#define CAN_CALL_glMaxShaderCompilerThreadsKHR 0
+#endif
+
+void iglMaxShaderCompilerThreadsKHR(GLuint count) {
+  GLEXTENSION_METHOD_BODY(CAN_CALL_glMaxShaderCompilerThreadsKHR,
+                          glMaxShaderCompilerThreadsKHR,
+                          PFNIGLMAXSHADERCOMPILERTHREADSPROC,
+                          count);
+}
+
 ///--------------------------------------
 /// MARK: - GL_NV_bindless_texture
 
@@ -45,6 +45,10 @@ using PFNIGLBINDIMAGETEXTUREPROC = void (*)(GLuint unit,
                                             GLenum format);
 using PFNIGLBINDRENDERBUFFERPROC = void (*)(GLenum target, GLuint renderbuffer);
 using PFNIGLBINDVERTEXARRAYPROC = void (*)(GLuint vao);
+using PFNIGLBUFFERSTORAGEPROC = void (*)(GLenum target,
+                                        GLsizeiptr size,
+                                        const void* data,
+                                        GLbitfield flags);
 using PFNIGLBLITFRAMEBUFFERPROC = void (*)(GLint srcX0,
                                            GLint srcY0,
                                            GLint srcX1,
@@ -56,6 +60,7 @@ using PFNIGLBLITFRAMEBUFFERPROC = void (*)(GLint srcX0,
                                            GLbitfield mask,
                                            GLenum filter);
 using PFNIGLCHECKFRAMEBUFFERSTATUSPROC = GLenum (*)(GLenum target);
+using PFNIGLCLIENTWAITSYNCPROC = GLenum (*)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 using PFNIGLCLEARBUFFERFVPROC = void (*)(GLenum buffer, GLint drawBuffer, const GLfloat* value);
 using PFNIGLCLEARDEPTHPROC = void (*)(GLdouble depth);
 using PFNIGLCLEARDEPTHFPROC = void (*)(GLfloat depth);
@@ -220,6 +225,7 @@ using PFNIGLMAPBUFFERRANGEPROC = void* (*)(GLenum target,
                                            GLintptr offset,
                                            GLsizeiptr length,
                                            GLbitfield access);
+using PFNIGLMAXSHADERCOMPILERTHREADSPROC = void (*)(GLuint count);
 using PFNIGLMEMORYBARRIERPROC = void (*)(GLbitfield barriers);
 using PFNIGLOBJECTLABELPROC = void (*)(GLenum identifier,
                                        GLuint name,
@@ -289,6 +295,7 @@ using PFNIGLUNIFORMBLOCKBINDINGPROC = void (*)(GLuint pid,
 using PFNIGLUNMAPBUFFERPROC = void (*)(GLenum target);
 
 using PFNIGLVERTEXATTRIBDIVISORPROC = void (*)(GLuint index, GLuint divisor);
+using PFNIGLWAITSYNCPROC = void (*)(GLsync sync, GLbitfield flags, GLuint64 timeout);
 
 using PFNIGLDRAWELEMENTSINSTANCEDPROC =
     void (*)(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount);
@@ -389,9 +396,11 @@ void iglRenderbufferStorageMultisampleAPPLE(GLenum target,
 ///--------------------------------------
 /// MARK: - GL_APPLE_sync
 
+GLenum iglClientWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout);
 void iglDeleteSyncAPPLE(GLsync sync);
 GLsync iglFenceSyncAPPLE(GLenum condition, GLbitfield flags);
 void iglGetSyncivAPPLE(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values);
+void iglWaitSyncAPPLE(GLsync sync, GLbitfield flags, GLuint64 timeout);
 
 ///--------------------------------------
 /// MARK: - GL_ARB_bindless_texture
@@ -400,6 +409,11 @@ GLuint64 iglGetTextureHandleARB(GLuint texture);
 void iglMakeTextureHandleResidentARB(GLuint64 handle);
 void iglMakeTextureHandleNonResidentARB(GLuint64 handle);
 
+///--------------------------------------
+/// MARK: - GL_ARB_buffer_storage
+
+void iglBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
 ///--------------------------------------
 /// MARK: - GL_ARB_compute_shader
 
@@ -490,6 +504,11 @@ void iglInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenu
 
 void* iglMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
 
+///--------------------------------------
+/// MARK: - GL_ARB_parallel_shader_compile
+
+void iglMaxShaderCompilerThreadsARB(GLuint count);
+
 ///--------------------------------------
 /// MARK: - GL_ARB_program_interface_query
 
@@ -525,9 +544,11 @@ void iglMemoryBarrier(GLbitfield barriers);
 ///--------------------------------------
 /// MARK: - GL_ARB_sync
 
+GLenum iglClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
 void iglDeleteSync(GLsync sync);
 GLsync iglFenceSync(GLenum condition, GLbitfield flags);
 void iglGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values);
+void iglWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
 
 ///--------------------------------------
 /// MARK: - GL_ARB_texture_storage
@@ -579,6 +600,11 @@ void iglGenVertexArrays(GLsizei n, GLuint* vertexArrays);
 
 void iglPolygonOffsetClamp(float factor, float units, float clamp);
 
+///--------------------------------------
+/// MARK: - GL_EXT_buffer_storage
+
+void iglBufferStorageEXT(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
 ///--------------------------------------
 /// MARK: - GL_EXT_debug_label
 
@@ -733,6 +759,11 @@ void iglObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length, const cha
 void iglPopDebugGroupKHR();
 void iglPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar* message);
 
+///--------------------------------------
+/// MARK: - GL_KHR_parallel_shader_compile
+
+void iglMaxShaderCompilerThreadsKHR(GLuint count);
+
 ///--------------------------------------
 /// MARK: - GL_NV_bindless_texture
 
@@ -79,6 +79,9 @@
 #ifndef GL_ALPHA8
 #define GL_ALPHA8 0x803C
 #endif
+#ifndef GL_ALREADY_SIGNALED
+#define GL_ALREADY_SIGNALED 0x911A
+#endif
 #ifndef GL_ATOMIC_COUNTER_BARRIER_BIT
 #define GL_ATOMIC_COUNTER_BARRIER_BIT 0x1000
 #endif
@@ -127,6 +130,9 @@
 #ifndef GL_COMPARE_REF_TO_TEXTURE
 #define GL_COMPARE_REF_TO_TEXTURE 0x884e
 #endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
 #ifndef GL_COMPRESSED_R11_EAC
 #define GL_COMPRESSED_R11_EAC 0x9270
 #endif
@@ -262,6 +268,9 @@
 #ifndef GL_COMPUTE_SHADER
 #define GL_COMPUTE_SHADER 0x91B9
 #endif
+#ifndef GL_CONDITION_SATISFIED
+#define GL_CONDITION_SATISFIED 0x911C
+#endif
 #ifndef GL_COPY_READ_BUFFER
 #define GL_COPY_READ_BUFFER 0x8f36
 #endif
@@ -364,6 +373,9 @@
 #ifndef GL_DYNAMIC_READ
 #define GL_DYNAMIC_READ 0x88e9
 #endif
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
 #ifndef GL_ELEMENT_ARRAY_BARRIER_BIT
 #define GL_ELEMENT_ARRAY_BARRIER_BIT 0x2
 #endif
@@ -529,6 +541,9 @@
 #ifndef GL_MAX_SAMPLES_IMG
 #define GL_MAX_SAMPLES_IMG 0x9135
 #endif
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
 #ifndef GL_MAX_SHADER_STORAGE_BLOCK_SIZE
 #define GL_MAX_SHADER_STORAGE_BLOCK_SIZE 0x90de
 #endif
@@ -643,6 +658,9 @@
 #ifndef GL_RGB10_A2
 #define GL_RGB10_A2 0x8059
 #endif
+#ifndef GL_RGB9_E5
+#define GL_RGB9_E5 0x8C3D
+#endif
 #ifndef GL_RGB10_A2UI
 #define GL_RGB10_A2UI 0x906f
 #endif
@@ -748,12 +766,21 @@
 #ifndef GL_STREAM_READ
 #define GL_STREAM_READ 0x88e1
 #endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif
 #ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
 #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
 #endif
 #ifndef GL_SYNC_STATUS
 #define GL_SYNC_STATUS 0x9114
 #endif
+#ifndef GL_TIMEOUT_EXPIRED
+#define GL_TIMEOUT_EXPIRED 0x911B
+#endif
+#ifndef GL_TIMEOUT_IGNORED
+#define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+#endif
 #ifndef GL_TEXTURE_SWIZZLE_A
 #define GL_TEXTURE_SWIZZLE_A 0x8e45
 #endif
@@ -853,6 +880,9 @@
 #ifndef GL_UNPACK_ROW_LENGTH
 #define GL_UNPACK_ROW_LENGTH 0x0cf2
 #endif
+#ifndef GL_UNSIGNALED
+#define GL_UNSIGNALED 0x9118
+#endif
 #ifndef GL_UNSIGNED_INT_10F_11F_11F_REV
 #define GL_UNSIGNED_INT_10F_11F_11F_REV 0x8c3b
 #endif
@@ -889,6 +919,9 @@
 #ifndef GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
 #define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x1
 #endif
+#ifndef GL_WAIT_FAILED
+#define GL_WAIT_FAILED 0x911D
+#endif
 #ifndef GL_WRITE_ONLY
 #define GL_WRITE_ONLY 0x88b9
 #endif
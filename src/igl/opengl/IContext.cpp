@@ -16,6 +16,7 @@
 #include <igl/DeviceFeatures.h>
 #include <igl/opengl/GLFunc.h>
 #include <igl/opengl/GLIncludes.h>
+#include <igl/opengl/VertexArrayObjectCache.h>
 
 #if defined(IGL_WITH_TRACY_GPU)
 #include "tracy/TracyOpenGL.hpp"
@@ -1471,6 +1472,13 @@ void IContext::willDestroy(void* IGL_NULLABLE glContext) {
   // Clear pool explicitly, since it might have reference back to IContext.
   getAdapterPool().clear();
   getComputeAdapterPool().clear();
+  vertexArrayObjectCache_ = nullptr;
+  if (isCurrentContext()) {
+    for (const auto& fence : frameFences_) {
+      deleteSync(fence.sync);
+    }
+  }
+  frameFences_.clear();
   // Unregister context
   if (glContext != nullptr) {
     IContext::unregisterContext(glContext);
@@ -1508,6 +1516,9 @@ void IContext::attachShader(GLuint program, GLuint shader) {
 }
 
 void IContext::bindBuffer(GLenum target, GLuint buffer) {
+  if (target == GL_ELEMENT_ARRAY_BUFFER && vertexArrayObjectCache_) {
+    vertexArrayObjectCache_->onElementArrayBufferBound();
+  }
 #if IGL_API_LOG
   GLuint unboundBuffer = boundBuffer(target);
   setBoundBuffer(target, buffer);
@@ -1769,6 +1780,31 @@ void IContext::bufferSubData(GLenum target,
   GLCHECK_ERRORS();
 }
 
+void IContext::bufferStorage(GLenum target,
+                             GLsizeiptr size,
+                             const GLvoid* IGL_NULLABLE data,
+                             GLbitfield flags) {
+  if (bufferStorageProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::BufferStorageExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::BufferStorage)) {
+        bufferStorageProc_ = iglBufferStorageEXT;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::BufferStorage)) {
+      bufferStorageProc_ = iglBufferStorage;
+    }
+    IGL_DEBUG_ASSERT(bufferStorageProc_, "No supported function for glBufferStorage\n");
+  }
+
+  APILOG("glBufferStorage(%s, %zu, %p, 0x%x) (buffer: %u)\n",
+         GL_ENUM_TO_STRING(target),
+         size,
+         data,
+         flags,
+         boundBuffer(target));
+  GLCALL_PROC(bufferStorageProc_, target, size, data, flags);
+  GLCHECK_ERRORS();
+}
+
 GLenum IContext::checkFramebufferStatus(GLenum target) {
   GLenum ret = 0;
 
@@ -1836,6 +1872,31 @@ void IContext::clearStencil(GLint s) {
   GLCHECK_ERRORS();
 }
 
+GLenum IContext::clientWaitSync(GLsync IGL_NULLABLE sync, GLbitfield flags, GLuint64 timeout) {
+  if (clientWaitSyncProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::SyncExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::Sync)) {
+        clientWaitSyncProc_ = iglClientWaitSyncAPPLE;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::Sync)) {
+      clientWaitSyncProc_ = iglClientWaitSync;
+    }
+    IGL_DEBUG_ASSERT(clientWaitSyncProc_, "No supported function for glClientWaitSync\n");
+  }
+
+  GLenum ret = GL_WAIT_FAILED;
+  GLCALL_PROC_WITH_RETURN(ret, clientWaitSyncProc_, GL_WAIT_FAILED, sync, flags, timeout);
+  // NOTE: Must log after call due to return value
+  APILOG("glClientWaitSync(%p, 0x%x, %llu) = %s\n",
+         sync,
+         flags,
+         static_cast<unsigned long long>(timeout),
+         GL_ENUM_TO_STRING(ret));
+  GLCHECK_ERRORS();
+
+  return ret;
+}
+
 void IContext::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
   APILOG("glColorMask(%s, %s, %s, %s) (framebuffer: %u)\n",
          GL_BOOL_TO_STRING(red),
@@ -2152,6 +2213,10 @@ void IContext::deleteBuffers(GLsizei n, const GLuint* buffers) {
           "glDeleteBuffers(%u, %p) (buffer: %u)\n", n, buffers, buffers == nullptr ? 0 : *buffers);
       GLCALL(DeleteBuffers)(n, buffers);
       GLCHECK_ERRORS();
+      if (vertexArrayObjectCache_) {
+        // buffer names can be reused, so drop all VAOs referencing the deleted buffers
+        vertexArrayObjectCache_->onBuffersDeleted(n, buffers);
+      }
     }
   }
 }
@@ -4329,6 +4394,23 @@ void IContext::viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
   GLCHECK_ERRORS();
 }
 
+void IContext::waitSync(GLsync IGL_NULLABLE sync, GLbitfield flags, GLuint64 timeout) {
+  if (waitSyncProc_ == nullptr) {
+    if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::SyncExtReq)) {
+      if (deviceFeatureSet_.hasExtension(Extensions::Sync)) {
+        waitSyncProc_ = iglWaitSyncAPPLE;
+      }
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::Sync)) {
+      waitSyncProc_ = iglWaitSync;
+    }
+    IGL_DEBUG_ASSERT(waitSyncProc_, "No supported function for glWaitSync\n");
+  }
+
+  APILOG("glWaitSync(%p, 0x%x, %llu)\n", sync, flags, static_cast<unsigned long long>(timeout));
+  GLCALL_PROC(waitSyncProc_, sync, flags, timeout);
+  GLCHECK_ERRORS();
+}
+
 GLuint64 IContext::getTextureHandle(GLuint texture) {
   if (getTextureHandleProc_ == nullptr) {
     if (deviceFeatureSet_.hasExtension(Extensions::BindlessTextureArb)) {
@@ -4394,6 +4476,22 @@ void IContext::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numG
   GLCHECK_ERRORS();
 }
 
+void IContext::maxShaderCompilerThreads(GLuint count) {
+  if (maxShaderCompilerThreadsProc_ == nullptr) {
+    if (deviceFeatureSet_.hasExtension(Extensions::ParallelShaderCompile)) {
+      maxShaderCompilerThreadsProc_ = iglMaxShaderCompilerThreadsKHR;
+    } else if (deviceFeatureSet_.hasInternalFeature(InternalFeatures::ParallelShaderCompile)) {
+      maxShaderCompilerThreadsProc_ = iglMaxShaderCompilerThreadsARB;
+    }
+    IGL_DEBUG_ASSERT(maxShaderCompilerThreadsProc_,
+                     "No supported function for glMaxShaderCompilerThreads\n");
+  }
+
+  APILOG("glMaxShaderCompilerThreads(%u)\n", count);
+  GLCALL_PROC(maxShaderCompilerThreadsProc_, count);
+  GLCHECK_ERRORS();
+}
+
 void IContext::memoryBarrier(GLbitfield barriers) {
   if (memoryBarrierProc_ == nullptr) {
     if (deviceFeatureSet_.hasInternalRequirement(InternalRequirement::ShaderImageLoadStoreExtReq)) {
@@ -4680,6 +4778,70 @@ bool IContext::shouldValidateShaders() const {
   return shouldValidateShaders_;
 }
 
+void IContext::setVertexArrayObjectCacheEnabled(bool enabled) {
+  vertexArrayObjectCacheEnabled_ = enabled;
+  if (enabled && !vertexArrayObjectCache_ &&
+      deviceFeatures().hasInternalFeature(InternalFeatures::VertexArrayObject)) {
+    vertexArrayObjectCache_ = std::make_unique<VertexArrayObjectCache>(*this);
+  } else if (!enabled && vertexArrayObjectCache_) {
+    vertexArrayObjectCache_->clear();
+  }
+}
+
+void IContext::setParallelShaderCompileEnabled(bool enabled) {
+  const bool supported =
+      deviceFeatures().hasInternalFeature(InternalFeatures::ParallelShaderCompile);
+  if (enabled && supported && !parallelShaderCompileEnabled_) {
+    // let the driver pick the number of compiler threads
+    maxShaderCompilerThreads(0xFFFFFFFF);
+  }
+  parallelShaderCompileEnabled_ = enabled && supported;
+}
+
+void IContext::endFrame() {
+  if (deviceFeatures().hasInternalFeature(InternalFeatures::Sync)) {
+    while (!frameFences_.empty()) {
+      GLint status = GL_UNSIGNALED;
+      getSynciv(frameFences_.front().sync, GL_SYNC_STATUS, 1, nullptr, &status);
+      if (status != GL_SIGNALED) {
+        break;
+      }
+      deleteSync(frameFences_.front().sync);
+      frameFences_.pop_front();
+    }
+    GLsync sync = fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (sync != nullptr) {
+      frameFences_.push_back({.frameIndex = frameIndex_, .sync = sync});
+    }
+  }
+  ++frameIndex_;
+}
+
+void IContext::waitForFrame(uint64_t frameIndex) {
+  if (frameIndex >= frameIndex_ || !deviceFeatures().hasInternalFeature(InternalFeatures::Sync)) {
+    finish();
+    for (const auto& fence : frameFences_) {
+      deleteSync(fence.sync);
+    }
+    frameFences_.clear();
+    return;
+  }
+  // 100 ms per wait, so that a lost context does not hang forever
+  constexpr GLuint64 kTimeoutNs = 100'000'000;
+  while (!frameFences_.empty() && frameFences_.front().frameIndex <= frameIndex) {
+    GLsync sync = frameFences_.front().sync;
+    GLenum status = clientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, kTimeoutNs);
+    for (int retries = 0; status == GL_TIMEOUT_EXPIRED && retries < 10; ++retries) {
+      status = clientWaitSync(sync, 0, kTimeoutNs);
+    }
+    IGL_SOFT_ASSERT(status != GL_TIMEOUT_EXPIRED && status != GL_WAIT_FAILED,
+                    "Waiting for frame %llu failed",
+                    static_cast<unsigned long long>(frameIndex));
+    deleteSync(sync);
+    frameFences_.pop_front();
+  }
+}
+
 void IContext::SynchronizedDeletionQueues::flushDeletionQueue(IContext& context) {
   if (IGL_DEBUG_VERIFY(context.isCurrentContext() || context.isCurrentSharegroup())) {
     swapScratchDeletionQueues();
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <ldrutils/lutils/Pool.h>
 #include <memory>
 #include <mutex>
@@ -29,6 +30,8 @@
 
 namespace igl::opengl {
 
+class VertexArrayObjectCache;
+
 ///
 /// Represents an pure abstract class that encapsulates in it an OpenGL context.
 /// Individual types that implement this class are the ones that provide implementation
@@ -91,6 +94,10 @@ class IContext {
                        GLbitfield mask,
                        GLenum filter);
   void bufferData(GLenum target, GLsizeiptr size, const GLvoid* IGL_NULLABLE data, GLenum usage);
+  void bufferStorage(GLenum target,
+                     GLsizeiptr size,
+                     const GLvoid* IGL_NULLABLE data,
+                     GLbitfield flags);
   void bufferSubData(GLenum target,
                      GLintptr offset,
                      GLsizeiptr size,
@@ -101,6 +108,7 @@ class IContext {
   void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
   void clearDepthf(GLfloat depth);
   void clearStencil(GLint s);
+  GLenum clientWaitSync(GLsync IGL_NULLABLE sync, GLbitfield flags, GLuint64 timeout);
   void colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
   void compileShader(GLuint shader);
   void compressedTexImage2D(GLenum target,
@@ -327,6 +335,7 @@ class IContext {
   GLboolean isTexture(GLuint texture);
   void linkProgram(GLuint program);
   void* IGL_NULLABLE mapBuffer(GLenum target, GLenum access);
+  void maxShaderCompilerThreads(GLuint count);
   void* IGL_NULLABLE mapBufferRange(GLenum target,
                                     GLintptr offset,
                                     GLsizeiptr length,
@@ -481,6 +490,7 @@ class IContext {
                            const GLvoid* IGL_NULLABLE ptr);
   void vertexAttribDivisor(GLuint index, GLuint divisor);
   void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+  void waitSync(GLsync IGL_NULLABLE sync, GLbitfield flags, GLuint64 timeout);
 
   void dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ);
   void memoryBarrier(GLbitfield barriers);
@@ -510,6 +520,63 @@ class IContext {
 
   void setShouldValidateShaders(bool shouldValidateShaders);
   bool shouldValidateShaders() const;
+
+  /** Enables or disables caching of vertex array objects per vertex layout and bound buffers.
+   * Takes effect for *subsequent* render passes. Disabling the cache deletes all cached VAOs.
+   * Requires InternalFeatures::VertexArrayObject; it is a no-op otherwise.
+   */
+  void setVertexArrayObjectCacheEnabled(bool enabled);
+  [[nodiscard]] bool isVertexArrayObjectCacheEnabled() const {
+    return vertexArrayObjectCache_ != nullptr && vertexArrayObjectCacheEnabled_;
+  }
+  [[nodiscard]] VertexArrayObjectCache* IGL_NULLABLE getVertexArrayObjectCache() const {
+    return vertexArrayObjectCache_.get();
+  }
+
+  /** Enables or disables promotion of loose vertex and fragment shader uniforms into std140
+   * uniform blocks (see PromotedUniforms). Takes effect for *subsequently* created shader modules.
+   * Requires DeviceFeatures::UniformBlocks; binding indices IGL_UNIFORM_BLOCKS_BINDING_MAX - 1 and
+   * IGL_UNIFORM_BLOCKS_BINDING_MAX - 2 are reserved for the promoted blocks when enabled.
+   */
+  void setUniformBlockPromotionEnabled(bool enabled) {
+    uniformBlockPromotionEnabled_ = enabled;
+  }
+  [[nodiscard]] bool isUniformBlockPromotionEnabled() const {
+    return uniformBlockPromotionEnabled_;
+  }
+
+  /** Enables or disables non-blocking shader compilation. When enabled, *subsequently* created
+   * shader modules and shader stages only kick off compiling and linking; compile errors are
+   * reported when the program finishes linking rather than by createShaderModule(). Use
+   * IShaderStages::isReady() and IRenderPipelineState::isReady() to poll for completion.
+   * Requires InternalFeatures::ParallelShaderCompile; it is a no-op otherwise.
+   */
+  void setParallelShaderCompileEnabled(bool enabled);
+  [[nodiscard]] bool isParallelShaderCompileEnabled() const {
+    return parallelShaderCompileEnabled_;
+  }
+
+  /** Number of frames the CPU may record ahead of the GPU. Streaming buffers
+   * (BufferDesc::BufferAPIHintBits::Ring) keep one region per frame in flight.
+   */
+  static constexpr uint32_t kMaxFramesInFlight = 3;
+
+  /** Index of the frame being recorded. It advances when a command buffer which presented a
+   * surface, or which was submitted with `endOfFrame`, is submitted.
+   */
+  [[nodiscard]] uint64_t getFrameIndex() const {
+    return frameIndex_;
+  }
+
+  /** Ends the current frame: inserts a fence after its commands when sync objects are supported
+   * and advances the frame index. Fences of frames the GPU has completed are released.
+   */
+  void endFrame();
+
+  /** Blocks until the GPU has completed all commands of frame `frameIndex`. Falls back to
+   * glFinish() if the frame has not ended yet or sync objects are not supported.
+   */
+  void waitForFrame(uint64_t frameIndex);
   inline bool isDestructionAllowed() const {
     return lockCount_ == 0;
   }
@@ -710,7 +777,9 @@ class IContext {
   PFNIGLBINDIMAGETEXTUREPROC IGL_NULLABLE bindImageTexturerProc_ = nullptr;
   PFNIGLBINDVERTEXARRAYPROC IGL_NULLABLE bindVertexArrayProc_ = nullptr;
   PFNIGLBLITFRAMEBUFFERPROC IGL_NULLABLE blitFramebufferProc_ = nullptr;
+  PFNIGLBUFFERSTORAGEPROC IGL_NULLABLE bufferStorageProc_ = nullptr;
   PFNIGLCLEARDEPTHFPROC IGL_NULLABLE clearDepthfProc_ = nullptr;
+  PFNIGLCLIENTWAITSYNCPROC IGL_NULLABLE clientWaitSyncProc_ = nullptr;
   PFNIGLCOMPRESSEDTEXIMAGE3DPROC IGL_NULLABLE compressedTexImage3DProc_ = nullptr;
   PFNIGLCOMPRESSEDTEXSUBIMAGE3DPROC IGL_NULLABLE compressedTexSubImage3DProc_ = nullptr;
   PFNIGLDEBUGMESSAGECALLBACKPROC IGL_NULLABLE debugMessageCallbackProc_ = nullptr;
@@ -730,6 +799,7 @@ class IContext {
   PFNIGLMAKETEXTUREHANDLENONRESIDENTPROC IGL_NULLABLE makeTextureHandleNonResidentProc_ = nullptr;
   PFNIGLMAPBUFFERPROC IGL_NULLABLE mapBufferProc_ = nullptr;
   PFNIGLMAPBUFFERRANGEPROC IGL_NULLABLE mapBufferRangeProc_ = nullptr;
+  PFNIGLMAXSHADERCOMPILERTHREADSPROC IGL_NULLABLE maxShaderCompilerThreadsProc_ = nullptr;
   PFNIGLMEMORYBARRIERPROC IGL_NULLABLE memoryBarrierProc_ = nullptr;
   PFNIGLOBJECTLABELPROC IGL_NULLABLE objectLabelProc_ = nullptr;
   PFNIGLPOPDEBUGGROUPPROC IGL_NULLABLE popDebugGroupProc_ = nullptr;
@@ -743,6 +813,7 @@ class IContext {
   PFNIGLTEXSUBIMAGE3DPROC IGL_NULLABLE texSubImage3DProc_ = nullptr;
   PFNIGLUNMAPBUFFERPROC IGL_NULLABLE unmapBufferProc_ = nullptr;
   PFNIGLVERTEXATTRIBDIVISORPROC IGL_NULLABLE vertexAttribDivisorProc_ = nullptr;
+  PFNIGLWAITSYNCPROC IGL_NULLABLE waitSyncProc_ = nullptr;
 
   /// Responsible for holding onto operations queued for deletion when not in
   /// context. All operations to non-scratch queues are suyncronized by one
@@ -801,6 +872,18 @@ class IContext {
   friend class DestructionGuard;
   std::vector<std::unique_ptr<RenderCommandAdapter>> renderAdapterPool_;
   std::vector<std::unique_ptr<ComputeCommandAdapter>> computeAdapterPool_;
+  std::unique_ptr<VertexArrayObjectCache> vertexArrayObjectCache_;
+  bool vertexArrayObjectCacheEnabled_ = false;
+  bool uniformBlockPromotionEnabled_ = false;
+  bool parallelShaderCompileEnabled_ = false;
+
+  struct FrameFence {
+    uint64_t frameIndex = 0;
+    GLsync IGL_NULLABLE sync = nullptr;
+  };
+  // fences of the frames which may still be executing on the GPU, oldest first
+  std::deque<FrameFence> frameFences_;
+  uint64_t frameIndex_ = 0;
 
   DeviceFeatureSet deviceFeatureSet_;
 
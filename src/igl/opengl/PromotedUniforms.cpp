@@ -0,0 +1,663 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/opengl/PromotedUniforms.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <igl/opengl/IContext.h>
+
+namespace igl::opengl {
+
+namespace {
+
+// Number of block-sized slices in the ring buffer of each block before it gets orphaned
+constexpr size_t kRingSize = 64;
+// Minimum value of GL_MAX_UNIFORM_BLOCK_SIZE
+constexpr uint32_t kMaxBlockSize = 16384;
+
+enum class TokenType : uint8_t { Identifier, Number, Symbol, Directive };
+
+struct Token {
+  TokenType type;
+  size_t begin;
+  size_t end;
+};
+
+bool isIdentifierStart(char c) {
+  return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool isIdentifierChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// Splits GLSL source into tokens, skipping whitespace and comments. Each preprocessor directive
+// becomes a single token.
+std::vector<Token> tokenize(std::string_view src) {
+  std::vector<Token> tokens;
+  bool isLineStart = true;
+  size_t i = 0;
+  while (i < src.size()) {
+    const char c = src[i];
+    if (c == '\n') {
+      isLineStart = true;
+      i++;
+    } else if (std::isspace(static_cast<unsigned char>(c))) {
+      i++;
+    } else if (c == '/' && i + 1 < src.size() && src[i + 1] == '/') {
+      while (i < src.size() && src[i] != '\n') {
+        i++;
+      }
+    } else if (c == '/' && i + 1 < src.size() && src[i + 1] == '*') {
+      const size_t end = src.find("*/", i + 2);
+      i = end == std::string_view::npos ? src.size() : end + 2;
+    } else if (c == '#' && isLineStart) {
+      const size_t begin = i;
+      while (i < src.size() && (src[i] != '\n' || src[i - 1] == '\\')) {
+        i++;
+      }
+      tokens.push_back({TokenType::Directive, begin, i});
+    } else if (isIdentifierStart(c)) {
+      const size_t begin = i;
+      while (i < src.size() && isIdentifierChar(src[i])) {
+        i++;
+      }
+      tokens.push_back({TokenType::Identifier, begin, i});
+      isLineStart = false;
+    } else if (std::isdigit(static_cast<unsigned char>(c)) ||
+               (c == '.' && i + 1 < src.size() &&
+                std::isdigit(static_cast<unsigned char>(src[i + 1])))) {
+      const size_t begin = i;
+      while (i < src.size() && (isIdentifierChar(src[i]) || src[i] == '.')) {
+        i++;
+      }
+      tokens.push_back({TokenType::Number, begin, i});
+      isLineStart = false;
+    } else {
+      tokens.push_back({TokenType::Symbol, i, i + 1});
+      isLineStart = false;
+      i++;
+    }
+  }
+  return tokens;
+}
+
+// Uniform blocks with instance names need GLSL 1.50 or GLSL ES 3.00
+bool supportsUniformBlocks(std::string_view src, const std::vector<Token>& tokens) {
+  for (const Token& t : tokens) {
+    if (t.type != TokenType::Directive) {
+      // #version has to come first
+      return false;
+    }
+    std::string_view directive = src.substr(t.begin + 1, t.end - t.begin - 1);
+    directive.remove_prefix(std::min(directive.find_first_not_of(" \t"), directive.size()));
+    if (directive.substr(0, 7) != "version") {
+      continue;
+    }
+    const int version = std::atoi(std::string(directive.substr(7)).c_str());
+    const bool isES = directive.find("es") != std::string_view::npos;
+    return isES ? version >= 300 : version >= 150;
+  }
+  return false;
+}
+
+UniformType parseType(std::string_view name) {
+  static const std::unordered_map<std::string_view, UniformType> kTypes = {
+      {"float", UniformType::Float},
+      {"vec2", UniformType::Float2},
+      {"vec3", UniformType::Float3},
+      {"vec4", UniformType::Float4},
+      {"bool", UniformType::Boolean},
+      {"int", UniformType::Int},
+      {"ivec2", UniformType::Int2},
+      {"ivec3", UniformType::Int3},
+      {"ivec4", UniformType::Int4},
+      {"mat2", UniformType::Mat2x2},
+      {"mat3", UniformType::Mat3x3},
+      {"mat4", UniformType::Mat4x4},
+  };
+  const auto it = kTypes.find(name);
+  return it != kTypes.end() ? it->second : UniformType::Invalid;
+}
+
+uint32_t getMatrixColumns(UniformType type) {
+  switch (type) {
+  case UniformType::Mat2x2:
+    return 2;
+  case UniformType::Mat3x3:
+    return 3;
+  case UniformType::Mat4x4:
+    return 4;
+  default:
+    return 0;
+  }
+}
+
+// std140 base alignment and size of a member
+void getStd140Layout(UniformType type, bool isArray, uint32_t& outAlignment, uint32_t& outSize) {
+  const uint32_t columns = getMatrixColumns(type);
+  if (columns) {
+    // matrices are stored as arrays of vec4-aligned columns
+    outAlignment = 16;
+    outSize = 16 * columns;
+  } else if (isArray) {
+    // array elements are rounded up to vec4
+    outAlignment = 16;
+    outSize = 16;
+  } else {
+    const auto size = static_cast<uint32_t>(
+        type == UniformType::Boolean ? sizeof(int32_t) : sizeForUniformType(type));
+    outAlignment = size == 12 ? 16 : size;
+    outSize = size;
+  }
+}
+
+struct Declaration {
+  size_t nameToken = 0;
+  UniformType type = UniformType::Invalid;
+  std::string typeName;
+  std::string precision;
+  size_t numElements = 1;
+  bool isArray = false;
+};
+
+struct Statement {
+  size_t firstToken = 0;
+  size_t lastToken = 0;
+  std::vector<Declaration> declarations;
+};
+
+// Parses `uniform [precision] type name[[N]] (, name[[N]])*;` starting at the `uniform` token
+bool parseStatement(std::string_view src,
+                    const std::vector<Token>& tokens,
+                    size_t first,
+                    Statement& outStatement) {
+  const auto text = [&](size_t i) {
+    return src.substr(tokens[i].begin, tokens[i].end - tokens[i].begin);
+  };
+  const auto isSymbol = [&](size_t i, char c) {
+    return i < tokens.size() && tokens[i].type == TokenType::Symbol && src[tokens[i].begin] == c;
+  };
+  const auto isIdentifier = [&](size_t i) {
+    return i < tokens.size() && tokens[i].type == TokenType::Identifier;
+  };
+
+  size_t i = first + 1;
+  std::string precision;
+  if (isIdentifier(i) && (text(i) == "lowp" || text(i) == "mediump" || text(i) == "highp")) {
+    precision = text(i);
+    i++;
+  }
+  if (!isIdentifier(i)) {
+    return false;
+  }
+  const std::string typeName(text(i));
+  const UniformType type = parseType(text(i++));
+  if (type == UniformType::Invalid) {
+    // samplers, structs, blocks and types not representable by UniformType
+    return false;
+  }
+
+  outStatement.firstToken = first;
+  outStatement.declarations.clear();
+  while (true) {
+    if (!isIdentifier(i)) {
+      return false;
+    }
+    Declaration decl;
+    decl.nameToken = i++;
+    decl.type = type;
+    decl.typeName = typeName;
+    decl.precision = precision;
+    if (isSymbol(i, '[')) {
+      // only literal array sizes are supported
+      if (i + 2 >= tokens.size() || tokens[i + 1].type != TokenType::Number ||
+          !isSymbol(i + 2, ']')) {
+        return false;
+      }
+      const std::string size(text(i + 1));
+      char* end = nullptr;
+      decl.numElements = std::strtoul(size.c_str(), &end, 10);
+      if (decl.numElements == 0 || (*end != '\0' && *end != 'u' && *end != 'U')) {
+        return false;
+      }
+      decl.isArray = true;
+      i += 3;
+    }
+    outStatement.declarations.push_back(std::move(decl));
+    if (isSymbol(i, ';')) {
+      outStatement.lastToken = i;
+      return true;
+    }
+    if (!isSymbol(i, ',')) {
+      // initializers and anything else
+      return false;
+    }
+    i++;
+  }
+}
+
+// Keywords which can precede a uniform name in an expression
+bool isExpressionKeyword(std::string_view word) {
+  return word == "return" || word == "else" || word == "case" || word == "do";
+}
+
+} // namespace
+
+std::string PromotedUniforms::rewriteShaderSource(const char* IGL_NULLABLE source,
+                                                  ShaderStage stage,
+                                                  StageBlock& outBlock) {
+  outBlock = {};
+  if (!source || (stage != ShaderStage::Vertex && stage != ShaderStage::Fragment)) {
+    return {};
+  }
+
+  const std::string_view src(source);
+  const std::vector<Token> tokens = tokenize(src);
+  if (!supportsUniformBlocks(src, tokens)) {
+    return {};
+  }
+
+  const auto text = [&](size_t i) {
+    return src.substr(tokens[i].begin, tokens[i].end - tokens[i].begin);
+  };
+  const auto isSymbol = [&](size_t i, char c) {
+    return tokens[i].type == TokenType::Symbol && src[tokens[i].begin] == c;
+  };
+
+  // find uniform declarations at global scope outside of conditional compilation
+  std::vector<Statement> statements;
+  int braceDepth = 0;
+  int conditionalDepth = 0;
+  for (size_t i = 0; i < tokens.size(); i++) {
+    const Token& t = tokens[i];
+    if (t.type == TokenType::Directive) {
+      std::string_view directive = text(i).substr(1);
+      directive.remove_prefix(std::min(directive.find_first_not_of(" \t"), directive.size()));
+      if (directive.substr(0, 2) == "if") {
+        conditionalDepth++;
+      } else if (directive.substr(0, 5) == "endif") {
+        conditionalDepth--;
+      }
+      continue;
+    }
+    if (t.type == TokenType::Symbol) {
+      braceDepth += isSymbol(i, '{') ? 1 : 0;
+      braceDepth -= isSymbol(i, '}') ? 1 : 0;
+      continue;
+    }
+    if (braceDepth != 0 || conditionalDepth != 0 || t.type != TokenType::Identifier ||
+        text(i) != "uniform") {
+      continue;
+    }
+    // skip `layout(...) uniform` and other qualified declarations
+    if (i > 0 && tokens[i - 1].type != TokenType::Directive && !isSymbol(i - 1, ';') &&
+        !isSymbol(i - 1, '}')) {
+      continue;
+    }
+    Statement statement;
+    if (parseStatement(src, tokens, i, statement)) {
+      i = statement.lastToken;
+      statements.push_back(std::move(statement));
+    }
+  }
+  if (statements.empty()) {
+    return {};
+  }
+
+  // the promoted uniforms are accessed through a macro, so exclude names which are declared more
+  // than once, shadowed, used as a member name or used by the preprocessor
+  std::unordered_map<std::string_view, int> numDeclarations;
+  std::vector<bool> isDeclarationToken(tokens.size(), false);
+  for (const Statement& statement : statements) {
+    for (size_t i = statement.firstToken; i <= statement.lastToken; i++) {
+      isDeclarationToken[i] = true;
+    }
+    for (const Declaration& decl : statement.declarations) {
+      numDeclarations[text(decl.nameToken)]++;
+    }
+  }
+  std::unordered_set<std::string_view> excluded;
+  for (const auto& [name, count] : numDeclarations) {
+    if (count > 1) {
+      excluded.insert(name);
+    }
+  }
+  for (size_t i = 0; i < tokens.size(); i++) {
+    if (isDeclarationToken[i]) {
+      continue;
+    }
+    if (tokens[i].type == TokenType::Directive) {
+      const std::string_view directive = text(i).substr(1);
+      for (const Token& t : tokenize(directive)) {
+        const std::string_view word = directive.substr(t.begin, t.end - t.begin);
+        const auto it = numDeclarations.find(word);
+        if (t.type == TokenType::Identifier && it != numDeclarations.end()) {
+          excluded.insert(it->first);
+        }
+      }
+      continue;
+    }
+    if (tokens[i].type != TokenType::Identifier || !numDeclarations.contains(text(i))) {
+      continue;
+    }
+    if (i > 0 && (isSymbol(i - 1, '.') || (tokens[i - 1].type == TokenType::Identifier &&
+                                           !isExpressionKeyword(text(i - 1))))) {
+      excluded.insert(text(i));
+    }
+  }
+
+  const bool isVertex = stage == ShaderStage::Vertex;
+  outBlock.blockName = isVertex ? kVertexBlockName : kFragmentBlockName;
+  const std::string instanceName =
+      isVertex ? "iglPromotedUniformsVS" : "iglPromotedUniformsFS";
+
+  // compute the std140 layout of the promoted statements
+  std::vector<const Statement*> promoted;
+  uint32_t offset = 0;
+  for (const Statement& statement : statements) {
+    const bool isPromotable =
+        std::none_of(statement.declarations.begin(),
+                     statement.declarations.end(),
+                     [&](const Declaration& d) { return excluded.contains(text(d.nameToken)); });
+    if (!isPromotable) {
+      continue;
+    }
+    promoted.push_back(&statement);
+    for (const Declaration& decl : statement.declarations) {
+      uint32_t alignment = 0;
+      uint32_t size = 0;
+      getStd140Layout(decl.type, decl.isArray, alignment, size);
+      offset = (offset + alignment - 1) & ~(alignment - 1);
+      outBlock.members.push_back({
+          .name = std::string(text(decl.nameToken)),
+          .type = decl.type,
+          .numElements = decl.numElements,
+          .isArray = decl.isArray,
+          .offset = offset,
+      });
+      offset += size * static_cast<uint32_t>(decl.numElements);
+    }
+  }
+  outBlock.size = (offset + 15) & ~15u;
+
+  if (promoted.empty() || outBlock.size > kMaxBlockSize) {
+    outBlock = {};
+    return {};
+  }
+
+  std::string block = "layout(std140) uniform " + outBlock.blockName + " {\n";
+  std::string defines;
+  for (const Statement* statement : promoted) {
+    for (const Declaration& decl : statement->declarations) {
+      const std::string_view name = text(decl.nameToken);
+      block += "  ";
+      if (!decl.precision.empty()) {
+        block += decl.precision + " ";
+      }
+      block += decl.typeName + " " + std::string(name);
+      if (decl.isArray) {
+        block += "[" + std::to_string(decl.numElements) + "]";
+      }
+      block += ";\n";
+      defines += "#define " + std::string(name) + " " + instanceName + "." + std::string(name) +
+                 "\n";
+    }
+  }
+  block += "} " + instanceName + ";\n" + defines;
+
+  // replace the first promoted statement with the block and blank the others, keeping line numbers
+  // of the remaining code intact where possible
+  std::string result;
+  result.reserve(src.size() + block.size());
+  size_t pos = 0;
+  for (const Statement* statement : promoted) {
+    const size_t begin = tokens[statement->firstToken].begin;
+    const size_t end = tokens[statement->lastToken].end;
+    result.append(src.substr(pos, begin - pos));
+    if (statement == promoted.front()) {
+      if (begin > 0 && src[begin - 1] != '\n') {
+        result += '\n';
+      }
+      result += block;
+    } else {
+      const std::string_view removed = src.substr(begin, end - begin);
+      result.append(static_cast<size_t>(std::count(removed.begin(), removed.end(), '\n')), '\n');
+    }
+    pos = end;
+  }
+  result.append(src.substr(pos));
+
+  return result;
+}
+
+bool PromotedUniforms::isPromotedBlockName(const std::string& name) {
+  return name == kVertexBlockName || name == kFragmentBlockName;
+}
+
+PromotedUniforms::PromotedUniforms(IContext& context,
+                                   StageBlock vertexBlock,
+                                   StageBlock fragmentBlock) :
+  WithContext(context) {
+  blocks_[0].desc = std::move(vertexBlock);
+  blocks_[0].bindingIndex = kVertexBindingIndex;
+  blocks_[1].desc = std::move(fragmentBlock);
+  blocks_[1].bindingIndex = kFragmentBindingIndex;
+}
+
+PromotedUniforms::~PromotedUniforms() {
+  for (Block& block : blocks_) {
+    if (block.buffer != 0) {
+      getContext().deleteBuffers(1, &block.buffer);
+      block.buffer = 0;
+    }
+  }
+}
+
+Result PromotedUniforms::initialize(GLuint programID) {
+  IContext& ctx = getContext();
+
+  // bind the active promoted blocks and create their buffers
+  GLint numBlocks = 0;
+  GLint maxBlockNameLength = 0;
+  ctx.getProgramiv(programID, GL_ACTIVE_UNIFORM_BLOCKS, &numBlocks);
+  ctx.getProgramiv(programID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+
+  size_t alignment = 16;
+  ctx.deviceFeatures().getFeatureLimits(DeviceFeatureLimits::BufferAlignment, alignment);
+
+  std::vector<GLchar> nameData(std::max(maxBlockNameLength, 1));
+  for (GLint i = 0; i < numBlocks; i++) {
+    GLsizei length = 0;
+    ctx.getActiveUniformBlockName(programID, i, maxBlockNameLength, &length, nameData.data());
+    const std::string name(nameData.data(), nameData.data() + length);
+    for (Block& block : blocks_) {
+      if (block.desc.empty() || name != block.desc.blockName) {
+        continue;
+      }
+      ctx.uniformBlockBinding(programID, i, block.bindingIndex);
+      block.alignedSize = (block.desc.size + alignment - 1) / alignment * alignment;
+      block.capacity = block.alignedSize * kRingSize;
+      ctx.genBuffers(1, &block.buffer);
+      if (block.buffer == 0) {
+        return Result(Result::Code::RuntimeError, "Failed to create promoted uniforms buffer");
+      }
+      ctx.bindBuffer(GL_UNIFORM_BUFFER, block.buffer);
+      ctx.bufferData(GL_UNIFORM_BUFFER, block.capacity, nullptr, GL_DYNAMIC_DRAW);
+    }
+  }
+  for (Block& block : blocks_) {
+    block.shadow.assign(block.desc.size, 0);
+    block.writeOffset = block.capacity;
+    block.isDirty = true;
+  }
+
+  // find the default-block uniforms to place the promoted ones after them
+  GLint numUniforms = 0;
+  GLint maxUniformNameLength = 0;
+  ctx.getProgramiv(programID, GL_ACTIVE_UNIFORMS, &numUniforms);
+  ctx.getProgramiv(programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxUniformNameLength);
+
+  std::unordered_map<std::string, GLint> defaultUniforms;
+  nameData.assign(std::max(maxUniformNameLength, 1), '\0');
+  GLint maxLocation = -1;
+  for (GLint i = 0; i < numUniforms; i++) {
+    GLsizei length = 0;
+    GLint size = 0;
+    GLenum type = GL_NONE;
+    ctx.getActiveUniform(
+        programID, i, maxUniformNameLength, &length, &size, &type, nameData.data());
+    const GLint location = ctx.getUniformLocation(programID, nameData.data());
+    if (location < 0) {
+      continue;
+    }
+    if (length >= 4 && std::strcmp(nameData.data() + length - 3, "[0]") == 0) {
+      length -= 3;
+    }
+    defaultUniforms.emplace(std::string(nameData.data(), nameData.data() + length), location);
+    maxLocation = std::max(maxLocation, location);
+  }
+
+  // merge the members of both stages
+  uniforms_.clear();
+  std::vector<Uniform> inDefaultBlock;
+  for (size_t stage = 0; stage != 2; stage++) {
+    for (const Member& member : blocks_[stage].desc.members) {
+      const auto defaultIt = defaultUniforms.find(member.name);
+      std::vector<Uniform>& list = defaultIt != defaultUniforms.end() ? inDefaultBlock : uniforms_;
+      auto it = std::find_if(
+          list.begin(), list.end(), [&](const Uniform& u) { return u.name == member.name; });
+      if (it == list.end()) {
+        Uniform uniform;
+        uniform.name = member.name;
+        uniform.type = member.type;
+        uniform.numElements = member.numElements;
+        if (defaultIt != defaultUniforms.end()) {
+          uniform.location = defaultIt->second;
+          uniform.isInDefaultBlock = true;
+        }
+        list.push_back(std::move(uniform));
+        it = list.end() - 1;
+      }
+      IGL_DEBUG_ASSERT(it->type == member.type,
+                       "Uniform %s has different types in vertex and fragment shaders",
+                       member.name.c_str());
+      it->numElements = std::min(it->numElements, member.numElements);
+      (stage == 0 ? it->vertexOffset : it->fragmentOffset) = static_cast<int>(member.offset);
+    }
+  }
+
+  baseLocation_ = maxLocation + 1;
+  numSyntheticLocations_ = uniforms_.size();
+  for (size_t i = 0; i != uniforms_.size(); i++) {
+    uniforms_[i].location = baseLocation_ + static_cast<int>(i);
+  }
+  uniforms_.insert(uniforms_.end(), inDefaultBlock.begin(), inDefaultBlock.end());
+
+  return Result();
+}
+
+bool PromotedUniforms::setUniform(const UniformDesc& desc, const uint8_t* IGL_NONNULL data) {
+  const Uniform* uniform = nullptr;
+  const int index = desc.location - baseLocation_;
+  if (index >= 0 && static_cast<size_t>(index) < numSyntheticLocations_) {
+    uniform = &uniforms_[index];
+  } else {
+    for (size_t i = numSyntheticLocations_; i < uniforms_.size(); i++) {
+      if (uniforms_[i].location == desc.location) {
+        uniform = &uniforms_[i];
+        break;
+      }
+    }
+  }
+  if (!uniform) {
+    return false;
+  }
+
+  IGL_DEBUG_ASSERT(desc.type == uniform->type,
+                   "Uniform %s set with a wrong type",
+                   uniform->name.c_str());
+
+  if (uniform->vertexOffset >= 0) {
+    writeMember(blocks_[0], uniform->vertexOffset, *uniform, desc, data);
+  }
+  if (uniform->fragmentOffset >= 0) {
+    writeMember(blocks_[1], uniform->fragmentOffset, *uniform, desc, data);
+  }
+
+  return !uniform->isInDefaultBlock;
+}
+
+void PromotedUniforms::writeMember(Block& block,
+                                   uint32_t offset,
+                                   const Uniform& uniform,
+                                   const UniformDesc& desc,
+                                   const uint8_t* IGL_NONNULL data) {
+  const auto update = [&block](size_t dstOffset, const void* src, size_t size) {
+    uint8_t* dst = block.shadow.data() + dstOffset;
+    if (std::memcmp(dst, src, size) != 0) {
+      std::memcpy(dst, src, size);
+      block.isDirty = true;
+    }
+  };
+
+  const size_t srcStride =
+      desc.elementStride != 0 ? desc.elementStride : sizeForUniformType(desc.type);
+  const uint32_t columns = getMatrixColumns(uniform.type);
+  const size_t dstStride = columns ? 16 * columns : 16;
+  const size_t numElements = std::min(desc.numElements, uniform.numElements);
+
+  for (size_t e = 0; e != numElements; e++) {
+    const uint8_t* src = data + e * srcStride;
+    const size_t dst = offset + e * dstStride;
+    if (columns) {
+      for (uint32_t c = 0; c != columns; c++) {
+        update(dst + 16 * c, src + c * (srcStride / columns), columns * sizeof(float));
+      }
+    } else if (uniform.type == UniformType::Boolean) {
+      const int32_t value = *src != 0 ? 1 : 0;
+      update(dst, &value, sizeof(value));
+    } else {
+      update(dst, src, sizeForUniformType(uniform.type));
+    }
+  }
+}
+
+void PromotedUniforms::bind(bool forceBind) {
+  IContext& ctx = getContext();
+  for (Block& block : blocks_) {
+    if (block.buffer == 0) {
+      continue;
+    }
+    if (block.isDirty) {
+      if (block.writeOffset + block.alignedSize > block.capacity) {
+        // orphan the buffer instead of waiting for draws using the previous contents
+        ctx.bindBuffer(GL_UNIFORM_BUFFER, block.buffer);
+        ctx.bufferData(GL_UNIFORM_BUFFER, block.capacity, nullptr, GL_DYNAMIC_DRAW);
+        block.writeOffset = 0;
+      }
+      ctx.bindBufferRange(
+          GL_UNIFORM_BUFFER, block.bindingIndex, block.buffer, block.writeOffset, block.desc.size);
+      ctx.bufferSubData(
+          GL_UNIFORM_BUFFER, block.writeOffset, block.desc.size, block.shadow.data());
+      block.boundOffset = block.writeOffset;
+      block.writeOffset += block.alignedSize;
+      block.isDirty = false;
+    } else if (forceBind) {
+      ctx.bindBufferRange(
+          GL_UNIFORM_BUFFER, block.bindingIndex, block.buffer, block.boundOffset, block.desc.size);
+    }
+  }
+}
+
+} // namespace igl::opengl
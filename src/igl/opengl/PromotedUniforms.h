@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <igl/Common.h>
+#include <igl/Shader.h>
+#include <igl/Uniform.h>
+#include <igl/opengl/GLIncludes.h>
+#include <igl/opengl/WithContext.h>
+
+namespace igl::opengl {
+
+/**
+ * @brief Loose default-block uniforms of a shader program promoted into std140 uniform blocks.
+ *
+ * When IContext::setUniformBlockPromotionEnabled() is on, vertex and fragment shader sources are
+ * rewritten at creation time: declarations of scalar, vector and matrix uniforms (and arrays of
+ * them) are moved into a per-stage `layout(std140)` block and referenced through a macro, so the
+ * shader body stays untouched. Promoted uniforms get locations above those of the remaining
+ * uniforms, so clients keep using getIndexByName() and bindUniform() unchanged.
+ *
+ * UniformAdapter writes promoted uniforms into a CPU shadow of each block. Before a draw, every
+ * modified block is uploaded with a single glBufferSubData() into a fresh range of a ring buffer
+ * and bound with a single glBindBufferRange(), instead of issuing one glUniform*() per uniform.
+ */
+class PromotedUniforms final : public WithContext {
+ public:
+  /// Binding indices reserved for the promoted blocks
+  static constexpr uint32_t kVertexBindingIndex = IGL_UNIFORM_BLOCKS_BINDING_MAX - 1;
+  static constexpr uint32_t kFragmentBindingIndex = IGL_UNIFORM_BLOCKS_BINDING_MAX - 2;
+  static constexpr const char* kVertexBlockName = "IGLPromotedUniformsVS";
+  static constexpr const char* kFragmentBlockName = "IGLPromotedUniformsFS";
+
+  struct Member {
+    std::string name;
+    UniformType type = UniformType::Invalid;
+    /// Greater than 1 for arrays
+    size_t numElements = 1;
+    bool isArray = false;
+    /// std140 offset within the block
+    uint32_t offset = 0;
+  };
+
+  /// Uniforms promoted from a single shader stage
+  struct StageBlock {
+    std::string blockName;
+    std::vector<Member> members;
+    /// std140 size of the block
+    uint32_t size = 0;
+
+    [[nodiscard]] bool empty() const {
+      return members.empty();
+    }
+  };
+
+  /// A promoted uniform of the program. A uniform declared in both stages is written to both
+  /// blocks.
+  struct Uniform {
+    std::string name;
+    UniformType type = UniformType::Invalid;
+    size_t numElements = 1;
+    int location = -1;
+    int vertexOffset = -1;
+    int fragmentOffset = -1;
+    /// True if the other stage could not promote this uniform. It keeps the location of the
+    /// default-block uniform and has to be set with glUniform*() as well.
+    bool isInDefaultBlock = false;
+  };
+
+  /// Moves all promotable uniform declarations of a vertex or fragment shader `source` into a
+  /// std140 block. Returns the rewritten source, or an empty string if the source cannot or need
+  /// not be rewritten (e.g. its GLSL version has no uniform blocks, or it has no loose uniforms).
+  [[nodiscard]] static std::string rewriteShaderSource(const char* IGL_NULLABLE source,
+                                                       ShaderStage stage,
+                                                       StageBlock& outBlock);
+
+  [[nodiscard]] static bool isPromotedBlockName(const std::string& name);
+
+  PromotedUniforms(IContext& context, StageBlock vertexBlock, StageBlock fragmentBlock);
+  ~PromotedUniforms() override;
+  PromotedUniforms(const PromotedUniforms&) = delete;
+  PromotedUniforms& operator=(const PromotedUniforms&) = delete;
+  PromotedUniforms(PromotedUniforms&&) = delete;
+  PromotedUniforms& operator=(PromotedUniforms&&) = delete;
+
+  /// Binds the blocks of the linked program `programID` to their binding indices, assigns
+  /// locations to the promoted uniforms and creates the GPU buffers.
+  Result initialize(GLuint programID);
+
+  [[nodiscard]] const std::vector<Uniform>& getUniforms() const {
+    return uniforms_;
+  }
+
+  /// Copies a uniform set with UniformAdapter into the CPU shadow of the blocks. `data` points to
+  /// the first element. Returns false if the uniform still has to be set with glUniform*(), i.e.
+  /// if `desc.location` is not a promoted uniform or if it is also in the default block.
+  bool setUniform(const UniformDesc& desc, const uint8_t* IGL_NONNULL data);
+
+  /// Uploads and binds modified blocks. Unmodified blocks are only rebound if `forceBind` is set,
+  /// e.g. after a pipeline change when another program may have used the same binding indices.
+  void bind(bool forceBind);
+
+ private:
+  struct Block {
+    StageBlock desc;
+    uint32_t bindingIndex = 0;
+    std::vector<uint8_t> shadow;
+    GLuint buffer = 0;
+    size_t alignedSize = 0;
+    size_t capacity = 0;
+    size_t writeOffset = 0;
+    size_t boundOffset = 0;
+    bool isDirty = true;
+  };
+
+  static void writeMember(Block& block,
+                          uint32_t offset,
+                          const Uniform& uniform,
+                          const UniformDesc& desc,
+                          const uint8_t* IGL_NONNULL data);
+
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  Block blocks_[2];
+  // uniforms with synthetic locations first, starting at baseLocation_, followed by the uniforms
+  // which are also in the default block
+  std::vector<Uniform> uniforms_;
+  size_t numSyntheticLocations_ = 0;
+  int baseLocation_ = 0;
+};
+
+} // namespace igl::opengl
@@ -61,6 +61,12 @@ void RenderCommandAdapter::initialize(const RenderPassDesc& renderPass,
       return;
     }
     activeVAO_->bind();
+    vaoCache_ = getContext().isVertexArrayObjectCacheEnabled()
+                    ? getContext().getVertexArrayObjectCache()
+                    : nullptr;
+    if (vaoCache_) {
+      vaoCache_->resetBoundEntry();
+    }
   }
   const auto& openglFramebuffer = static_cast<const Framebuffer&>(*framebuffer);
   openglFramebuffer.bind(renderPass);
@@ -110,6 +116,8 @@ void RenderCommandAdapter::setDepthBias(float depthBias, float slopeScale, float
 
 void RenderCommandAdapter::clearVertexBuffers() {
   vertexBuffersDirty_.reset();
+  vertexBuffersBound_.reset();
+  isVertexArrayDirty_ = true;
 }
 
 void RenderCommandAdapter::setVertexBuffer(Buffer& buffer,
@@ -118,9 +126,17 @@ void RenderCommandAdapter::setVertexBuffer(Buffer& buffer,
                                            Result* IGL_NULLABLE outResult) {
   IGL_DEBUG_ASSERT(index < IGL_BUFFER_BINDINGS_MAX,
                    "Buffer index is beyond max, may want to increase limit");
-  if (index < IGL_BUFFER_BINDINGS_MAX) {
-    vertexBuffers_[index] = {.resource = &buffer, .offset = offset};
+  // uniform buffers are the only buffers which are not ArrayBuffers
+  const bool isArrayBuffer = IGL_DEBUG_VERIFY(buffer.getType() != Buffer::Type::Uniform);
+  if (index < IGL_BUFFER_BINDINGS_MAX && isArrayBuffer) {
+    // streaming buffers are bound to their current region
+    vertexBuffers_[index] = {
+        .resource = &buffer,
+        .offset = offset + static_cast<ArrayBuffer&>(buffer).acquireBindOffset(),
+    };
     SET_DIRTY(vertexBuffersDirty_, index);
+    vertexBuffersBound_.set(index);
+    isVertexArrayDirty_ = true;
     Result::setOk(outResult);
   } else {
     Result::setResult(outResult, Result::Code::ArgumentInvalid);
@@ -128,6 +144,12 @@ void RenderCommandAdapter::setVertexBuffer(Buffer& buffer,
 }
 
 void RenderCommandAdapter::setIndexBuffer(Buffer& buffer) {
+  if (vaoCache_) {
+    // the element array buffer binding is part of the VAO state, so it is bound in willDraw()
+    indexBuffer_ = &buffer;
+    isVertexArrayDirty_ = true;
+    return;
+  }
   bindBufferWithShaderStorageBufferOverride(buffer, GL_ELEMENT_ARRAY_BUFFER);
 }
 
@@ -268,10 +290,13 @@ void RenderCommandAdapter::setPipelineState(const std::shared_ptr<IRenderPipelin
   }
   pipelineState_ = newValue;
   setDirty(StateMask::PIPELINE);
+  isVertexArrayDirty_ = true;
 }
 
 void RenderCommandAdapter::drawArrays(GLenum mode, GLint first, GLsizei count) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   getContext().drawArrays(toMockWireframeMode(mode), first, count);
   didDraw();
 }
@@ -279,7 +304,9 @@ void RenderCommandAdapter::drawArrays(GLenum mode, GLint first, GLsizei count) {
 void RenderCommandAdapter::drawArraysIndirect(GLenum mode,
                                               Buffer& indirectBuffer,
                                               const GLvoid* IGL_NULLABLE indirectBufferOffset) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::DrawArraysIndirect)) {
     bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
     getContext().drawArraysIndirect(toMockWireframeMode(mode), indirectBufferOffset);
@@ -293,7 +320,9 @@ void RenderCommandAdapter::drawArraysInstanced(GLenum mode,
                                                GLint first,
                                                GLsizei count,
                                                GLsizei instancecount) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   if (getContext().deviceFeatures().hasFeature(DeviceFeatures::DrawInstanced)) {
     getContext().drawArraysInstanced(toMockWireframeMode(mode), first, count, instancecount);
   } else {
@@ -306,7 +335,9 @@ void RenderCommandAdapter::drawElements(GLenum mode,
                                         GLsizei indexCount,
                                         GLenum indexType,
                                         const GLvoid* IGL_NULLABLE indexOffset) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   getContext().drawElements(toMockWireframeMode(mode), indexCount, indexType, indexOffset);
   didDraw();
 }
@@ -316,7 +347,9 @@ void RenderCommandAdapter::drawElementsInstanced(GLenum mode,
                                                  GLenum indexType,
                                                  const GLvoid* IGL_NULLABLE indexOffset,
                                                  GLsizei instancecount) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   if (getContext().deviceFeatures().hasFeature(DeviceFeatures::DrawInstanced)) {
     getContext().drawElementsInstanced(
         toMockWireframeMode(mode), indexCount, indexType, indexOffset, instancecount);
@@ -330,7 +363,9 @@ void RenderCommandAdapter::drawElementsIndirect(GLenum mode,
                                                 GLenum indexType,
                                                 Buffer& indirectBuffer,
                                                 const GLvoid* IGL_NULLABLE indirectBufferOffset) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   if (getContext().deviceFeatures().hasFeature(DeviceFeatures::DrawIndexedIndirect)) {
     bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
     getContext().drawElementsIndirect(toMockWireframeMode(mode), indexType, indirectBufferOffset);
@@ -345,7 +380,9 @@ void RenderCommandAdapter::multiDrawArraysIndirect(GLenum mode,
                                                    const GLvoid* IGL_NULLABLE indirectBufferOffset,
                                                    GLsizei drawcount,
                                                    GLsizei stride) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::MultiDrawIndirect)) {
     bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
     getContext().multiDrawArraysIndirect(
@@ -363,7 +400,9 @@ void RenderCommandAdapter::multiDrawElementsIndirect(GLenum mode,
                                                          indirectBufferOffset,
                                                      GLsizei drawcount,
                                                      GLsizei stride) {
-  willDraw();
+  if (!willDraw()) {
+    return;
+  }
   if (getContext().deviceFeatures().hasInternalFeature(InternalFeatures::MultiDrawIndirect)) {
     bindBufferWithShaderStorageBufferOverride(indirectBuffer, GL_DRAW_INDIRECT_BUFFER);
     getContext().multiDrawElementsIndirect(
@@ -377,7 +416,17 @@ void RenderCommandAdapter::multiDrawElementsIndirect(GLenum mode,
 void RenderCommandAdapter::endEncoding() {
   // Some minimal cleanup needs to occur in order. Otherwise, OpenGL can end in a bad state
   // with complex rendering.
-  if (pipelineState_) {
+  if (vaoCache_) {
+    // leave the cached VAOs untouched and restore the VAO owned by this adapter
+    if (cachedVAO_) {
+      activeVAO_->bind();
+      vaoCache_->resetBoundEntry();
+    }
+    cachedVAO_ = nullptr;
+    indexBuffer_ = nullptr;
+    vertexBuffersBound_.reset();
+    isVertexArrayDirty_ = true;
+  } else if (pipelineState_) {
     unbindVertexAttributes();
   }
 
@@ -404,12 +453,26 @@ void RenderCommandAdapter::endEncoding() {
  * uniforms, and dirty vertex/fragment texture-sampler pairs. Also
  * validates shader stages when shader validation is enabled.
  */
-void RenderCommandAdapter::willDraw() {
+bool RenderCommandAdapter::willDraw() {
   Result ret;
   auto* pipelineState = static_cast<RenderPipelineState*>(pipelineState_.get());
 
+  // a program which failed to link in parallel is never made current: skip the draw rather than
+  // draw with whichever program is current
+  if (pipelineState && !pipelineState->getLinkResult().isOk()) {
+    return false;
+  }
+
+  const bool isPipelineDirty = isDirty(StateMask::PIPELINE);
+
   // Vertex Buffers must be bound before pipelineState->bind()
-  if (pipelineState) {
+  if (pipelineState && vaoCache_) {
+    bindCachedVertexArray(*pipelineState);
+    if (isDirty(StateMask::PIPELINE)) {
+      pipelineState->bind();
+      clearDirty(StateMask::PIPELINE);
+    }
+  } else if (pipelineState) {
     pipelineState->clearActiveAttributesLocations();
     for (size_t bufferIndex = 0; bufferIndex < IGL_BUFFER_BINDINGS_MAX; ++bufferIndex) {
       if (IS_DIRTY(vertexBuffersDirty_, bufferIndex)) {
@@ -452,7 +515,10 @@ void RenderCommandAdapter::willDraw() {
   static const size_t kFragmentTextureStatesSize = fragmentTextureStates_.size();
   if (pipelineState) {
     // Bind uniforms to be used for render
-    uniformAdapter_.bindToPipeline(getContext());
+    const ShaderStages* shaderStages = pipelineState->getShaderStages();
+    uniformAdapter_.bindToPipeline(getContext(),
+                                   shaderStages ? shaderStages->getPromotedUniforms() : nullptr,
+                                   isPipelineDirty);
     // Bind storage buffers
     for (size_t bufferIndex = 0; bufferIndex < IGL_BUFFER_BINDINGS_MAX; ++bufferIndex) {
       if (IS_DIRTY(storageBuffersDirty_, bufferIndex)) {
@@ -517,6 +583,68 @@ void RenderCommandAdapter::willDraw() {
       }
     }
   }
+  return true;
+}
+
+/**
+ * @brief Binds the cached VAO matching the current vertex layout and buffers.
+ *
+ * The lookup only happens when the pipeline, a vertex buffer or the index buffer changed, or when
+ * cache entries were removed. On a miss, the vertex attributes are specified once into a new VAO.
+ * Repeated draws of the same mesh with the same vertex layout cost at most a glBindVertexArray().
+ */
+void RenderCommandAdapter::bindCachedVertexArray(RenderPipelineState& pipelineState) {
+  if (cachedVAOGeneration_ != vaoCache_->getGeneration()) {
+    // the entry may have been deleted
+    cachedVAO_ = nullptr;
+  }
+
+  if (isVertexArrayDirty_ || !cachedVAO_) {
+    VertexArrayObjectCache::Key key;
+    key.layoutId = pipelineState.getVertexLayoutId(*vaoCache_);
+    key.indexBuffer = indexBuffer_ ? static_cast<ArrayBuffer*>(indexBuffer_)->getId() : 0;
+    const auto& mask = pipelineState.getVertexBufferMask();
+    for (size_t bufferIndex = 0; bufferIndex < IGL_BUFFER_BINDINGS_MAX; ++bufferIndex) {
+      if (mask.test(bufferIndex) && vertexBuffersBound_.test(bufferIndex)) {
+        const auto& bufferState = vertexBuffers_[bufferIndex];
+        key.vertexBuffers[bufferIndex] = {
+            .buffer = static_cast<ArrayBuffer*>(bufferState.resource)->getId(),
+            .offset = bufferState.offset,
+        };
+      }
+    }
+
+    bool created = false;
+    auto* entry = vaoCache_->getOrCreate(key, created);
+    if (!IGL_DEBUG_VERIFY(entry)) {
+      return;
+    }
+    // a new entry may reuse the address of an evicted one
+    if (entry != cachedVAO_ || created) {
+      vaoCache_->bind(*entry);
+    }
+    if (created) {
+      for (size_t bufferIndex = 0; bufferIndex < IGL_BUFFER_BINDINGS_MAX; ++bufferIndex) {
+        if (key.vertexBuffers[bufferIndex].buffer) {
+          auto& bufferState = vertexBuffers_[bufferIndex];
+          bindBufferWithShaderStorageBufferOverride((*bufferState.resource), GL_ARRAY_BUFFER);
+          pipelineState.bindVertexAttributes(bufferIndex, bufferState.offset);
+        }
+      }
+      // a new VAO starts with all attributes disabled, so there is nothing to unbind later
+      pipelineState.clearActiveAttributesLocations();
+    }
+
+    cachedVAO_ = entry;
+    cachedVAOGeneration_ = vaoCache_->getGeneration();
+    vertexBuffersDirty_.reset();
+    isVertexArrayDirty_ = false;
+  }
+
+  if (indexBuffer_ && !cachedVAO_->isIndexBufferBound) {
+    bindBufferWithShaderStorageBufferOverride(*indexBuffer_, GL_ELEMENT_ARRAY_BUFFER);
+    cachedVAO_->isIndexBufferBound = true;
+  }
 }
 
 GLenum RenderCommandAdapter::toMockWireframeMode(GLenum mode) const {
@@ -14,6 +14,7 @@
 #include <igl/opengl/GLIncludes.h>
 #include <igl/opengl/UnbindPolicy.h>
 #include <igl/opengl/UniformAdapter.h>
+#include <igl/opengl/VertexArrayObjectCache.h>
 #include <igl/opengl/WithContext.h>
 
 namespace igl {
@@ -26,6 +27,7 @@ class IRenderPipelineState;
 
 namespace opengl {
 class Buffer;
+class RenderPipelineState;
 class VertexArrayObject;
 
 class RenderCommandAdapter final : public WithContext {
@@ -141,9 +143,11 @@ class RenderCommandAdapter final : public WithContext {
 
   void clearDependentResources(const std::shared_ptr<IRenderPipelineState>& newValue,
                                Result* IGL_NULLABLE outResult = nullptr);
-  void willDraw();
+  /// Returns false if the draw has to be skipped
+  [[nodiscard]] bool willDraw();
   void didDraw();
   void unbindVertexAttributes();
+  void bindCachedVertexArray(RenderPipelineState& pipelineState);
 
   void bindBufferWithShaderStorageBufferOverride(Buffer& buffer,
                                                  GLenum overrideTargetForShaderStorageBuffer);
@@ -176,6 +180,13 @@ class RenderCommandAdapter final : public WithContext {
   std::shared_ptr<IRenderPipelineState> pipelineState_;
   std::shared_ptr<IDepthStencilState> depthStencilState_;
   std::shared_ptr<VertexArrayObject> activeVAO_ = nullptr;
+  // Used instead of activeVAO_ for drawing when IContext::isVertexArrayObjectCacheEnabled()
+  VertexArrayObjectCache* IGL_NULLABLE vaoCache_ = nullptr;
+  VertexArrayObjectCache::Entry* IGL_NULLABLE cachedVAO_ = nullptr;
+  uint64_t cachedVAOGeneration_ = 0;
+  std::bitset<IGL_BUFFER_BINDINGS_MAX> vertexBuffersBound_;
+  Buffer* IGL_NULLABLE indexBuffer_ = nullptr;
+  bool isVertexArrayDirty_ = true;
   uint32_t frontStencilReferenceValue_ = 0xFF;
   uint32_t backStencilReferenceValue_ = 0xFF;
 
@@ -414,9 +414,15 @@ void RenderCommandEncoder::bindIndexBuffer(IBuffer& buffer,
                                            IndexFormat format,
                                            size_t bufferOffset) {
   if (IGL_DEBUG_VERIFY(adapter_)) {
+    auto& glBuffer = static_cast<Buffer&>(buffer);
+    if (!IGL_DEBUG_VERIFY(glBuffer.getType() == Buffer::Type::Attribute)) {
+      return;
+    }
     indexType_ = toGlType(format);
-    indexBufferOffset_ = reinterpret_cast<void*>(bufferOffset); // NOLINT(performance-no-int-to-ptr)
-    adapter_->setIndexBuffer((Buffer&)buffer);
+    // streaming buffers are bound to their current region
+    const size_t offset = bufferOffset + static_cast<ArrayBuffer&>(glBuffer).acquireBindOffset();
+    indexBufferOffset_ = reinterpret_cast<void*>(offset); // NOLINT(performance-no-int-to-ptr)
+    adapter_->setIndexBuffer(glBuffer);
   }
 }
 
@@ -9,6 +9,7 @@
 
 #include <cstring>
 #include <igl/opengl/GLIncludes.h>
+#include <igl/opengl/PromotedUniforms.h>
 
 namespace {
 
@@ -44,6 +45,38 @@ igl::UniformType toIGLUniformType(GLenum type) {
   }
 }
 
+GLenum toGLUniformType(igl::UniformType type) {
+  switch (type) {
+  case igl::UniformType::Float:
+    return GL_FLOAT;
+  case igl::UniformType::Float2:
+    return GL_FLOAT_VEC2;
+  case igl::UniformType::Float3:
+    return GL_FLOAT_VEC3;
+  case igl::UniformType::Float4:
+    return GL_FLOAT_VEC4;
+  case igl::UniformType::Boolean:
+    return GL_BOOL;
+  case igl::UniformType::Int:
+    return GL_INT;
+  case igl::UniformType::Int2:
+    return GL_INT_VEC2;
+  case igl::UniformType::Int3:
+    return GL_INT_VEC3;
+  case igl::UniformType::Int4:
+    return GL_INT_VEC4;
+  case igl::UniformType::Mat2x2:
+    return GL_FLOAT_MAT2;
+  case igl::UniformType::Mat3x3:
+    return GL_FLOAT_MAT3;
+  case igl::UniformType::Mat4x4:
+    return GL_FLOAT_MAT4;
+  case igl::UniformType::Invalid:
+    return GL_NONE;
+  }
+  IGL_UNREACHABLE_RETURN(GL_NONE)
+}
+
 igl::TextureType toIGLTextureType(GLenum type) {
   switch (type) {
   case GL_SAMPLER_2D:
@@ -87,6 +120,9 @@ RenderPipelineReflection::RenderPipelineReflection(IContext& context, const Shad
     generateUniformBlocksDictionary(context, stages.getProgramID());
   }
   generateUniformDictionary(context, stages.getProgramID());
+  if (const PromotedUniforms* promotedUniforms = stages.getPromotedUniforms()) {
+    addPromotedUniforms(*promotedUniforms);
+  }
   generateAttributeDictionary(context, stages.getProgramID());
   generateShaderStorageBufferObjectDictionary(context, stages.getProgramID());
   cacheDescriptors();
@@ -157,6 +193,17 @@ void RenderPipelineReflection::generateUniformDictionary(IContext& context, GLui
   }
 }
 
+void RenderPipelineReflection::addPromotedUniforms(const PromotedUniforms& promotedUniforms) {
+  for (const auto& uniform : promotedUniforms.getUniforms()) {
+    if (uniform.isInDefaultBlock) {
+      continue;
+    }
+    const UniformDesc u(
+        static_cast<GLsizei>(uniform.numElements), uniform.location, toGLUniformType(uniform.type));
+    uniformDictionary_.insert(std::make_pair(igl::genNameHandle(uniform.name), u));
+  }
+}
+
 void RenderPipelineReflection::generateUniformBlocksDictionary(IContext& context, GLuint pid) {
   IGL_DEBUG_ASSERT(pid != 0);
   uniformBlocksDictionary_.clear();
@@ -190,6 +237,10 @@ void RenderPipelineReflection::generateUniformBlocksDictionary(IContext& context
                                       uniformBlockNameData.data());
     const std::string uniformBlockName(uniformBlockNameData.begin(),
                                        uniformBlockNameData.begin() + blockNameLength);
+    if (PromotedUniforms::isPromotedBlockName(uniformBlockName)) {
+      // promoted uniforms are exposed as regular uniforms
+      continue;
+    }
 
     context.getActiveUniformBlockiv(
         pid, blockDesc.blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE, &blockDesc.size);
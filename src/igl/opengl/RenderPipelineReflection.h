@@ -77,6 +77,7 @@ class RenderPipelineReflection final : public IRenderPipelineReflection {
   std::unordered_map<NameHandle, int> shaderStorageBufferObjectDictionary_;
 
   void generateUniformDictionary(IContext& context, GLuint pid);
+  void addPromotedUniforms(const PromotedUniforms& promotedUniforms);
   void generateUniformBlocksDictionary(IContext& context, GLuint pid);
   void generateShaderStorageBufferObjectDictionary(IContext& context, GLuint pid);
   void generateAttributeDictionary(IContext& context, GLuint pid);
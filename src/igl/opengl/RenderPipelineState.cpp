@@ -7,7 +7,9 @@
 
 #include <igl/opengl/RenderPipelineState.h>
 
+#include <algorithm>
 #include <igl/RenderCommandEncoder.h> // for igl::BindTarget
+#include <igl/opengl/VertexArrayObjectCache.h>
 #include <igl/opengl/VertexInputState.h>
 
 namespace igl::opengl {
@@ -117,9 +119,48 @@ Result RenderPipelineState::create() {
     return Result(Result::Code::ArgumentInvalid, "Missing required shader module(s).");
   }
 
+  const auto& mFramebufferDesc = desc_.targetDesc;
+  if (!mFramebufferDesc.colorAttachments.empty()) {
+    const ColorWriteMask colorWriteMask = mFramebufferDesc.colorAttachments[0].colorWriteMask;
+    colorMask_[0] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsRed) != 0);
+    colorMask_[1] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsGreen) != 0);
+    colorMask_[2] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsBlue) != 0);
+    colorMask_[3] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsAlpha) != 0);
+  }
+
+  if (!mFramebufferDesc.colorAttachments.empty() &&
+      mFramebufferDesc.colorAttachments[0].blendEnabled) {
+    blendEnabled_ = true;
+    // GL equation sets blending equation for both RGB and alpha
+    blendMode_ = {
+        .blendOpColor = convertBlendOp(mFramebufferDesc.colorAttachments[0].rgbBlendOp),
+        .blendOpAlpha = convertBlendOp(mFramebufferDesc.colorAttachments[0].alphaBlendOp),
+        .srcColor = convertBlendFactor(mFramebufferDesc.colorAttachments[0].srcRGBBlendFactor),
+        .dstColor = convertBlendFactor(mFramebufferDesc.colorAttachments[0].dstRGBBlendFactor),
+        .srcAlpha = convertBlendFactor(mFramebufferDesc.colorAttachments[0].srcAlphaBlendFactor),
+        .dstAlpha = convertBlendFactor(mFramebufferDesc.colorAttachments[0].dstAlphaBlendFactor)};
+  } else {
+    blendEnabled_ = false;
+  }
+
+  // don't block on the parallel link, the rest is created once the program is linked
+  if (!shaderStages->isReady()) {
+    reflectionPending_ = true;
+    return Result();
+  }
+  linkResult_ = createReflection();
+  return linkResult_;
+}
+
+Result RenderPipelineState::createReflection() const {
+  const auto* shaderStages = static_cast<ShaderStages*>(desc_.shaderStages.get());
+  Result linkResult = shaderStages->waitForLink();
+  if (!linkResult.isOk()) {
+    return linkResult;
+  }
+
   reflection_ = std::make_shared<RenderPipelineReflection>(getContext(), *shaderStages);
 
-  const auto& mFramebufferDesc = desc_.targetDesc;
   // Get and cache all attribute locations, since this won't change throughout
   // the lifetime of this RenderPipelineState
   const auto* vertexInputState = static_cast<VertexInputState*>(desc_.vertexInputState.get());
@@ -136,6 +177,9 @@ Result RenderPipelineState::create() {
         IGL_DEBUG_ASSERT(index < IGL_BUFFER_BINDINGS_MAX);
         if (index < IGL_BUFFER_BINDINGS_MAX) {
           bufferAttribLocations_[index].push_back(loc);
+          if (loc >= 0) {
+            vertexBufferMask_.set(index);
+          }
         }
       }
     }
@@ -191,33 +235,33 @@ Result RenderPipelineState::create() {
     unitSamplerLocationMap_[realTextureUnit] = loc;
   }
 
-  if (!mFramebufferDesc.colorAttachments.empty()) {
-    const ColorWriteMask colorWriteMask = mFramebufferDesc.colorAttachments[0].colorWriteMask;
-    colorMask_[0] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsRed) != 0);
-    colorMask_[1] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsGreen) != 0);
-    colorMask_[2] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsBlue) != 0);
-    colorMask_[3] = static_cast<GLboolean>((colorWriteMask & kColorWriteBitsAlpha) != 0);
-  }
+  return Result();
+}
 
-  if (!mFramebufferDesc.colorAttachments.empty() &&
-      mFramebufferDesc.colorAttachments[0].blendEnabled) {
-    blendEnabled_ = true;
-    // GL equation sets blending equation for both RGB and alpha
-    blendMode_ = {
-        .blendOpColor = convertBlendOp(mFramebufferDesc.colorAttachments[0].rgbBlendOp),
-        .blendOpAlpha = convertBlendOp(mFramebufferDesc.colorAttachments[0].alphaBlendOp),
-        .srcColor = convertBlendFactor(mFramebufferDesc.colorAttachments[0].srcRGBBlendFactor),
-        .dstColor = convertBlendFactor(mFramebufferDesc.colorAttachments[0].dstRGBBlendFactor),
-        .srcAlpha = convertBlendFactor(mFramebufferDesc.colorAttachments[0].srcAlphaBlendFactor),
-        .dstAlpha = convertBlendFactor(mFramebufferDesc.colorAttachments[0].dstAlphaBlendFactor)};
-  } else {
-    blendEnabled_ = false;
+void RenderPipelineState::resolvePendingReflection() const {
+  if (reflectionPending_) {
+    // only the state derived from the linked program is filled in here
+    reflectionPending_ = false;
+    linkResult_ = createReflection();
+    if (!linkResult_.isOk()) {
+      IGL_LOG_ERROR("Failed to create render pipeline: %s\n", linkResult_.message.c_str());
+    }
   }
+}
 
-  return Result();
+bool RenderPipelineState::isReady() const {
+  if (!reflectionPending_) {
+    return true;
+  }
+  if (!getShaderStages()->isReady()) {
+    return false;
+  }
+  resolvePendingReflection();
+  return true;
 }
 
 void RenderPipelineState::bind() {
+  resolvePendingReflection();
   if (desc_.shaderStages) {
     const auto* shaderStages = static_cast<ShaderStages*>(desc_.shaderStages.get());
     shaderStages->bind();
@@ -284,6 +328,7 @@ void RenderPipelineState::bindVertexAttributes(size_t bufferIndex, size_t buffer
   }
 #endif
 
+  resolvePendingReflection();
   const auto& attribList = static_cast<VertexInputState*>(desc_.vertexInputState.get())
                                ->getAssociatedAttributes(bufferIndex);
   auto& locations = bufferAttribLocations_[bufferIndex];
@@ -329,6 +374,49 @@ void RenderPipelineState::bindVertexAttributes(size_t bufferIndex, size_t buffer
   }
 }
 
+uint32_t RenderPipelineState::getVertexLayoutId(VertexArrayObjectCache& cache) {
+  resolvePendingReflection();
+  if (vertexLayoutCacheId_ == cache.getCacheId()) {
+    return vertexLayoutId_;
+  }
+
+  // Flatten everything bindVertexAttributes() specifies, so pipelines with identical layouts and
+  // attribute locations share the same cached VAOs
+  std::vector<uint32_t> signature;
+  auto* vertexInputState = static_cast<VertexInputState*>(desc_.vertexInputState.get());
+  for (size_t bufferIndex = 0; vertexInputState && bufferIndex < IGL_BUFFER_BINDINGS_MAX;
+       bufferIndex++) {
+    if (!vertexBufferMask_.test(bufferIndex)) {
+      continue;
+    }
+    const auto& attribList = vertexInputState->getAssociatedAttributes(bufferIndex);
+    const auto& locations = bufferAttribLocations_[bufferIndex];
+    for (size_t i = 0, iLen = std::min(attribList.size(), locations.size()); i < iLen; i++) {
+      if (locations[i] < 0) {
+        continue;
+      }
+      const auto& attribute = attribList[i];
+      const auto divisor = attribute.sampleFunction == igl::VertexSampleFunction::Instance
+                               ? static_cast<uint32_t>(attribute.sampleRate)
+                               : 0u;
+      signature.insert(signature.end(),
+                       {static_cast<uint32_t>(bufferIndex),
+                        static_cast<uint32_t>(locations[i]),
+                        static_cast<uint32_t>(attribute.numComponents),
+                        attribute.componentType,
+                        attribute.normalized,
+                        static_cast<uint32_t>(attribute.stride),
+                        static_cast<uint32_t>(attribute.bufferOffset),
+                        divisor});
+    }
+  }
+
+  vertexLayoutId_ = cache.getLayoutId(signature);
+  vertexLayoutCacheId_ = cache.getCacheId();
+
+  return vertexLayoutId_;
+}
+
 void RenderPipelineState::unbindVertexAttributes() {
   for (const auto& l : activeAttributesLocations_) {
     getContext().disableVertexAttribArray(l);
@@ -358,6 +446,8 @@ Result RenderPipelineState::bindTextureUnit(const size_t unit,
     return Result{Result::Code::ArgumentInvalid, "Unit specified greater than maximum\n"};
   }
 
+  resolvePendingReflection();
+
   GLint samplerLocation = -1;
   if (bindTarget == igl::BindTarget::kVertex) {
     auto it = vertexTextureUnitRemap_.find(unit);
@@ -391,6 +481,7 @@ bool RenderPipelineState::matchesVertexInputState(const RenderPipelineState& rhs
 }
 
 int RenderPipelineState::getIndexByName(const NameHandle& name, ShaderStage /*stage*/) const {
+  resolvePendingReflection();
   if (reflection_ == nullptr) {
     return -1;
   }
@@ -398,6 +489,7 @@ int RenderPipelineState::getIndexByName(const NameHandle& name, ShaderStage /*st
 }
 
 int RenderPipelineState::getIndexByName(const std::string& name, ShaderStage /*stage*/) const {
+  resolvePendingReflection();
   if (reflection_ == nullptr) {
     return -1;
   }
@@ -409,6 +501,7 @@ int RenderPipelineState::getUniformBlockBindingPoint(const NameHandle& uniformBl
 }
 
 std::shared_ptr<IRenderPipelineReflection> RenderPipelineState::renderPipelineReflection() {
+  resolvePendingReflection();
   return reflection_;
 }
 
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <bitset>
 #include <unordered_map>
 #include <igl/NameHandle.h>
 #include <igl/RenderPipelineState.h>
@@ -18,6 +19,8 @@
 
 namespace igl::opengl {
 
+class VertexArrayObjectCache;
+
 struct BlendMode {
   GLenum blendOpColor;
   GLenum blendOpAlpha;
@@ -31,6 +34,8 @@ class RenderPipelineState final : public WithContext, public IRenderPipelineStat
   friend class Device;
 
   Result create();
+  Result createReflection() const;
+  void resolvePendingReflection() const;
 
  public:
   explicit RenderPipelineState(IContext& context,
@@ -48,6 +53,9 @@ class RenderPipelineState final : public WithContext, public IRenderPipelineStat
   [[nodiscard]] bool matchesShaderProgram(const RenderPipelineState& rhs) const;
   [[nodiscard]] bool matchesVertexInputState(const RenderPipelineState& rhs) const;
 
+  /// Polls the shader stages and finishes creating the pipeline once they are linked
+  [[nodiscard]] bool isReady() const override;
+
   [[nodiscard]] int getIndexByName(const NameHandle& name, ShaderStage stage) const override;
   [[nodiscard]] int getIndexByName(const std::string& name, ShaderStage stage) const override;
 
@@ -82,14 +90,35 @@ class RenderPipelineState final : public WithContext, public IRenderPipelineStat
 
   void unbindPrevPipelineVertexAttributes();
 
+  /// Buffer indices which feed at least one attribute of the vertex shader
+  [[nodiscard]] const std::bitset<IGL_BUFFER_BINDINGS_MAX>& getVertexBufferMask() const {
+    resolvePendingReflection();
+    return vertexBufferMask_;
+  }
+
+  /// Returns the id of this pipeline's vertex attribute layout in `cache`
+  [[nodiscard]] uint32_t getVertexLayoutId(VertexArrayObjectCache& cache);
+
+  /// Returns the link result of a program linked in parallel, or Ok. Finishes a pending link. A
+  /// pipeline whose program failed to link is never bound and draws with it are skipped.
+  [[nodiscard]] Result getLinkResult() const {
+    resolvePendingReflection();
+    return linkResult_;
+  }
+
  private:
   // Tracks a list of attribute locations associated with a bufferIndex
-  std::vector<int> bufferAttribLocations_[IGL_BUFFER_BINDINGS_MAX];
-
-  std::shared_ptr<RenderPipelineReflection> reflection_;
-  std::unordered_map<size_t, size_t> vertexTextureUnitRemap_;
-  std::array<GLint, IGL_TEXTURE_SAMPLERS_MAX> unitSamplerLocationMap_{};
-  std::unordered_map<int, size_t> uniformBlockBindingMap_;
+  // the state derived from the linked program is mutable: with parallel shader compilation it is
+  // created by the first (possibly const) call which needs it, see resolvePendingReflection()
+  mutable std::vector<int> bufferAttribLocations_[IGL_BUFFER_BINDINGS_MAX];
+  mutable std::bitset<IGL_BUFFER_BINDINGS_MAX> vertexBufferMask_;
+  uint64_t vertexLayoutCacheId_ = 0; // VertexArrayObjectCache::getCacheId(), 0 if not resolved
+  uint32_t vertexLayoutId_ = 0;
+
+  mutable std::shared_ptr<RenderPipelineReflection> reflection_;
+  mutable std::unordered_map<size_t, size_t> vertexTextureUnitRemap_;
+  mutable std::array<GLint, IGL_TEXTURE_SAMPLERS_MAX> unitSamplerLocationMap_{};
+  mutable std::unordered_map<int, size_t> uniformBlockBindingMap_;
   std::array<GLboolean, 4> colorMask_ = {GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE};
   std::vector<int> prevPipelineStateAttributesLocations_;
   std::vector<int> activeAttributesLocations_;
@@ -101,6 +130,10 @@ class RenderPipelineState final : public WithContext, public IRenderPipelineStat
                           .dstAlpha = GL_ZERO};
   bool blendEnabled_ = false;
   bool uniformBlockBindingPointSet_ = false;
+  // set while the shader stages are linked in parallel; the state derived from the linked program
+  // is created by the first call which needs it
+  mutable bool reflectionPending_ = false;
+  mutable Result linkResult_;
 };
 
 } // namespace igl::opengl
@@ -20,6 +20,23 @@
 
 namespace igl::opengl {
 
+namespace {
+
+std::string getShaderInfoLog(IContext& context, GLuint shaderID) {
+  // Get the size of log
+  GLsizei logSize = 0;
+  context.getShaderiv(shaderID, GL_INFO_LOG_LENGTH, &logSize);
+
+  // Pre-allocate vector for storage
+  std::vector<GLchar> log(logSize);
+  context.getShaderInfoLog(shaderID, logSize, nullptr, log.data());
+
+  // Create actual string from it
+  return {log.begin(), log.end()};
+}
+
+} // namespace
+
 ShaderStages::ShaderStages(const ShaderStagesDesc& desc, IContext& context) :
   IShaderStages(desc), WithContext(context) {}
 
@@ -74,6 +91,14 @@ void ShaderStages::createRenderProgram(Result* result) {
   getContext().detachShader(programID, vertexShaderID);
   getContext().detachShader(programID, fragmentShaderID);
 
+  // promoted uniforms need a linked program, so only defer linking without them
+  if (vertexShader.getPromotedUniformBlock().empty() &&
+      fragmentShader.getPromotedUniformBlock().empty() && deferLinkStatus(programID)) {
+    promotedUniforms_.reset();
+    Result::setResult(result, Result::Code::Ok);
+    return;
+  }
+
   // check to see if the linking succeeded
   GLint status = 0;
   getContext().getProgramiv(programID, GL_LINK_STATUS, &status);
@@ -92,6 +117,19 @@ void ShaderStages::createRenderProgram(Result* result) {
   }
   programID_ = programID;
 
+  promotedUniforms_.reset();
+  if (!vertexShader.getPromotedUniformBlock().empty() ||
+      !fragmentShader.getPromotedUniformBlock().empty()) {
+    promotedUniforms_ = std::make_unique<PromotedUniforms>(getContext(),
+                                                           vertexShader.getPromotedUniformBlock(),
+                                                           fragmentShader.getPromotedUniformBlock());
+    Result promotedResult = promotedUniforms_->initialize(programID_);
+    if (!promotedResult.isOk()) {
+      Result::setResult(result, std::move(promotedResult));
+      return;
+    }
+  }
+
   Result::setResult(result, Result::Code::Ok);
 }
 
@@ -128,6 +166,11 @@ void ShaderStages::createComputeProgram(Result* result) {
   // detach the shaders now that they've been linked
   getContext().detachShader(programID, shaderID);
 
+  if (deferLinkStatus(programID)) {
+    Result::setResult(result, Result::Code::Ok);
+    return;
+  }
+
   // check to see if the linking succeeded
   GLint status = 0;
   getContext().getProgramiv(programID, GL_LINK_STATUS, &status);
@@ -149,6 +192,59 @@ void ShaderStages::createComputeProgram(Result* result) {
   Result::setResult(result, Result::Code::Ok);
 }
 
+bool ShaderStages::deferLinkStatus(GLuint programID) {
+  if (!getContext().isParallelShaderCompileEnabled()) {
+    return false;
+  }
+
+  // the link status is queried by isReady() or waitForLink()
+  if (programID_ != 0) {
+    getContext().deleteProgram(programID_);
+  }
+  programID_ = programID;
+  linkPending_ = true;
+  linkResult_ = Result();
+  return true;
+}
+
+bool ShaderStages::isReady() const {
+  if (!linkPending_) {
+    return true;
+  }
+  GLint completed = GL_FALSE;
+  getContext().getProgramiv(programID_, GL_COMPLETION_STATUS_KHR, &completed);
+  if (completed == GL_FALSE) {
+    return false;
+  }
+  waitForLink();
+  return true;
+}
+
+Result ShaderStages::waitForLink() const {
+  if (!linkPending_) {
+    return linkResult_;
+  }
+  linkPending_ = false;
+
+  GLint status = 0;
+  getContext().getProgramiv(programID_, GL_LINK_STATUS, &status);
+  if (status == GL_FALSE) {
+    // compile errors of deferred shader modules surface here
+    std::string errorLog;
+    for (const auto* module : {getVertexModule().get(),
+                               getFragmentModule().get(),
+                               getComputeModule().get()}) {
+      if (module != nullptr) {
+        errorLog += static_cast<const ShaderModule*>(module)->getInfoLog();
+      }
+    }
+    errorLog += getProgramInfoLog(programID_);
+    IGL_LOG_ERROR("failed to link shaders:\n%s\n", errorLog.c_str());
+    linkResult_ = Result(Result::Code::RuntimeError, std::move(errorLog));
+  }
+  return linkResult_;
+}
+
 // link the given shaders into this shader program
 Result ShaderStages::create(const ShaderStagesDesc& /*desc*/) {
   Result result;
@@ -177,6 +273,11 @@ Result ShaderStages::validate() const {
 }
 
 void ShaderStages::bind() const {
+  if (!waitForLink().isOk()) {
+    // never make a program which failed to link current
+    getContext().useProgram(0);
+    return;
+  }
   getContext().useProgram(programID_);
 }
 
@@ -243,8 +344,17 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
     getContext().objectLabel(identifier, shaderID, desc.debugName.size(), desc.debugName.c_str());
   }
 
+  // move loose uniforms into a uniform block if requested
+  PromotedUniforms::StageBlock promotedBlock;
+  std::string promotedSource;
+  if (getContext().isUniformBlockPromotionEnabled() && shaderType_ != GL_COMPUTE_SHADER &&
+      getContext().deviceFeatures().hasFeature(DeviceFeatures::UniformBlocks)) {
+    promotedSource =
+        PromotedUniforms::rewriteShaderSource(desc.input.source, desc.info.stage, promotedBlock);
+  }
+
   // compile the shader
-  const GLchar* src = desc.input.source;
+  const GLchar* src = promotedSource.empty() ? desc.input.source : promotedSource.c_str();
 
 #if IGL_SHADER_DUMP
   auto hash = std::hash<const GLchar*>()(src);
@@ -277,20 +387,23 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
   getContext().shaderSource(shaderID, 1, &src, nullptr);
   getContext().compileShader(shaderID);
 
-  // see if the compilation succeeded
-  GLint status = 0;
-  getContext().getShaderiv(shaderID, GL_COMPILE_STATUS, &status);
+  // see if the compilation succeeded; with parallel compilation the status is not queried here
+  // since that would block until the compiler is done, errors are reported when linking instead
+  GLint status = GL_TRUE;
+  if (!getContext().isParallelShaderCompileEnabled() || !promotedSource.empty()) {
+    getContext().getShaderiv(shaderID, GL_COMPILE_STATUS, &status);
+  }
+  if (status == GL_FALSE && !promotedSource.empty()) {
+    // the rewritten source was rejected; fall back to the original one
+    IGL_LOG_INFO("Uniform block promotion failed for shader %s\n", desc.debugName.c_str());
+    promotedBlock = {};
+    src = desc.input.source;
+    getContext().shaderSource(shaderID, 1, &src, nullptr);
+    getContext().compileShader(shaderID);
+    getContext().getShaderiv(shaderID, GL_COMPILE_STATUS, &status);
+  }
   if (status == GL_FALSE) {
-    // Get the size of log
-    GLsizei logSize = 0;
-    getContext().getShaderiv(shaderID, GL_INFO_LOG_LENGTH, &logSize);
-
-    // Pre-allocate vector for storage
-    std::vector<GLchar> log(logSize);
-    getContext().getShaderInfoLog(shaderID, logSize, nullptr, log.data());
-
-    // Create actual string from it
-    const std::string errorLog(log.begin(), log.end());
+    const std::string errorLog = getShaderInfoLog(getContext(), shaderID);
     IGL_LOG_ERROR("failed to compile %s shader:\n%s\nSource\n%s",
                   (shaderType_ == GL_VERTEX_SHADER ? "vertex" : "fragment"),
                   errorLog.c_str(),
@@ -308,6 +421,7 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
     getContext().deleteShader(shaderID_);
   }
   shaderID_ = shaderID;
+  promotedBlock_ = std::move(promotedBlock);
 
   hash_ =
       std::hash<std::string_view>()(std::string_view(desc.input.source, strlen(desc.input.source)));
@@ -315,6 +429,10 @@ Result ShaderModule::create(const ShaderModuleDesc& desc) {
   return Result();
 }
 
+std::string ShaderModule::getInfoLog() const {
+  return getShaderInfoLog(getContext(), shaderID_);
+}
+
 std::string ShaderStages::getProgramInfoLog(GLuint programID) const {
   // Get the size of log
   GLsizei logSize = 0;
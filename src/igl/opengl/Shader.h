@@ -8,10 +8,12 @@
 #pragma once
 
 #include <cstdlib>
+#include <memory>
 #include <unordered_map>
 #include <igl/Shader.h>
 #include <igl/opengl/GLIncludes.h>
 #include <igl/opengl/IContext.h>
+#include <igl/opengl/PromotedUniforms.h>
 
 namespace igl {
 class ICommandBuffer;
@@ -36,6 +38,14 @@ class ShaderModule : public WithContext, public IShaderModule {
     return hash_;
   }
 
+  /// Returns the compile log of the shader
+  [[nodiscard]] std::string getInfoLog() const;
+
+  /// Uniforms moved into a uniform block when uniform block promotion is enabled
+  [[nodiscard]] const PromotedUniforms::StageBlock& getPromotedUniformBlock() const {
+    return promotedBlock_;
+  }
+
   ShaderModule(IContext& context, ShaderModuleInfo info);
 
   ShaderModule(const ShaderModule&) = delete;
@@ -52,6 +62,8 @@ class ShaderModule : public WithContext, public IShaderModule {
 
   // Hash of the shader source
   size_t hash_ = 0;
+
+  PromotedUniforms::StageBlock promotedBlock_;
 };
 
 class ShaderStages final : public IShaderStages, public WithContext {
@@ -72,17 +84,35 @@ class ShaderStages final : public IShaderStages, public WithContext {
   void bind() const;
   void unbind() const;
 
+  /// Polls GL_COMPLETION_STATUS_KHR while the program is linked in parallel
+  [[nodiscard]] bool isReady() const override;
+
+  /// Blocks until the program is linked and returns the result of compiling and linking it
+  Result waitForLink() const;
+
   [[nodiscard]] GLuint getProgramID() const {
     return programID_;
   }
 
+  /// Returns nullptr unless some uniforms of the shader modules were promoted to uniform blocks
+  [[nodiscard]] PromotedUniforms* IGL_NULLABLE getPromotedUniforms() const {
+    return promotedUniforms_.get();
+  }
+
  private:
   void createRenderProgram(Result* result);
   void createComputeProgram(Result* result);
+  [[nodiscard]] bool deferLinkStatus(GLuint programID);
   [[nodiscard]] std::string getProgramInfoLog(GLuint programID) const;
 
   // the GL shader program ID
   GLuint programID_ = 0;
+
+  // set while programID_ is linked in parallel and its link status was not queried yet
+  mutable bool linkPending_ = false;
+  mutable Result linkResult_;
+
+  std::unique_ptr<PromotedUniforms> promotedUniforms_;
 };
 
 } // namespace opengl
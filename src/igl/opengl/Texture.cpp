@@ -480,6 +480,12 @@ bool Texture::toFormatDescGL(const IContext& ctx,
     internalFormat = GL_RGB10_A2;
     return true;
 
+  case TextureFormat::R9G9B9E5_F:
+    format = GL_RGB;
+    type = GL_UNSIGNED_INT_5_9_9_9_REV;
+    internalFormat = GL_RGB9_E5;
+    return true;
+
   case TextureFormat::ABGR_UNorm4: // TODO Test this
     format = GL_RGBA;
     type = GL_UNSIGNED_SHORT_4_4_4_4;
@@ -13,6 +13,8 @@ namespace igl::opengl {
 
 // TextureBufferBase encapsulates OpenGL textures
 class TextureBufferBase : public Texture {
+  friend class TextureUploader;
+
   using Super = Texture;
 
  public:
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/opengl/TextureUploader.h>
+
+#include <cstring>
+#include <igl/opengl/DeviceFeatureSet.h>
+#include <igl/opengl/IContext.h>
+#include <igl/opengl/TextureBufferBase.h>
+
+namespace igl::opengl {
+
+TextureUploader::TextureUploader(IContext& context) : WithContext(context) {
+  Result result;
+  // Creating the shared context may make it current on this thread.
+  sharedContext_ = context.createShareContext(&result);
+  if (!result.isOk() || sharedContext_ == nullptr) {
+    IGL_LOG_INFO("[IGL] Shared context unavailable, texture uploads are synchronous: %s\n",
+                 result.message.c_str());
+    sharedContext_ = nullptr;
+    context.setCurrent();
+    return;
+  }
+  // A context can only be current on one thread, so hand the shared context over to the worker.
+  sharedContext_->clearCurrentContext();
+  context.setCurrent();
+
+  worker_ = std::thread([this]() { workerLoop(); });
+}
+
+TextureUploader::~TextureUploader() {
+  if (worker_.joinable()) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    jobAvailable_.notify_one();
+    worker_.join();
+  }
+  // The worker executed every pending upload before exiting.
+  synchronize();
+}
+
+TextureUploader::UploadId TextureUploader::upload(std::shared_ptr<ITexture> texture,
+                                                  const TextureRangeDesc& range,
+                                                  const void* IGL_NONNULL data,
+                                                  size_t bytesPerRow,
+                                                  bool generateMipmaps) {
+  IGL_DEBUG_ASSERT(texture != nullptr && data != nullptr);
+  IGL_DEBUG_ASSERT(texture->validateRange(range).isOk());
+
+  Job job;
+  job.id = nextId_++;
+  job.texture = std::move(texture);
+  job.range = range;
+  job.bytesPerRow = bytesPerRow;
+  job.generateMipmaps = generateMipmaps;
+
+  if (!isAsync()) {
+    // Upload straight from the caller's memory, there is no need for a copy.
+    const auto result = job.texture->upload(range, data, bytesPerRow);
+    if (!result.isOk()) {
+      IGL_LOG_ERROR("[IGL] Texture upload failed: %s\n", result.message.c_str());
+    }
+    if (generateMipmaps) {
+      static_cast<const TextureBufferBase&>(*job.texture).generateMipmap();
+    }
+    lastSynchronizedId_ = job.id;
+    return job.id;
+  }
+
+  const size_t numBytes =
+      job.texture->getProperties().getBytesPerRange(range, static_cast<uint32_t>(bytesPerRow));
+  job.data.resize(numBytes);
+  std::memcpy(job.data.data(), data, numBytes);
+
+  const UploadId id = job.id;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    pendingJobs_.push_back(std::move(job));
+  }
+  jobAvailable_.notify_one();
+  return id;
+}
+
+TextureUploader::UploadId TextureUploader::synchronize() {
+  std::deque<FinishedJob> finishedJobs;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    finishedJobs.swap(finishedJobs_);
+  }
+
+  auto& context = getContext();
+  for (const auto& finished : finishedJobs) {
+    if (finished.sync != nullptr) {
+      // The render context waits on the GPU, this does not block the calling thread.
+      context.waitSync(finished.sync, 0, GL_TIMEOUT_IGNORED);
+      context.deleteSync(finished.sync);
+    }
+    lastSynchronizedId_ = finished.id;
+  }
+  return lastSynchronizedId_;
+}
+
+void TextureUploader::wait(UploadId id) {
+  IGL_DEBUG_ASSERT(id < nextId_, "Waiting for an upload which was never queued");
+  if (isComplete(id)) {
+    return;
+  }
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    jobFinished_.wait(lock, [this, id]() { return lastFinishedId_ >= id; });
+  }
+  synchronize();
+}
+
+void TextureUploader::run(const Job& job) {
+  const auto result = job.texture->upload(job.range, job.data.data(), job.bytesPerRow);
+  if (!result.isOk()) {
+    IGL_LOG_ERROR("[IGL] Texture upload failed: %s\n", result.message.c_str());
+  }
+  if (job.generateMipmaps) {
+    static_cast<const TextureBufferBase&>(*job.texture).generateMipmap();
+  }
+}
+
+void TextureUploader::workerLoop() {
+  auto& context = *sharedContext_;
+  context.setCurrent();
+  const bool hasSync = context.deviceFeatures().hasInternalFeature(InternalFeatures::Sync);
+  {
+    // Textures were created with the render context; route their GL calls to the shared one.
+    const WithContext::ScopedSharedContext scopedContext(context);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      jobAvailable_.wait(lock, [this]() { return stopping_ || !pendingJobs_.empty(); });
+      if (pendingJobs_.empty()) {
+        break;
+      }
+      Job job = std::move(pendingJobs_.front());
+      pendingJobs_.pop_front();
+      lock.unlock();
+
+      run(job);
+
+      FinishedJob finished;
+      finished.id = job.id;
+      // The last reference to the texture is released on the render thread.
+      finished.texture = std::move(job.texture);
+      if (hasSync) {
+        finished.sync = context.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // The fence has to reach the GPU before another context can wait for it.
+        context.flush();
+      } else {
+        context.finish();
+      }
+
+      lock.lock();
+      lastFinishedId_ = finished.id;
+      finishedJobs_.push_back(std::move(finished));
+      jobFinished_.notify_all();
+    }
+  }
+  context.clearCurrentContext();
+}
+
+} // namespace igl::opengl
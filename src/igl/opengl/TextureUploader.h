@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <igl/Texture.h>
+#include <igl/opengl/GLIncludes.h>
+#include <igl/opengl/WithContext.h>
+
+namespace igl::opengl {
+
+class IContext;
+
+/// Uploads texture data on a worker thread that owns a GL context shared with the render context.
+///
+/// The worker performs glTex(Sub)Image* and mipmap generation and publishes every finished upload
+/// through a glFenceSync. The render thread calls synchronize() once per frame (or wait() for a
+/// particular upload), which makes the render context wait for those fences with glWaitSync. The
+/// wait happens on the GPU, so large texture loads no longer stall the render thread.
+///
+/// A texture must not be used for rendering until its upload completed (see isComplete()). When the
+/// platform cannot create a shared context, uploads run synchronously on the calling thread.
+///
+/// With GLX, the shared context uses the X connection of the render context from another thread,
+/// so the application has to call XInitThreads() before any other Xlib call.
+class TextureUploader final : public WithContext {
+ public:
+  using UploadId = uint64_t;
+
+  /// Must be called on the render thread with `context` current.
+  explicit TextureUploader(IContext& context);
+  ~TextureUploader() override;
+
+  TextureUploader(const TextureUploader&) = delete;
+  TextureUploader& operator=(const TextureUploader&) = delete;
+  TextureUploader(TextureUploader&&) = delete;
+  TextureUploader& operator=(TextureUploader&&) = delete;
+
+  /// Returns true when uploads are performed by the worker thread.
+  [[nodiscard]] bool isAsync() const {
+    return sharedContext_ != nullptr;
+  }
+
+  /// Copies `data` and queues an upload of `range` into `texture`. When `generateMipmaps` is set,
+  /// the remaining mip levels are generated on the worker after the upload.
+  /// @return An id which can be passed to isComplete() and wait().
+  UploadId upload(std::shared_ptr<ITexture> texture,
+                  const TextureRangeDesc& range,
+                  const void* IGL_NONNULL data,
+                  size_t bytesPerRow = 0,
+                  bool generateMipmaps = false);
+
+  /// Makes the render context wait for all uploads finished by the worker so far.
+  /// @return The id of the latest upload that can be used by the render context.
+  UploadId synchronize();
+
+  /// Blocks until upload `id` is finished by the worker, then synchronizes.
+  void wait(UploadId id);
+
+  /// Returns true once upload `id` was synchronized with the render context.
+  [[nodiscard]] bool isComplete(UploadId id) const {
+    return id <= lastSynchronizedId_;
+  }
+
+ private:
+  struct Job {
+    UploadId id = 0;
+    std::shared_ptr<ITexture> texture;
+    TextureRangeDesc range;
+    std::vector<uint8_t> data;
+    size_t bytesPerRow = 0;
+    bool generateMipmaps = false;
+  };
+
+  struct FinishedJob {
+    UploadId id = 0;
+    std::shared_ptr<ITexture> texture;
+    GLsync IGL_NULLABLE sync = nullptr;
+  };
+
+  static void run(const Job& job);
+  void workerLoop();
+
+  std::unique_ptr<IContext> sharedContext_;
+  std::thread worker_;
+
+  std::mutex mutex_;
+  std::condition_variable jobAvailable_;
+  std::condition_variable jobFinished_;
+  std::deque<Job> pendingJobs_;
+  std::deque<FinishedJob> finishedJobs_;
+  UploadId lastFinishedId_ = 0;
+  bool stopping_ = false;
+
+  // only accessed on the render thread
+  UploadId nextId_ = 1;
+  UploadId lastSynchronizedId_ = 0;
+};
+
+} // namespace igl::opengl
@@ -8,6 +8,7 @@
 #include <igl/opengl/UniformAdapter.h>
 
 #include <igl/opengl/Buffer.h>
+#include <igl/opengl/PromotedUniforms.h>
 #include <igl/opengl/UniformBuffer.h>
 
 namespace igl::opengl {
@@ -146,13 +147,18 @@ void UniformAdapter::setUniformBuffer(IBuffer* buffer,
   }
 }
 
-void UniformAdapter::bindToPipeline(IContext& context) {
+void UniformAdapter::bindToPipeline(IContext& context,
+                                    PromotedUniforms* IGL_NULLABLE promotedUniforms,
+                                    bool forceBind) {
   // bind uniforms
   for (const auto& uniform : uniforms_) {
     const auto& uniformDesc = uniform.desc;
     IGL_DEBUG_ASSERT(uniformDesc.location >= 0);
     IGL_DEBUG_ASSERT(uniformData_.data(), "Uniform data must be non-null");
     auto* start = uniformData_.data() + uniform.dataOffset;
+    if (promotedUniforms && promotedUniforms->setUniform(uniformDesc, start)) {
+      continue;
+    }
     if (uniformDesc.numElements > 1 || uniformDesc.type == UniformType::Mat3x3) {
       IGL_DEBUG_ASSERT(uniformDesc.elementStride > 0,
                        "stride has to be larger than 0 for uniform at offset %zu",
@@ -172,6 +178,10 @@ void UniformAdapter::bindToPipeline(IContext& context) {
   std::fill(uniformsDirty_.begin(), uniformsDirty_.end(), false);
 #endif
 
+  if (promotedUniforms) {
+    promotedUniforms->bind(forceBind);
+  }
+
   // bind uniform block buffers
   for (size_t bindingIndex = 0; bindingIndex < IGL_UNIFORM_BLOCKS_BINDING_MAX; ++bindingIndex) {
     if (uniformBuffersDirtyMask_ & (1 << bindingIndex)) {
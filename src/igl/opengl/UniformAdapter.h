@@ -14,6 +14,7 @@
 
 namespace igl::opengl {
 class IContext;
+class PromotedUniforms;
 
 class UniformAdapter {
  public:
@@ -37,7 +38,12 @@ class UniformAdapter {
     return maxUniforms_;
   }
 
-  void bindToPipeline(IContext& context);
+  /// Issues the queued uniforms. Uniforms promoted to uniform blocks are written to
+  /// `promotedUniforms` instead, whose blocks are then uploaded and bound; `forceBind` rebinds them
+  /// even if unmodified, e.g. after a pipeline change.
+  void bindToPipeline(IContext& context,
+                      PromotedUniforms* IGL_NULLABLE promotedUniforms = nullptr,
+                      bool forceBind = false);
 
  private:
   struct UniformState {
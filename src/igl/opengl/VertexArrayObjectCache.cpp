@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/opengl/VertexArrayObjectCache.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <igl/opengl/IContext.h>
+#include <igl/opengl/VertexArrayObject.h>
+
+namespace igl::opengl {
+
+namespace {
+
+std::atomic<uint64_t> nextCacheId{1};
+
+void hashCombine(size_t& seed, size_t value) {
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+bool referencesBuffer(const VertexArrayObjectCache::Key& key, GLuint buffer) {
+  if (key.indexBuffer == buffer) {
+    return true;
+  }
+  return std::any_of(key.vertexBuffers.begin(),
+                     key.vertexBuffers.end(),
+                     [buffer](const auto& binding) { return binding.buffer == buffer; });
+}
+
+} // namespace
+
+size_t VertexArrayObjectCache::KeyHash::operator()(const Key& key) const {
+  size_t hash = key.layoutId;
+  hashCombine(hash, key.indexBuffer);
+  for (size_t i = 0; i != key.vertexBuffers.size(); i++) {
+    const VertexBufferBinding& binding = key.vertexBuffers[i];
+    if (binding.buffer) {
+      hashCombine(hash, i);
+      hashCombine(hash, binding.buffer);
+      hashCombine(hash, binding.offset);
+    }
+  }
+  return hash;
+}
+
+VertexArrayObjectCache::VertexArrayObjectCache(IContext& context) :
+  context_(context), cacheId_(nextCacheId.fetch_add(1, std::memory_order_relaxed)) {}
+
+VertexArrayObjectCache::~VertexArrayObjectCache() {
+  clear();
+}
+
+uint32_t VertexArrayObjectCache::getLayoutId(const std::vector<uint32_t>& layoutSignature) {
+  const auto it = layoutIds_.find(layoutSignature);
+  if (it != layoutIds_.end()) {
+    return it->second;
+  }
+  const auto id = static_cast<uint32_t>(layoutIds_.size());
+  layoutIds_.emplace(layoutSignature, id);
+  return id;
+}
+
+VertexArrayObjectCache::Entry* IGL_NULLABLE VertexArrayObjectCache::getOrCreate(const Key& key,
+                                                                                 bool& outCreated) {
+  outCreated = false;
+
+  const auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    stats_.numHits++;
+    it->second.lastUsed = ++useCounter_;
+    return &it->second;
+  }
+
+  stats_.numMisses++;
+
+  if (entries_.size() >= kMaxEntries) {
+    evictLeastRecentlyUsed();
+  }
+
+  auto vao = std::make_unique<VertexArrayObject>(context_);
+  const Result result = vao->create();
+  if (!result.isOk()) {
+    IGL_LOG_ERROR("VertexArrayObjectCache: %s\n", result.message.c_str());
+    return nullptr;
+  }
+
+  addBufferRefs(key);
+
+  Entry& entry = entries_[key];
+  entry.vao = std::move(vao);
+  entry.lastUsed = ++useCounter_;
+  outCreated = true;
+
+  return &entry;
+}
+
+void VertexArrayObjectCache::bind(Entry& entry) {
+  entry.vao->bind();
+  boundEntry_ = &entry;
+}
+
+void VertexArrayObjectCache::onBuffersDeleted(GLsizei n, const GLuint* IGL_NULLABLE buffers) {
+  if (!buffers || bufferRefs_.empty()) {
+    return;
+  }
+  for (GLsizei i = 0; i != n; i++) {
+    const GLuint buffer = buffers[i];
+    if (buffer == 0 || bufferRefs_.find(buffer) == bufferRefs_.end()) {
+      continue;
+    }
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (referencesBuffer(it->first, buffer)) {
+        stats_.numInvalidations++;
+        auto next = std::next(it);
+        erase(it);
+        it = next;
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+void VertexArrayObjectCache::clear() {
+  if (entries_.empty()) {
+    return;
+  }
+  entries_.clear();
+  bufferRefs_.clear();
+  boundEntry_ = nullptr;
+  generation_++;
+}
+
+void VertexArrayObjectCache::addBufferRefs(const Key& key) {
+  if (key.indexBuffer) {
+    bufferRefs_[key.indexBuffer]++;
+  }
+  for (const VertexBufferBinding& binding : key.vertexBuffers) {
+    if (binding.buffer) {
+      bufferRefs_[binding.buffer]++;
+    }
+  }
+}
+
+void VertexArrayObjectCache::removeBufferRefs(const Key& key) {
+  const auto release = [this](GLuint buffer) {
+    auto it = bufferRefs_.find(buffer);
+    if (IGL_DEBUG_VERIFY(it != bufferRefs_.end()) && --it->second == 0) {
+      bufferRefs_.erase(it);
+    }
+  };
+  if (key.indexBuffer) {
+    release(key.indexBuffer);
+  }
+  for (const VertexBufferBinding& binding : key.vertexBuffers) {
+    if (binding.buffer) {
+      release(binding.buffer);
+    }
+  }
+}
+
+void VertexArrayObjectCache::erase(EntryMap::iterator it) {
+  if (boundEntry_ == &it->second) {
+    // deleting a bound VAO reverts the binding to zero
+    boundEntry_ = nullptr;
+  }
+  removeBufferRefs(it->first);
+  entries_.erase(it);
+  generation_++;
+}
+
+void VertexArrayObjectCache::evictLeastRecentlyUsed() {
+  auto lru = std::min_element(entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+    return a.second.lastUsed < b.second.lastUsed;
+  });
+  if (lru != entries_.end()) {
+    stats_.numEvictions++;
+    erase(lru);
+  }
+}
+
+} // namespace igl::opengl
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <igl/Common.h>
+#include <igl/opengl/GLIncludes.h>
+
+namespace igl::opengl {
+
+class IContext;
+class VertexArrayObject;
+
+/**
+ * @brief Caches vertex array objects keyed by vertex layout and bound buffers.
+ *
+ * Each VAO captures the attribute pointers, enables and divisors of one vertex layout applied to
+ * one set of vertex buffers, plus the element array buffer. Drawing the same mesh with the same
+ * vertex layout again only needs a glBindVertexArray() instead of re-specifying every attribute.
+ *
+ * Entries referencing a buffer are dropped when the buffer is deleted, since GL buffer names can
+ * be reused. Entries may also be evicted when the cache is full; any removal bumps the generation
+ * so users holding an Entry pointer know to look it up again.
+ */
+class VertexArrayObjectCache final {
+ public:
+  struct VertexBufferBinding {
+    GLuint buffer = 0;
+    size_t offset = 0;
+
+    bool operator==(const VertexBufferBinding& other) const = default;
+  };
+
+  struct Key {
+    /// Identifies the attribute layout (locations, formats, strides, divisors) of a pipeline
+    uint32_t layoutId = 0;
+    GLuint indexBuffer = 0;
+    std::array<VertexBufferBinding, IGL_BUFFER_BINDINGS_MAX> vertexBuffers{};
+
+    bool operator==(const Key& other) const = default;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Entry {
+    std::unique_ptr<VertexArrayObject> vao;
+    uint64_t lastUsed = 0;
+    /// False when the element array buffer binding of this VAO may have been overwritten, e.g. by
+    /// an index buffer upload while this VAO was bound
+    bool isIndexBufferBound = false;
+  };
+
+  struct Stats {
+    uint64_t numHits = 0;
+    uint64_t numMisses = 0;
+    uint64_t numEvictions = 0;
+    uint64_t numInvalidations = 0;
+  };
+
+  static constexpr size_t kMaxEntries = 512;
+
+  explicit VertexArrayObjectCache(IContext& context);
+  ~VertexArrayObjectCache();
+  VertexArrayObjectCache(const VertexArrayObjectCache&) = delete;
+  VertexArrayObjectCache& operator=(const VertexArrayObjectCache&) = delete;
+  VertexArrayObjectCache(VertexArrayObjectCache&&) = delete;
+  VertexArrayObjectCache& operator=(VertexArrayObjectCache&&) = delete;
+
+  /// Returns a stable id for a flattened vertex layout. Identical layouts share the same id, so
+  /// pipelines with the same vertex input state and attribute locations share VAOs.
+  [[nodiscard]] uint32_t getLayoutId(const std::vector<uint32_t>& layoutSignature);
+
+  /// Identifies this cache and its layout ids. Unlike the address of the cache, it is never reused
+  /// by another cache, so layout ids remembered by a pipeline cannot be mistaken for a new cache's.
+  [[nodiscard]] uint64_t getCacheId() const {
+    return cacheId_;
+  }
+
+  /// Returns the entry for `key`, creating a new VAO on a miss. `outCreated` is set to true when
+  /// the caller has to specify the vertex attributes of the new VAO. Returns nullptr if the VAO
+  /// cannot be created.
+  [[nodiscard]] Entry* IGL_NULLABLE getOrCreate(const Key& key, bool& outCreated);
+
+  /// Binds the VAO of `entry` and tracks it as the currently bound entry
+  void bind(Entry& entry);
+  /// Stops tracking the currently bound entry; called when another VAO gets bound
+  void resetBoundEntry() {
+    boundEntry_ = nullptr;
+  }
+
+  /// Called by IContext when GL_ELEMENT_ARRAY_BUFFER is rebound, which modifies the bound VAO
+  void onElementArrayBufferBound() {
+    if (boundEntry_) {
+      boundEntry_->isIndexBufferBound = false;
+    }
+  }
+  /// Called by IContext when buffers are deleted; drops all entries referencing them
+  void onBuffersDeleted(GLsizei n, const GLuint* IGL_NULLABLE buffers);
+
+  /// Deletes all cached VAOs. Layout ids stay valid.
+  void clear();
+
+  [[nodiscard]] uint64_t getGeneration() const {
+    return generation_;
+  }
+  [[nodiscard]] size_t size() const {
+    return entries_.size();
+  }
+  [[nodiscard]] const Stats& getStats() const {
+    return stats_;
+  }
+
+ private:
+  using EntryMap = std::unordered_map<Key, Entry, KeyHash>;
+
+  void addBufferRefs(const Key& key);
+  void removeBufferRefs(const Key& key);
+  void erase(EntryMap::iterator it);
+  void evictLeastRecentlyUsed();
+
+  IContext& context_;
+  const uint64_t cacheId_;
+  EntryMap entries_;
+  // number of entries referencing each buffer, to skip the scan on deletion of unrelated buffers
+  std::unordered_map<GLuint, uint32_t> bufferRefs_;
+  std::map<std::vector<uint32_t>, uint32_t> layoutIds_;
+  Entry* IGL_NULLABLE boundEntry_ = nullptr;
+  uint64_t generation_ = 0;
+  uint64_t useCounter_ = 0;
+  Stats stats_;
+};
+
+} // namespace igl::opengl
@@ -11,6 +11,9 @@
 #include <igl/opengl/IContext.h>
 
 namespace igl::opengl {
+namespace {
+thread_local IContext* sharedContextOverride = nullptr;
+} // namespace
 
 WithContext::WithContext(IContext& context) : context_(&context) {
   if (!context_->addRef()) {
@@ -28,6 +31,9 @@ WithContext::~WithContext() {
 }
 
 IContext& WithContext::getContext() const {
+  if (sharedContextOverride != nullptr) {
+    return *sharedContextOverride;
+  }
   IGL_DEBUG_ASSERT(context_->isLikelyValidObject(),
                    "Accessing invalid IContext reference."
                    // @fb-only
@@ -35,4 +41,13 @@ IContext& WithContext::getContext() const {
   return *context_;
 }
 
+WithContext::ScopedSharedContext::ScopedSharedContext(IContext& sharedContext) :
+  previous_(sharedContextOverride) {
+  sharedContextOverride = &sharedContext;
+}
+
+WithContext::ScopedSharedContext::~ScopedSharedContext() {
+  sharedContextOverride = previous_;
+}
+
 } // namespace igl::opengl
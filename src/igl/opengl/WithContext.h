@@ -23,6 +23,21 @@ class WithContext {
 
   [[nodiscard]] IContext& getContext() const;
 
+  /// While in scope, getContext() returns `sharedContext` for every object used on the calling
+  /// thread. This lets a worker thread drive objects through a context shared with the one they
+  /// were created with.
+  class ScopedSharedContext {
+   public:
+    explicit ScopedSharedContext(IContext& sharedContext);
+    ~ScopedSharedContext();
+
+    ScopedSharedContext(const ScopedSharedContext&) = delete;
+    ScopedSharedContext& operator=(const ScopedSharedContext&) = delete;
+
+   private:
+    IContext* previous_;
+  };
+
  private:
   IContext* context_;
 };
@@ -143,7 +143,7 @@ Context::Context(std::shared_ptr<GLXSharedModule> module,
                  bool offscreen /* = false */,
                  uint32_t width /* = 0 */,
                  uint32_t height /* = 0 */) :
-  contextOwned_(true), offscreen_(offscreen), module_(std::move(module)) {
+  contextOwned_(true), displayOwned_(true), offscreen_(offscreen), module_(std::move(module)) {
   if (!module_) {
     module_ = std::make_shared<GLXSharedModule>();
   }
@@ -215,6 +215,38 @@ Context::Context(std::shared_ptr<GLXSharedModule> module,
   IGL_DEBUG_ASSERT(result.isOk(), result.message.c_str());
 }
 
+Context::Context(std::shared_ptr<GLXSharedModule> module,
+                 Display* display,
+                 GLXContext shareContext) :
+  contextOwned_(true), offscreen_(true), module_(std::move(module)), display_(display) {
+  static int visualAttribs[] = {None};
+  int contextAttribs[] = {GLX_CONTEXT_MAJOR_VERSION_ARB, 4, GLX_CONTEXT_MINOR_VERSION_ARB, 6, None};
+
+  int fbcount = 0;
+  GLXFBConfig* fbc =
+      module_->glXChooseFBConfig(display_, DefaultScreen(display_), visualAttribs, &fbcount);
+  if (fbc == nullptr) {
+    return;
+  }
+  contextHandle_ =
+      module_->glXCreateContextAttribsARB(display_, fbc[0], shareContext, True, contextAttribs);
+  if (contextHandle_ != nullptr) {
+    IContext::registerContext(contextHandle_, this);
+
+    int pbufferAttribs[] = {GLX_PBUFFER_WIDTH, 1, GLX_PBUFFER_HEIGHT, 1, None};
+    windowHandle_ = module_->glXCreatePbuffer(display_, fbc[0], pbufferAttribs);
+  }
+  module_->XFree(fbc);
+
+  if (contextHandle_ != nullptr) {
+    setCurrent();
+
+    Result result;
+    initialize(&result);
+    IGL_DEBUG_ASSERT(result.isOk(), result.message.c_str());
+  }
+}
+
 Context::~Context() {
   // Clear pool explicitly, since it might have reference back to IContext.
   getAdapterPool().clear();
@@ -224,7 +256,7 @@ Context::~Context() {
 
   // Destroy GLX.
   if (contextOwned_) {
-    if (offscreen_) {
+    if (offscreen_ && windowHandle_) {
       module_->glXDestroyPbuffer(display_, windowHandle_);
       windowHandle_ = 0;
     }
@@ -232,7 +264,7 @@ Context::~Context() {
       module_->glXDestroyContext(display_, contextHandle_);
       contextHandle_ = nullptr;
     }
-    if (display_) {
+    if (display_ && displayOwned_) {
       module_->XCloseDisplay(display_);
       display_ = nullptr;
     }
@@ -268,9 +300,16 @@ void Context::present(std::shared_ptr<ITexture> surface) const {
 }
 
 std::unique_ptr<IContext> Context::createShareContext(Result* outResult) {
-  IGL_DEBUG_ASSERT_NOT_IMPLEMENTED();
-  Result::setResult(outResult, Result::Code::Unimplemented, "Implement as needed");
-  return nullptr;
+  // The shared context uses the same X connection. Making it current on another thread requires
+  // the application to call XInitThreads() before any other Xlib call.
+  auto context =
+      std::unique_ptr<Context>(new Context(module_, display_, contextHandle_)); // NOLINT
+  if (context->contextHandle_ == nullptr) {
+    Result::setResult(outResult, Result::Code::RuntimeError, "Failed to create shared GLX context");
+    return nullptr;
+  }
+  Result::setOk(outResult);
+  return context;
 }
 
 std::shared_ptr<GLXSharedModule> Context::getSharedModule() const {
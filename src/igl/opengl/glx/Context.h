@@ -48,7 +48,11 @@ class Context : public IContext {
   std::shared_ptr<GLXSharedModule> getSharedModule() const;
 
  private:
+  /// Creates an offscreen context on `display` sharing objects with `shareContext`.
+  Context(std::shared_ptr<GLXSharedModule> module, Display* display, GLXContext shareContext);
+
   const bool contextOwned_ = false;
+  const bool displayOwned_ = false;
   const bool offscreen_ = false;
   std::shared_ptr<GLXSharedModule> module_;
   Display* display_ = nullptr;
@@ -94,6 +94,7 @@ namespace igl::opengl::util {
 #define GL_RGB16F 0x881B
 #define GL_RGB32F 0x8815
 #define GL_RGB5_A1 0x8057
+#define GL_RGB9_E5 0x8C3D
 #define GL_RGBA 0x1908
 #define GL_RGBA16F 0x881A
 #define GL_RGBA32F 0x8814
@@ -322,6 +323,9 @@ TextureFormat glTextureFormatToTextureFormat(int32_t glInternalFormat,
   case GL_RGB10_A2UI:
     return TextureFormat::RGB10_A2_Uint_Rev;
 
+  case GL_RGB9_E5:
+    return TextureFormat::R9G9B9E5_F;
+
   case GL_RGB10_A2:
     if (glFormat == GL_BGRA) {
       return TextureFormat::BGR10_A2_Unorm;
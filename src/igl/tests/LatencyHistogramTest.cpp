@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <shell/shared/renderSession/LatencyHistogram.h>
+
+namespace igl::tests {
+
+using shell::LatencyHistogram;
+
+namespace {
+
+// 1 / 2^(kSubBucketBits - 1)
+constexpr double kMaxRelativeError = 1.0 / (1u << (LatencyHistogram::kSubBucketBits - 1));
+
+double usToMs(uint64_t valueUs) {
+  return static_cast<double>(valueUs) / 1000.0;
+}
+
+} // namespace
+
+TEST(LatencyHistogramTest, Empty) {
+  const LatencyHistogram histogram;
+  EXPECT_EQ(histogram.getCount(), 0u);
+  EXPECT_EQ(histogram.getMinMs(), 0.0);
+  EXPECT_EQ(histogram.getMaxMs(), 0.0);
+  EXPECT_EQ(histogram.getMeanMs(), 0.0);
+  EXPECT_EQ(histogram.getValueAtPercentile(50.0), 0.0);
+  EXPECT_EQ(histogram.getCountAbove(0.0), 0u);
+}
+
+TEST(LatencyHistogramTest, ExactPercentiles) {
+  // values below 2^kSubBucketBits microseconds have their own bucket
+  LatencyHistogram histogram;
+  for (uint64_t valueUs = 1; valueUs <= 100; ++valueUs) {
+    histogram.record(usToMs(valueUs));
+  }
+  EXPECT_EQ(histogram.getCount(), 100u);
+  EXPECT_DOUBLE_EQ(histogram.getMinMs(), 0.001);
+  EXPECT_DOUBLE_EQ(histogram.getMaxMs(), 0.1);
+  EXPECT_NEAR(histogram.getMeanMs(), 0.0505, 1e-9);
+
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(0.0), 0.001);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(50.0), 0.050);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(95.0), 0.095);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(99.0), 0.099);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(99.9), 0.1);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(100.0), 0.1);
+  // out of range percentiles are clamped
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(-1.0), 0.001);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(200.0), 0.1);
+}
+
+TEST(LatencyHistogramTest, BucketRelativeError) {
+  // the second value only makes sure the reported value is not clamped to the maximum
+  constexpr uint64_t kLargeUs = 1ull << 30;
+  for (uint64_t valueUs = 1; valueUs < kLargeUs / 2; valueUs += 1 + valueUs / 7) {
+    LatencyHistogram histogram;
+    histogram.record(usToMs(valueUs));
+    histogram.record(usToMs(kLargeUs));
+    const double reportedMs = histogram.getValueAtPercentile(50.0);
+    ASSERT_GE(reportedMs, usToMs(valueUs)) << valueUs;
+    ASSERT_LE(reportedMs, usToMs(valueUs) * (1.0 + kMaxRelativeError)) << valueUs;
+  }
+}
+
+TEST(LatencyHistogramTest, BucketBoundaries) {
+  // the first value which is not stored exactly starts a bucket of width 2
+  constexpr uint64_t kFirstInexactUs = 1u << LatencyHistogram::kSubBucketBits;
+  LatencyHistogram histogram;
+  histogram.record(usToMs(kFirstInexactUs));
+  histogram.record(usToMs(kFirstInexactUs + 2));
+  histogram.record(1000.0);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(33.0), usToMs(kFirstInexactUs + 1));
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(66.0), usToMs(kFirstInexactUs + 3));
+}
+
+TEST(LatencyHistogramTest, ReportedValuesNeverExceedMax) {
+  LatencyHistogram histogram;
+  histogram.record(10.0);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(50.0), 10.0);
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(100.0), 10.0);
+}
+
+TEST(LatencyHistogramTest, ClampsInvalidAndHugeValues) {
+  LatencyHistogram histogram;
+  histogram.record(-1.0);
+  histogram.record(std::numeric_limits<double>::quiet_NaN());
+  EXPECT_EQ(histogram.getCount(), 2u);
+  EXPECT_EQ(histogram.getMaxMs(), 0.0);
+
+  histogram.record(1e12);
+  EXPECT_DOUBLE_EQ(histogram.getMaxMs(), usToMs(LatencyHistogram::kMaxValueUs));
+  EXPECT_DOUBLE_EQ(histogram.getValueAtPercentile(100.0),
+                   usToMs(LatencyHistogram::kMaxValueUs));
+}
+
+TEST(LatencyHistogramTest, CountAbove) {
+  LatencyHistogram histogram;
+  histogram.record(0.05);
+  histogram.record(0.1);
+  histogram.record(0.2);
+  histogram.record(50.0);
+  EXPECT_EQ(histogram.getCountAbove(0.0), 4u);
+  EXPECT_EQ(histogram.getCountAbove(0.1), 2u);
+  EXPECT_EQ(histogram.getCountAbove(16.6), 1u);
+  EXPECT_EQ(histogram.getCountAbove(100.0), 0u);
+}
+
+TEST(LatencyHistogramTest, MergeAndReset) {
+  LatencyHistogram a;
+  LatencyHistogram b;
+  for (uint64_t valueUs = 1; valueUs <= 50; ++valueUs) {
+    a.record(usToMs(valueUs));
+    b.record(usToMs(valueUs + 50));
+  }
+  a.merge(b);
+  EXPECT_EQ(a.getCount(), 100u);
+  EXPECT_DOUBLE_EQ(a.getMinMs(), 0.001);
+  EXPECT_DOUBLE_EQ(a.getMaxMs(), 0.1);
+  EXPECT_DOUBLE_EQ(a.getValueAtPercentile(50.0), 0.050);
+
+  const auto summary = a.summarize();
+  EXPECT_EQ(summary.count, 100u);
+  EXPECT_DOUBLE_EQ(summary.p95Ms, 0.095);
+  EXPECT_DOUBLE_EQ(summary.p99Ms, 0.099);
+
+  a.reset();
+  EXPECT_EQ(a.getCount(), 0u);
+  EXPECT_EQ(a.getValueAtPercentile(50.0), 0.0);
+}
+
+} // namespace igl::tests
@@ -7,9 +7,12 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <mutex>
 #include <random>
 #include <string>
 #include <thread>
+#include <vector>
 #include <igl/Core.h>
 
 namespace igl::tests {
@@ -42,6 +45,46 @@ int callLogV(IGLLogLevel logLevel, const char* IGL_RESTRICT format, ...) {
   va_end(ap);
   return result;
 }
+
+std::mutex asyncMessagesMutex;
+std::vector<std::string> asyncMessages;
+std::atomic<bool> asyncHandlerEntered = false;
+std::atomic<bool> asyncHandlerReleased = true;
+
+int asyncLogHandler(IGLLogLevel /*logLevel*/, const char* IGL_RESTRICT format, va_list ap) {
+  asyncHandlerEntered = true;
+  while (!asyncHandlerReleased) {
+    std::this_thread::yield();
+  }
+  char buffer[64];
+  FOLLY_PUSH_WARNING
+  FOLLY_GNU_DISABLE_WARNING("-Wformat-nonliteral")
+  vsnprintf(buffer, sizeof(buffer), format, ap);
+  FOLLY_POP_WARNING
+  const std::lock_guard<std::mutex> guard(asyncMessagesMutex);
+  asyncMessages.emplace_back(buffer);
+  return 0;
+}
+
+class LogAsyncTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    originalHandler_ = IGLLogGetHandler();
+    IGLLogSetHandler(asyncLogHandler);
+    asyncMessages.clear();
+    asyncHandlerEntered = false;
+    asyncHandlerReleased = true;
+  }
+
+  void TearDown() override {
+    asyncHandlerReleased = true;
+    IGLLogAsyncStop();
+    IGLLogSetHandler(originalHandler_);
+  }
+
+ private:
+  IGLLogHandlerFunc originalHandler_ = nullptr;
+};
 } // namespace
 
 TEST(LogTest, GetDefaultHandlerReturnsNonNull) {
@@ -136,4 +179,91 @@ TEST(LogTest, LogOnceRaceCondition) {
   t4.join();
 }
 
+TEST_F(LogAsyncTest, DeliversMessagesInOrder) {
+  ASSERT_TRUE(IGLLogAsyncStart({}));
+  EXPECT_TRUE(IGLLogAsyncIsRunning());
+  EXPECT_FALSE(IGLLogAsyncStart({}));
+
+  for (int i = 0; i != 100; ++i) {
+    IGLLog(IGLLogInfo, "message %d", i);
+  }
+  IGLLogFlush();
+
+  {
+    const std::lock_guard<std::mutex> guard(asyncMessagesMutex);
+    ASSERT_EQ(asyncMessages.size(), 100u);
+    EXPECT_EQ(asyncMessages.front(), "message 0");
+    EXPECT_EQ(asyncMessages.back(), "message 99");
+  }
+  const IGLLogAsyncStats stats = IGLLogAsyncGetStats();
+  EXPECT_EQ(stats.logged, 100u);
+  EXPECT_EQ(stats.droppedQueueFull, 0u);
+
+  // Messages are logged synchronously again after stopping
+  IGLLogAsyncStop();
+  EXPECT_FALSE(IGLLogAsyncIsRunning());
+  IGLLog(IGLLogInfo, "sync");
+  const std::lock_guard<std::mutex> guard(asyncMessagesMutex);
+  EXPECT_EQ(asyncMessages.back(), "sync");
+}
+
+TEST_F(LogAsyncTest, DropsAndTruncates) {
+  ASSERT_TRUE(IGLLogAsyncStart({.capacity = 4, .maxRecordLength = 8}));
+
+  // Block the drain thread inside the handler, then overfill the ring buffer. The slot of the
+  // message being logged is only released after the handler returns, leaving 3 free slots.
+  asyncHandlerReleased = false;
+  IGLLog(IGLLogInfo, "first");
+  while (!asyncHandlerEntered) {
+    std::this_thread::yield();
+  }
+  for (int i = 0; i != 10; ++i) {
+    IGLLog(IGLLogInfo, "message %d", i);
+  }
+  asyncHandlerReleased = true;
+  IGLLogAsyncStop();
+
+  const IGLLogAsyncStats stats = IGLLogAsyncGetStats();
+  EXPECT_EQ(stats.logged, 4u);
+  EXPECT_EQ(stats.droppedQueueFull, 7u);
+  EXPECT_EQ(stats.truncated, 3u);
+  const std::lock_guard<std::mutex> guard(asyncMessagesMutex);
+  ASSERT_EQ(asyncMessages.size(), 4u);
+  EXPECT_EQ(asyncMessages[1], "message");
+}
+
+TEST_F(LogAsyncTest, RateLimit) {
+  ASSERT_TRUE(IGLLogAsyncStart({.maxMessagesPerSecond = 5}));
+  for (int i = 0; i != 20; ++i) {
+    IGLLog(IGLLogInfo, "message %d", i);
+  }
+  IGLLogFlush();
+
+  // A one-second window can end while logging
+  const IGLLogAsyncStats stats = IGLLogAsyncGetStats();
+  EXPECT_LE(stats.logged, 10u);
+  EXPECT_EQ(stats.logged + stats.droppedRateLimited, 20u);
+}
+
+TEST_F(LogAsyncTest, ManyProducers) {
+  ASSERT_TRUE(IGLLogAsyncStart({.capacity = 64}));
+  std::vector<std::thread> threads;
+  for (int t = 0; t != 4; ++t) {
+    threads.emplace_back([]() {
+      for (int i = 0; i != 1000; ++i) {
+        IGLLog(IGLLogInfo, "message %d", i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  IGLLogAsyncStop();
+
+  const IGLLogAsyncStats stats = IGLLogAsyncGetStats();
+  EXPECT_EQ(stats.logged + stats.droppedQueueFull, 4000u);
+  const std::lock_guard<std::mutex> guard(asyncMessagesMutex);
+  EXPECT_EQ(asyncMessages.size(), stats.logged);
+}
+
 } // namespace igl::tests
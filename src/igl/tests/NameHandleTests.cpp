@@ -8,8 +8,10 @@
 #include <gtest/gtest.h>
 
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <igl/NameHandle.h>
 
 // NOLINTBEGIN(misc-use-internal-linkage,facebook-static-object-destructor-check)
@@ -184,6 +186,43 @@ TEST(NameHandleTests, vector_hash) {
   EXPECT_EQ(m.at(key1Copy), 10);
   EXPECT_EQ(m.size(), 2u);
 }
+
+TEST(NameHandleTests, interning) {
+  // Handles with the same name share their string
+  const NameHandle runtime = genNameHandle(std::string("interned") + "Name");
+  EXPECT_EQ(runtime.c_str(), IGL_NAMEHANDLE("internedName").c_str());
+  const NameHandle fromView(std::string_view("internedName"), runtime.getCrc32());
+  EXPECT_EQ(runtime.c_str(), fromView.c_str());
+
+  // A different CRC32 for the same string is a different handle, as with CRC32 comparisons
+  EXPECT_NE(NameHandle("internedName", runtime.getCrc32() + 1), runtime);
+
+  // The empty name is the default handle
+  EXPECT_EQ(genNameHandle(""), NameHandle());
+}
+
+TEST(NameHandleTests, interning_threads) {
+  constexpr size_t kNumThreads = 8;
+  constexpr size_t kNumNames = 256;
+
+  std::vector<std::vector<NameHandle>> handles(kNumThreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&handles, t]() {
+      for (size_t i = 0; i < kNumNames; ++i) {
+        handles[t].push_back(genNameHandle("threadName" + std::to_string(i)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t t = 1; t < kNumThreads; ++t) {
+    EXPECT_EQ(handles[t], handles[0]);
+  }
+  EXPECT_EQ(handles[0][42].toString(), "threadName42");
+}
 // NOLINTEND(google-readability-avoid-underscore-in-googletest-name)
 
 } // namespace igl::tests
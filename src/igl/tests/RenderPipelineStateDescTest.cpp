@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <functional>
+#include <memory>
 #include <igl/ComputePipelineState.h>
 #include <igl/RenderPipelineState.h>
 
@@ -336,4 +337,43 @@ TEST(ComputePipelineDescTest, HashEqualObjectsHaveSameHash) {
   EXPECT_EQ(hasher(a), hasher(b));
 }
 
+// -------------------------------------------------------------------------
+// Pipeline state ids
+// -------------------------------------------------------------------------
+
+namespace {
+
+class TestRenderPipelineState final : public IRenderPipelineState {
+ public:
+  TestRenderPipelineState() : IRenderPipelineState(RenderPipelineDesc{}) {}
+  std::shared_ptr<IRenderPipelineReflection> renderPipelineReflection() override {
+    return nullptr;
+  }
+  void setRenderPipelineReflection(
+      const IRenderPipelineReflection& /*renderPipelineReflection*/) override {}
+};
+
+class TestComputePipelineState final : public IComputePipelineState {
+ public:
+  std::shared_ptr<IComputePipelineReflection> computePipelineReflection() override {
+    return nullptr;
+  }
+};
+
+} // namespace
+
+TEST(PipelineStateIdTest, IdsAreNeverReused) {
+  uint64_t firstId = 0;
+  {
+    const auto pipelineState = std::make_unique<TestRenderPipelineState>();
+    firstId = pipelineState->getId();
+    EXPECT_NE(firstId, 0u);
+  }
+  // the next pipeline state may be allocated at the same address, but gets a new id
+  const auto renderPipelineState = std::make_unique<TestRenderPipelineState>();
+  const auto computePipelineState = std::make_unique<TestComputePipelineState>();
+  EXPECT_GT(renderPipelineState->getId(), firstId);
+  EXPECT_GT(computePipelineState->getId(), renderPipelineState->getId());
+}
+
 } // namespace igl::tests
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <shell/shared/renderSession/SessionBenchmarkReport.h>
+
+namespace igl::tests {
+
+using shell::FrameTimingSample;
+using shell::SessionBenchmarkReport;
+
+namespace {
+
+// Returns the text of the JSON object following "key": in json
+std::string findObject(const std::string& json, const std::string& key) {
+  const size_t keyPos = json.find("\"" + key + "\": {");
+  if (keyPos == std::string::npos) {
+    return {};
+  }
+  const size_t begin = json.find('{', keyPos);
+  const size_t end = json.find('}', begin);
+  return json.substr(begin, end - begin + 1);
+}
+
+} // namespace
+
+TEST(SessionBenchmarkReportTest, Percentiles) {
+  SessionBenchmarkReport report("TestSession", "Vulkan");
+  // 1..100 microseconds are recorded exactly
+  for (int i = 1; i <= 100; ++i) {
+    report.recordFrame({
+        .encodeMs = i / 1000.0,
+        .submitMs = 2.0,
+        .queueDrainMs = (101 - i) / 1000.0,
+    });
+  }
+  EXPECT_EQ(report.getFrameCount(), 100u);
+
+  const auto encode = report.getEncodeHistogram().summarize();
+  EXPECT_EQ(encode.count, 100u);
+  EXPECT_DOUBLE_EQ(encode.minMs, 0.001);
+  EXPECT_DOUBLE_EQ(encode.maxMs, 0.1);
+  EXPECT_DOUBLE_EQ(encode.p50Ms, 0.050);
+  EXPECT_DOUBLE_EQ(encode.p95Ms, 0.095);
+  EXPECT_DOUBLE_EQ(encode.p99Ms, 0.099);
+
+  const auto submit = report.getSubmitHistogram().summarize();
+  EXPECT_DOUBLE_EQ(submit.minMs, 2.0);
+  EXPECT_DOUBLE_EQ(submit.p50Ms, 2.0);
+  EXPECT_DOUBLE_EQ(submit.maxMs, 2.0);
+
+  // the order of the samples does not matter
+  const auto queueDrain = report.getQueueDrainHistogram().summarize();
+  EXPECT_DOUBLE_EQ(queueDrain.p50Ms, encode.p50Ms);
+  EXPECT_DOUBLE_EQ(queueDrain.p95Ms, encode.p95Ms);
+}
+
+TEST(SessionBenchmarkReportTest, JsonShape) {
+  SessionBenchmarkReport report("Test\"Session", "Vulkan");
+  // values below 0.128 ms are recorded exactly
+  report.recordFrame({.encodeMs = 0.1, .submitMs = 0.5, .queueDrainMs = 4.0});
+  report.recordFrame({.encodeMs = 0.12, .submitMs = 0.5, .queueDrainMs = 4.0});
+
+  const std::string json = report.toJson();
+  EXPECT_NE(json.find("\"session\": \"Test\\\"Session\""), std::string::npos) << json;
+  EXPECT_NE(json.find("\"backend\": \"Vulkan\""), std::string::npos) << json;
+  EXPECT_NE(json.find("\"frames\": 2,"), std::string::npos) << json;
+  EXPECT_EQ(json.find("gpu"), std::string::npos) << json;
+
+  for (const char* metric : {"encode_ms", "submit_ms", "queue_drain_ms"}) {
+    const std::string object = findObject(json, metric);
+    ASSERT_FALSE(object.empty()) << metric << " missing in " << json;
+    for (const char* stat : {"count", "min", "max", "mean", "p50", "p95", "p99", "p999"}) {
+      EXPECT_NE(object.find(std::string("\"") + stat + "\": "), std::string::npos)
+          << stat << " missing in " << object;
+    }
+  }
+  EXPECT_EQ(findObject(json, "encode_ms"),
+            "{\"count\": 2, \"min\": 0.100, \"max\": 0.120, \"mean\": 0.110, \"p50\": 0.100, "
+            "\"p95\": 0.120, \"p99\": 0.120, \"p999\": 0.120}");
+}
+
+TEST(SessionBenchmarkReportTest, WriteJson) {
+  SessionBenchmarkReport report("TestSession", "OpenGL");
+  report.recordFrame({.encodeMs = 1.0, .submitMs = 1.0, .queueDrainMs = 1.0});
+
+  const std::string path = ::testing::TempDir() + "session_benchmark_report.json";
+  ASSERT_TRUE(report.writeJson(path));
+  const std::ifstream file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_EQ(contents.str(), report.toJson());
+  std::remove(path.c_str());
+
+  EXPECT_FALSE(report.writeJson(::testing::TempDir() + "missing_dir/report.json"));
+}
+
+} // namespace igl::tests
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../util/Common.h"
+
+#include <IGLU/gpu_profiler/GpuProfiler.h>
+#include <igl/CommandBuffer.h>
+#include <utility>
+
+namespace igl::tests {
+
+using iglu::gpu_profiler::GpuFrame;
+using iglu::gpu_profiler::GpuProfiler;
+using iglu::gpu_profiler::GpuScope;
+
+class GpuProfilerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_TRUE(iglDev_ != nullptr);
+    ASSERT_TRUE(cmdQueue_ != nullptr);
+  }
+
+ protected:
+  [[nodiscard]] static GpuFrame makeFrame() {
+    GpuFrame frame;
+    frame.frameIndex = 7;
+    frame.scopes.push_back({.label = "Frame", .startNanos = 0, .durationNanos = 3000000});
+    frame.scopes.push_back(
+        {.label = "Shadow \"pass\"", .parent = 0, .depth = 1, .durationNanos = 1000000});
+    frame.scopes.push_back({.label = "Main",
+                            .parent = 0,
+                            .depth = 1,
+                            .startNanos = 1000000,
+                            .durationNanos = 2000000});
+    return frame;
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+TEST_F(GpuProfilerTest, FormatTree) {
+  EXPECT_EQ(iglu::gpu_profiler::formatGpuFrameTree(makeFrame()),
+            "GPU frame 7\n"
+            "  Frame: 3.000 ms\n"
+            "    Shadow \"pass\": 1.000 ms\n"
+            "    Main: 2.000 ms\n");
+}
+
+TEST_F(GpuProfilerTest, ChromeTrace) {
+  const std::string json = iglu::gpu_profiler::exportChromeTrace({makeFrame()});
+
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\": \"Shadow \\\"pass\\\"\""), std::string::npos);
+  EXPECT_NE(json.find("\"tid\": 1, \"ts\": 1000.000, \"dur\": 2000.000"), std::string::npos);
+  EXPECT_EQ(iglu::gpu_profiler::exportChromeTrace({}), "{\"displayTimeUnit\": \"ms\", "
+                                                      "\"traceEvents\": [\n]}\n");
+}
+
+TEST_F(GpuProfilerTest, DebugGroups) {
+  if (iglDev_->getBackendType() != BackendType::Vulkan) {
+    GTEST_SKIP() << "Timing debug groups is only implemented by the Vulkan backend";
+  }
+
+  GpuProfiler profiler(*iglDev_, {.maxScopesPerFrame = 8, .framesInFlight = 2});
+  if (!profiler.isSupported()) {
+    GTEST_SKIP() << "Timestamp queries are not supported";
+  }
+
+  size_t numCallbacks = 0;
+  profiler.setFrameCallback([&numCallbacks](const GpuFrame& /*frame*/) { numCallbacks++; });
+
+  CommandBufferDesc desc;
+  desc.timestampQueries = profiler.beginFrame();
+  ASSERT_TRUE(desc.timestampQueries != nullptr);
+
+  Result ret;
+  auto cmdBuf = cmdQueue_->createCommandBuffer(desc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message;
+
+  cmdBuf->pushDebugGroupLabel("Frame");
+  cmdBuf->pushDebugGroupLabel("Shadow");
+  cmdBuf->popDebugGroupLabel();
+  cmdBuf->pushDebugGroupLabel("Main");
+  cmdBuf->pushDebugGroupLabel("Opaque");
+  cmdBuf->popDebugGroupLabel();
+  cmdBuf->popDebugGroupLabel();
+  cmdBuf->popDebugGroupLabel();
+
+  cmdQueue_->submit(*cmdBuf);
+  cmdBuf->waitUntilCompleted();
+  profiler.endFrame();
+
+  const GpuFrame* frame = profiler.getLatestFrame();
+  ASSERT_TRUE(frame != nullptr);
+  EXPECT_EQ(numCallbacks, 1u);
+  EXPECT_EQ(frame->frameIndex, 0u);
+  ASSERT_EQ(frame->scopes.size(), 4u);
+
+  const GpuScope& root = frame->scopes[0];
+  EXPECT_EQ(root.label, "Frame");
+  EXPECT_EQ(root.parent, GpuScope::kNoParent);
+  EXPECT_EQ(root.depth, 0u);
+
+  const std::pair<const char*, uint32_t> expected[] = {{"Shadow", 0}, {"Main", 0}, {"Opaque", 2}};
+  for (size_t i = 0; i != 3; ++i) {
+    const GpuScope& scope = frame->scopes[i + 1];
+    EXPECT_EQ(scope.label, expected[i].first);
+    EXPECT_EQ(scope.parent, expected[i].second);
+    EXPECT_EQ(scope.depth, frame->scopes[scope.parent].depth + 1);
+    EXPECT_LE(scope.durationNanos, root.durationNanos);
+  }
+}
+
+TEST_F(GpuProfilerTest, OnlyVulkanIsSupported) {
+  if (iglDev_->getBackendType() == BackendType::Vulkan) {
+    GTEST_SKIP() << "Tests the other backends";
+  }
+
+  GpuProfiler profiler(*iglDev_);
+  EXPECT_FALSE(profiler.isSupported());
+  EXPECT_EQ(profiler.beginFrame(), nullptr);
+}
+
+TEST_F(GpuProfilerTest, DropsExpiredFrame) {
+  if (iglDev_->getBackendType() != BackendType::Vulkan) {
+    GTEST_SKIP() << "Timing debug groups is only implemented by the Vulkan backend";
+  }
+
+  constexpr uint32_t kMaxFrameAge = 4;
+  GpuProfiler profiler(*iglDev_,
+                       {.maxScopesPerFrame = 8, .framesInFlight = 1, .maxFrameAge = kMaxFrameAge});
+  if (!profiler.isSupported()) {
+    GTEST_SKIP() << "Timestamp queries are not supported";
+  }
+
+  // the results of this frame do not become available until its command buffer is submitted
+  CommandBufferDesc desc;
+  desc.timestampQueries = profiler.beginFrame();
+  ASSERT_TRUE(desc.timestampQueries != nullptr);
+  Result ret;
+  auto cmdBuf = cmdQueue_->createCommandBuffer(desc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message;
+  cmdBuf->pushDebugGroupLabel("Frame");
+  cmdBuf->popDebugGroupLabel();
+
+  for (uint32_t i = 1; i != kMaxFrameAge; ++i) {
+    profiler.endFrame();
+    EXPECT_EQ(profiler.beginFrame(), nullptr);
+  }
+  profiler.endFrame();
+  EXPECT_TRUE(profiler.beginFrame() != nullptr);
+  EXPECT_EQ(profiler.getLatestFrame(), nullptr);
+
+  cmdQueue_->submit(*cmdBuf);
+  cmdBuf->waitUntilCompleted();
+}
+
+} // namespace igl::tests
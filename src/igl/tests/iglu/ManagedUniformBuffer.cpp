@@ -113,6 +113,33 @@ TEST_F(ManagedUniformBufferTest, UpdateData) {
   }
 }
 
+TEST_F(ManagedUniformBufferTest, UpdateDataBySlot) {
+  iglu::ManagedUniformBuffer buffer(*iglDev_,
+                                    {.index = 0,
+                                     .length = 64,
+                                     .uniforms = {{.name = "first",
+                                                   .location = 0,
+                                                   .type = UniformType::Float,
+                                                   .numElements = 1,
+                                                   .offset = 0,
+                                                   .elementStride = 0},
+                                                  {.name = "second",
+                                                   .location = 1,
+                                                   .type = UniformType::Float,
+                                                   .numElements = 1,
+                                                   .offset = sizeof(float),
+                                                   .elementStride = 0}}});
+  const int slot = buffer.getIndex("second");
+  ASSERT_EQ(slot, 1);
+
+  const float data[2] = {1000.0f, 1.0f};
+  EXPECT_TRUE(buffer.updateData(slot, data, sizeof(data)));
+  EXPECT_EQ(static_cast<float*>(buffer.getData())[1], data[0]);
+
+  EXPECT_FALSE(buffer.updateData(-1, data, sizeof(float)));
+  EXPECT_FALSE(buffer.updateData(2, data, sizeof(float)));
+}
+
 TEST_F(ManagedUniformBufferTest, GetUniformDataSize) {
   iglu::ManagedUniformBuffer buffer(*iglDev_,
                                     {.index = 0,
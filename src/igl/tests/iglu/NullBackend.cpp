@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/null_backend/Device.h>
+#include <array>
+#include <igl/CommandBuffer.h>
+#include <igl/CommandQueue.h>
+#include <igl/Framebuffer.h>
+#include <igl/RenderCommandEncoder.h>
+#include <igl/RenderPass.h>
+#include <igl/RenderPipelineState.h>
+#include <igl/ShaderCreator.h>
+#include <igl/VertexInputState.h>
+
+namespace igl::tests {
+
+namespace {
+
+// Never compiled by the null backend, so the contents do not matter.
+const char* kVertexSource = "void main() {}";
+const char* kFragmentSource = "void main() {}";
+
+} // namespace
+
+//
+// NullBackendTest
+//
+// Tests for the device which counts commands instead of executing them.
+//
+class NullBackendTest : public ::testing::Test {
+ public:
+  NullBackendTest() = default;
+  ~NullBackendTest() override = default;
+
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+
+    Result ret;
+    cmdQueue_ = device_.createCommandQueue({}, &ret);
+    ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+    ASSERT_NE(cmdQueue_, nullptr);
+  }
+
+  void TearDown() override {}
+
+ protected:
+  std::shared_ptr<IRenderPipelineState> createPipeline() {
+    Result ret;
+    std::shared_ptr<IShaderStages> stages = ShaderStagesCreator::fromModuleStringInput(
+        device_, kVertexSource, "main", "", kFragmentSource, "main", "", &ret);
+    EXPECT_TRUE(ret.isOk()) << ret.message.c_str();
+
+    RenderPipelineDesc desc;
+    desc.shaderStages = std::move(stages);
+    desc.targetDesc.colorAttachments.resize(1);
+    desc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+    auto pipeline = device_.createRenderPipeline(desc, &ret);
+    EXPECT_TRUE(ret.isOk()) << ret.message.c_str();
+    return pipeline;
+  }
+
+  iglu::null_backend::Device device_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+//
+// RecordFrame
+//
+// Record a frame of draws and check what was counted.
+//
+TEST_F(NullBackendTest, RecordFrame) {
+  Result ret;
+  const std::array<float, 12> vertices{};
+  auto vertexBuffer = device_.createBuffer(
+      BufferDesc(BufferDesc::BufferTypeBits::Vertex, vertices.data(), sizeof(vertices)), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  const std::array<uint16_t, 6> indices{0, 1, 2, 2, 1, 0};
+  auto indexBuffer = device_.createBuffer(
+      BufferDesc(BufferDesc::BufferTypeBits::Index, indices.data(), sizeof(indices)), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  auto colorTexture = device_.createTexture(
+      TextureDesc::new2D(
+          TextureFormat::RGBA_UNorm8, 4, 4, TextureDesc::TextureUsageBits::Attachment),
+      &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  FramebufferDesc framebufferDesc;
+  framebufferDesc.colorAttachments[0].texture = colorTexture;
+  auto framebuffer = device_.createFramebuffer(framebufferDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  auto pipeline = createPipeline();
+  ASSERT_NE(pipeline, nullptr);
+
+  const auto& counters = device_.getCounters();
+  EXPECT_EQ(counters.buffersCreated, 2u);
+  EXPECT_EQ(counters.texturesCreated, 1u);
+  EXPECT_EQ(counters.framebuffersCreated, 1u);
+  EXPECT_EQ(counters.pipelinesCreated, 1u);
+  EXPECT_EQ(counters.liveBufferBytes, sizeof(vertices) + sizeof(indices));
+  EXPECT_EQ(counters.liveTextureBytes, 4u * 4u * 4u);
+
+  device_.resetCounters();
+  EXPECT_EQ(counters.buffersCreated, 0u);
+  EXPECT_EQ(counters.liveBuffers, 2u);
+
+  RenderPassDesc renderPass;
+  renderPass.colorAttachments.resize(1);
+  auto cmdBuffer = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  auto encoder = cmdBuffer->createRenderCommandEncoder(renderPass, framebuffer, {}, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  encoder->bindRenderPipelineState(pipeline);
+  encoder->bindRenderPipelineState(pipeline);
+  encoder->bindVertexBuffer(0, *vertexBuffer);
+  encoder->bindIndexBuffer(*indexBuffer, IndexFormat::UInt16);
+  encoder->bindViewport({0.0f, 0.0f, 4.0f, 4.0f, 0.0f, 1.0f});
+  encoder->draw(3);
+  encoder->drawIndexed(6, 2);
+  encoder->endEncoding();
+  cmdQueue_->submit(*cmdBuffer, true);
+
+  EXPECT_EQ(counters.commandBuffers, 1u);
+  EXPECT_EQ(counters.submits, 1u);
+  EXPECT_EQ(counters.frames, 1u);
+  EXPECT_EQ(counters.renderPasses, 1u);
+  EXPECT_EQ(counters.draws, 2u);
+  EXPECT_EQ(counters.indexedDraws, 1u);
+  EXPECT_EQ(counters.vertices, 3u + 6u * 2u);
+  EXPECT_EQ(counters.pipelineBinds, 2u);
+  EXPECT_EQ(counters.redundantPipelineBinds, 1u);
+  EXPECT_EQ(counters.bufferBinds, 2u);
+  EXPECT_EQ(counters.dynamicStateChanges, 1u);
+  EXPECT_EQ(device_.getCurrentDrawCount(), 2u);
+}
+
+//
+// LiveResources
+//
+// Live resource counters follow the lifetime of the resources and survive resetCounters().
+//
+TEST_F(NullBackendTest, LiveResources) {
+  Result ret;
+  {
+    auto buffer = device_.createBuffer(
+        BufferDesc(BufferDesc::BufferTypeBits::Uniform, nullptr, 256), &ret);
+    ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+    EXPECT_EQ(device_.getCounters().liveBuffers, 1u);
+    EXPECT_EQ(device_.getGPUMemoryUsage(), 256u);
+
+    const std::array<uint8_t, 64> data{};
+    EXPECT_TRUE(buffer->upload(data.data(), BufferRange(data.size(), 16)).isOk());
+    EXPECT_FALSE(buffer->upload(data.data(), BufferRange(data.size(), 240)).isOk());
+    EXPECT_EQ(device_.getCounters().bufferUploads, 1u);
+    EXPECT_EQ(device_.getCounters().bufferUploadBytes, data.size());
+
+    device_.resetCounters();
+    EXPECT_EQ(device_.getCounters().liveBuffers, 1u);
+  }
+  EXPECT_EQ(device_.getCounters().liveBuffers, 0u);
+  EXPECT_EQ(device_.getGPUMemoryUsage(), 0u);
+}
+
+//
+// ReportedBackendType
+//
+// The device can impersonate another backend so that clients take the same code paths.
+//
+TEST_F(NullBackendTest, ReportedBackendType) {
+  EXPECT_EQ(device_.getBackendType(), BackendType::Custom);
+
+  const iglu::null_backend::Device vulkanDevice(BackendType::Vulkan);
+  EXPECT_EQ(vulkanDevice.getBackendType(), BackendType::Vulkan);
+  EXPECT_EQ(vulkanDevice.getShaderVersion().family, ShaderFamily::SpirV);
+  EXPECT_EQ(vulkanDevice.getNormalizedZRange(), NormalizedZRange::ZeroToOne);
+}
+
+} // namespace igl::tests
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../util/Common.h"
+
+#include <IGLU/render_graph/RenderGraph.h>
+#include <string>
+#include <vector>
+#include <igl/CommandBuffer.h>
+
+namespace igl::tests {
+
+using iglu::render_graph::PassBuilder;
+using iglu::render_graph::PassResources;
+using iglu::render_graph::RenderGraph;
+using iglu::render_graph::TextureHandle;
+
+class RenderGraphTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    setDebugBreakEnabled(false);
+
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_TRUE(iglDev_ != nullptr);
+    ASSERT_TRUE(cmdQueue_ != nullptr);
+  }
+
+ protected:
+  [[nodiscard]] static TextureDesc makeDesc(const char* name, uint32_t size = 64) {
+    TextureDesc desc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                          size,
+                                          size,
+                                          TextureDesc::TextureUsageBits::Sampled |
+                                              TextureDesc::TextureUsageBits::Attachment);
+    desc.debugName = name;
+    return desc;
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+};
+
+TEST_F(RenderGraphTest, CullsUnusedPasses) {
+  RenderGraph graph;
+
+  TextureHandle used = iglu::render_graph::kInvalidTexture;
+  TextureHandle output = iglu::render_graph::kInvalidTexture;
+
+  const uint32_t producer = graph.addPass(
+      "producer", [&](PassBuilder& b) { used = b.createTexture(makeDesc("used")); }, nullptr);
+  const uint32_t unused = graph.addPass(
+      "unused", [&](PassBuilder& b) { b.createTexture(makeDesc("unused")); }, nullptr);
+  const uint32_t consumer = graph.addPass(
+      "consumer",
+      [&](PassBuilder& b) {
+        b.read(used);
+        output = b.createTexture(makeDesc("output"));
+      },
+      nullptr);
+  const uint32_t sideEffect = graph.addPass(
+      "sideEffect", [&](PassBuilder& b) { b.setSideEffect(); }, nullptr);
+  graph.markOutput(output);
+
+  Result ret;
+  ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+  ASSERT_TRUE(ret.isOk()) << ret.message;
+
+  EXPECT_FALSE(graph.isCulled(producer));
+  EXPECT_TRUE(graph.isCulled(unused));
+  EXPECT_FALSE(graph.isCulled(consumer));
+  EXPECT_FALSE(graph.isCulled(sideEffect));
+
+  EXPECT_EQ(graph.getStats().numPasses, 4u);
+  EXPECT_EQ(graph.getStats().numCulledPasses, 1u);
+  EXPECT_EQ(graph.getStats().numTransientTextures, 2u);
+}
+
+TEST_F(RenderGraphTest, AliasesTransientTextures) {
+  RenderGraph graph;
+
+  // a ping-pong post-processing chain: each intermediate texture is used by 2 adjacent passes
+  constexpr uint32_t kNumPasses = 6;
+  TextureHandle prev = iglu::render_graph::kInvalidTexture;
+  for (uint32_t i = 0; i != kNumPasses; i++) {
+    graph.addPass(
+        "post",
+        [&](PassBuilder& b) {
+          if (prev != iglu::render_graph::kInvalidTexture) {
+            b.read(prev);
+          }
+          prev = b.createTexture(makeDesc("intermediate"));
+        },
+        nullptr);
+  }
+  graph.markOutput(prev);
+
+  Result ret;
+  ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+
+  const auto& stats = graph.getStats();
+  EXPECT_EQ(stats.numCulledPasses, 0u);
+  EXPECT_EQ(stats.numTransientTextures, kNumPasses);
+  EXPECT_EQ(stats.numPhysicalTextures, 2u);
+  EXPECT_LT(stats.physicalBytes, stats.transientBytes);
+
+  // textures with different descriptions are never aliased
+  graph.reset();
+
+  TextureHandle small = iglu::render_graph::kInvalidTexture;
+  graph.addPass(
+      "small", [&](PassBuilder& b) { small = b.createTexture(makeDesc("small", 32)); }, nullptr);
+  graph.addPass(
+      "big",
+      [&](PassBuilder& b) {
+        b.read(small);
+        graph.markOutput(b.createTexture(makeDesc("big", 128)));
+      },
+      nullptr);
+  ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+  EXPECT_EQ(graph.getStats().numPhysicalTextures, 2u);
+}
+
+TEST_F(RenderGraphTest, DoesNotAliasStorageTexturesAfterRead) {
+  RenderGraph graph;
+
+  // storage textures read by a pass are not transitioned back by the backend, so nothing would
+  // order that read before a write into the same texture by a later pass
+  TextureDesc desc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                        64,
+                                        64,
+                                        TextureDesc::TextureUsageBits::Sampled |
+                                            TextureDesc::TextureUsageBits::Storage);
+  constexpr uint32_t kNumPasses = 4;
+  TextureHandle prev = iglu::render_graph::kInvalidTexture;
+  for (uint32_t i = 0; i != kNumPasses; i++) {
+    graph.addPass(
+        "compute",
+        [&](PassBuilder& b) {
+          if (prev != iglu::render_graph::kInvalidTexture) {
+            b.read(prev);
+          }
+          prev = b.createTexture(desc);
+        },
+        nullptr);
+  }
+  graph.markOutput(prev);
+
+  Result ret;
+  ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+
+  const auto& stats = graph.getStats();
+  EXPECT_EQ(stats.numTransientTextures, kNumPasses);
+  EXPECT_EQ(stats.numPhysicalTextures, kNumPasses);
+  EXPECT_GT(stats.numAliasingRejectedWar, 0u);
+  EXPECT_EQ(stats.physicalBytes, stats.transientBytes);
+}
+
+TEST_F(RenderGraphTest, DependenciesForEveryReadAfterWrite) {
+  RenderGraph graph;
+
+  TextureHandle tex = iglu::render_graph::kInvalidTexture;
+  graph.addPass(
+      "write", [&](PassBuilder& b) { tex = b.createTexture(makeDesc("tex")); }, nullptr);
+
+  std::vector<uint32_t> numDeps;
+  const auto countDeps = [&numDeps](const PassResources& resources, ICommandBuffer& /*cmdBuf*/) {
+    uint32_t n = 0;
+    for (const Dependencies* deps = &resources.getDependencies(); deps; deps = deps->next) {
+      for (const ITexture* t : deps->textures) {
+        n += t ? 1 : 0;
+      }
+    }
+    numDeps.push_back(n);
+  };
+
+  // the attachment goes back to attachment layout after each reader, so both need a barrier
+  graph.addPass(
+      "read1",
+      [&](PassBuilder& b) {
+        b.read(tex);
+        b.setSideEffect();
+      },
+      countDeps);
+  graph.addPass(
+      "read2",
+      [&](PassBuilder& b) {
+        b.read(tex);
+        b.setSideEffect();
+      },
+      countDeps);
+  // a pass which only writes needs none
+  graph.addPass(
+      "overwrite",
+      [&](PassBuilder& b) {
+        b.write(tex);
+        b.setSideEffect();
+      },
+      countDeps);
+
+  Result ret;
+  ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+  EXPECT_EQ(graph.getStats().numDependencies, 2u);
+
+  auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk());
+  graph.execute(*cmdBuf);
+
+  EXPECT_EQ(numDeps, (std::vector<uint32_t>{1, 1, 0}));
+}
+
+TEST_F(RenderGraphTest, ChainsMoreThanMaxDependencies) {
+  RenderGraph graph;
+
+  constexpr uint32_t kNumTextures = Dependencies::kIglMaxTextureDependencies + 3;
+
+  std::vector<TextureHandle> textures;
+  graph.addPass(
+      "write",
+      [&](PassBuilder& b) {
+        for (uint32_t i = 0; i != kNumTextures; i++) {
+          textures.push_back(b.createTexture(makeDesc("tex")));
+        }
+      },
+      nullptr);
+
+  uint32_t numDeps = 0;
+  graph.addPass(
+      "read",
+      [&](PassBuilder& b) {
+        for (TextureHandle t : textures) {
+          b.read(t);
+        }
+        b.setSideEffect();
+      },
+      [&numDeps](const PassResources& resources, ICommandBuffer& /*cmdBuf*/) {
+        for (const Dependencies* deps = &resources.getDependencies(); deps; deps = deps->next) {
+          for (const ITexture* t : deps->textures) {
+            numDeps += t ? 1 : 0;
+          }
+        }
+      });
+
+  Result ret;
+  ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+
+  auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk());
+  graph.execute(*cmdBuf);
+
+  EXPECT_EQ(numDeps, kNumTextures);
+}
+
+TEST_F(RenderGraphTest, ReusesPooledTexturesAcrossFrames) {
+  RenderGraph graph;
+
+  std::shared_ptr<ITexture> firstFrameTexture;
+
+  for (int frame = 0; frame != 3; frame++) {
+    graph.reset();
+
+    TextureHandle tex = iglu::render_graph::kInvalidTexture;
+    graph.addPass(
+        "write", [&](PassBuilder& b) { tex = b.createTexture(makeDesc("tex")); }, nullptr);
+    graph.addPass(
+        "read",
+        [&](PassBuilder& b) {
+          b.read(tex);
+          b.setSideEffect();
+        },
+        [&](const PassResources& resources, ICommandBuffer& /*cmdBuf*/) {
+          if (!firstFrameTexture) {
+            firstFrameTexture = resources.getTexture(tex);
+          }
+          EXPECT_EQ(resources.getTexture(tex), firstFrameTexture);
+        });
+
+    Result ret;
+    ASSERT_TRUE(graph.compile(*iglDev_, &ret));
+    auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+    ASSERT_TRUE(ret.isOk());
+    graph.execute(*cmdBuf);
+  }
+
+  EXPECT_NE(firstFrameTexture, nullptr);
+}
+
+} // namespace igl::tests
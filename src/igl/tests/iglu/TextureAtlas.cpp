@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/null_backend/Device.h>
+#include <IGLU/texture_atlas/TextureAtlas.h>
+#include <algorithm>
+#include <vector>
+
+namespace igl::tests {
+
+namespace {
+
+using iglu::texture_atlas::EntryHandle;
+using iglu::texture_atlas::kInvalidEntry;
+using iglu::texture_atlas::PackedRect;
+using iglu::texture_atlas::RectPacker;
+using iglu::texture_atlas::TextureAtlas;
+
+bool overlaps(const PackedRect& a, const PackedRect& b) {
+  return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height &&
+         b.y < a.y + a.height;
+}
+
+} // namespace
+
+TEST(RectPackerTest, InsertsWithoutOverlap) {
+  RectPacker packer(128, 128);
+  std::vector<PackedRect> rects;
+  for (uint32_t i = 0; i < 40; ++i) {
+    const auto rect = packer.insert(8 + (i * 7) % 17, 8 + (i * 5) % 13);
+    ASSERT_TRUE(rect.has_value());
+    EXPECT_LE(rect->x + rect->width, 128u);
+    EXPECT_LE(rect->y + rect->height, 128u);
+    for (const auto& other : rects) {
+      EXPECT_FALSE(overlaps(*rect, other));
+    }
+    rects.push_back(*rect);
+  }
+  EXPECT_EQ(packer.getNumRects(), rects.size());
+  EXPECT_FALSE(packer.insert(129, 1).has_value());
+  EXPECT_FALSE(packer.insert(0, 1).has_value());
+}
+
+TEST(RectPackerTest, FillsExactly) {
+  RectPacker packer(64, 64);
+  for (uint32_t i = 0; i < 16; ++i) {
+    ASSERT_TRUE(packer.insert(16, 16).has_value());
+  }
+  EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.0f);
+  EXPECT_TRUE(packer.getFreeRects().empty());
+  EXPECT_FALSE(packer.insert(1, 1).has_value());
+
+  packer.clear();
+  EXPECT_EQ(packer.getNumRects(), 0u);
+  EXPECT_TRUE(packer.insert(64, 64).has_value());
+}
+
+TEST(RectPackerTest, ReusesRemovedSpace) {
+  RectPacker packer(64, 64);
+  std::vector<PackedRect> rects;
+  for (uint32_t i = 0; i < 4; ++i) {
+    rects.push_back(*packer.insert(32, 32));
+  }
+  EXPECT_FALSE(packer.insert(32, 32).has_value());
+
+  // Freeing two neighbors makes room for a rectangle spanning both
+  const PackedRect a = rects[0];
+  auto b = std::find_if(rects.begin() + 1, rects.end(), [&a](const PackedRect& r) {
+    return r.y == a.y;
+  });
+  ASSERT_NE(b, rects.end());
+  EXPECT_TRUE(packer.remove(a));
+  EXPECT_TRUE(packer.remove(*b));
+  EXPECT_FALSE(packer.remove(a));
+  const auto wide = packer.insert(64, 32);
+  ASSERT_TRUE(wide.has_value());
+  EXPECT_EQ(wide->y, a.y);
+  EXPECT_FLOAT_EQ(packer.getOccupancy(), 1.0f);
+}
+
+TEST(RectPackerTest, RemovesInAnyOrder) {
+  RectPacker packer(64, 64);
+  std::vector<PackedRect> rects;
+  for (uint32_t i = 0; i < 16; ++i) {
+    rects.push_back(*packer.insert(16, 16));
+  }
+
+  // Free rectangles never overlap used ones, and freeing everything restores the whole area
+  for (uint32_t i = 0; i < 16; ++i) {
+    const PackedRect rect = rects[(i * 7) % 16];
+    ASSERT_TRUE(packer.remove(rect));
+    for (uint32_t j = i + 1; j < 16; ++j) {
+      for (const auto& freeRect : packer.getFreeRects()) {
+        EXPECT_FALSE(overlaps(freeRect, rects[(j * 7) % 16]));
+      }
+    }
+  }
+  ASSERT_EQ(packer.getFreeRects().size(), 1u);
+  EXPECT_EQ(packer.getFreeRects()[0], (PackedRect{0, 0, 64, 64}));
+}
+
+TEST(RectPackerTest, MergesFreedSpace) {
+  RectPacker packer(64, 64);
+  std::vector<PackedRect> rects;
+  for (uint32_t i = 0; i < 16; ++i) {
+    rects.push_back(*packer.insert(16, 16));
+  }
+
+  // Freeing a 2x2 block of rectangles in diagonal order makes room for a 32x32 rectangle
+  const auto find = [&rects](uint32_t x, uint32_t y) {
+    return *std::find_if(rects.begin(), rects.end(), [x, y](const PackedRect& r) {
+      return r.x == x && r.y == y;
+    });
+  };
+  for (const auto& [x, y] : {std::pair{16u, 16u}, {32u, 32u}, {16u, 32u}, {32u, 16u}}) {
+    EXPECT_FALSE(packer.insert(32, 32).has_value());
+    ASSERT_TRUE(packer.remove(find(x, y)));
+  }
+  const auto rect = packer.insert(32, 32);
+  ASSERT_TRUE(rect.has_value());
+  EXPECT_EQ(*rect, (PackedRect{16, 16, 32, 32}));
+}
+
+//
+// TextureAtlasTest
+//
+// Tests packing and uploads of the texture atlas on the null backend, which counts uploads.
+//
+class TextureAtlasTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+  }
+
+ protected:
+  iglu::null_backend::Device device_;
+};
+
+TEST_F(TextureAtlasTest, AddsEntriesWithUvRects) {
+  TextureAtlas atlas(device_, {.pageWidth = 256, .pageHeight = 128, .padding = 2});
+  const std::vector<uint32_t> texels(30 * 10, 0xFF00FF00u);
+
+  Result ret;
+  const EntryHandle handle = atlas.add(30, 10, texels.data(), 0, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message;
+  ASSERT_NE(handle, kInvalidEntry);
+  EXPECT_EQ(atlas.getNumPages(), 1u);
+  EXPECT_EQ(atlas.getNumEntries(), 1u);
+  ASSERT_NE(atlas.getPage(0), nullptr);
+
+  const auto* entry = atlas.getEntry(handle);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->page, 0u);
+  EXPECT_EQ(entry->rect.width, 30u);
+  EXPECT_EQ(entry->rect.height, 10u);
+  EXPECT_GE(entry->rect.x, 2u);
+  EXPECT_GE(entry->rect.y, 2u);
+  EXPECT_FLOAT_EQ(entry->u0, static_cast<float>(entry->rect.x) / 256.0f);
+  EXPECT_FLOAT_EQ(entry->v0, static_cast<float>(entry->rect.y) / 128.0f);
+  EXPECT_FLOAT_EQ(entry->u1, static_cast<float>(entry->rect.x + 30) / 256.0f);
+  EXPECT_FLOAT_EQ(entry->v1, static_cast<float>(entry->rect.y + 10) / 128.0f);
+
+  // The image is uploaded once, together with its padding
+  EXPECT_EQ(device_.getCounters().textureUploads, 1u);
+  EXPECT_EQ(device_.getCounters().textureUploadBytes, size_t(34) * 14 * 4);
+
+  atlas.remove(handle);
+  EXPECT_EQ(atlas.getEntry(handle), nullptr);
+  EXPECT_EQ(atlas.getNumEntries(), 0u);
+}
+
+TEST_F(TextureAtlasTest, GrowsPagesUntilFull) {
+  TextureAtlas atlas(device_, {.pageWidth = 64, .pageHeight = 64, .maxPages = 2, .padding = 0});
+  const std::vector<uint32_t> texels(32 * 32);
+
+  std::vector<EntryHandle> handles;
+  for (uint32_t i = 0; i < 8; ++i) {
+    handles.push_back(atlas.add(32, 32, texels.data()));
+    ASSERT_NE(handles.back(), kInvalidEntry);
+    EXPECT_EQ(atlas.getEntry(handles.back())->page, i / 4);
+  }
+  EXPECT_EQ(atlas.getNumPages(), 2u);
+  EXPECT_EQ(device_.getCounters().texturesCreated, 2u);
+
+  Result ret;
+  EXPECT_EQ(atlas.add(32, 32, texels.data(), 0, &ret), kInvalidEntry);
+  EXPECT_EQ(ret.code, Result::Code::RuntimeError);
+  EXPECT_EQ(atlas.add(65, 1, texels.data(), 0, &ret), kInvalidEntry);
+  EXPECT_EQ(ret.code, Result::Code::ArgumentOutOfRange);
+
+  // Removed space and handles are reused without creating pages
+  atlas.remove(handles[5]);
+  const EntryHandle handle = atlas.add(32, 32, texels.data(), 0, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message;
+  EXPECT_EQ(handle, handles[5]);
+  EXPECT_EQ(atlas.getEntry(handle)->page, 1u);
+  EXPECT_EQ(atlas.getNumPages(), 2u);
+
+  atlas.clear();
+  EXPECT_EQ(atlas.getNumEntries(), 0u);
+  EXPECT_NE(atlas.add(32, 32, texels.data()), kInvalidEntry);
+  EXPECT_EQ(atlas.getNumPages(), 2u);
+}
+
+TEST_F(TextureAtlasTest, UploadsMipLevels) {
+  TextureAtlas atlas(device_, {.pageWidth = 128, .pageHeight = 128, .numMipLevels = 3});
+  const std::vector<uint32_t> texels(16 * 10, 0xFFFFFFFFu);
+
+  // Images and padding are aligned to 4 texels so every level covers whole texels
+  std::vector<EntryHandle> handles;
+  for (uint32_t i = 0; i < 3; ++i) {
+    Result ret;
+    handles.push_back(atlas.add(10, 10, texels.data(), 16 * 4, &ret));
+    ASSERT_TRUE(ret.isOk()) << ret.message;
+    const auto* entry = atlas.getEntry(handles.back());
+    EXPECT_EQ(entry->rect.x % 4, 0u);
+    EXPECT_EQ(entry->rect.y % 4, 0u);
+  }
+  EXPECT_EQ(atlas.getDesc().numMipLevels, 3u);
+  EXPECT_EQ(device_.getCounters().textureUploads, 3u * 3u);
+  // 10 + 2 * 4 padding is rounded up to 20 texels
+  EXPECT_EQ(device_.getCounters().textureUploadBytes, 3u * (20 * 20 + 10 * 10 + 5 * 5) * 4);
+}
+
+} // namespace igl::tests
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/uniform/ArenaCollection.h>
+#include <cstring>
+#include <vector>
+#include <igl/NameHandle.h>
+
+namespace iglu::tests {
+
+//
+// UniformArenaCollectionTest
+//
+// Tests for the std140 and Metal layouts and the updates of uniform::ArenaCollection.
+//
+class UniformArenaCollectionTest : public ::testing::Test {
+ public:
+  UniformArenaCollectionTest() = default;
+  ~UniformArenaCollectionTest() override = default;
+
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+  }
+
+  void TearDown() override {}
+};
+
+TEST_F(UniformArenaCollectionTest, Std140Layout) {
+  uniform::ArenaCollection c;
+  c.set(IGL_NAMEHANDLE("time"), 1.0f); // offset 0
+  c.set(IGL_NAMEHANDLE("direction"), glm::vec3(1.0f, 2.0f, 3.0f)); // aligned to 16
+  c.set(IGL_NAMEHANDLE("intensity"), 4.0f); // packed after the vec3
+  c.set(IGL_NAMEHANDLE("uv"), glm::vec2(5.0f, 6.0f)); // aligned to 8
+  c.set(IGL_NAMEHANDLE("normalMatrix"), glm::mat3(1.0f)); // 3 columns of 16 bytes
+  c.set(IGL_NAMEHANDLE("weights"), std::vector<float>{1.0f, 2.0f}); // stride 16
+  c.set(IGL_NAMEHANDLE("enabled"), true); // 4 bytes
+
+  auto offsetOf = [&c](const igl::NameHandle& name) { return c.find(name)->offset; };
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("time")), 0u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("direction")), 16u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("intensity")), 28u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("uv")), 32u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("normalMatrix")), 48u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("weights")), 96u);
+  EXPECT_EQ(c.find(IGL_NAMEHANDLE("weights"))->stride, 16u);
+  EXPECT_EQ(c.find(IGL_NAMEHANDLE("weights"))->count, 2u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("enabled")), 128u);
+  EXPECT_EQ(c.numBytes(), 144u); // rounded up to 16
+
+  const auto* bytes = static_cast<const uint8_t*>(c.data());
+  float value = 0.0f;
+  std::memcpy(&value, bytes + 16 + 8, sizeof(value));
+  EXPECT_EQ(value, 3.0f);
+  std::memcpy(&value, bytes + 96 + 16, sizeof(value));
+  EXPECT_EQ(value, 2.0f);
+
+  // Entries are sorted by CRC32 and names keep their insertion order
+  const auto& entries = c.entries();
+  ASSERT_EQ(entries.size(), 7u);
+  for (size_t i = 1; i < entries.size(); ++i) {
+    EXPECT_LT(entries[i - 1].crc32, entries[i].crc32);
+  }
+  EXPECT_EQ(c.names().front(), IGL_NAMEHANDLE("time"));
+  EXPECT_EQ(c.names().back(), IGL_NAMEHANDLE("enabled"));
+}
+
+TEST_F(UniformArenaCollectionTest, MetalLayout) {
+  uniform::ArenaCollection c(uniform::ArenaLayout::Metal);
+  c.set(IGL_NAMEHANDLE("time"), 1.0f); // offset 0
+  c.set(IGL_NAMEHANDLE("direction"), glm::vec3(1.0f, 2.0f, 3.0f)); // 16 bytes, aligned to 16
+  c.set(IGL_NAMEHANDLE("intensity"), 4.0f); // not packed after the float3
+  c.set(IGL_NAMEHANDLE("uv"), glm::vec2(5.0f, 6.0f)); // aligned to 8
+  c.set(IGL_NAMEHANDLE("normalMatrix"), glm::mat3(1.0f)); // 3 columns of 16 bytes
+  c.set(IGL_NAMEHANDLE("weights"), std::vector<float>{1.0f, 2.0f}); // stride 4
+  c.set(IGL_NAMEHANDLE("enabled"), true); // 1 byte
+  c.set(IGL_NAMEHANDLE("rotation"), glm::mat2(1.0f)); // 2 columns of 8 bytes, aligned to 8
+
+  auto offsetOf = [&c](const igl::NameHandle& name) { return c.find(name)->offset; };
+  EXPECT_EQ(c.layout(), uniform::ArenaLayout::Metal);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("time")), 0u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("direction")), 16u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("intensity")), 32u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("uv")), 40u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("normalMatrix")), 48u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("weights")), 96u);
+  EXPECT_EQ(c.find(IGL_NAMEHANDLE("weights"))->stride, 4u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("enabled")), 104u);
+  EXPECT_EQ(offsetOf(IGL_NAMEHANDLE("rotation")), 112u);
+  EXPECT_EQ(c.numBytes(), 128u);
+
+  const auto* bytes = static_cast<const uint8_t*>(c.data());
+  float value = 0.0f;
+  std::memcpy(&value, bytes + 96 + 4, sizeof(value));
+  EXPECT_EQ(value, 2.0f);
+  EXPECT_EQ(bytes[104], 1u);
+
+  glm::vec3 direction(0.0f);
+  ASSERT_TRUE(c.get(IGL_NAMEHANDLE("direction"), direction));
+  EXPECT_EQ(direction, glm::vec3(1.0f, 2.0f, 3.0f));
+
+  // Collections with different layouts never share their arena
+  uniform::ArenaCollection std140;
+  std140.set(IGL_NAMEHANDLE("time"), 1.0f);
+  uniform::ArenaCollection metal(uniform::ArenaLayout::Metal);
+  metal.set(IGL_NAMEHANDLE("time"), 1.0f);
+  EXPECT_FALSE(std140.hasSameLayout(metal));
+
+  EXPECT_EQ(uniform::getArenaLayout(igl::BackendType::Metal), uniform::ArenaLayout::Metal);
+  EXPECT_EQ(uniform::getArenaLayout(igl::BackendType::Vulkan), uniform::ArenaLayout::Std140);
+  EXPECT_EQ(uniform::getArenaLayout(igl::BackendType::OpenGL), uniform::ArenaLayout::Std140);
+}
+
+TEST_F(UniformArenaCollectionTest, BoolArray) {
+  for (const auto layout : {uniform::ArenaLayout::Std140, uniform::ArenaLayout::Metal}) {
+    uniform::ArenaCollection c(layout);
+    c.set(IGL_NAMEHANDLE("flags"), std::vector<bool>{true, false, true});
+
+    const auto* entry = c.find(IGL_NAMEHANDLE("flags"));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->count, 3u);
+    EXPECT_EQ(entry->stride, layout == uniform::ArenaLayout::Metal ? 1u : 16u);
+    for (size_t i = 0; i < 3; ++i) {
+      bool value = false;
+      ASSERT_TRUE(c.get(IGL_NAMEHANDLE("flags"), value, i));
+      EXPECT_EQ(value, i != 1);
+    }
+  }
+}
+
+TEST_F(UniformArenaCollectionTest, Crc32Collision) {
+  // Two different names with the same CRC32
+  const igl::NameHandle first("first", 42);
+  const igl::NameHandle second("second", 42);
+
+  uniform::ArenaCollection c;
+  c.set(first, 1.0f);
+  c.set(second, 2.0f);
+  ASSERT_EQ(c.entries().size(), 2u);
+  EXPECT_NE(c.find(first), c.find(second));
+
+  float value = 0.0f;
+  ASSERT_TRUE(c.get(first, value));
+  EXPECT_EQ(value, 1.0f);
+  ASSERT_TRUE(c.get(second, value));
+  EXPECT_EQ(value, 2.0f);
+  EXPECT_FALSE(c.contains(igl::NameHandle("third", 42)));
+
+  // Updates match the names, not only the CRC32s
+  uniform::ArenaCollection changes;
+  changes.set(second, 3.0f);
+  c.update(changes);
+  ASSERT_TRUE(c.get(first, value));
+  EXPECT_EQ(value, 1.0f);
+  ASSERT_TRUE(c.get(second, value));
+  EXPECT_EQ(value, 3.0f);
+}
+
+TEST_F(UniformArenaCollectionTest, SetAndGet) {
+  uniform::ArenaCollection c;
+  glm::mat3 matrix(1.0f);
+  matrix[2][1] = 7.0f;
+  c.set(IGL_NAMEHANDLE("matrix"), matrix);
+  c.set(IGL_NAMEHANDLE("color"), glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
+  c.set(IGL_NAMEHANDLE("color"), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+
+  glm::mat3 outMatrix(0.0f);
+  ASSERT_TRUE(c.get(IGL_NAMEHANDLE("matrix"), outMatrix));
+  EXPECT_EQ(outMatrix, matrix);
+
+  glm::vec4 outColor(0.0f);
+  ASSERT_TRUE(c.get(IGL_NAMEHANDLE("color"), outColor));
+  EXPECT_EQ(outColor, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
+  EXPECT_EQ(c.entries().size(), 2u);
+
+  // Wrong type or missing name
+  float outFloat = 0.0f;
+  EXPECT_FALSE(c.get(IGL_NAMEHANDLE("color"), outFloat));
+  EXPECT_FALSE(c.get(IGL_NAMEHANDLE("missing"), outFloat));
+  EXPECT_FALSE(c.contains(IGL_NAMEHANDLE("missing")));
+}
+
+TEST_F(UniformArenaCollectionTest, Update) {
+  uniform::ArenaCollection base;
+  base.set(IGL_NAMEHANDLE("time"), 0.0f);
+  base.set(IGL_NAMEHANDLE("color"), glm::vec4(0.0f));
+
+  // Same layout: the whole arena is copied
+  uniform::ArenaCollection copy = base;
+  EXPECT_TRUE(copy == base);
+  copy.set(IGL_NAMEHANDLE("time"), 2.0f);
+  EXPECT_TRUE(copy.hasSameLayout(base));
+  EXPECT_TRUE(copy != base);
+  base.update(copy);
+  EXPECT_TRUE(copy == base);
+
+  // Different layout: only the uniforms in changes are copied
+  uniform::ArenaCollection changes;
+  changes.set(IGL_NAMEHANDLE("color"), glm::vec4(1.0f));
+  base.update(changes);
+
+  float time = 0.0f;
+  glm::vec4 color(0.0f);
+  ASSERT_TRUE(base.get(IGL_NAMEHANDLE("time"), time));
+  ASSERT_TRUE(base.get(IGL_NAMEHANDLE("color"), color));
+  EXPECT_EQ(time, 2.0f);
+  EXPECT_EQ(color, glm::vec4(1.0f));
+
+  base.clear();
+  EXPECT_EQ(base.numBytes(), 0u);
+  EXPECT_TRUE(base.names().empty());
+}
+
+} // namespace iglu::tests
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/texture_loader/MipmapGenerator.h>
+#include <IGLU/texture_loader/bc7/TextureLoaderFactory.h>
+#include <algorithm>
+#include <astcenc.h>
+#include <bc7decomp.h>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <vector>
+
+namespace igl::tests {
+
+namespace {
+
+using namespace iglu::textureloader;
+
+// Raw RGBA images: "RAW0", width, height, 2 bytes of padding, then the texels of level 0
+constexpr uint32_t kRawHeaderLength = 8;
+
+// Largest difference of a decoded channel from the source
+constexpr int kMaxBlockError = 8;
+
+// The texels form a smooth gradient, which BC7 and ASTC encode with small errors
+std::vector<uint8_t> makeRawImage(uint8_t width, uint8_t height) {
+  std::vector<uint8_t> buffer = {'R', 'A', 'W', '0', width, height, 0, 0};
+  for (size_t y = 0; y < height; ++y) {
+    for (size_t x = 0; x < width; ++x) {
+      const auto v = static_cast<uint8_t>((x + y) * 8);
+      buffer.insert(buffer.end(), {v, static_cast<uint8_t>(255 - v), 64, 255});
+    }
+  }
+  return buffer;
+}
+
+// Decodes every 4x4 block of the encoded mip chain with decodeBlock and compares the texels of each
+// level with the source chain, which is filtered from the image like the loader does
+void expectMatchesImage(const std::vector<uint8_t>& image,
+                        const IData& encoded,
+                        const std::function<void(const uint8_t*, uint8_t*)>& decodeBlock) {
+  TextureDesc desc;
+  desc.type = TextureType::TwoD;
+  desc.format = TextureFormat::RGBA_UNorm8;
+  desc.width = image[4];
+  desc.height = image[5];
+  desc.numMipLevels = TextureDesc::calcNumMipLevels(desc.width, desc.height);
+  std::vector<uint8_t> source(image.begin() + kRawHeaderLength, image.end());
+  source.resize(TextureFormatProperties::fromTextureFormat(desc.format)
+                    .getBytesPerRange(desc.asRange()));
+  ASSERT_TRUE(generateMipmaps(desc, source.data()).isOk());
+
+  const uint8_t* sourceLevel = source.data();
+  const uint8_t* blocks = encoded.data();
+  for (uint32_t level = 0; level < desc.numMipLevels; ++level) {
+    const uint32_t width = std::max(desc.width >> level, 1u);
+    const uint32_t height = std::max(desc.height >> level, 1u);
+    for (uint32_t by = 0; by < (height + 3) / 4; ++by) {
+      for (uint32_t bx = 0; bx < (width + 3) / 4; ++bx) {
+        uint8_t pixels[16 * 4] = {};
+        decodeBlock(blocks, pixels);
+        blocks += 16;
+        for (uint32_t y = by * 4; y < std::min(by * 4 + 4, height); ++y) {
+          for (uint32_t x = bx * 4; x < std::min(bx * 4 + 4, width); ++x) {
+            for (uint32_t c = 0; c < 4; ++c) {
+              const int decoded = pixels[((y - by * 4) * 4 + (x - bx * 4)) * 4 + c];
+              const int expected = sourceLevel[(y * width + x) * 4 + c];
+              ASSERT_LE(std::abs(decoded - expected), kMaxBlockError)
+                  << "level " << level << ", texel " << x << "," << y << ", channel " << c;
+            }
+          }
+        }
+      }
+    }
+    sourceLevel += static_cast<size_t>(width) * height * 4;
+  }
+  ASSERT_EQ(blocks, encoded.data() + encoded.size());
+}
+
+class RawTextureLoader : public ITextureLoader {
+ public:
+  RawTextureLoader(DataReader reader, TextureFormat format) noexcept : ITextureLoader(reader) {
+    auto& desc = mutableDescriptor();
+    desc.type = TextureType::TwoD;
+    desc.format = format;
+    desc.width = reader.data()[4];
+    desc.height = reader.data()[5];
+    desc.numMipLevels = TextureDesc::calcNumMipLevels(desc.width, desc.height);
+  }
+
+ private:
+  std::unique_ptr<IData> loadInternal(Result* IGL_NULLABLE outResult) const noexcept final {
+    const uint32_t length = memorySizeInBytes();
+    auto data = std::make_unique<uint8_t[]>(length);
+    std::memcpy(data.get(), reader().at(kRawHeaderLength), length);
+    return IData::tryCreate(std::move(data), length, outResult);
+  }
+};
+
+class RawTextureLoaderFactory : public ITextureLoaderFactory {
+ public:
+  [[nodiscard]] uint32_t minHeaderLength() const noexcept final {
+    return kRawHeaderLength;
+  }
+
+ private:
+  [[nodiscard]] bool canCreateInternal(DataReader headerReader,
+                                       Result* IGL_NULLABLE outResult) const noexcept final {
+    if (std::memcmp(headerReader.data(), "RAW0", 4) != 0) {
+      Result::setResult(outResult, Result::Code::InvalidOperation, "Incorrect identifier.");
+      return false;
+    }
+    return true;
+  }
+
+  [[nodiscard]] std::unique_ptr<ITextureLoader> tryCreateInternal(
+      DataReader reader,
+      TextureFormat preferredFormat,
+      Result* IGL_NULLABLE /*outResult*/) const noexcept final {
+    return std::make_unique<RawTextureLoader>(
+        reader,
+        preferredFormat != TextureFormat::Invalid ? preferredFormat : TextureFormat::RGBA_UNorm8);
+  }
+};
+
+} // namespace
+
+class Bc7TextureLoaderTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    cacheDirectory_ = std::filesystem::temp_directory_path() / "igl_bc7_cache_test";
+    std::filesystem::remove_all(cacheDirectory_);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(cacheDirectory_);
+  }
+
+ protected:
+  [[nodiscard]] static bc7::TextureLoaderFactory makeFactory(bc7::EncoderDesc desc) {
+    return bc7::TextureLoaderFactory(std::make_unique<RawTextureLoaderFactory>(), std::move(desc));
+  }
+
+  std::filesystem::path cacheDirectory_;
+};
+
+TEST_F(Bc7TextureLoaderTest, EncodesMipChain) {
+  const auto image = makeRawImage(16, 8);
+  auto factory =
+      makeFactory({.quality = bc7::Quality::Fast, .numThreads = 2, .cacheDirectory = {}});
+
+  Result ret;
+  auto loader = factory.tryCreate(image.data(), static_cast<uint32_t>(image.size()), &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  EXPECT_EQ(loader->descriptor().format, TextureFormat::RGBA_BC7_UNORM_4x4);
+  EXPECT_EQ(loader->descriptor().numMipLevels, 5u);
+  EXPECT_FALSE(loader->shouldGenerateMipmaps());
+  // 4x2 blocks, 2x1 blocks, then one block for each of 4x2, 2x1 and 1x1
+  EXPECT_EQ(loader->memorySizeInBytes(), 16u * (8u + 2u + 1u + 1u + 1u));
+
+  auto data = loader->load(&ret);
+  ASSERT_NE(data, nullptr) << ret.message;
+  EXPECT_EQ(data->size(), loader->memorySizeInBytes());
+  const auto decodeBc7 = [](const uint8_t* block, uint8_t* pixels) {
+    ASSERT_TRUE(bc7decomp::unpack_bc7(block, reinterpret_cast<bc7decomp::color_rgba*>(pixels)));
+  };
+  expectMatchesImage(image, *data, decodeBc7);
+
+  loader = factory.tryCreate(
+      image.data(), static_cast<uint32_t>(image.size()), TextureFormat::RGBA_BC7_SRGB_4x4, &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  EXPECT_EQ(loader->descriptor().format, TextureFormat::RGBA_BC7_SRGB_4x4);
+  data = loader->load(&ret);
+  ASSERT_NE(data, nullptr) << ret.message;
+  expectMatchesImage(image, *data, decodeBc7);
+}
+
+TEST_F(Bc7TextureLoaderTest, EncodesAstc) {
+  const auto image = makeRawImage(16, 8);
+  auto factory = makeFactory({.quality = bc7::Quality::Fast, .numThreads = 2});
+
+  for (const auto format : {TextureFormat::RGBA_ASTC_4x4, TextureFormat::SRGB8_A8_ASTC_4x4}) {
+    Result ret;
+    auto loader =
+        factory.tryCreate(image.data(), static_cast<uint32_t>(image.size()), format, &ret);
+    ASSERT_NE(loader, nullptr) << ret.message;
+    EXPECT_EQ(loader->descriptor().format, format);
+    EXPECT_EQ(loader->descriptor().numMipLevels, 5u);
+    // ASTC 4x4 blocks are 16 bytes, like BC7 blocks
+    EXPECT_EQ(loader->memorySizeInBytes(), 16u * (8u + 2u + 1u + 1u + 1u));
+
+    auto data = loader->load(&ret);
+    ASSERT_NE(data, nullptr) << ret.message;
+    EXPECT_EQ(data->size(), loader->memorySizeInBytes());
+
+    // sRGB blocks decode to sRGB encoded texels, which are compared with the source as is
+    const bool srgb = format == TextureFormat::SRGB8_A8_ASTC_4x4;
+    astcenc_config config;
+    ASSERT_EQ(astcenc_config_init(srgb ? ASTCENC_PRF_LDR_SRGB : ASTCENC_PRF_LDR,
+                                  4,
+                                  4,
+                                  1,
+                                  ASTCENC_PRE_FASTEST,
+                                  ASTCENC_FLG_DECOMPRESS_ONLY,
+                                  &config),
+              ASTCENC_SUCCESS);
+    astcenc_context* context = nullptr;
+    ASSERT_EQ(astcenc_context_alloc(&config, 1, &context), ASTCENC_SUCCESS);
+    expectMatchesImage(image, *data, [context](const uint8_t* block, uint8_t* pixels) {
+      void* slice = pixels;
+      astcenc_image decoded = {
+          .dim_x = 4, .dim_y = 4, .dim_z = 1, .data_type = ASTCENC_TYPE_U8, .data = &slice};
+      const astcenc_swizzle swizzle = {ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A};
+      ASSERT_EQ(astcenc_decompress_image(context, block, 16, &decoded, &swizzle, 0),
+                ASTCENC_SUCCESS);
+    });
+    astcenc_context_free(context);
+  }
+}
+
+TEST_F(Bc7TextureLoaderTest, PassesThroughOtherImages) {
+  auto factory = makeFactory({});
+  Result ret;
+
+  // Not a multiple of the block size
+  auto image = makeRawImage(6, 4);
+  auto loader = factory.tryCreate(image.data(), static_cast<uint32_t>(image.size()), &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  EXPECT_EQ(loader->descriptor().format, TextureFormat::RGBA_UNorm8);
+
+  // Uncompressed format requested explicitly
+  image = makeRawImage(8, 8);
+  loader = factory.tryCreate(
+      image.data(), static_cast<uint32_t>(image.size()), TextureFormat::RGBA_UNorm8, &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  EXPECT_EQ(loader->descriptor().format, TextureFormat::RGBA_UNorm8);
+
+  // Unknown identifier
+  image[0] = 'X';
+  EXPECT_EQ(factory.tryCreate(image.data(), static_cast<uint32_t>(image.size()), &ret), nullptr);
+}
+
+TEST_F(Bc7TextureLoaderTest, Cache) {
+  const auto image = makeRawImage(8, 8);
+  auto factory = makeFactory({.cacheDirectory = cacheDirectory_.string()});
+
+  Result ret;
+  auto loader = factory.tryCreate(image.data(), static_cast<uint32_t>(image.size()), &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  auto encoded = loader->load(&ret);
+  ASSERT_NE(encoded, nullptr) << ret.message;
+  ASSERT_EQ(std::distance(std::filesystem::directory_iterator(cacheDirectory_),
+                          std::filesystem::directory_iterator()),
+            1);
+
+  // The second load reads the cache file: overwrite the encoded blocks in it, which re-encoding
+  // would not reproduce
+  const auto cacheFile = std::filesystem::directory_iterator(cacheDirectory_)->path();
+  const auto cacheFileSize = std::filesystem::file_size(cacheFile);
+  ASSERT_GT(cacheFileSize, encoded->size());
+  {
+    std::fstream file(cacheFile, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(cacheFileSize - encoded->size()));
+    const std::vector<char> pattern(encoded->size(), 0x5a);
+    file.write(pattern.data(), static_cast<std::streamsize>(pattern.size()));
+    ASSERT_TRUE(file.good());
+  }
+  auto cached = loader->load(&ret);
+  ASSERT_NE(cached, nullptr) << ret.message;
+  ASSERT_EQ(cached->size(), encoded->size());
+  for (size_t i = 0; i < cached->size(); ++i) {
+    ASSERT_EQ(cached->data()[i], 0x5a) << i;
+  }
+
+  // A different image gets its own cache entry
+  auto other = makeRawImage(8, 8);
+  other.back() = 0;
+  loader = factory.tryCreate(other.data(), static_cast<uint32_t>(other.size()), &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  ASSERT_NE(loader->load(&ret), nullptr) << ret.message;
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator(cacheDirectory_),
+                          std::filesystem::directory_iterator()),
+            2);
+}
+
+} // namespace igl::tests
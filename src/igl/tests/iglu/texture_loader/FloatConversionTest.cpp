@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/texture_loader/FloatConversion.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace igl::tests {
+
+using namespace iglu::textureloader;
+
+TEST(FloatConversionTest, HalfRoundTrip) {
+  // Every finite half value converts to float and back exactly
+  for (uint32_t h = 0; h < 0x10000; ++h) {
+    const auto half = static_cast<uint16_t>(h);
+    if ((half & 0x7c00) == 0x7c00) {
+      continue;
+    }
+    ASSERT_EQ(floatToHalf(halfToFloat(half)), half) << h;
+  }
+  EXPECT_EQ(floatToHalf(1.0f), 0x3c00);
+  EXPECT_EQ(floatToHalf(-2.0f), 0xc000);
+  EXPECT_EQ(floatToHalf(65504.0f), 0x7bff);
+  EXPECT_EQ(floatToHalf(1.0e6f), 0x7c00);
+  EXPECT_TRUE(std::isnan(halfToFloat(floatToHalf(std::numeric_limits<float>::quiet_NaN()))));
+  // Ties round to even
+  EXPECT_EQ(floatToHalf(1.0f + 1.0f / 2048.0f), 0x3c00);
+  EXPECT_EQ(floatToHalf(1.0f + 3.0f / 2048.0f), 0x3c02);
+}
+
+TEST(FloatConversionTest, SharedExponent) {
+  float rgb[3] = {};
+  unpackR9G9B9E5(packR9G9B9E5(1.0f, 0.5f, 0.25f), rgb);
+  EXPECT_EQ(rgb[0], 1.0f);
+  EXPECT_EQ(rgb[1], 0.5f);
+  EXPECT_EQ(rgb[2], 0.25f);
+
+  unpackR9G9B9E5(packR9G9B9E5(-1.0f, std::numeric_limits<float>::quiet_NaN(), 1.0e9f), rgb);
+  EXPECT_EQ(rgb[0], 0.0f);
+  EXPECT_EQ(rgb[1], 0.0f);
+  EXPECT_EQ(rgb[2], 65408.0f);
+
+  EXPECT_EQ(packR9G9B9E5(0.0f, 0.0f, 0.0f), 0u);
+}
+
+TEST(FloatConversionTest, ConvertTexels) {
+  // An odd count exercises both the vectorized and the scalar paths
+  constexpr size_t kNumTexels = 37;
+  std::vector<float> src(kNumTexels * 4);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<float>(i) * 0.37f - 3.0f;
+  }
+
+  std::vector<uint16_t> halfs(src.size());
+  convertRgbaF32ToRgbaF16(src.data(), halfs.data(), kNumTexels);
+  for (size_t i = 0; i < src.size(); ++i) {
+    EXPECT_EQ(halfs[i], floatToHalf(src[i])) << i;
+  }
+
+  std::vector<uint32_t> packed(kNumTexels);
+  convertRgbaF32ToR9G9B9E5(src.data(), packed.data(), kNumTexels);
+  for (size_t i = 0; i < kNumTexels; ++i) {
+    EXPECT_EQ(packed[i], packR9G9B9E5(src[i * 4], src[i * 4 + 1], src[i * 4 + 2])) << i;
+  }
+}
+
+} // namespace igl::tests
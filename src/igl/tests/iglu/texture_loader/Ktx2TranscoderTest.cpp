@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/texture_loader/ktx2/TextureLoaderFactory.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ktx.h>
+#include <numeric>
+#include <vector>
+
+namespace igl::tests {
+
+namespace {
+
+enum class Encoding { Etc1s, Uastc, UastcZstd };
+
+constexpr uint32_t kVkFormatR8G8B8A8Unorm = 37u;
+constexpr uint32_t kVkFormatR8G8B8A8Srgb = 43u;
+
+// Encodes an RGBA image with a full mip chain and returns the KTX2 file
+std::vector<uint8_t> makeBasisFile(Encoding encoding,
+                                   uint32_t width,
+                                   uint32_t height,
+                                   uint32_t numLayers,
+                                   uint32_t numFaces,
+                                   bool srgb) {
+  ktxTextureCreateInfo createInfo = {};
+  createInfo.vkFormat = srgb ? kVkFormatR8G8B8A8Srgb : kVkFormatR8G8B8A8Unorm;
+  createInfo.baseWidth = width;
+  createInfo.baseHeight = height;
+  createInfo.baseDepth = 1;
+  createInfo.numDimensions = 2;
+  createInfo.numLevels = TextureDesc::calcNumMipLevels(width, height);
+  createInfo.numLayers = numLayers;
+  createInfo.numFaces = numFaces;
+  createInfo.isArray = numLayers > 1 ? KTX_TRUE : KTX_FALSE;
+  createInfo.generateMipmaps = KTX_FALSE;
+
+  ktxTexture2* texture = nullptr;
+  if (ktxTexture2_Create(&createInfo, KTX_TEXTURE_CREATE_ALLOC_STORAGE, &texture) != KTX_SUCCESS) {
+    return {};
+  }
+
+  for (uint32_t mipLevel = 0; mipLevel < createInfo.numLevels; ++mipLevel) {
+    const uint32_t levelWidth = std::max(width >> mipLevel, 1u);
+    const uint32_t levelHeight = std::max(height >> mipLevel, 1u);
+    std::vector<uint8_t> texels(static_cast<size_t>(levelWidth) * levelHeight * 4);
+    for (uint32_t layer = 0; layer < numLayers; ++layer) {
+      for (uint32_t face = 0; face < numFaces; ++face) {
+        for (size_t i = 0; i < texels.size(); ++i) {
+          texels[i] = static_cast<uint8_t>(i * 7 + mipLevel * 31 + layer * 57 + face * 83);
+        }
+        ktxTexture_SetImageFromMemory(
+            ktxTexture(texture), mipLevel, layer, face, texels.data(), texels.size());
+      }
+    }
+  }
+
+  ktx_error_code_e result = KTX_SUCCESS;
+  if (encoding == Encoding::Etc1s) {
+    result = ktxTexture2_CompressBasis(texture, 0);
+  } else {
+    ktxBasisParams params = {};
+    params.structSize = sizeof(params);
+    params.uastc = KTX_TRUE;
+    params.uastcFlags = KTX_PACK_UASTC_LEVEL_FASTEST;
+    params.threadCount = 1;
+    result = ktxTexture2_CompressBasisEx(texture, &params);
+    if (result == KTX_SUCCESS && encoding == Encoding::UastcZstd) {
+      result = ktxTexture2_DeflateZstd(texture, 1);
+    }
+  }
+
+  std::vector<uint8_t> file;
+  ktx_uint8_t* bytes = nullptr;
+  ktx_size_t size = 0;
+  if (result == KTX_SUCCESS &&
+      ktxTexture_WriteToMemory(ktxTexture(texture), &bytes, &size) == KTX_SUCCESS) {
+    file.assign(bytes, bytes + size);
+    free(bytes); // NOLINT(cppcoreguidelines-no-malloc)
+  }
+  ktxTexture_Destroy(ktxTexture(texture));
+  return file;
+}
+
+// Transcodes the whole file with libktx on the calling thread
+std::vector<uint8_t> transcodeReference(const std::vector<uint8_t>& file,
+                                        const TextureDesc& desc) {
+  ktxTexture2* texture = nullptr;
+  if (ktxTexture2_CreateFromMemory(
+          file.data(), file.size(), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &texture) !=
+      KTX_SUCCESS) {
+    return {};
+  }
+  const bool astc = desc.format == TextureFormat::RGBA_ASTC_4x4 ||
+                    desc.format == TextureFormat::SRGB8_A8_ASTC_4x4;
+  std::vector<uint8_t> data;
+  if (ktxTexture2_TranscodeBasis(texture, astc ? KTX_TTF_ASTC_4x4_RGBA : KTX_TTF_BC7_RGBA, 0) ==
+      KTX_SUCCESS) {
+    const auto range = desc.asRange();
+    const auto properties = TextureFormatProperties::fromTextureFormat(desc.format);
+    data.resize(properties.getBytesPerRange(range));
+    for (uint32_t mipLevel = 0; mipLevel < desc.numMipLevels; ++mipLevel) {
+      for (uint32_t layer = 0; layer < desc.numLayers; ++layer) {
+        for (uint32_t face = 0; face < range.numFaces; ++face) {
+          const auto imageRange = range.atMipLevel(mipLevel).atLayer(layer).atFace(face);
+          ktx_size_t offset = 0;
+          ktxTexture_GetImageOffset(ktxTexture(texture), mipLevel, layer, face, &offset);
+          std::memcpy(data.data() + properties.getSubRangeByteOffset(range, imageRange),
+                      texture->pData + offset,
+                      properties.getBytesPerRange(imageRange));
+        }
+      }
+    }
+  }
+  ktxTexture_Destroy(ktxTexture(texture));
+  return data;
+}
+
+} // namespace
+
+class Ktx2TranscoderTest : public ::testing::TestWithParam<Encoding> {};
+
+TEST_P(Ktx2TranscoderTest, MatchesSingleThreadedTranscoding) {
+  struct Shape {
+    uint32_t width;
+    uint32_t height;
+    uint32_t numLayers;
+    uint32_t numFaces;
+    bool srgb;
+  };
+  for (const auto& shape : {Shape{64, 32, 1, 1, false},
+                            Shape{32, 32, 3, 1, true},
+                            Shape{16, 16, 1, 6, false}}) {
+    const auto file = makeBasisFile(
+        GetParam(), shape.width, shape.height, shape.numLayers, shape.numFaces, shape.srgb);
+    ASSERT_FALSE(file.empty());
+
+    std::vector<uint32_t> levels;
+    iglu::textureloader::ktx2::TextureLoaderFactory factory({
+        .numThreads = 4,
+        .onLevelTranscoded =
+            [&levels](uint32_t mipLevel, const uint8_t* /*data*/, uint32_t /*length*/) {
+              levels.push_back(mipLevel);
+            },
+    });
+
+    Result ret;
+    auto loader = factory.tryCreate(file.data(), static_cast<uint32_t>(file.size()), &ret);
+    ASSERT_NE(loader, nullptr) << ret.message;
+    const auto& desc = loader->descriptor();
+    EXPECT_EQ(desc.format, iglu::textureloader::ktx2::transcodedFormat(shape.srgb));
+    EXPECT_EQ(desc.numLayers, shape.numLayers);
+    EXPECT_EQ(desc.type,
+              shape.numFaces == 6   ? TextureType::Cube
+              : shape.numLayers > 1 ? TextureType::TwoDArray
+                                    : TextureType::TwoD);
+
+    auto data = loader->load(&ret);
+    ASSERT_NE(data, nullptr) << ret.message;
+    const auto expected = transcodeReference(file, desc);
+    ASSERT_EQ(data->size(), expected.size());
+    EXPECT_EQ(std::memcmp(data->data(), expected.data(), expected.size()), 0);
+
+    // Every level is reported once
+    std::sort(levels.begin(), levels.end());
+    std::vector<uint32_t> expectedLevels(desc.numMipLevels);
+    std::iota(expectedLevels.begin(), expectedLevels.end(), 0u);
+    EXPECT_EQ(levels, expectedLevels);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllEncodings,
+                         Ktx2TranscoderTest,
+                         ::testing::Values(Encoding::Etc1s, Encoding::Uastc, Encoding::UastcZstd));
+
+} // namespace igl::tests
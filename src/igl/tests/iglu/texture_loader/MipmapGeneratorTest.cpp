@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/texture_loader/FloatConversion.h>
+#include <IGLU/texture_loader/MipmapGenerator.h>
+#include <cstring>
+#include <vector>
+
+namespace igl::tests {
+
+using iglu::textureloader::generateMipmaps;
+using iglu::textureloader::MipmapFilter;
+
+namespace {
+
+TextureDesc makeDesc(TextureFormat format,
+                     uint32_t width,
+                     uint32_t height,
+                     uint32_t numLayers = 1) {
+  auto desc = TextureDesc::new2DArray(format, width, height, numLayers, TextureDesc::Sampled);
+  desc.numMipLevels = TextureDesc::calcNumMipLevels(width, height);
+  return desc;
+}
+
+size_t levelOffset(const TextureDesc& desc, uint32_t mipLevel, uint32_t layer = 0) {
+  const auto range = desc.asRange();
+  return TextureFormatProperties::fromTextureFormat(desc.format)
+      .getSubRangeByteOffset(range, range.atMipLevel(mipLevel).atLayer(layer));
+}
+
+std::vector<uint8_t> allocate(const TextureDesc& desc) {
+  return std::vector<uint8_t>(
+      TextureFormatProperties::fromTextureFormat(desc.format).getBytesPerRange(desc.asRange()));
+}
+
+} // namespace
+
+TEST(MipmapGeneratorTest, BoxRgba8) {
+  const auto desc = makeDesc(TextureFormat::RGBA_UNorm8, 4, 2);
+  auto data = allocate(desc);
+  for (size_t i = 0; i < 8; ++i) {
+    const auto v = static_cast<uint8_t>(i * 20);
+    std::memcpy(data.data() + i * 4, std::vector<uint8_t>{v, 255, 0, 255}.data(), 4);
+  }
+  ASSERT_TRUE(generateMipmaps(desc, data.data()).isOk());
+
+  // Level 1 is 2x1: averages of texels {0, 1, 4, 5} and {2, 3, 6, 7}
+  const uint8_t* level1 = data.data() + levelOffset(desc, 1);
+  EXPECT_EQ(level1[0], 50);
+  EXPECT_EQ(level1[1], 255);
+  EXPECT_EQ(level1[4], 90);
+  // Level 2 is 1x1
+  const uint8_t* level2 = data.data() + levelOffset(desc, 2);
+  EXPECT_EQ(level2[0], 70);
+  EXPECT_EQ(level2[3], 255);
+}
+
+TEST(MipmapGeneratorTest, SrgbAveragesInLinearSpace) {
+  const auto desc = makeDesc(TextureFormat::RGBA_SRGB, 2, 1);
+  auto data = allocate(desc);
+  const uint8_t level0[] = {0, 0, 0, 0, 255, 255, 255, 255};
+  std::memcpy(data.data(), level0, sizeof(level0));
+  ASSERT_TRUE(generateMipmaps(desc, data.data()).isOk());
+
+  // Linear 0.5 is 188 in sRGB, while alpha is averaged as is
+  const uint8_t* level1 = data.data() + levelOffset(desc, 1);
+  EXPECT_EQ(level1[0], 188);
+  EXPECT_EQ(level1[3], 128);
+}
+
+TEST(MipmapGeneratorTest, PremultiplyAlpha) {
+  const auto desc = makeDesc(TextureFormat::RGBA_UNorm8, 2, 1);
+  auto data = allocate(desc);
+  const uint8_t level0[] = {255, 0, 0, 255, 0, 255, 0, 0};
+  std::memcpy(data.data(), level0, sizeof(level0));
+
+  ASSERT_TRUE(generateMipmaps(desc, data.data()).isOk());
+  EXPECT_EQ(data[levelOffset(desc, 1) + 1], 128);
+
+  // The green of the transparent texel does not bleed into the result
+  ASSERT_TRUE(generateMipmaps(desc, data.data(), {.premultiplyAlpha = true}).isOk());
+  const uint8_t* level1 = data.data() + levelOffset(desc, 1);
+  EXPECT_EQ(level1[0], 255);
+  EXPECT_EQ(level1[1], 0);
+  EXPECT_EQ(level1[3], 128);
+}
+
+TEST(MipmapGeneratorTest, KaiserFloatFormats) {
+  for (const auto format :
+       {TextureFormat::RGBA_F32, TextureFormat::RGBA_F16, TextureFormat::R9G9B9E5_F}) {
+    // A constant image stays constant on all levels, including odd sizes and edges
+    const auto desc = makeDesc(format, 7, 5, 2);
+    auto data = allocate(desc);
+    std::vector<float> rgba(7 * 5 * 4, 2.0f);
+    for (uint32_t layer = 0; layer < 2; ++layer) {
+      uint8_t* level0 = data.data() + levelOffset(desc, 0, layer);
+      if (format == TextureFormat::RGBA_F32) {
+        std::memcpy(level0, rgba.data(), rgba.size() * sizeof(float));
+      } else if (format == TextureFormat::RGBA_F16) {
+        iglu::textureloader::convertRgbaF32ToRgbaF16(
+            rgba.data(), reinterpret_cast<uint16_t*>(level0), 7 * 5);
+      } else {
+        iglu::textureloader::convertRgbaF32ToR9G9B9E5(
+            rgba.data(), reinterpret_cast<uint32_t*>(level0), 7 * 5);
+      }
+    }
+
+    ASSERT_TRUE(generateMipmaps(desc, data.data(), {.filter = MipmapFilter::Kaiser}).isOk());
+    EXPECT_EQ(desc.numMipLevels, 3u);
+    const uint8_t* level2 = data.data() + levelOffset(desc, 2, 1);
+    float value = 0.0f;
+    if (format == TextureFormat::RGBA_F32) {
+      std::memcpy(&value, level2, sizeof(value));
+    } else if (format == TextureFormat::RGBA_F16) {
+      uint16_t half = 0;
+      std::memcpy(&half, level2, sizeof(half));
+      value = iglu::textureloader::halfToFloat(half);
+    } else {
+      uint32_t packed = 0;
+      std::memcpy(&packed, level2, sizeof(packed));
+      float rgb[3] = {};
+      iglu::textureloader::unpackR9G9B9E5(packed, rgb);
+      value = rgb[0];
+    }
+    EXPECT_NEAR(value, 2.0f, 1e-3f);
+  }
+}
+
+TEST(MipmapGeneratorTest, FloatSource) {
+  // Every level matches the RGBA_F32 chain converted to the compact format, i.e. levels are not
+  // filtered from quantized data
+  const auto descF32 = makeDesc(TextureFormat::RGBA_F32, 16, 8);
+  std::vector<float> rgba(16 * 8 * 4);
+  for (size_t i = 0; i < rgba.size(); ++i) {
+    rgba[i] = static_cast<float>((i * 7919) % 1000) * 0.0137f;
+  }
+  auto chainF32 = allocate(descF32);
+  ASSERT_TRUE(generateMipmaps(descF32, rgba.data(), chainF32.data()).isOk());
+  EXPECT_EQ(std::memcmp(chainF32.data(), rgba.data(), rgba.size() * sizeof(float)), 0);
+
+  const auto desc = makeDesc(TextureFormat::R9G9B9E5_F, 16, 8);
+  auto data = allocate(desc);
+  ASSERT_TRUE(generateMipmaps(desc, rgba.data(), data.data()).isOk());
+  for (uint32_t mipLevel = 0; mipLevel < desc.numMipLevels; ++mipLevel) {
+    const auto numTexels = desc.asRange().atMipLevel(mipLevel).width *
+                           desc.asRange().atMipLevel(mipLevel).height;
+    std::vector<uint32_t> expected(numTexels);
+    iglu::textureloader::convertRgbaF32ToR9G9B9E5(
+        reinterpret_cast<const float*>(chainF32.data() + levelOffset(descF32, mipLevel)),
+        expected.data(),
+        numTexels);
+    EXPECT_EQ(std::memcmp(data.data() + levelOffset(desc, mipLevel),
+                          expected.data(),
+                          numTexels * sizeof(uint32_t)),
+              0)
+        << "mip level " << mipLevel;
+  }
+
+  // Arrays need the overload which decodes level 0 of every layer
+  const auto arrayDesc = makeDesc(TextureFormat::RGBA_F32, 16, 8, 2);
+  auto arrayData = allocate(arrayDesc);
+  EXPECT_EQ(generateMipmaps(arrayDesc, rgba.data(), arrayData.data()).code,
+            Result::Code::Unsupported);
+}
+
+TEST(MipmapGeneratorTest, ThreadsMatchSingleThread) {
+  const auto desc = makeDesc(TextureFormat::RGBA_SRGB, 512, 256);
+  auto data = allocate(desc);
+  for (size_t i = 0; i < 512 * 256 * 4; ++i) {
+    data[i] = static_cast<uint8_t>((i * 7919) >> 3);
+  }
+  auto copy = data;
+
+  for (const auto filter : {MipmapFilter::Box, MipmapFilter::Kaiser}) {
+    ASSERT_TRUE(generateMipmaps(desc, data.data(), {.filter = filter, .numThreads = 1}).isOk());
+    ASSERT_TRUE(generateMipmaps(desc, copy.data(), {.filter = filter, .numThreads = 4}).isOk());
+    EXPECT_EQ(data, copy);
+  }
+}
+
+TEST(MipmapGeneratorTest, UnsupportedFormats) {
+  using iglu::textureloader::isMipmapGenerationSupported;
+  EXPECT_FALSE(isMipmapGenerationSupported(TextureFormat::RGBA_BC7_UNORM_4x4));
+  EXPECT_TRUE(isMipmapGenerationSupported(TextureFormat::BGRA_SRGB));
+
+  const auto desc = makeDesc(TextureFormat::R_UInt16, 4, 4);
+  auto data = allocate(desc);
+  EXPECT_EQ(generateMipmaps(desc, data.data()).code, Result::Code::Unsupported);
+}
+
+} // namespace igl::tests
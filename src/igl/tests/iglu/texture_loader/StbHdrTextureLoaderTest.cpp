@@ -103,6 +103,65 @@ TEST_F(StbHdrTextureLoaderTest, ValidHeaderWithExtraDataSucceeds) {
   EXPECT_TRUE(ret.isOk()) << ret.message;
 }
 
+TEST_F(StbHdrTextureLoaderTest, FormatAndMipLevels) {
+  auto buffer = populateMinimalValidFile(true, 64u, 32u);
+  auto reader =
+      *iglu::textureloader::DataReader::tryCreate(reinterpret_cast<const uint8_t*>(buffer.data()),
+                                                  static_cast<uint32_t>(buffer.size()),
+                                                  nullptr);
+
+  Result ret;
+  auto loader = factory_.tryCreate(reader, &ret);
+  ASSERT_NE(loader, nullptr);
+  EXPECT_EQ(loader->descriptor().format, TextureFormat::RGBA_F32);
+  EXPECT_EQ(loader->descriptor().numMipLevels, 7u);
+  // The mip chain is filtered on the CPU and included in the loaded data
+  EXPECT_FALSE(loader->shouldGenerateMipmaps());
+  const uint32_t numTexels = 64u * 32u + 32u * 16u + 16u * 8u + 8u * 4u + 4u * 2u + 2u + 1u;
+  EXPECT_EQ(loader->memorySizeInBytes(), 16u * numTexels);
+
+  for (const auto format : {TextureFormat::RGBA_F16, TextureFormat::R9G9B9E5_F}) {
+    loader = factory_.tryCreate(reader, format, &ret);
+    ASSERT_NE(loader, nullptr);
+    EXPECT_EQ(loader->descriptor().format, format);
+  }
+
+  // Formats without a conversion from float fall back to RGBA_F32
+  loader = factory_.tryCreate(reader, TextureFormat::RGBA_UNorm8, &ret);
+  ASSERT_NE(loader, nullptr);
+  EXPECT_EQ(loader->descriptor().format, TextureFormat::RGBA_F32);
+}
+
+TEST_F(StbHdrTextureLoaderTest, DecodesMipChain) {
+  // 2x2 image stored as flat RGBE texels; with an exponent of 129 a mantissa of 128 is 1.0
+  auto buffer = populateMinimalValidFile(true, 2u, 2u);
+  const uint8_t texels[] = {128, 0, 0, 129, 0, 128, 0, 129, 0, 0, 128, 129, 128, 128, 128, 129};
+  buffer.append(reinterpret_cast<const char*>(texels), sizeof(texels));
+  auto reader =
+      *iglu::textureloader::DataReader::tryCreate(reinterpret_cast<const uint8_t*>(buffer.data()),
+                                                  static_cast<uint32_t>(buffer.size()),
+                                                  nullptr);
+
+  Result ret;
+  auto loader = factory_.tryCreate(reader, &ret);
+  ASSERT_NE(loader, nullptr) << ret.message;
+  ASSERT_EQ(loader->descriptor().format, TextureFormat::RGBA_F32);
+  ASSERT_EQ(loader->descriptor().numMipLevels, 2u);
+
+  auto data = loader->load(&ret);
+  ASSERT_NE(data, nullptr) << ret.message;
+  ASSERT_EQ(data->size(), 16u * (4u + 1u));
+
+  float values[20] = {};
+  std::memcpy(values, data->data(), sizeof(values));
+  const float level0Texel0[] = {1.0f, 0.0f, 0.0f, 1.0f};
+  const float level1[] = {0.5f, 0.5f, 0.5f, 1.0f};
+  for (size_t c = 0; c < 4; ++c) {
+    EXPECT_FLOAT_EQ(values[c], level0Texel0[c]) << "channel " << c;
+    EXPECT_FLOAT_EQ(values[16 + c], level1[c]) << "channel " << c;
+  }
+}
+
 TEST_F(StbHdrTextureLoaderTest, InsufficientDataFails) {
   std::string buffer = "?RADIANCE\n";
 
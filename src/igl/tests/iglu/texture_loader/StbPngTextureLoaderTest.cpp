@@ -164,5 +164,24 @@ TEST_F(StbPngTextureLoaderTest, PngData2x2Succeeds) {
   EXPECT_NE(data, nullptr);
   ASSERT_TRUE(ret.isOk()) << ret.message;
   EXPECT_EQ(data->size(), 4u * 4u);
+  // Mipmaps are left to the GPU unless the factory opts in to CPU mipmaps
+  EXPECT_TRUE(loader->shouldGenerateMipmaps());
+}
+
+TEST_F(StbPngTextureLoaderTest, PngData2x2CpuMipmaps) {
+  const iglu::textureloader::stb::png::TextureLoaderFactory factory(
+      iglu::textureloader::MipmapGeneratorDesc{});
+  Result ret;
+  auto reader = *iglu::textureloader::DataReader::tryCreate(
+      kRed2x2PNG.data(), static_cast<uint32_t>(kRed2x2PNG.size()), nullptr);
+  auto loader = factory.tryCreate(reader, &ret);
+  ASSERT_NE(loader, nullptr);
+  EXPECT_FALSE(loader->shouldGenerateMipmaps());
+  auto data = loader->load(&ret);
+  ASSERT_NE(data, nullptr);
+  ASSERT_TRUE(ret.isOk()) << ret.message;
+  ASSERT_EQ(data->size(), 4u * 4u + 4u);
+  // The 1x1 level is the average of the red 2x2 image
+  EXPECT_EQ(std::memcmp(data->data() + 16, data->data(), 4), 0);
 }
 } // namespace igl::tests::stb::png
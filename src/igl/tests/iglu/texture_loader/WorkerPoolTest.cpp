@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <IGLU/texture_loader/WorkerPool.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace igl::tests {
+
+using iglu::textureloader::WorkerPool;
+
+TEST(WorkerPoolTest, RunsEveryIndexOnce) {
+  WorkerPool pool(3);
+  EXPECT_EQ(pool.numWorkers(), 3u);
+
+  std::vector<std::atomic<uint32_t>> calls(1000);
+  pool.parallelFor(calls.size(), 0, [&](size_t i) { ++calls[i]; });
+  for (const auto& count : calls) {
+    EXPECT_EQ(count, 1u);
+  }
+
+  // Empty ranges return without calling func
+  pool.parallelFor(0, 0, [](size_t) { FAIL(); });
+}
+
+TEST(WorkerPoolTest, MaxThreads) {
+  WorkerPool pool(3);
+
+  // A single thread is the calling thread
+  const auto caller = std::this_thread::get_id();
+  pool.parallelFor(100, 1, [&](size_t) { EXPECT_EQ(std::this_thread::get_id(), caller); });
+
+  std::atomic<uint32_t> running = 0;
+  std::atomic<uint32_t> maxRunning = 0;
+  pool.parallelFor(64, 2, [&](size_t) {
+    const uint32_t count = ++running;
+    uint32_t expected = maxRunning;
+    while (count > expected && !maxRunning.compare_exchange_weak(expected, count)) {
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    --running;
+  });
+  EXPECT_LE(maxRunning, 2u);
+}
+
+TEST(WorkerPoolTest, NestedAndConcurrentCalls) {
+  WorkerPool pool(2);
+
+  // Callers always make progress themselves, so nested calls on busy workers cannot deadlock
+  std::atomic<uint32_t> total = 0;
+  auto nested = [&] {
+    pool.parallelFor(8, 0, [&](size_t) {
+      pool.parallelFor(16, 0, [&](size_t) { ++total; });
+    });
+  };
+  std::thread other(nested);
+  nested();
+  other.join();
+  EXPECT_EQ(total, 2u * 8u * 16u);
+}
+
+TEST(WorkerPoolTest, NoWorkers) {
+  WorkerPool pool(0);
+  uint32_t sum = 0;
+  pool.parallelFor(10, 0, [&](size_t i) { sum += static_cast<uint32_t>(i); });
+  EXPECT_EQ(sum, 45u);
+}
+
+} // namespace igl::tests
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../data/ShaderData.h"
+#include "../util/Common.h"
+
+#include <chrono>
+#include <thread>
+#include <igl/RenderPipelineState.h>
+#include <igl/ShaderCreator.h>
+#include <igl/VertexInputState.h>
+#include <igl/opengl/Device.h>
+#include <igl/opengl/DeviceFeatureSet.h>
+#include <igl/opengl/IContext.h>
+#include <igl/opengl/RenderPipelineState.h>
+#include <igl/opengl/Shader.h>
+
+namespace igl::tests {
+
+namespace {
+
+const char* kBrokenFragmentShader = R"(
+void main() {
+  gl_FragColor = undeclaredVariable;
+})";
+
+template<typename T>
+bool pollUntilReady(const T& object) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!object.isReady()) {
+    if (std::chrono::steady_clock::now() > deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+} // namespace
+
+//
+// ParallelShaderCompileOGLTest
+//
+// Tests for non-blocking shader compilation with KHR_parallel_shader_compile in OpenGL.
+//
+class ParallelShaderCompileOGLTest : public ::testing::Test {
+ public:
+  ParallelShaderCompileOGLTest() = default;
+  ~ParallelShaderCompileOGLTest() override = default;
+
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_NE(iglDev_, nullptr);
+    ASSERT_NE(cmdQueue_, nullptr);
+
+    context_ = &static_cast<opengl::Device&>(*iglDev_).getContext();
+  }
+
+  void TearDown() override {
+    context_->setParallelShaderCompileEnabled(false);
+  }
+
+ protected:
+  std::shared_ptr<IShaderStages> createStages(const char* fragmentSource, Result* outResult) {
+    return ShaderStagesCreator::fromModuleStringInput(*iglDev_,
+                                                      data::shader::kOglSimpleVertShader.data(),
+                                                      "main",
+                                                      "",
+                                                      fragmentSource,
+                                                      "main",
+                                                      "",
+                                                      outResult);
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+  opengl::IContext* context_ = nullptr;
+};
+
+//
+// SynchronousByDefault
+//
+// Without parallel compilation everything is ready as soon as it is created.
+//
+TEST_F(ParallelShaderCompileOGLTest, SynchronousByDefault) {
+  EXPECT_FALSE(context_->isParallelShaderCompileEnabled());
+
+  Result ret;
+  auto stages = createStages(data::shader::kOglSimpleFragShader.data(), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  EXPECT_TRUE(stages->isReady());
+
+  // compile errors are still reported by module creation
+  createStages(kBrokenFragmentShader, &ret);
+  EXPECT_FALSE(ret.isOk());
+}
+
+//
+// PipelineBecomesReady
+//
+// Create a pipeline while the program is linked in parallel and poll until it is ready.
+//
+TEST_F(ParallelShaderCompileOGLTest, PipelineBecomesReady) {
+  context_->setParallelShaderCompileEnabled(true);
+  if (!context_->isParallelShaderCompileEnabled()) {
+    GTEST_SKIP() << "KHR_parallel_shader_compile not supported";
+  }
+
+  Result ret;
+  std::shared_ptr<IShaderStages> stages =
+      createStages(data::shader::kOglSimpleFragShader.data(), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  VertexInputStateDesc inputDesc;
+  inputDesc.attributes[0].format = VertexAttributeFormat::Float4;
+  inputDesc.attributes[0].offset = 0;
+  inputDesc.attributes[0].bufferIndex = 0;
+  inputDesc.attributes[0].name = "position_in";
+  inputDesc.attributes[0].location = 0;
+  inputDesc.inputBindings[0].stride = sizeof(float) * 4;
+  inputDesc.numAttributes = inputDesc.numInputBindings = 1;
+  auto vertexInputState = iglDev_->createVertexInputState(inputDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  RenderPipelineDesc pipelineDesc;
+  pipelineDesc.vertexInputState = vertexInputState;
+  pipelineDesc.shaderStages = stages;
+  pipelineDesc.targetDesc.colorAttachments.resize(1);
+  pipelineDesc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+  pipelineDesc.fragmentUnitSamplerMap[0] = IGL_NAMEHANDLE("inputImage");
+  auto pipelineState = iglDev_->createRenderPipeline(pipelineDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  ASSERT_TRUE(pollUntilReady(*pipelineState));
+  EXPECT_TRUE(stages->isReady());
+  EXPECT_TRUE(static_cast<opengl::ShaderStages&>(*stages).waitForLink().isOk());
+  EXPECT_GE(pipelineState->getIndexByName(IGL_NAMEHANDLE("inputImage"), ShaderStage::Fragment),
+            0);
+  EXPECT_TRUE(static_cast<opengl::RenderPipelineState&>(*pipelineState).getVertexBufferMask()[0]);
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+//
+// DeferredCompileError
+//
+// Compile errors are reported when the program finishes linking.
+//
+TEST_F(ParallelShaderCompileOGLTest, DeferredCompileError) {
+  context_->setParallelShaderCompileEnabled(true);
+  if (!context_->isParallelShaderCompileEnabled()) {
+    GTEST_SKIP() << "KHR_parallel_shader_compile not supported";
+  }
+
+  Result ret;
+  auto stages = createStages(kBrokenFragmentShader, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(stages, nullptr);
+
+  ASSERT_TRUE(pollUntilReady(*stages));
+  const Result linkResult = static_cast<opengl::ShaderStages&>(*stages).waitForLink();
+  EXPECT_FALSE(linkResult.isOk());
+  EXPECT_FALSE(linkResult.message.empty());
+}
+
+//
+// DeferredLinkErrorSkipsBind
+//
+// A pipeline whose program fails to link in parallel reports the failure and never makes the
+// program current.
+//
+TEST_F(ParallelShaderCompileOGLTest, DeferredLinkErrorSkipsBind) {
+  context_->setParallelShaderCompileEnabled(true);
+  if (!context_->isParallelShaderCompileEnabled()) {
+    GTEST_SKIP() << "KHR_parallel_shader_compile not supported";
+  }
+
+  Result ret;
+  std::shared_ptr<IShaderStages> stages = createStages(kBrokenFragmentShader, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(stages, nullptr);
+
+  RenderPipelineDesc pipelineDesc;
+  pipelineDesc.shaderStages = stages;
+  pipelineDesc.targetDesc.colorAttachments.resize(1);
+  pipelineDesc.targetDesc.colorAttachments[0].textureFormat = TextureFormat::RGBA_UNorm8;
+  auto pipelineState = iglDev_->createRenderPipeline(pipelineDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(pipelineState, nullptr);
+
+  auto& oglPipelineState = static_cast<opengl::RenderPipelineState&>(*pipelineState);
+  EXPECT_FALSE(oglPipelineState.getLinkResult().isOk());
+
+  oglPipelineState.bind();
+  GLint currentProgram = -1;
+  context_->getIntegerv(GL_CURRENT_PROGRAM, &currentProgram);
+  EXPECT_EQ(currentProgram, 0);
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+} // namespace igl::tests
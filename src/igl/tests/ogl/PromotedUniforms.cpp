@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <igl/opengl/PromotedUniforms.h>
+
+#include "../data/VertexIndexData.h"
+#include "../util/Common.h"
+
+#include <array>
+#include <string>
+#include <igl/CommandBuffer.h>
+#include <igl/RenderPass.h>
+#include <igl/RenderPipelineState.h>
+#include <igl/ShaderCreator.h>
+#include <igl/VertexInputState.h>
+#include <igl/opengl/Device.h>
+#include <igl/opengl/IContext.h>
+#include <igl/opengl/Shader.h>
+#include <igl/opengl/Version.h>
+
+namespace igl::tests {
+
+using opengl::PromotedUniforms;
+
+namespace {
+
+constexpr uint32_t kOffscreenTexWidth = 2;
+constexpr uint32_t kOffscreenTexHeight = 2;
+
+const char* kVertexShaderBody = R"(
+in vec4 position;
+uniform float scale;
+uniform mat4 unusedMatrix;
+void main() {
+  gl_Position = vec4(position.xyz * scale, 1.0);
+})";
+
+const char* kFragmentShaderBody = R"(
+precision highp float;
+uniform vec4 color;
+uniform bool useColor;
+out vec4 fragColor;
+void main() {
+  fragColor = useColor ? color : vec4(0.0);
+})";
+
+} // namespace
+
+//
+// PromotedUniformsOGLTest
+//
+// Tests for promotion of loose uniforms into uniform blocks in OpenGL.
+//
+class PromotedUniformsOGLTest : public ::testing::Test {
+ public:
+  PromotedUniformsOGLTest() = default;
+  ~PromotedUniformsOGLTest() override = default;
+
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_NE(iglDev_, nullptr);
+    ASSERT_NE(cmdQueue_, nullptr);
+
+    context_ = &static_cast<opengl::Device&>(*iglDev_).getContext();
+  }
+
+  void TearDown() override {
+    context_->setUniformBlockPromotionEnabled(false);
+  }
+
+ protected:
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+  opengl::IContext* context_ = nullptr;
+};
+
+//
+// RewriteShaderSource
+//
+// Check the std140 layout of promoted uniforms and which declarations are left untouched.
+//
+TEST_F(PromotedUniformsOGLTest, RewriteShaderSource) {
+  const char* source = R"(#version 300 es
+precision highp float;
+uniform mat4 mvp; uniform float scale, bias[3];
+uniform vec3 tint;
+uniform bool flag;
+uniform sampler2D tex;
+layout(std140) uniform Block { vec4 x; };
+uniform vec4 initialized = vec4(1.0);
+struct S { vec4 member; };
+uniform vec4 member;
+uniform vec2 shadowed;
+#ifdef FOO
+uniform float conditional;
+#endif
+void main() {
+  float shadowed = scale;
+}
+)";
+
+  PromotedUniforms::StageBlock block;
+  const std::string rewritten =
+      PromotedUniforms::rewriteShaderSource(source, ShaderStage::Vertex, block);
+  ASSERT_FALSE(rewritten.empty());
+
+  EXPECT_EQ(block.blockName, PromotedUniforms::kVertexBlockName);
+  ASSERT_EQ(block.members.size(), 5u);
+  EXPECT_EQ(block.members[0].name, "mvp");
+  EXPECT_EQ(block.members[0].offset, 0u);
+  EXPECT_EQ(block.members[1].name, "scale");
+  EXPECT_EQ(block.members[1].offset, 64u);
+  EXPECT_EQ(block.members[2].name, "bias");
+  EXPECT_EQ(block.members[2].offset, 80u);
+  EXPECT_EQ(block.members[2].numElements, 3u);
+  EXPECT_EQ(block.members[3].name, "tint");
+  EXPECT_EQ(block.members[3].offset, 128u);
+  EXPECT_EQ(block.members[4].name, "flag");
+  EXPECT_EQ(block.members[4].type, UniformType::Boolean);
+  EXPECT_EQ(block.members[4].offset, 140u);
+  EXPECT_EQ(block.size, 144u);
+
+  EXPECT_NE(rewritten.find("#define scale iglPromotedUniformsVS.scale"), std::string::npos);
+  EXPECT_NE(rewritten.find("uniform sampler2D tex;"), std::string::npos);
+  EXPECT_NE(rewritten.find("uniform vec4 initialized"), std::string::npos);
+  EXPECT_NE(rewritten.find("uniform vec4 member;"), std::string::npos);
+  EXPECT_NE(rewritten.find("uniform vec2 shadowed;"), std::string::npos);
+  EXPECT_NE(rewritten.find("uniform float conditional;"), std::string::npos);
+
+  // GLSL versions without uniform blocks are left alone
+  EXPECT_TRUE(PromotedUniforms::rewriteShaderSource(
+                  "#version 100\nuniform float x;\n", ShaderStage::Vertex, block)
+                  .empty());
+  EXPECT_TRUE(block.empty());
+  EXPECT_TRUE(
+      PromotedUniforms::rewriteShaderSource("uniform float x;\n", ShaderStage::Fragment, block)
+          .empty());
+}
+
+//
+// RenderWithPromotedUniforms
+//
+// Render with promoted uniforms and check that updates reach the shader.
+//
+TEST_F(PromotedUniformsOGLTest, RenderWithPromotedUniforms) {
+  const ShaderVersion shaderVersion = iglDev_->getShaderVersion();
+  const bool isES = shaderVersion.family == ShaderFamily::GlslEs;
+  const uint32_t version = shaderVersion.majorVersion * 100 + shaderVersion.minorVersion;
+  if (!iglDev_->hasFeature(DeviceFeatures::UniformBlocks) || version < (isES ? 300u : 150u)) {
+    GTEST_SKIP() << "Uniform block promotion not supported";
+  }
+
+  context_->setUniformBlockPromotionEnabled(true);
+
+  Result ret;
+  const std::string versionString = opengl::getStringFromShaderVersion(shaderVersion);
+  const std::string vs = versionString + kVertexShaderBody;
+  const std::string fs = versionString + kFragmentShaderBody;
+  std::shared_ptr<IShaderStages> stages = ShaderStagesCreator::fromModuleStringInput(
+      *iglDev_, vs.c_str(), "main", "", fs.c_str(), "main", "", &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  const PromotedUniforms* promoted =
+      static_cast<opengl::ShaderStages&>(*stages).getPromotedUniforms();
+  ASSERT_NE(promoted, nullptr);
+  EXPECT_EQ(promoted->getUniforms().size(), 4u);
+
+  auto texture = iglDev_->createTexture(
+      TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                         kOffscreenTexWidth,
+                         kOffscreenTexHeight,
+                         TextureDesc::TextureUsageBits::Sampled |
+                             TextureDesc::TextureUsageBits::Attachment),
+      &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  FramebufferDesc framebufferDesc;
+  framebufferDesc.colorAttachments[0].texture = texture;
+  auto framebuffer = iglDev_->createFramebuffer(framebufferDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  VertexInputStateDesc inputDesc;
+  inputDesc.attributes[0].format = VertexAttributeFormat::Float4;
+  inputDesc.attributes[0].offset = 0;
+  inputDesc.attributes[0].bufferIndex = 0;
+  inputDesc.attributes[0].name = "position";
+  inputDesc.attributes[0].location = 0;
+  inputDesc.inputBindings[0].stride = sizeof(float) * 4;
+  inputDesc.numAttributes = inputDesc.numInputBindings = 1;
+  auto vertexInputState = iglDev_->createVertexInputState(inputDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  BufferDesc vbDesc;
+  vbDesc.type = BufferDesc::BufferTypeBits::Vertex;
+  vbDesc.data = data::vertex_index::kQuadVert.data();
+  vbDesc.length = sizeof(data::vertex_index::kQuadVert);
+  auto vb = iglDev_->createBuffer(vbDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  BufferDesc ibDesc;
+  ibDesc.type = BufferDesc::BufferTypeBits::Index;
+  ibDesc.data = data::vertex_index::kQuadInd.data();
+  ibDesc.length = sizeof(data::vertex_index::kQuadInd);
+  auto ib = iglDev_->createBuffer(ibDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  RenderPipelineDesc pipelineDesc;
+  pipelineDesc.vertexInputState = vertexInputState;
+  pipelineDesc.shaderStages = stages;
+  pipelineDesc.targetDesc.colorAttachments.resize(1);
+  pipelineDesc.targetDesc.colorAttachments[0].textureFormat = texture->getFormat();
+  pipelineDesc.cullMode = CullMode::Disabled;
+  auto pipelineState = iglDev_->createRenderPipeline(pipelineDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  UniformDesc scaleDesc;
+  scaleDesc.location = pipelineState->getIndexByName(genNameHandle("scale"), ShaderStage::Vertex);
+  scaleDesc.type = UniformType::Float;
+  UniformDesc colorDesc;
+  colorDesc.location =
+      pipelineState->getIndexByName(genNameHandle("color"), ShaderStage::Fragment);
+  colorDesc.type = UniformType::Float4;
+  UniformDesc useColorDesc;
+  useColorDesc.location =
+      pipelineState->getIndexByName(genNameHandle("useColor"), ShaderStage::Fragment);
+  useColorDesc.type = UniformType::Boolean;
+  ASSERT_GE(scaleDesc.location, 0);
+  ASSERT_GE(colorDesc.location, 0);
+  ASSERT_GE(useColorDesc.location, 0);
+
+  RenderPassDesc renderPass;
+  renderPass.colorAttachments.resize(1);
+  renderPass.colorAttachments[0].loadAction = LoadAction::Clear;
+  renderPass.colorAttachments[0].storeAction = StoreAction::Store;
+  renderPass.colorAttachments[0].clearColor = {0.0, 0.0, 0.0, 0.0};
+
+  const auto renderAndReadPixel = [&](const std::array<float, 4>& color) -> uint32_t {
+    auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+    auto encoder = cmdBuf->createRenderCommandEncoder(renderPass, framebuffer);
+    encoder->bindRenderPipelineState(pipelineState);
+    encoder->bindVertexBuffer(0, *vb);
+    encoder->bindIndexBuffer(*ib, IndexFormat::UInt16);
+    const float scale = 1.0f;
+    const bool useColor = true;
+    encoder->bindUniform(scaleDesc, &scale);
+    encoder->bindUniform(colorDesc, color.data());
+    encoder->bindUniform(useColorDesc, &useColor);
+    encoder->drawIndexed(6);
+    encoder->endEncoding();
+    cmdQueue_->submit(*cmdBuf);
+
+    std::array<uint32_t, kOffscreenTexWidth * kOffscreenTexHeight> pixels{};
+    framebuffer->copyBytesColorAttachment(
+        *cmdQueue_,
+        0,
+        pixels.data(),
+        TextureRangeDesc::new2D(0, 0, kOffscreenTexWidth, kOffscreenTexHeight));
+    return pixels[0];
+  };
+
+  EXPECT_EQ(renderAndReadPixel({1.0f, 0.0f, 0.0f, 1.0f}), 0xFF0000FFu);
+  EXPECT_EQ(renderAndReadPixel({0.0f, 1.0f, 0.0f, 1.0f}), 0xFF00FF00u);
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+} // namespace igl::tests
@@ -21,6 +21,7 @@
 #include <igl/VertexInputState.h>
 #include <igl/opengl/Device.h>
 #include <igl/opengl/IContext.h>
+#include <igl/opengl/VertexArrayObjectCache.h>
 
 namespace igl::tests {
 
@@ -361,4 +362,130 @@ TEST_F(RenderCommandAdapterOGLTest, DrawCountIncrement) {
   ASSERT_GT(drawCountAfter, drawCountBefore);
 }
 
+//
+// VertexArrayObjectCache
+//
+// Draw the same mesh repeatedly with the VAO cache enabled: the VAO is created once and reused
+// across draws and render passes, and the rendered output is unchanged.
+//
+TEST_F(RenderCommandAdapterOGLTest, VertexArrayObjectCache) {
+  if (!context_->deviceFeatures().hasInternalFeature(opengl::InternalFeatures::VertexArrayObject)) {
+    GTEST_SKIP() << "VertexArrayObject not supported";
+  }
+
+  context_->setVertexArrayObjectCacheEnabled(true);
+  ASSERT_TRUE(context_->isVertexArrayObjectCacheEnabled());
+  auto* cache = context_->getVertexArrayObjectCache();
+  ASSERT_NE(cache, nullptr);
+  const auto statsBefore = cache->getStats();
+
+  Result ret;
+  for (int pass = 0; pass != 2; pass++) {
+    auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+    ASSERT_EQ(ret.code, Result::Code::Ok);
+
+    auto cmdEncoder = cmdBuf->createRenderCommandEncoder(renderPass_, framebuffer_);
+    ASSERT_NE(cmdEncoder, nullptr);
+
+    cmdEncoder->bindRenderPipelineState(pipelineState_);
+    cmdEncoder->bindVertexBuffer(data::shader::kSimplePosIndex, *vb_);
+    cmdEncoder->bindVertexBuffer(data::shader::kSimpleUvIndex, *uvb_);
+    cmdEncoder->bindTexture(0, igl::BindTarget::kFragment, inputTexture_.get());
+    cmdEncoder->bindSamplerState(0, igl::BindTarget::kFragment, sampler_.get());
+    cmdEncoder->bindIndexBuffer(*ib_, IndexFormat::UInt16);
+
+    cmdEncoder->drawIndexed(6);
+    // rebinding the same buffers hits the cache
+    cmdEncoder->bindVertexBuffer(data::shader::kSimplePosIndex, *vb_);
+    cmdEncoder->drawIndexed(6);
+    cmdEncoder->endEncoding();
+
+    cmdQueue_->submit(*cmdBuf);
+  }
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+
+  const auto& stats = cache->getStats();
+  EXPECT_EQ(stats.numMisses - statsBefore.numMisses, 1u);
+  EXPECT_EQ(stats.numHits - statsBefore.numHits, 3u);
+
+  std::array<uint32_t, OFFSCREEN_TEX_WIDTH * OFFSCREEN_TEX_HEIGHT> pixels{};
+  framebuffer_->copyBytesColorAttachment(
+      *cmdQueue_,
+      0,
+      pixels.data(),
+      TextureRangeDesc::new2D(0, 0, OFFSCREEN_TEX_WIDTH, OFFSCREEN_TEX_HEIGHT));
+  for (auto px : pixels) {
+    ASSERT_NE(px, 0u);
+  }
+
+  context_->setVertexArrayObjectCacheEnabled(false);
+  EXPECT_EQ(cache->size(), 0u);
+}
+
+//
+// VertexArrayObjectCacheBufferDeletion
+//
+// Deleting a buffer drops all cached VAOs referencing it, since GL buffer names can be reused.
+//
+TEST_F(RenderCommandAdapterOGLTest, VertexArrayObjectCacheBufferDeletion) {
+  if (!context_->deviceFeatures().hasInternalFeature(opengl::InternalFeatures::VertexArrayObject)) {
+    GTEST_SKIP() << "VertexArrayObject not supported";
+  }
+
+  context_->setVertexArrayObjectCacheEnabled(true);
+  auto* cache = context_->getVertexArrayObjectCache();
+  ASSERT_NE(cache, nullptr);
+  cache->clear();
+
+  Result ret;
+  std::unique_ptr<IBuffer> tempVB = iglDev_->createBuffer(
+      BufferDesc(BufferDesc::BufferTypeBits::Vertex,
+                 data::vertex_index::kQuadVert.data(),
+                 sizeof(data::vertex_index::kQuadVert)),
+      &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_EQ(ret.code, Result::Code::Ok);
+  auto cmdEncoder = cmdBuf->createRenderCommandEncoder(renderPass_, framebuffer_);
+  ASSERT_NE(cmdEncoder, nullptr);
+
+  cmdEncoder->bindRenderPipelineState(pipelineState_);
+  cmdEncoder->bindVertexBuffer(data::shader::kSimpleUvIndex, *uvb_);
+  cmdEncoder->bindIndexBuffer(*ib_, IndexFormat::UInt16);
+  cmdEncoder->bindVertexBuffer(data::shader::kSimplePosIndex, *vb_);
+  cmdEncoder->drawIndexed(6);
+  cmdEncoder->bindVertexBuffer(data::shader::kSimplePosIndex, *tempVB);
+  cmdEncoder->drawIndexed(6);
+  cmdEncoder->endEncoding();
+  cmdQueue_->submit(*cmdBuf);
+
+  EXPECT_EQ(cache->size(), 2u);
+
+  const auto numInvalidations = cache->getStats().numInvalidations;
+  tempVB = nullptr;
+
+  EXPECT_EQ(cache->size(), 1u);
+  EXPECT_EQ(cache->getStats().numInvalidations, numInvalidations + 1);
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+
+  context_->setVertexArrayObjectCacheEnabled(false);
+}
+
+//
+// VertexArrayObjectCacheIds
+//
+// Pipelines remember their layout id per cache id. A cache allocated at the address of a destroyed
+// cache must not be mistaken for it.
+//
+TEST_F(RenderCommandAdapterOGLTest, VertexArrayObjectCacheIds) {
+  auto cache = std::make_unique<opengl::VertexArrayObjectCache>(*context_);
+  const uint64_t firstId = cache->getCacheId();
+  EXPECT_NE(firstId, 0u);
+  cache.reset();
+  cache = std::make_unique<opengl::VertexArrayObjectCache>(*context_);
+  EXPECT_NE(cache->getCacheId(), firstId);
+}
+
 } // namespace igl::tests
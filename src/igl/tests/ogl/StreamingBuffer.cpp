@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "../util/Common.h"
+
+#include <array>
+#include <cstring>
+#include <igl/CommandBuffer.h>
+#include <igl/opengl/Buffer.h>
+#include <igl/opengl/Device.h>
+#include <igl/opengl/DeviceFeatureSet.h>
+#include <igl/opengl/IContext.h>
+
+namespace igl::tests {
+
+//
+// StreamingBufferOGLTest
+//
+// Tests for streaming (BufferAPIHintBits::Ring) buffers in OpenGL.
+//
+class StreamingBufferOGLTest : public ::testing::Test {
+ public:
+  StreamingBufferOGLTest() = default;
+  ~StreamingBufferOGLTest() override = default;
+
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_NE(iglDev_, nullptr);
+    ASSERT_NE(cmdQueue_, nullptr);
+
+    context_ = &static_cast<opengl::Device&>(*iglDev_).getContext();
+  }
+
+  void TearDown() override {}
+
+ protected:
+  std::unique_ptr<IBuffer> createStreamingBuffer(BufferDesc::BufferType type,
+                                                 const void* data,
+                                                 size_t length) {
+    Result ret;
+    BufferDesc desc;
+    desc.type = type;
+    desc.data = data;
+    desc.length = length;
+    desc.storage = ResourceStorage::Shared;
+    desc.hint = BufferDesc::BufferAPIHintBits::Ring;
+    if (type == BufferDesc::BufferTypeBits::Uniform) {
+      desc.hint |= BufferDesc::BufferAPIHintBits::UniformBlock;
+    }
+    auto buffer = iglDev_->createBuffer(desc, &ret);
+    EXPECT_TRUE(ret.isOk()) << ret.message.c_str();
+    return buffer;
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+  opengl::IContext* context_ = nullptr;
+};
+
+//
+// FrameFences
+//
+// Check that submitting with endOfFrame advances the frame index and that waiting for a frame
+// returns once the GPU completed it.
+//
+TEST_F(StreamingBufferOGLTest, FrameFences) {
+  const uint64_t firstFrame = context_->getFrameIndex();
+
+  Result ret;
+  auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  cmdQueue_->submit(*cmdBuf);
+  EXPECT_EQ(context_->getFrameIndex(), firstFrame);
+
+  cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  cmdQueue_->submit(*cmdBuf, true);
+  EXPECT_EQ(context_->getFrameIndex(), firstFrame + 1);
+
+  context_->endFrame();
+  EXPECT_EQ(context_->getFrameIndex(), firstFrame + 2);
+
+  context_->waitForFrame(firstFrame + 1);
+  // the current frame has not ended, so this falls back to glFinish()
+  context_->waitForFrame(context_->getFrameIndex());
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+//
+// UploadAcrossFrames
+//
+// Upload partial ranges over several frames, binding the buffer once per frame, and check that
+// every region of a persistently mapped buffer ends up with the latest contents.
+//
+TEST_F(StreamingBufferOGLTest, UploadAcrossFrames) {
+  std::array<uint32_t, 16> expected{};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = static_cast<uint32_t>(i);
+  }
+  auto buffer = createStreamingBuffer(
+      BufferDesc::BufferTypeBits::Vertex, expected.data(), sizeof(expected));
+  ASSERT_NE(buffer, nullptr);
+
+  auto& glBuffer = static_cast<opengl::ArrayBuffer&>(*buffer);
+  ASSERT_TRUE(glBuffer.isStreaming());
+  EXPECT_NE(buffer->acceptedApiHints() & BufferDesc::BufferAPIHintBits::Ring, 0);
+  const bool hasBufferStorage =
+      context_->deviceFeatures().hasInternalFeature(opengl::InternalFeatures::BufferStorage);
+  EXPECT_EQ(glBuffer.isPersistentlyMapped(), hasBufferStorage);
+
+  std::array<size_t, opengl::IContext::kMaxFramesInFlight + 1> bindOffsets{};
+  for (size_t frame = 0; frame < bindOffsets.size(); ++frame) {
+    // update a different element each frame
+    const uint32_t value = 100 + static_cast<uint32_t>(frame);
+    expected[frame] = value;
+    const BufferRange range(sizeof(value), frame * sizeof(uint32_t));
+    ASSERT_TRUE(buffer->upload(&value, range).isOk());
+    // a second update before the region is bound stays in the same region
+    const size_t bindOffset = glBuffer.getBindOffset();
+    ASSERT_TRUE(buffer->upload(&value, range).isOk());
+    EXPECT_EQ(glBuffer.getBindOffset(), bindOffset);
+    // what a draw using the buffer does
+    bindOffsets[frame] = glBuffer.acquireBindOffset();
+    context_->endFrame();
+  }
+
+  if (glBuffer.isPersistentlyMapped()) {
+    EXPECT_NE(bindOffsets[0], bindOffsets[1]);
+    EXPECT_NE(bindOffsets[1], bindOffsets[2]);
+    EXPECT_EQ(bindOffsets[0], bindOffsets[opengl::IContext::kMaxFramesInFlight]);
+    EXPECT_EQ(glBuffer.getBindOffset() % 16, 0u);
+  } else {
+    EXPECT_EQ(glBuffer.getBindOffset(), 0u);
+  }
+
+  Result ret;
+  auto* mapped = buffer->map(BufferRange(sizeof(expected), 0), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(mapped, nullptr);
+  EXPECT_EQ(std::memcmp(mapped, expected.data(), sizeof(expected)), 0);
+  buffer->unmap();
+
+  // read back the current region on the GPU side
+  if (iglDev_->hasFeature(DeviceFeatures::CopyBuffer) &&
+      iglDev_->hasFeature(DeviceFeatures::MapBufferRange)) {
+    BufferDesc readbackDesc;
+    readbackDesc.type = BufferDesc::BufferTypeBits::Vertex;
+    readbackDesc.length = sizeof(expected);
+    readbackDesc.storage = ResourceStorage::Shared;
+    auto readback = iglDev_->createBuffer(readbackDesc, &ret);
+    ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+    auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+    ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+    cmdBuf->copyBuffer(*buffer, *readback, 0, 0, sizeof(expected));
+    cmdQueue_->submit(*cmdBuf);
+
+    auto* readbackData = readback->map(BufferRange(sizeof(expected), 0), &ret);
+    ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+    ASSERT_NE(readbackData, nullptr);
+    EXPECT_EQ(std::memcmp(readbackData, expected.data(), sizeof(expected)), 0);
+    readback->unmap();
+  }
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+//
+// UploadAfterBind
+//
+// An upload after the buffer was bound in the same frame must not overwrite the region the GPU may
+// still read.
+//
+TEST_F(StreamingBufferOGLTest, UploadAfterBind) {
+  std::array<uint32_t, 4> expected = {1, 2, 3, 4};
+  auto buffer = createStreamingBuffer(
+      BufferDesc::BufferTypeBits::Vertex, expected.data(), sizeof(expected));
+  ASSERT_NE(buffer, nullptr);
+  auto& glBuffer = static_cast<opengl::ArrayBuffer&>(*buffer);
+  ASSERT_TRUE(glBuffer.isStreaming());
+
+  std::array<size_t, opengl::IContext::kMaxFramesInFlight + 1> bindOffsets{};
+  for (size_t i = 0; i < bindOffsets.size(); ++i) {
+    expected[0] = 10 + static_cast<uint32_t>(i);
+    ASSERT_TRUE(buffer->upload(expected.data(), BufferRange(sizeof(uint32_t), 0)).isOk());
+    bindOffsets[i] = glBuffer.acquireBindOffset();
+  }
+
+  if (glBuffer.isPersistentlyMapped()) {
+    // every upload moved to the next region; wrapping around waits for the GPU
+    EXPECT_NE(bindOffsets[0], bindOffsets[1]);
+    EXPECT_NE(bindOffsets[1], bindOffsets[2]);
+    EXPECT_EQ(bindOffsets[0], bindOffsets[opengl::IContext::kMaxFramesInFlight]);
+  }
+
+  Result ret;
+  auto* mapped = buffer->map(BufferRange(sizeof(expected), 0), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(mapped, nullptr);
+  EXPECT_EQ(std::memcmp(mapped, expected.data(), sizeof(expected)), 0);
+  buffer->unmap();
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+//
+// CopyIntoStreamingBuffer
+//
+// copyBuffer() into a streaming buffer has to update the CPU shadow copy too.
+//
+TEST_F(StreamingBufferOGLTest, CopyIntoStreamingBuffer) {
+  if (!iglDev_->hasFeature(DeviceFeatures::CopyBuffer) ||
+      !iglDev_->hasFeature(DeviceFeatures::MapBufferRange)) {
+    GTEST_SKIP() << "Buffer copies not supported";
+  }
+
+  const std::array<uint32_t, 4> source = {5, 6, 7, 8};
+  Result ret;
+  BufferDesc srcDesc;
+  srcDesc.type = BufferDesc::BufferTypeBits::Vertex;
+  srcDesc.data = source.data();
+  srcDesc.length = sizeof(source);
+  srcDesc.storage = ResourceStorage::Shared;
+  auto src = iglDev_->createBuffer(srcDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  std::array<uint32_t, 4> expected = {1, 2, 3, 4};
+  auto buffer = createStreamingBuffer(
+      BufferDesc::BufferTypeBits::Vertex, expected.data(), sizeof(expected));
+  ASSERT_NE(buffer, nullptr);
+
+  auto cmdBuf = cmdQueue_->createCommandBuffer({}, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  cmdBuf->copyBuffer(*src, *buffer, sizeof(uint32_t), 2 * sizeof(uint32_t), 2 * sizeof(uint32_t));
+  cmdQueue_->submit(*cmdBuf);
+  expected[2] = source[1];
+  expected[3] = source[2];
+
+  auto* mapped = buffer->map(BufferRange(sizeof(expected), 0), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(mapped, nullptr);
+  EXPECT_EQ(std::memcmp(mapped, expected.data(), sizeof(expected)), 0);
+  buffer->unmap();
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+//
+// UniformBlockBindRange
+//
+// Bind the current region of a streaming uniform block buffer.
+//
+TEST_F(StreamingBufferOGLTest, UniformBlockBindRange) {
+  if (!iglDev_->hasFeature(DeviceFeatures::UniformBlocks)) {
+    GTEST_SKIP() << "Uniform blocks not supported";
+  }
+
+  const std::array<float, 4> data = {1.0f, 2.0f, 3.0f, 4.0f};
+  auto buffer =
+      createStreamingBuffer(BufferDesc::BufferTypeBits::Uniform, data.data(), sizeof(data));
+  ASSERT_NE(buffer, nullptr);
+  auto& glBuffer = static_cast<opengl::UniformBlockBuffer&>(*buffer);
+  ASSERT_TRUE(glBuffer.isStreaming());
+
+  context_->endFrame();
+  ASSERT_TRUE(buffer->upload(data.data(), BufferRange(sizeof(data), 0)).isOk());
+
+  Result ret;
+  glBuffer.bindBase(0, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  glBuffer.bindRange(0, 0, sizeof(data), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+} // namespace igl::tests
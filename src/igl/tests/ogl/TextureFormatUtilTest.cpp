@@ -95,6 +95,7 @@
 #define GL_RGB16F 0x881B
 #define GL_RGB32F 0x8815
 #define GL_RGB5_A1 0x8057
+#define GL_RGB9_E5 0x8C3D
 #define GL_RGBA 0x1908
 #define GL_RGBA16F 0x881A
 #define GL_RGBA32F 0x8814
@@ -165,6 +166,10 @@ TEST(TextureFormatUtilTest, RGB10A2DependsOnGlFormat) {
   ASSERT_EQ(glTextureFormatToTextureFormat(GL_RGB10_A2, GL_BGRA), TextureFormat::BGR10_A2_Unorm);
 }
 
+TEST(TextureFormatUtilTest, SharedExponentFormat) {
+  ASSERT_EQ(glTextureFormatToTextureFormat(GL_RGB9_E5), TextureFormat::R9G9B9E5_F);
+}
+
 TEST(TextureFormatUtilTest, ASTCCompressedFormats) {
   ASSERT_EQ(glTextureFormatToTextureFormat(GL_COMPRESSED_RGBA_ASTC_4x4_KHR),
             TextureFormat::RGBA_ASTC_4x4);
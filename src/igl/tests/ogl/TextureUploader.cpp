@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <igl/opengl/TextureUploader.h>
+
+#include "../util/Common.h"
+
+#include <array>
+#include <igl/Framebuffer.h>
+#include <igl/opengl/Device.h>
+#include <igl/opengl/IContext.h>
+
+namespace igl::tests {
+
+namespace {
+
+constexpr uint32_t kTextureSize = 4;
+
+} // namespace
+
+//
+// TextureUploaderOGLTest
+//
+// Tests for uploading textures through a shared context in OpenGL.
+//
+class TextureUploaderOGLTest : public ::testing::Test {
+ public:
+  TextureUploaderOGLTest() = default;
+  ~TextureUploaderOGLTest() override = default;
+
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+    util::createDeviceAndQueue(iglDev_, cmdQueue_);
+    ASSERT_NE(iglDev_, nullptr);
+    ASSERT_NE(cmdQueue_, nullptr);
+
+    context_ = &static_cast<opengl::Device&>(*iglDev_).getContext();
+  }
+
+  void TearDown() override {}
+
+ protected:
+  std::shared_ptr<ITexture> createTexture() {
+    Result ret;
+    auto texture = iglDev_->createTexture(
+        TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                           kTextureSize,
+                           kTextureSize,
+                           TextureDesc::TextureUsageBits::Sampled |
+                               TextureDesc::TextureUsageBits::Attachment),
+        &ret);
+    EXPECT_TRUE(ret.isOk()) << ret.message.c_str();
+    return texture;
+  }
+
+  std::array<uint32_t, kTextureSize * kTextureSize> readPixels(
+      const std::shared_ptr<ITexture>& texture) {
+    Result ret;
+    FramebufferDesc framebufferDesc;
+    framebufferDesc.colorAttachments[0].texture = texture;
+    auto framebuffer = iglDev_->createFramebuffer(framebufferDesc, &ret);
+    EXPECT_TRUE(ret.isOk()) << ret.message.c_str();
+
+    std::array<uint32_t, kTextureSize * kTextureSize> pixels{};
+    framebuffer->copyBytesColorAttachment(
+        *cmdQueue_, 0, pixels.data(), TextureRangeDesc::new2D(0, 0, kTextureSize, kTextureSize));
+    return pixels;
+  }
+
+  std::shared_ptr<IDevice> iglDev_;
+  std::shared_ptr<ICommandQueue> cmdQueue_;
+  opengl::IContext* context_ = nullptr;
+};
+
+//
+// AsyncWithSharedContext
+//
+// Uploads go through the worker thread whenever the platform can create a shared context.
+//
+TEST_F(TextureUploaderOGLTest, AsyncWithSharedContext) {
+  Result ret;
+  auto sharedContext = context_->createShareContext(&ret);
+  const bool hasSharedContext = ret.isOk() && sharedContext != nullptr;
+  sharedContext = nullptr;
+  context_->setCurrent();
+  if (!hasSharedContext) {
+    GTEST_SKIP() << "Shared contexts not supported";
+  }
+
+  const opengl::TextureUploader uploader(*context_);
+  EXPECT_TRUE(uploader.isAsync());
+  EXPECT_TRUE(context_->isCurrentContext());
+}
+
+//
+// UploadAndWait
+//
+// Upload several textures, wait for the last one and check the contents of all of them.
+//
+TEST_F(TextureUploaderOGLTest, UploadAndWait) {
+  std::array<std::shared_ptr<ITexture>, 3> textures;
+  std::array<std::array<uint32_t, kTextureSize * kTextureSize>, 3> data{};
+
+  opengl::TextureUploader::UploadId lastId = 0;
+  {
+    opengl::TextureUploader uploader(*context_);
+    EXPECT_TRUE(context_->isCurrentContext());
+
+    for (size_t i = 0; i < textures.size(); ++i) {
+      textures[i] = createTexture();
+      ASSERT_NE(textures[i], nullptr);
+      data[i].fill(0xFF000000u + static_cast<uint32_t>(i + 1));
+      const auto id = uploader.upload(
+          textures[i], textures[i]->getFullRange(), data[i].data(), 0, /*generateMipmaps*/ false);
+      EXPECT_GT(id, lastId);
+      lastId = id;
+    }
+
+    uploader.wait(lastId);
+    EXPECT_TRUE(uploader.isComplete(lastId));
+    // uploads finish in order
+    EXPECT_TRUE(uploader.isComplete(lastId - 1));
+    EXPECT_EQ(uploader.synchronize(), lastId);
+    EXPECT_TRUE(context_->isCurrentContext());
+  }
+
+  for (size_t i = 0; i < textures.size(); ++i) {
+    EXPECT_EQ(readPixels(textures[i]), data[i]);
+  }
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+//
+// DestroyWithPendingUploads
+//
+// Destroying the uploader executes pending uploads and synchronizes with them.
+//
+TEST_F(TextureUploaderOGLTest, DestroyWithPendingUploads) {
+  auto texture = createTexture();
+  ASSERT_NE(texture, nullptr);
+  std::array<uint32_t, kTextureSize * kTextureSize> data{};
+  data.fill(0xFF00FF00u);
+  {
+    opengl::TextureUploader uploader(*context_);
+    uploader.upload(texture, texture->getFullRange(), data.data());
+  }
+  EXPECT_EQ(readPixels(texture), data);
+
+  ASSERT_EQ(context_->checkForErrors(__FILE__, __LINE__), GL_NO_ERROR);
+}
+
+} // namespace igl::tests
@@ -15,6 +15,9 @@
 #include <igl/RenderCommandEncoder.h>
 #include <igl/RenderPass.h>
 #include <igl/Texture.h>
+#include <igl/vulkan/Texture.h>
+#include <igl/vulkan/VulkanImage.h>
+#include <igl/vulkan/VulkanTexture.h>
 
 #if IGL_PLATFORM_WINDOWS || IGL_PLATFORM_ANDROID || IGL_PLATFORM_MACOSX || IGL_PLATFORM_LINUX
 
@@ -253,6 +256,68 @@ TEST_F(ImageLayoutTransitionTest, MultipleRenderPassesOnSameTexture) {
   }
 }
 
+
+TEST_F(ImageLayoutTransitionTest, ChainedDependencies) {
+  Result ret;
+
+  const TextureDesc texDesc = TextureDesc::new2D(TextureFormat::RGBA_UNorm8,
+                                                 4,
+                                                 4,
+                                                 TextureDesc::TextureUsageBits::Attachment |
+                                                     TextureDesc::TextureUsageBits::Sampled);
+  auto target = iglDev_->createTexture(texDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  FramebufferDesc fbDesc;
+  fbDesc.colorAttachments[0].texture = target;
+  auto fb = iglDev_->createFramebuffer(fbDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(fb, nullptr);
+
+  // more textures than fit into one igl::Dependencies
+  constexpr uint32_t kNumTextures = Dependencies::kIglMaxTextureDependencies + 3;
+  std::vector<std::shared_ptr<ITexture>> textures;
+  Dependencies deps[2];
+  for (uint32_t i = 0; i != kNumTextures; i++) {
+    textures.push_back(iglDev_->createTexture(texDesc, &ret));
+    ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+    constexpr uint32_t kMax = Dependencies::kIglMaxTextureDependencies;
+    deps[i / kMax].textures[i % kMax] = textures.back().get();
+  }
+  deps[0].next = &deps[1];
+
+  const auto layout = [](const std::shared_ptr<ITexture>& texture) {
+    return static_cast<vulkan::Texture&>(*texture).getVulkanTexture().image.imageLayout_;
+  };
+
+  auto cmdBuf = cmdQueue_->createCommandBuffer(CommandBufferDesc(), &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(cmdBuf, nullptr);
+
+  RenderPassDesc rpDesc;
+  rpDesc.colorAttachments.resize(1);
+  rpDesc.colorAttachments[0].loadAction = LoadAction::Clear;
+  rpDesc.colorAttachments[0].storeAction = StoreAction::Store;
+
+  auto encoder = cmdBuf->createRenderCommandEncoder(rpDesc, fb, deps[0], &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  ASSERT_NE(encoder, nullptr);
+
+  for (uint32_t i = 0; i != kNumTextures; i++) {
+    EXPECT_EQ(layout(textures[i]), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) << "texture " << i;
+  }
+
+  encoder->endEncoding();
+
+  // every dependent render target goes back to an attachment, including the chained ones
+  for (uint32_t i = 0; i != kNumTextures; i++) {
+    EXPECT_EQ(layout(textures[i]), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL) << "texture " << i;
+  }
+
+  cmdQueue_->submit(*cmdBuf);
+  cmdBuf->waitUntilCompleted();
+}
+
 } // namespace igl::tests
 
 #endif // IGL_PLATFORM_WINDOWS || IGL_PLATFORM_ANDROID || IGL_PLATFORM_MACOSX || IGL_PLATFORM_LINUX
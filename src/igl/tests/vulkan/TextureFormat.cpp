@@ -79,6 +79,8 @@ TEST(TextureFormatUtilTest, textureFormatToVkFormat) {
             VK_FORMAT_A2B10G10R10_UNORM_PACK32);
   ASSERT_EQ(textureFormatToVkFormat(igl::TextureFormat::R_F32), VK_FORMAT_R32_SFLOAT);
   ASSERT_EQ(textureFormatToVkFormat(igl::TextureFormat::R_UInt32), VK_FORMAT_R32_UINT);
+  ASSERT_EQ(textureFormatToVkFormat(igl::TextureFormat::R9G9B9E5_F),
+            VK_FORMAT_E5B9G9R9_UFLOAT_PACK32);
   ASSERT_EQ(textureFormatToVkFormat(igl::TextureFormat::RG_F32), VK_FORMAT_R32G32_SFLOAT);
   ASSERT_EQ(textureFormatToVkFormat(igl::TextureFormat::RGB_F16), VK_FORMAT_R16G16B16_SFLOAT);
   ASSERT_EQ(textureFormatToVkFormat(igl::TextureFormat::RGBA_F16), VK_FORMAT_R16G16B16A16_SFLOAT);
@@ -246,6 +248,9 @@ TEST(TextureFormatUtilTest, vkTextureFormatToTextureFormat) {
 
   ASSERT_EQ(util::vkTextureFormatToTextureFormat(VK_FORMAT_R32_SFLOAT), igl::TextureFormat::R_F32);
 
+  ASSERT_EQ(util::vkTextureFormatToTextureFormat(VK_FORMAT_E5B9G9R9_UFLOAT_PACK32),
+            igl::TextureFormat::R9G9B9E5_F);
+
   ASSERT_EQ(util::vkTextureFormatToTextureFormat(VK_FORMAT_R32_UINT), igl::TextureFormat::R_UInt32);
 
   ASSERT_EQ(util::vkTextureFormatToTextureFormat(VK_FORMAT_R32G32_SFLOAT),
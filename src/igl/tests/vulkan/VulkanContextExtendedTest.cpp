@@ -7,10 +7,16 @@
 
 #include <gtest/gtest.h>
 
+#include "../data/ShaderData.h"
 #include "../util/TestDevice.h"
 
 #include <future>
+#include <utility>
+#include <igl/Buffer.h>
 #include <igl/CommandBuffer.h>
+#include <igl/ComputeCommandEncoder.h>
+#include <igl/ComputePipelineState.h>
+#include <igl/ShaderCreator.h>
 #include <igl/vulkan/Device.h>
 #include <igl/vulkan/VulkanContext.h>
 
@@ -127,6 +133,235 @@ TEST_F(VulkanContextExtendedTest, GetFrameNumber) {
   EXPECT_EQ(ctx.getFrameNumber(), 0u);
 }
 
+TEST_F(VulkanContextExtendedTest, BindlessDescriptorStatsIncrementalUpdate) {
+  auto& ctx = getVulkanContext();
+
+  Result ret;
+  auto cmdQueue = iglDev_->createCommandQueue(CommandQueueDesc{}, &ret);
+  ASSERT_TRUE(ret.isOk());
+
+  // flushes pending bindless updates
+  const auto encode = [&]() {
+    auto cmdBuf = cmdQueue->createCommandBuffer(CommandBufferDesc(), &ret);
+    ASSERT_TRUE(ret.isOk());
+    auto encoder = cmdBuf->createComputeCommandEncoder();
+    ASSERT_NE(encoder, nullptr);
+    encoder->endEncoding();
+    cmdQueue->submit(*cmdBuf);
+  };
+
+  const TextureDesc texDesc =
+      TextureDesc::new2D(TextureFormat::RGBA_UNorm8, 4, 4, TextureDesc::TextureUsageBits::Sampled);
+
+  // the first texture can grow the descriptor set, which rewrites all of it
+  auto texture0 = iglDev_->createTexture(texDesc, &ret);
+  ASSERT_TRUE(ret.isOk());
+  encode();
+
+  if (!ctx.config_.enableDescriptorIndexing) {
+    const igl::vulkan::BindlessDescriptorStats stats = ctx.getBindlessDescriptorStats();
+    EXPECT_EQ(stats.numDescriptorsWrittenTotal, 0u);
+    EXPECT_EQ(stats.maxTextures, 0u);
+    return;
+  }
+
+  const igl::vulkan::BindlessDescriptorStats before = ctx.getBindlessDescriptorStats();
+  ASSERT_GE(before.maxTextures, 3u);
+
+  // a new texture touches only its own slot: 4 sampled image bindings + 1 storage image binding
+  auto texture1 = iglDev_->createTexture(texDesc, &ret);
+  ASSERT_TRUE(ret.isOk());
+  encode();
+  const igl::vulkan::BindlessDescriptorStats created = ctx.getBindlessDescriptorStats();
+  EXPECT_EQ(created.numFullUpdates, before.numFullUpdates);
+  EXPECT_EQ(created.numDescriptorsWrittenTotal - before.numDescriptorsWrittenTotal, 5u);
+
+  // a destroyed texture does not touch the descriptor set at all
+  texture1 = nullptr;
+  encode();
+  const igl::vulkan::BindlessDescriptorStats destroyed = ctx.getBindlessDescriptorStats();
+  EXPECT_EQ(destroyed.numFullUpdates, before.numFullUpdates);
+  EXPECT_EQ(destroyed.numDescriptorsWrittenTotal, created.numDescriptorsWrittenTotal);
+  EXPECT_EQ(destroyed.numWaitsForReusedSlots, created.numWaitsForReusedSlots);
+
+  // the freed slot is reused once its submit has completed, so no wait is needed
+  ctx.waitIdle();
+  auto texture2 = iglDev_->createTexture(texDesc, &ret);
+  ASSERT_TRUE(ret.isOk());
+  encode();
+  const igl::vulkan::BindlessDescriptorStats reused = ctx.getBindlessDescriptorStats();
+  EXPECT_EQ(reused.numFullUpdates, before.numFullUpdates);
+  EXPECT_EQ(reused.numDescriptorsWrittenTotal - destroyed.numDescriptorsWrittenTotal, 5u);
+  EXPECT_EQ(reused.numWaitsForReusedSlots, destroyed.numWaitsForReusedSlots);
+}
+
+TEST_F(VulkanContextExtendedTest, DescriptorSetCacheStats) {
+  auto& ctx = getVulkanContext();
+
+  EXPECT_EQ(igl::vulkan::DescriptorSetCacheStats{}.hitRate(), 0.0f);
+
+  if (ctx.features().has_VK_EXT_descriptor_buffer) {
+    GTEST_SKIP() << "Descriptor sets are not cached with descriptor buffers";
+  }
+
+  // the cache is opt-in; it is only consulted when descriptor sets are updated
+  ctx.config_.enableDescriptorSetCache = true;
+
+  Result ret;
+  auto cmdQueue = iglDev_->createCommandQueue(CommandQueueDesc{}, &ret);
+  ASSERT_TRUE(ret.isOk());
+
+  const std::string computeSource(data::shader::kVulkanSimpleComputeShader);
+  auto computeModule =
+      ShaderModuleCreator::fromStringInput(*iglDev_,
+                                           computeSource.c_str(),
+                                           {.stage = ShaderStage::Compute, .entryPoint = "main"},
+                                           "DescriptorSetCacheStats",
+                                           &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  auto stages = ShaderStagesCreator::fromComputeModule(*iglDev_, computeModule, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  const ComputePipelineDesc pipelineDesc{
+      .buffersMap =
+          {
+              {data::shader::kSimpleComputeInputIndex,
+               IGL_NAMEHANDLE(data::shader::kSimpleComputeInput)},
+              {data::shader::kSimpleComputeOutputIndex,
+               IGL_NAMEHANDLE(data::shader::kSimpleComputeOutput)},
+          },
+      .shaderStages = std::move(stages),
+      .debugName = "DescriptorSetCacheStats",
+  };
+  auto pipeline = iglDev_->createComputePipeline(pipelineDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  const BufferDesc bufferDesc{
+      .type = BufferDesc::BufferTypeBits::Storage,
+      .length = 6 * sizeof(float),
+      .storage = ResourceStorage::Shared,
+  };
+  auto bufferA = iglDev_->createBuffer(bufferDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+  auto bufferB = iglDev_->createBuffer(bufferDesc, &ret);
+  ASSERT_TRUE(ret.isOk()) << ret.message.c_str();
+
+  // Within one submit: A->B and B->A miss, binding A->B again reuses the first descriptor set
+  const auto submit = [&]() {
+    auto cmdBuf = cmdQueue->createCommandBuffer(CommandBufferDesc(), &ret);
+    ASSERT_TRUE(ret.isOk());
+    auto encoder = cmdBuf->createComputeCommandEncoder();
+    ASSERT_NE(encoder, nullptr);
+    encoder->bindComputePipelineState(pipeline);
+    for (const auto& [in, out] : {std::pair{bufferA.get(), bufferB.get()},
+                                  std::pair{bufferB.get(), bufferA.get()},
+                                  std::pair{bufferA.get(), bufferB.get()}}) {
+      encoder->bindBuffer(data::shader::kSimpleComputeInputIndex, in);
+      encoder->bindBuffer(data::shader::kSimpleComputeOutputIndex, out);
+      encoder->dispatchThreadGroups(Dimensions(1, 1, 1), Dimensions(6, 1, 1));
+    }
+    encoder->endEncoding();
+    cmdQueue->submit(*cmdBuf);
+    cmdBuf->waitUntilCompleted();
+  };
+
+  const igl::vulkan::DescriptorSetCacheStats before = ctx.getDescriptorSetCacheStats();
+  submit();
+  const igl::vulkan::DescriptorSetCacheStats afterFirst = ctx.getDescriptorSetCacheStats();
+  EXPECT_EQ(afterFirst.numLookups - before.numLookups, 3u);
+  EXPECT_EQ(afterFirst.numUpdateDescriptorSetsSaved - before.numUpdateDescriptorSetsSaved, 1u);
+  EXPECT_EQ(afterFirst.numDescriptorWritesSaved - before.numDescriptorWritesSaved, 2u);
+
+  // The next submit starts with an empty cache, so descriptor sets of the retired submit, which the
+  // arena may recycle and rewrite, are never returned; the same bindings miss once and hit again
+  submit();
+  const igl::vulkan::DescriptorSetCacheStats afterSecond = ctx.getDescriptorSetCacheStats();
+  EXPECT_EQ(afterSecond.numLookups - afterFirst.numLookups, 3u);
+  EXPECT_EQ(afterSecond.numUpdateDescriptorSetsSaved - afterFirst.numUpdateDescriptorSetsSaved,
+            1u);
+  EXPECT_GT(afterSecond.hitRate(), 0.0f);
+  EXPECT_LE(afterSecond.hitRate(), 1.0f);
+}
+
+TEST_F(VulkanContextExtendedTest, MemoryStatsTrackCategories) {
+  auto& ctx = getVulkanContext();
+
+  const igl::vulkan::MemoryStats before = ctx.getMemoryStats();
+  ASSERT_GT(before.numHeaps, 0u);
+  for (uint32_t i = 0; i != before.numHeaps; i++) {
+    EXPECT_GT(before.heaps[i].size, 0u);
+    EXPECT_LE(before.heaps[i].budget, before.heaps[i].size);
+  }
+
+  Result ret;
+  const TextureDesc texDesc = TextureDesc::new2D(
+      TextureFormat::RGBA_UNorm8, 256, 256, TextureDesc::TextureUsageBits::Sampled);
+  auto texture = iglDev_->createTexture(texDesc, &ret);
+  ASSERT_TRUE(ret.isOk());
+  auto buffer =
+      iglDev_->createBuffer(BufferDesc(BufferDesc::BufferTypeBits::Storage, nullptr, 4096), &ret);
+  ASSERT_TRUE(ret.isOk());
+
+  const igl::vulkan::MemoryStats after = ctx.getMemoryStats(true);
+  EXPECT_GE(after.getCategoryBytes(igl::vulkan::MemoryCategory::Texture) -
+                before.getCategoryBytes(igl::vulkan::MemoryCategory::Texture),
+            256u * 256u * 4u);
+  EXPECT_GE(after.getCategoryBytes(igl::vulkan::MemoryCategory::Buffer) -
+                before.getCategoryBytes(igl::vulkan::MemoryCategory::Buffer),
+            4096u);
+  for (uint32_t i = 0; i != after.numHeaps; i++) {
+    EXPECT_LE(after.heaps[i].allocationBytes, after.heaps[i].blockBytes);
+  }
+  // IDevice::getGPUMemoryUsage() reports IGL allocations only, not the heap usage of the system
+  EXPECT_EQ(iglDev_->getGPUMemoryUsage(), after.getTotalCategoryBytes());
+  EXPECT_EQ(ctx.getAllocatedMemoryBytes(), after.getTotalCategoryBytes());
+
+  texture = nullptr;
+  buffer = nullptr;
+
+  const igl::vulkan::MemoryStats released = ctx.getMemoryStats();
+  EXPECT_EQ(released.getCategoryBytes(igl::vulkan::MemoryCategory::Texture),
+            before.getCategoryBytes(igl::vulkan::MemoryCategory::Texture));
+  EXPECT_EQ(released.getCategoryBytes(igl::vulkan::MemoryCategory::Buffer),
+            before.getCategoryBytes(igl::vulkan::MemoryCategory::Buffer));
+}
+
+TEST_F(VulkanContextExtendedTest, MemoryBudgetCallback) {
+  auto& ctx = getVulkanContext();
+
+  uint32_t numCalls = 0;
+  // any non-empty heap is over 0% of its budget
+  ctx.addMemoryBudgetCallback(
+      0.0f, [&numCalls](const igl::vulkan::MemoryStats& stats, uint32_t heapIndex) {
+        EXPECT_LT(heapIndex, stats.numHeaps);
+        EXPECT_GT(stats.heaps[heapIndex].usage, 0u);
+        numCalls++;
+      });
+
+  Result ret;
+  auto cmdQueue = iglDev_->createCommandQueue(CommandQueueDesc{}, &ret);
+  ASSERT_TRUE(ret.isOk());
+  auto buffer =
+      iglDev_->createBuffer(BufferDesc(BufferDesc::BufferTypeBits::Storage, nullptr, 4096), &ret);
+  ASSERT_TRUE(ret.isOk());
+
+  const auto submit = [&]() {
+    auto cmdBuf = cmdQueue->createCommandBuffer(CommandBufferDesc(), &ret);
+    ASSERT_TRUE(ret.isOk());
+    cmdQueue->submit(*cmdBuf);
+  };
+
+  submit();
+  const uint32_t numCallsAfterFirstSubmit = numCalls;
+  if (ctx.getMemoryStats().getTotalUsage() > 0) {
+    EXPECT_GT(numCallsAfterFirstSubmit, 0u);
+  }
+
+  // callbacks are invoked only when a heap crosses the threshold
+  submit();
+  EXPECT_EQ(numCalls, numCallsAfterFirstSubmit);
+}
+
 } // namespace igl::tests
 
 #endif // IGL_PLATFORM_WINDOWS || IGL_PLATFORM_ANDROID || IGL_PLATFORM_MACOSX || IGL_PLATFORM_LINUX
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <igl/vulkan/VulkanRetirementQueue.h>
+
+#include "../util/TestDevice.h"
+
+#include <vector>
+#include <igl/vulkan/Device.h>
+#include <igl/vulkan/VulkanContext.h>
+
+#if IGL_PLATFORM_WINDOWS || IGL_PLATFORM_ANDROID || IGL_PLATFORM_MACOSX || IGL_PLATFORM_LINUX
+
+namespace igl::tests {
+
+using igl::vulkan::VulkanRetirementQueue;
+
+namespace {
+
+VulkanRetirementQueue::SubmitHandle makeHandle(uint32_t submitId, uint32_t bufferIndex = 0) {
+  return VulkanRetirementQueue::SubmitHandle((uint64_t(submitId) << 32) + bufferIndex);
+}
+
+VulkanRetirementQueue::Entry makeEntry(uint64_t handle) {
+  return {.type = VulkanRetirementQueue::Type::Buffer, .handle = handle, .allocation = 0};
+}
+
+} // namespace
+
+TEST(VulkanRetirementQueueTest, EmptyQueue) {
+  VulkanRetirementQueue queue;
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0u);
+  EXPECT_EQ(queue.numBuckets(), 0u);
+
+  uint32_t numDestroyed = 0;
+  queue.process([](auto, uint64_t) { return true; },
+                [&numDestroyed](const VulkanRetirementQueue::Entry&) { numDestroyed++; });
+  EXPECT_EQ(numDestroyed, 0u);
+}
+
+TEST(VulkanRetirementQueueTest, GroupsEntriesBySubmitHandleAndFrame) {
+  VulkanRetirementQueue queue;
+
+  queue.push(makeHandle(1), 10, makeEntry(1));
+  queue.push(makeHandle(1), 10, makeEntry(2));
+  queue.push(makeHandle(1), 11, makeEntry(3));
+  queue.push(makeHandle(2), 11, makeEntry(4));
+  queue.push(makeHandle(2), 11, makeEntry(5));
+
+  EXPECT_FALSE(queue.empty());
+  EXPECT_EQ(queue.size(), 5u);
+  EXPECT_EQ(queue.numBuckets(), 3u);
+}
+
+TEST(VulkanRetirementQueueTest, ProcessStopsAtFirstNonRetirableBucket) {
+  VulkanRetirementQueue queue;
+
+  queue.push(makeHandle(1), 1, makeEntry(1));
+  queue.push(makeHandle(2), 1, makeEntry(2));
+  queue.push(makeHandle(2), 1, makeEntry(3));
+  queue.push(makeHandle(3), 2, makeEntry(4));
+
+  std::vector<uint64_t> destroyed;
+  const auto destroy = [&destroyed](const VulkanRetirementQueue::Entry& e) {
+    destroyed.push_back(e.handle);
+  };
+
+  // only submits 1 and 2 have completed
+  queue.process([](VulkanRetirementQueue::SubmitHandle h, uint64_t) { return h.submitId <= 2; },
+                destroy);
+
+  EXPECT_EQ(destroyed, (std::vector<uint64_t>{1, 2, 3}));
+  EXPECT_EQ(queue.size(), 1u);
+  EXPECT_EQ(queue.numBuckets(), 1u);
+
+  // a newer bucket must not be retired before an older one even if it is ready
+  queue.push(makeHandle(4), 3, makeEntry(5));
+  queue.process([](VulkanRetirementQueue::SubmitHandle h, uint64_t) { return h.submitId == 4; },
+                destroy);
+  EXPECT_EQ(queue.size(), 2u);
+
+  queue.process([](auto, uint64_t frameId) { return frameId < 3; }, destroy);
+  EXPECT_EQ(destroyed, (std::vector<uint64_t>{1, 2, 3, 4}));
+  EXPECT_EQ(queue.size(), 1u);
+}
+
+TEST(VulkanRetirementQueueTest, ProcessAllWaitsForEveryBucket) {
+  VulkanRetirementQueue queue;
+
+  queue.push(makeHandle(1), 1, makeEntry(1));
+  queue.push(makeHandle(2), 1, makeEntry(2));
+  queue.push(makeHandle(3), 2, makeEntry(3));
+
+  std::vector<uint32_t> waited;
+  std::vector<uint64_t> destroyed;
+  queue.processAll(
+      [&waited](VulkanRetirementQueue::SubmitHandle h) { waited.push_back(h.submitId); },
+      [&destroyed](const VulkanRetirementQueue::Entry& e) { destroyed.push_back(e.handle); });
+
+  EXPECT_EQ(waited, (std::vector<uint32_t>{1, 2, 3}));
+  EXPECT_EQ(destroyed, (std::vector<uint64_t>{1, 2, 3}));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.numBuckets(), 0u);
+}
+
+TEST(VulkanRetirementQueueTest, GrowsWhileWrappedAround) {
+  VulkanRetirementQueue queue;
+
+  std::vector<uint64_t> destroyed;
+  const auto destroy = [&destroyed](const VulkanRetirementQueue::Entry& e) {
+    destroyed.push_back(e.handle);
+  };
+
+  // move the start of the ring buffer away from index 0
+  uint32_t submitId = 1;
+  for (; submitId != 11; submitId++) {
+    queue.push(makeHandle(submitId), submitId, makeEntry(submitId));
+  }
+  queue.process([](VulkanRetirementQueue::SubmitHandle h, uint64_t) { return h.submitId < 8; },
+                destroy);
+  EXPECT_EQ(queue.numBuckets(), 3u);
+
+  // wrap around and grow the ring buffer several times
+  for (; submitId != 101; submitId++) {
+    queue.push(makeHandle(submitId), submitId, makeEntry(submitId));
+  }
+  EXPECT_EQ(queue.numBuckets(), 93u);
+  EXPECT_EQ(queue.size(), 93u);
+
+  queue.process([](auto, uint64_t) { return true; }, destroy);
+
+  ASSERT_EQ(destroyed.size(), 100u);
+  for (uint64_t i = 0; i != destroyed.size(); i++) {
+    EXPECT_EQ(destroyed[i], i + 1);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(VulkanRetirementQueueTest, HandleConversion) {
+  int value = 0;
+  int* ptr = &value;
+
+  EXPECT_EQ(VulkanRetirementQueue::fromUint64<int*>(VulkanRetirementQueue::toUint64(ptr)), ptr);
+  EXPECT_EQ(VulkanRetirementQueue::fromUint64<uint64_t>(
+                VulkanRetirementQueue::toUint64(uint64_t(0xdeadbeef12345678ull))),
+            0xdeadbeef12345678ull);
+}
+
+class VulkanRetirementQueueContextTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    igl::setDebugBreakEnabled(false);
+    iglDev_ = util::createTestDevice();
+    ASSERT_NE(iglDev_, nullptr);
+    ASSERT_EQ(iglDev_->getBackendType(), BackendType::Vulkan) << "Test requires Vulkan backend";
+  }
+
+ protected:
+  std::shared_ptr<IDevice> iglDev_;
+};
+
+TEST_F(VulkanRetirementQueueContextTest, DestroyedBuffersAreRetired) {
+  auto& ctx = static_cast<igl::vulkan::Device&>(*iglDev_).getVulkanContext();
+
+  const size_t numPending = ctx.retirementQueue.size();
+  const size_t numPendingBuckets = ctx.retirementQueue.numBuckets();
+
+  for (int i = 0; i != 8; i++) {
+    Result ret;
+    auto buffer = iglDev_->createBuffer(
+        BufferDesc(BufferDesc::BufferTypeBits::Uniform, nullptr, 256), &ret);
+    ASSERT_TRUE(ret.isOk());
+    ASSERT_NE(buffer, nullptr);
+  }
+
+  EXPECT_EQ(ctx.retirementQueue.size(), numPending + 8);
+  // all buffers were destroyed before the same submit and within the same frame
+  EXPECT_LE(ctx.retirementQueue.numBuckets(), numPendingBuckets + 1);
+
+  ctx.waitDeferredTasks();
+
+  EXPECT_TRUE(ctx.retirementQueue.empty());
+}
+
+} // namespace igl::tests
+
+#endif
@@ -12,6 +12,7 @@
 #include <igl/vulkan/ComputeCommandEncoder.h>
 #include <igl/vulkan/RenderCommandEncoder.h>
 #include <igl/vulkan/Texture.h>
+#include <igl/vulkan/TimestampQueries.h>
 #include <igl/vulkan/VulkanContext.h>
 #include <igl/vulkan/VulkanImage.h>
 #include <igl/vulkan/VulkanTexture.h>
@@ -22,6 +23,12 @@ CommandBuffer::CommandBuffer(VulkanContext& ctx, CommandBufferDesc desc) :
   ICommandBuffer(std::move(desc)), ctx_(ctx), wrapper_(ctx_.immediate_->acquire()) {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
   IGL_DEBUG_ASSERT(wrapper_.cmdBuf != VK_NULL_HANDLE);
+
+  if (ICommandBuffer::desc.timestampQueries) {
+    // Reset the queries now: debug groups may start inside a render pass, where it is not allowed
+    static_cast<TimestampQueries&>(*ICommandBuffer::desc.timestampQueries)
+        .recordReset(wrapper_.cmdBuf);
+  }
 }
 
 std::unique_ptr<IComputeCommandEncoder> CommandBuffer::createComputeCommandEncoder() {
@@ -120,12 +127,35 @@ void CommandBuffer::present(const std::shared_ptr<ITexture>& surface) const {
 void CommandBuffer::pushDebugGroupLabel(const char* label, const igl::Color& color) const {
   IGL_DEBUG_ASSERT(label != nullptr && *label);
   ivkCmdBeginDebugUtilsLabel(&ctx_.vf_, wrapper_.cmdBuf, label, color.toFloatPtr());
+  beginDebugGroupTimestamp(label);
 }
 
 void CommandBuffer::popDebugGroupLabel() const {
+  endDebugGroupTimestamp();
   ivkCmdEndDebugUtilsLabel(&ctx_.vf_, wrapper_.cmdBuf);
 }
 
+void CommandBuffer::beginDebugGroupTimestamp(const char* label) const {
+  if (!desc.timestampQueries) {
+    return;
+  }
+  auto& queries = static_cast<TimestampQueries&>(*desc.timestampQueries);
+  const uint32_t parentSlot = debugGroupSlots_.empty() ? TimestampQueries::kNoParentSlot
+                                                       : debugGroupSlots_.back();
+  debugGroupSlots_.push_back(queries.beginElapsedQuery(wrapper_.cmdBuf, label, parentSlot));
+}
+
+void CommandBuffer::endDebugGroupTimestamp() const {
+  if (!desc.timestampQueries || debugGroupSlots_.empty()) {
+    return;
+  }
+  const uint32_t slot = debugGroupSlots_.back();
+  debugGroupSlots_.pop_back();
+  if (slot != TimestampQueries::kInvalidSlot) {
+    static_cast<TimestampQueries&>(*desc.timestampQueries).endElapsedQuery(wrapper_.cmdBuf, slot);
+  }
+}
+
 void CommandBuffer::copyBuffer(IBuffer& src,
                                IBuffer& dst,
                                uint64_t srcOffset,
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <vector>
 #include <igl/CommandBuffer.h>
 #include <igl/vulkan/Common.h>
 #include <igl/vulkan/VulkanImmediateCommands.h>
@@ -54,6 +55,15 @@ class CommandBuffer final : public ICommandBuffer,
 
   void popDebugGroupLabel() const override;
 
+  /// @brief If the command buffer was created with CommandBufferDesc::timestampQueries, allocates
+  /// a timing slot for the debug group and writes its start timestamp. Debug groups pushed on this
+  /// command buffer and on its encoders share one stack, so nested groups record their parent slot.
+  void beginDebugGroupTimestamp(const char* label) const;
+
+  /// @brief Writes the end timestamp of the innermost debug group started with
+  /// beginDebugGroupTimestamp()
+  void endDebugGroupTimestamp() const;
+
   void copyBuffer(IBuffer& src,
                   IBuffer& dst,
                   uint64_t srcOffset,
@@ -99,6 +109,10 @@ class CommandBuffer final : public ICommandBuffer,
   mutable std::shared_ptr<ITexture> presentedSurface_;
 
   VulkanImmediateCommands::SubmitHandle lastSubmitHandle_ = {};
+
+  // Timing slots of the currently open debug groups (TimestampQueries::kInvalidSlot if the slot
+  // could not be allocated)
+  mutable std::vector<uint32_t> debugGroupSlots_;
 };
 
 } // namespace igl::vulkan
@@ -185,6 +185,8 @@ VkFormat textureFormatToVkFormat(TextureFormat format) {
     return VK_FORMAT_R32_SFLOAT;
   case TextureFormat::R_UInt32:
     return VK_FORMAT_R32_UINT;
+  case TextureFormat::R9G9B9E5_F:
+    return VK_FORMAT_E5B9G9R9_UFLOAT_PACK32;
   case TextureFormat::RG_F32:
     return VK_FORMAT_R32G32_SFLOAT;
   case TextureFormat::RGB_F16:
@@ -123,6 +123,9 @@ struct VulkanContextConfig {
   bool enableDualSrcBlend = true;
   bool enableGfxReconstruct = false;
   bool enableMultiviewPerViewViewports = false;
+  // reuse descriptor sets (textures, buffers, storage images) written earlier during the same
+  // submit when the exact same resources are bound again (opt-in)
+  bool enableDescriptorSetCache = false;
 
   ColorSpace swapChainColorSpace = igl::ColorSpace::SRGBNonlinear;
   TextureFormat requestedSwapChainTextureFormat = igl::TextureFormat::RGBA_UNorm8;
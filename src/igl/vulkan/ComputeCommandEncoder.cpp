@@ -196,6 +196,7 @@ void ComputeCommandEncoder::dispatchThreadGroupsIndirect(IBuffer& indirectBuffer
 void ComputeCommandEncoder::pushDebugGroupLabel(const char* label, const igl::Color& color) const {
   IGL_DEBUG_ASSERT(label != nullptr && *label);
   ivkCmdBeginDebugUtilsLabel(&ctx_.vf_, cmdBuffer_, label, color.toFloatPtr());
+  static_cast<const CommandBuffer&>(*getCommandBufferPtr()).beginDebugGroupTimestamp(label);
 }
 
 void ComputeCommandEncoder::insertDebugEventLabel(const char* label,
@@ -205,6 +206,7 @@ void ComputeCommandEncoder::insertDebugEventLabel(const char* label,
 }
 
 void ComputeCommandEncoder::popDebugGroupLabel() const {
+  static_cast<const CommandBuffer&>(*getCommandBufferPtr()).endDebugGroupTimestamp();
   ivkCmdEndDebugUtilsLabel(&ctx_.vf_, cmdBuffer_);
 }
 
@@ -33,17 +33,11 @@ ComputePipelineState ::~ComputePipelineState() {
 
   if (pipeline_ != VK_NULL_HANDLE) {
     const auto& ctx = device_.getVulkanContext();
-    ctx.deferredTask(std::packaged_task<void()>(
-        [vf = &ctx.vf_, device = device_.getVulkanContext().getVkDevice(), pipeline = pipeline_]() {
-          vf->vkDestroyPipeline(device, pipeline, nullptr);
-        }));
+    ctx.deferredDestroy(VulkanRetirementQueue::Type::Pipeline, pipeline_);
   }
   if (pipelineLayout != VK_NULL_HANDLE) {
     const auto& ctx = device_.getVulkanContext();
-    ctx.deferredTask(std::packaged_task<void()>(
-        [vf = &ctx.vf_, device = ctx.getVkDevice(), layout = pipelineLayout]() {
-          vf->vkDestroyPipelineLayout(device, layout, nullptr);
-        }));
+    ctx.deferredDestroy(VulkanRetirementQueue::Type::PipelineLayout, pipelineLayout);
   }
 }
 
@@ -57,13 +51,9 @@ VkPipeline ComputePipelineState::getVkPipeline() const {
     // existing textures increases
     if (lastBindlessVkDescriptorSetLayout != ctx.getBindlessVkDescriptorSetLayout()) {
       // there's a new descriptor set layout - drop the previous Vulkan pipeline
-      const VkDevice device = ctx.getVkDevice();
       if (pipeline_ != VK_NULL_HANDLE) {
-        ctx.deferredTask(std::packaged_task<void()>(
-            [vf = &ctx.vf_, device, pipeline = pipeline_, layout = pipelineLayout]() {
-              vf->vkDestroyPipeline(device, pipeline, nullptr);
-              vf->vkDestroyPipelineLayout(device, layout, nullptr);
-            }));
+        ctx.deferredDestroy(VulkanRetirementQueue::Type::Pipeline, pipeline_);
+        ctx.deferredDestroy(VulkanRetirementQueue::Type::PipelineLayout, pipelineLayout);
       }
       pipeline_ = VK_NULL_HANDLE;
       pipelineLayout = VK_NULL_HANDLE;
@@ -609,6 +609,16 @@ size_t Device::getShaderCompilationCountInternal() const {
   return ctx_->shaderCompilationCount_;
 }
 
+size_t Device::getGPUMemoryUsageInternal() const {
+  // memory allocated by IGL resources of this device; heap usage and budgets, which include other
+  // processes, are reported separately by getMemoryStats()
+  return static_cast<size_t>(ctx_->getAllocatedMemoryBytes());
+}
+
+MemoryStats Device::getMemoryStats(bool detailed) const {
+  return ctx_->getMemoryStats(detailed);
+}
+
 std::unique_ptr<IShaderLibrary> Device::createShaderLibraryInternal(const ShaderLibraryDesc& desc,
                                                                     Result* IGL_NULLABLE
                                                                         outResult) const {
@@ -115,6 +115,11 @@ class Device final : public IDevice {
   [[nodiscard]] BackendType getBackendType() const override;
   [[nodiscard]] size_t getCurrentDrawCount() const override;
   [[nodiscard]] size_t getShaderCompilationCount() const override;
+  [[nodiscard]] size_t getGPUMemoryUsage() const override;
+
+  /// @brief Returns GPU memory budget and usage per heap and per IGL resource category. See
+  /// VulkanContext::addMemoryBudgetCallback() to get notified when a heap is close to its budget.
+  [[nodiscard]] MemoryStats getMemoryStats(bool detailed = false) const;
 
   void setCurrentThread() override;
 
@@ -209,6 +214,7 @@ class Device final : public IDevice {
 
   [[nodiscard]] size_t getCurrentDrawCountInternal() const;
   [[nodiscard]] size_t getShaderCompilationCountInternal() const;
+  [[nodiscard]] size_t getGPUMemoryUsageInternal() const;
 
   void setCurrentThreadInternal();
 
@@ -365,6 +371,10 @@ inline bool Device::getFeatureLimits(DeviceFeatureLimits featureLimits, size_t&
   return getShaderCompilationCountInternal();
 }
 
+[[nodiscard]] inline size_t Device::getGPUMemoryUsage() const {
+  return getGPUMemoryUsageInternal();
+}
+
 inline void Device::setCurrentThread() {
   setCurrentThreadInternal();
 }
@@ -86,7 +86,16 @@ void RenderCommandEncoder::initialize(const RenderPassDesc& renderPass,
   processDependencies(dependencies);
 
   framebuffer_ = framebuffer;
-  dependencies_ = dependencies;
+  // the chain may not outlive this call, so keep the textures themselves
+  dependentTextures_.clear();
+  for (const Dependencies* deps = &dependencies; deps; deps = deps->next) {
+    for (ITexture* IGL_NULLABLE tex : deps->textures) {
+      if (!tex) {
+        break;
+      }
+      dependentTextures_.push_back(tex);
+    }
+  }
 
   Result::setOk(&outResult);
 
@@ -293,12 +302,9 @@ void RenderCommandEncoder::endEncoding() {
 
   ctx_.vf_.vkCmdEndRenderPass(cmdBuffer_);
 
-  for (ITexture* IGL_NULLABLE tex : dependencies_.textures) {
+  for (ITexture* tex : dependentTextures_) {
     // TODO: at some point we might want to know in which layout a dependent texture wants to be. We
     // can implement that by adding a notion of image layouts to IGL.
-    if (!tex) {
-      continue;
-    }
 
     // Retrieve the VulkanImage to check its usage
     const auto& vkTex = static_cast<Texture&>(*tex);
@@ -319,7 +325,7 @@ void RenderCommandEncoder::endEncoding() {
       }
     }
   }
-  dependencies_ = {};
+  dependentTextures_.clear();
 
   // set image layouts after the render pass
   const FramebufferDesc& desc = static_cast<const Framebuffer&>((*framebuffer_)).getDesc();
@@ -350,6 +356,7 @@ void RenderCommandEncoder::endEncoding() {
 void RenderCommandEncoder::pushDebugGroupLabel(const char* label, const igl::Color& color) const {
   IGL_DEBUG_ASSERT(label != nullptr && *label);
   ivkCmdBeginDebugUtilsLabel(&ctx_.vf_, cmdBuffer_, label, color.toFloatPtr());
+  static_cast<const CommandBuffer&>(*getCommandBufferPtr()).beginDebugGroupTimestamp(label);
 }
 
 void RenderCommandEncoder::insertDebugEventLabel(const char* label, const igl::Color& color) const {
@@ -358,6 +365,7 @@ void RenderCommandEncoder::insertDebugEventLabel(const char* label, const igl::C
 }
 
 void RenderCommandEncoder::popDebugGroupLabel() const {
+  static_cast<const CommandBuffer&>(*getCommandBufferPtr()).endDebugGroupTimestamp();
   ivkCmdEndDebugUtilsLabel(&ctx_.vf_, cmdBuffer_);
 }
 
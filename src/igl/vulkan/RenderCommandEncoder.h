@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <igl/Buffer.h>
 #include <igl/CommandEncoder.h>
 #include <igl/Common.h>
@@ -162,7 +164,8 @@ class RenderCommandEncoder : public IRenderCommandEncoder {
 
   bool isVertexBufferBound_[IGL_BUFFER_BINDINGS_MAX] = {};
 
-  Dependencies dependencies_ = {};
+  // textures of all Dependencies passed to initialize(), including the ones chained with `next`
+  std::vector<ITexture*> dependentTextures_;
 
   const igl::vulkan::RenderPipelineState* rps_ = nullptr;
   BindGroupTextureHandle pendingBindGroupTexture_ = {};
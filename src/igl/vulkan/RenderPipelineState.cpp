@@ -340,18 +340,13 @@ RenderPipelineState::RenderPipelineState(const igl::vulkan::Device& device,
 }
 
 void RenderPipelineState::deferDestroyPipelinesAndLayout(const VulkanContext& ctx) const {
-  VkDevice device = ctx.getVkDevice();
   for (const auto& p : pipelines_) {
     if (p.second != VK_NULL_HANDLE) {
-      ctx.deferredTask(std::packaged_task<void()>([vf = &ctx.vf_, device, pipeline = p.second]() {
-        vf->vkDestroyPipeline(device, pipeline, nullptr);
-      }));
+      ctx.deferredDestroy(VulkanRetirementQueue::Type::Pipeline, p.second);
     }
   }
   if (pipelineLayout) {
-    ctx.deferredTask(std::packaged_task<void()>([vf = &ctx.vf_, device, layout = pipelineLayout]() {
-      vf->vkDestroyPipelineLayout(device, layout, nullptr);
-    }));
+    ctx.deferredDestroy(VulkanRetirementQueue::Type::PipelineLayout, pipelineLayout);
   }
 }
 
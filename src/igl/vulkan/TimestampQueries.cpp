@@ -44,7 +44,9 @@ TimestampQueries::TimestampQueries(VulkanContext& ctx, uint32_t maxSlots) :
                                   debugName.c_str()));
 
   labels_.resize(maxSlots_);
+  parentSlots_.resize(maxSlots_, kNoParentSlot);
   elapsedNanos_.resize(maxSlots_, 0);
+  startNanos_.resize(maxSlots_, 0);
   queryResults_.resize(static_cast<size_t>(maxSlots_) * kTimestampsPerTimingSlot);
 }
 
@@ -53,10 +55,7 @@ TimestampQueries::~TimestampQueries() {
   IGL_ENSURE_VULKAN_CONTEXT_THREAD(&ctx_);
 
   if (queryPool_ != VK_NULL_HANDLE) {
-    ctx_.deferredTask(std::packaged_task<void()>(
-        [vf = &ctx_.vf_, device = ctx_.getVkDevice(), queryPool = queryPool_]() {
-          vf->vkDestroyQueryPool(device, queryPool, nullptr);
-        }));
+    ctx_.deferredDestroy(VulkanRetirementQueue::Type::QueryPool, queryPool_);
   }
 }
 
@@ -74,7 +73,9 @@ void TimestampQueries::reset() {
   resetRecorded_ = false;
   resultsReady_ = false;
   std::fill(elapsedNanos_.begin(), elapsedNanos_.end(), 0);
+  std::fill(startNanos_.begin(), startNanos_.end(), 0);
   std::fill(labels_.begin(), labels_.end(), std::string());
+  std::fill(parentSlots_.begin(), parentSlots_.end(), kNoParentSlot);
 }
 
 bool TimestampQueries::resultsAvailable() const {
@@ -91,11 +92,39 @@ uint64_t TimestampQueries::getElapsedNanos(uint32_t slotIndex) const {
   return elapsedNanos_[slotIndex];
 }
 
+uint64_t TimestampQueries::getStartNanos(uint32_t slotIndex) const {
+  if (slotIndex >= currentSlot_ || !updateResults()) {
+    return 0;
+  }
+  return startNanos_[slotIndex];
+}
+
+uint32_t TimestampQueries::getParentSlot(uint32_t slotIndex) const {
+  if (slotIndex >= currentSlot_) {
+    return kNoParentSlot;
+  }
+  return parentSlots_[slotIndex];
+}
+
 bool TimestampQueries::isValid() const {
   return queryPool_ != VK_NULL_HANDLE;
 }
 
-uint32_t TimestampQueries::beginElapsedQuery(VkCommandBuffer commandBuffer, const char* label) {
+void TimestampQueries::recordReset(VkCommandBuffer commandBuffer) {
+  IGL_PROFILER_FUNCTION();
+  IGL_ENSURE_VULKAN_CONTEXT_THREAD(&ctx_);
+
+  if (!isValid() || commandBuffer == VK_NULL_HANDLE || resetRecorded_) {
+    return;
+  }
+  commandBuffer_ = commandBuffer;
+  ctx_.vf_.vkCmdResetQueryPool(commandBuffer, queryPool_, 0, maxSlots_ * kTimestampsPerTimingSlot);
+  resetRecorded_ = true;
+}
+
+uint32_t TimestampQueries::beginElapsedQuery(VkCommandBuffer commandBuffer,
+                                             const char* label,
+                                             uint32_t parentSlot) {
   IGL_PROFILER_FUNCTION();
   IGL_ENSURE_VULKAN_CONTEXT_THREAD(&ctx_);
 
@@ -103,21 +132,18 @@ uint32_t TimestampQueries::beginElapsedQuery(VkCommandBuffer commandBuffer, cons
       (commandBuffer_ != VK_NULL_HANDLE && commandBuffer_ != commandBuffer)) {
     return kInvalidSlot;
   }
-  commandBuffer_ = commandBuffer;
 
-  // The pool reset is recorded lazily on the first query of a command buffer.
-  // vkCmdResetQueryPool must NOT be recorded inside an active render pass, so a
+  // The pool reset is recorded lazily on the first query of a command buffer unless recordReset()
+  // was called. vkCmdResetQueryPool must NOT be recorded inside an active render pass, so a
   // caller timing a render pass must issue the first beginElapsedQuery() before
-  // vkCmdBeginRenderPass(). Compute callers (the current consumers) record this
-  // outside any encoder, so the reset is always emitted at a legal point.
-  if (!resetRecorded_) {
-    ctx_.vf_.vkCmdResetQueryPool(
-        commandBuffer, queryPool_, 0, maxSlots_ * kTimestampsPerTimingSlot);
-    resetRecorded_ = true;
-  }
+  // vkCmdBeginRenderPass(). Compute callers record this outside any encoder, and command buffers
+  // timing debug groups call recordReset() on creation, so the reset is always emitted at a legal
+  // point.
+  recordReset(commandBuffer);
 
   const uint32_t slot = currentSlot_++;
   labels_[slot] = label != nullptr ? label : "";
+  parentSlots_[slot] = parentSlot < slot ? parentSlot : kNoParentSlot;
   resultsReady_ = false;
 
   ctx_.vf_.vkCmdWriteTimestamp(commandBuffer,
@@ -182,11 +208,14 @@ bool TimestampQueries::updateResults() const {
     }
   }
 
+  const uint64_t origin = queryResults_[0].timestamp;
   for (uint32_t slot = 0; slot < currentSlot_; ++slot) {
     const uint64_t begin = queryResults_[slot * kTimestampsPerTimingSlot].timestamp;
     const uint64_t end = queryResults_[slot * kTimestampsPerTimingSlot + 1].timestamp;
     const uint64_t delta = end > begin ? end - begin : 0;
+    const uint64_t offset = begin > origin ? begin - origin : 0;
     elapsedNanos_[slot] = static_cast<uint64_t>(static_cast<double>(delta) * timestampPeriod_);
+    startNanos_[slot] = static_cast<uint64_t>(static_cast<double>(offset) * timestampPeriod_);
   }
 
   resultsReady_ = true;
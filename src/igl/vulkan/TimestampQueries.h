@@ -42,9 +42,18 @@ class TimestampQueries final : public ITimestampQueries {
   void reset() override;
   [[nodiscard]] bool resultsAvailable() const override;
   [[nodiscard]] uint64_t getElapsedNanos(uint32_t slotIndex) const override;
+  [[nodiscard]] uint64_t getStartNanos(uint32_t slotIndex) const override;
+  [[nodiscard]] uint32_t getParentSlot(uint32_t slotIndex) const override;
   [[nodiscard]] bool isValid() const override;
 
-  [[nodiscard]] uint32_t beginElapsedQuery(VkCommandBuffer commandBuffer, const char* label);
+  /// Records the query pool reset into the command buffer. Called by command buffers created with
+  /// CommandBufferDesc::timestampQueries so that queries can later begin inside a render pass,
+  /// where vkCmdResetQueryPool is not allowed.
+  void recordReset(VkCommandBuffer commandBuffer);
+
+  [[nodiscard]] uint32_t beginElapsedQuery(VkCommandBuffer commandBuffer,
+                                           const char* label,
+                                           uint32_t parentSlot = kNoParentSlot);
   void endElapsedQuery(VkCommandBuffer commandBuffer, uint32_t slotIndex);
 
   [[nodiscard]] const char* getLabel(uint32_t slotIndex) const override;
@@ -67,9 +76,11 @@ class TimestampQueries final : public ITimestampQueries {
   bool resetRecorded_ = false;
   float timestampPeriod_ = 0.0f;
   std::vector<std::string> labels_;
+  std::vector<uint32_t> parentSlots_;
 
   mutable bool resultsReady_ = false;
   mutable std::vector<uint64_t> elapsedNanos_;
+  mutable std::vector<uint64_t> startNanos_;
   // Result readback scratch, sized once in the ctor (maxSlots_ * 2) and reused
   // every updateResults() call to avoid per-poll heap allocation in the hot path.
   mutable std::vector<QueryResult> queryResults_;
@@ -18,12 +18,14 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
                            VkDeviceSize bufferSize,
                            VkBufferUsageFlags usageFlags,
                            VkMemoryPropertyFlags memFlags,
-                           const char* debugName) :
+                           const char* debugName,
+                           MemoryCategory memoryCategory) :
   ctx_(ctx),
   device_(device),
   bufferSize_(bufferSize),
   usageFlags_(usageFlags),
-  memFlags_(memFlags) {
+  memFlags_(memFlags),
+  memoryCategory_(memoryCategory) {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_CREATE);
 
   IGL_DEBUG_ASSERT(bufferSize > 0);
@@ -88,6 +90,11 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
                            vmaAllocation_,
                            IGL_FORMAT("VMA Allocation: {}", debugName).c_str());
 
+      VmaAllocationInfo allocationInfo;
+      vmaGetAllocationInfo(
+          static_cast<VmaAllocator>(ctx_.getVmaAllocator()), vmaAllocation_, &allocationInfo);
+      allocatedSize_ = allocationInfo.size;
+
       // handle memory-mapped buffers
       if (memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
         vmaMapMemory(
@@ -114,6 +121,7 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
                                   ctx.features().has_VK_KHR_buffer_device_address,
                                   &vkMemory_));
       VK_ASSERT(ctx_.vf_.vkBindBufferMemory(device_, vkBuffer_, vkMemory_, 0));
+      allocatedSize_ = requirements.size;
 
       VK_ASSERT(ivkSetDebugObjectName(&ctx_.vf_,
                                       device_,
@@ -130,6 +138,8 @@ VulkanBuffer::VulkanBuffer(const VulkanContext& ctx,
 
   IGL_DEBUG_ASSERT(vkBuffer_ != VK_NULL_HANDLE);
 
+  ctx_.trackMemoryUsage(memoryCategory_, static_cast<int64_t>(allocatedSize_));
+
   // set debug name
   VK_ASSERT(ivkSetDebugObjectName(
       &ctx_.vf_, device_, VK_OBJECT_TYPE_BUFFER, (uint64_t)vkBuffer_, debugName));
@@ -150,23 +160,18 @@ VulkanBuffer::~VulkanBuffer() {
 
   IGL_ENSURE_VULKAN_CONTEXT_THREAD(&ctx_);
 
+  ctx_.trackMemoryUsage(memoryCategory_, -static_cast<int64_t>(allocatedSize_));
+
   if (IGL_VULKAN_USE_VMA) {
     if (mappedPtr_) {
       vmaUnmapMemory(static_cast<VmaAllocator>(ctx_.getVmaAllocator()), vmaAllocation_);
     }
-    ctx_.deferredTask(std::packaged_task<void()>(
-        [vma = ctx_.getVmaAllocator(), buffer = vkBuffer_, allocation = vmaAllocation_]() {
-          vmaDestroyBuffer(static_cast<VmaAllocator>(vma), buffer, allocation);
-        }));
+    ctx_.deferredDestroy(VulkanRetirementQueue::Type::BufferVma, vkBuffer_, vmaAllocation_);
   } else {
     if (mappedPtr_) {
       ctx_.vf_.vkUnmapMemory(device_, vkMemory_);
     }
-    ctx_.deferredTask(std::packaged_task<void()>(
-        [vf = &ctx_.vf_, device = device_, buffer = vkBuffer_, memory = vkMemory_]() {
-          vf->vkDestroyBuffer(device, buffer, nullptr);
-          vf->vkFreeMemory(device, memory, nullptr);
-        }));
+    ctx_.deferredDestroy(VulkanRetirementQueue::Type::Buffer, vkBuffer_, vkMemory_);
   }
 }
 
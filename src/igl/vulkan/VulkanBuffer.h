@@ -12,6 +12,7 @@
 namespace igl::vulkan {
 
 class VulkanContext;
+enum class MemoryCategory : uint8_t;
 
 /// @brief A wrapper around a Vulkan Buffer object that provides convenience functions for
 /// uploading/downloading data to/from the GPU.
@@ -20,14 +21,16 @@ class VulkanBuffer {
   /** @brief Creates a new VulkanBuffer with a given size, usage flags, memory property flags, and
    * an optional debug name. Uses VMA if IGL is built with VMA support. If memory flags specify
    * that the buffer is visible by the host (the CPU), then the buffer's memory will be mapped into
-   * the application's address space and can be accessed directly.
+   * the application's address space and can be accessed directly. The allocation is accounted
+   * under `memoryCategory` in VulkanContext::getMemoryStats().
    */
   VulkanBuffer(const VulkanContext& ctx,
                VkDevice device,
                VkDeviceSize bufferSize,
                VkBufferUsageFlags usageFlags,
                VkMemoryPropertyFlags memFlags,
-               const char* debugName = nullptr);
+               const char* debugName,
+               MemoryCategory memoryCategory);
   ~VulkanBuffer();
 
   VulkanBuffer(const VulkanBuffer&) = delete;
@@ -93,6 +96,8 @@ class VulkanBuffer {
   VmaAllocation vmaAllocation_ = VK_NULL_HANDLE;
   VkDeviceAddress vkDeviceAddress_ = 0;
   VkDeviceSize bufferSize_ = 0;
+  VkDeviceSize allocatedSize_ = 0; // accounted in VulkanContext::getMemoryStats()
+  MemoryCategory memoryCategory_;
   VkBufferUsageFlags usageFlags_ = 0;
   VkMemoryPropertyFlags memFlags_ = 0;
   void* mappedPtr_ = nullptr;
@@ -5,9 +5,11 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -65,6 +67,12 @@ const uint32_t kBinding_SamplerShadow = 5;
 const uint32_t kBinding_StorageImages = 6;
 // NOLINTEND(readability-identifier-naming)
 
+// the smallest capacity the bindless descriptor set grows to once the initial one is exhausted
+const uint32_t kMinBindlessGrowth = 1024u;
+
+// submits between two memory budget checks when no frames are presented
+const uint32_t kMemoryBudgetCheckInterval = 32u;
+
 #if !IGL_PLATFORM_APPLE
 VKAPI_ATTR VkBool32 VKAPI_CALL
 vulkanDebugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT msgSeverity,
@@ -230,12 +238,9 @@ class DescriptorPoolsArena final {
   DescriptorPoolsArena& operator=(DescriptorPoolsArena&&) = delete;
   ~DescriptorPoolsArena() {
     extinct_.push_back({.pool = pool_, .handle = {}});
-    ctx_.deferredTask(std::packaged_task<void()>(
-        [extinct = std::move(extinct_), vf = ctx_.vf_, device = device_]() {
-          for (const auto& p : extinct) {
-            vf.vkDestroyDescriptorPool(device, p.pool, nullptr);
-          }
-        }));
+    for (const auto& p : extinct_) {
+      ctx_.deferredDestroy(VulkanRetirementQueue::Type::DescriptorPool, p.pool);
+    }
   }
   [[nodiscard]] VkDescriptorSetLayout getVkDescriptorSetLayout() const {
     return dsl_;
@@ -262,6 +267,47 @@ class DescriptorPoolsArena final {
     return dset;
   }
 
+  /// @brief Returns a descriptor set which was written with exactly the same `contents` under the
+  /// same `nextSubmitHandle`, or VK_NULL_HANDLE. Descriptor sets handed out for a submit are not
+  /// recycled before that submit completes, and neither are the resources referenced by them, so
+  /// binding such a descriptor set again is safe. The cache is dropped on every new submit.
+  [[nodiscard]] VkDescriptorSet findCachedDescriptorSet(
+      VulkanImmediateCommands::SubmitHandle nextSubmitHandle,
+      const uint64_t* contents,
+      uint32_t numContents,
+      uint64_t hash) {
+    if (cacheSubmitHandle_ != nextSubmitHandle) {
+      cacheSubmitHandle_ = nextSubmitHandle;
+      cacheIndex_.clear();
+      cacheEntries_.clear();
+      cacheContents_.clear();
+      return VK_NULL_HANDLE;
+    }
+    const auto range = cacheIndex_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      const CachedDescriptorSet& e = cacheEntries_[it->second];
+      if (e.numContents == numContents &&
+          std::equal(contents, contents + numContents, cacheContents_.data() + e.offset)) {
+        return e.dset;
+      }
+    }
+    return VK_NULL_HANDLE;
+  }
+
+  void cacheDescriptorSet(VkDescriptorSet dset,
+                          const uint64_t* contents,
+                          uint32_t numContents,
+                          uint64_t hash) {
+    if (cacheEntries_.size() >= kMaxCachedDSets) {
+      return;
+    }
+    cacheIndex_.emplace(hash, static_cast<uint32_t>(cacheEntries_.size()));
+    cacheEntries_.push_back({.dset = dset,
+                             .offset = static_cast<uint32_t>(cacheContents_.size()),
+                             .numContents = numContents});
+    cacheContents_.insert(cacheContents_.end(), contents, contents + numContents);
+  }
+
  private:
   void switchToNewDescriptorPool(VulkanImmediateCommands& ic,
                                  VulkanImmediateCommands::SubmitHandle nextSubmitHandle) {
@@ -328,10 +374,39 @@ class DescriptorPoolsArena final {
   };
 
   std::deque<ExtinctDescriptorPool> extinct_;
+
+  // descriptor sets written under `cacheSubmitHandle_`
+  static constexpr uint32_t kMaxCachedDSets = 256;
+
+  struct CachedDescriptorSet {
+    VkDescriptorSet dset = VK_NULL_HANDLE;
+    uint32_t offset = 0; // into cacheContents_
+    uint32_t numContents = 0;
+  };
+
+  VulkanImmediateCommands::SubmitHandle cacheSubmitHandle_ = {};
+  // hash of the contents -> index into cacheEntries_
+  std::unordered_multimap<uint64_t, uint32_t> cacheIndex_;
+  std::vector<CachedDescriptorSet> cacheEntries_;
+  std::vector<uint64_t> cacheContents_;
 };
 
 namespace {
 
+// contents of a descriptor set as a flat array of words used as a cache key by DescriptorPoolsArena
+template<size_t N>
+struct DescriptorSetContents {
+  uint64_t words[N] = {}; // NOLINT(modernize-avoid-c-arrays)
+  uint32_t numWords = 0;
+  uint64_t hash = 0;
+
+  void add(uint64_t value) {
+    IGL_DEBUG_ASSERT(numWords < N);
+    words[numWords++] = value;
+    hash ^= std::hash<uint64_t>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+};
+
 inline size_t alignUp(size_t value, size_t alignment) {
   return (value + alignment - 1) & ~(alignment - 1);
 }
@@ -381,7 +456,8 @@ class DescriptorBuffersArena final {
                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
                                         VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                                     nullptr,
-                                    "DescriptorBuffer")};
+                                    "DescriptorBuffer",
+                                    MemoryCategory::DescriptorBuffer)};
   }
 
  private:
@@ -428,6 +504,30 @@ struct VulkanContextImpl final {
   VkDescriptorSet dsBindless = VK_NULL_HANDLE;
   uint32_t currentMaxBindlessTextures = 8;
   uint32_t currentMaxBindlessSamplers = 8;
+  // slots of dsBindless which have to be rewritten by checkAndUpdateDescriptorSets()
+  std::vector<uint32_t> dirtyBindlessTextures;
+  std::vector<uint32_t> dirtyBindlessSamplers;
+  // slots of destroyed resources and the submits which can still reference them: such slots are
+  // not rewritten, but reusing one for a new resource has to wait for its submit to complete
+  std::vector<std::pair<uint32_t, VulkanImmediateCommands::SubmitHandle>> pendingBindlessTextures;
+  std::vector<std::pair<uint32_t, VulkanImmediateCommands::SubmitHandle>> pendingBindlessSamplers;
+  // dsBindless was (re)allocated and every slot has to be written
+  bool needsFullBindlessUpdate = true;
+  BindlessDescriptorStats bindlessStats;
+  DescriptorSetCacheStats descriptorSetCacheStats;
+
+  // bytes allocated by IGL buffers and images, indexed by MemoryCategory
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  std::atomic<int64_t> memoryCategoryBytes[(size_t)MemoryCategory::Count];
+  struct MemoryBudgetCallbackInfo {
+    float budgetFraction = 1.0f;
+    MemoryBudgetCallback callback;
+    uint32_t heapsOverBudget = 0; // bitmask of heaps the callback was invoked for
+  };
+  std::vector<MemoryBudgetCallbackInfo> memoryBudgetCallbacks;
+  uint64_t vmaFrameNumber = 0;
+  uint64_t budgetCheckFrameNumber = 0;
+  uint32_t numSubmitsUntilBudgetCheck = 0;
 
   ldr::Pool<BindGroupBufferTag, BindGroupMetadataBuffers> bindGroupBuffersPool;
   ldr::Pool<BindGroupTextureTag, BindGroupMetadataTextures> bindGroupTexturesPool;
@@ -485,6 +585,26 @@ struct VulkanContextImpl final {
                                                                "arenaBuffers_");
     return *arenaBuffers[dsl].get();
   }
+
+  // returns a descriptor set which already holds `contents`, or VK_NULL_HANDLE
+  template<size_t N>
+  VkDescriptorSet findCachedDescriptorSet(const VulkanContext& ctx,
+                                          DescriptorPoolsArena& arena,
+                                          VulkanImmediateCommands::SubmitHandle nextSubmitHandle,
+                                          const DescriptorSetContents<N>& contents,
+                                          uint32_t numDescriptors) {
+    if (!ctx.config_.enableDescriptorSetCache) {
+      return VK_NULL_HANDLE;
+    }
+    VkDescriptorSet dset = arena.findCachedDescriptorSet(
+        nextSubmitHandle, contents.words, contents.numWords, contents.hash);
+    descriptorSetCacheStats.numLookups++;
+    if (dset != VK_NULL_HANDLE) {
+      descriptorSetCacheStats.numUpdateDescriptorSetsSaved++;
+      descriptorSetCacheStats.numDescriptorWritesSaved += numDescriptors;
+    }
+    return dset;
+  }
 };
 
 VulkanContext::VulkanContext(VulkanContextConfig config,
@@ -1095,6 +1215,7 @@ Result VulkanContext::initContext(const HWDeviceDesc& desc,
                               vkInstance_,
                               apiVersion > VK_API_VERSION_1_3 ? VK_API_VERSION_1_3 : apiVersion,
                               features_.has_VK_KHR_buffer_device_address,
+                              features_.has_VK_EXT_memory_budget,
                               (VkDeviceSize)config_.vmaPreferredLargeHeapBlockSize,
                               &pimpl_->vma));
   }
@@ -1264,6 +1385,12 @@ void VulkanContext::growBindlessDescriptorPool(uint32_t newMaxTextures, uint32_t
 
   pimpl_->currentMaxBindlessTextures = newMaxTextures;
   pimpl_->currentMaxBindlessSamplers = newMaxSamplers;
+  // a brand new descriptor set is allocated below and none of its slots are populated yet
+  pimpl_->needsFullBindlessUpdate = true;
+  pimpl_->dirtyBindlessTextures.clear();
+  pimpl_->dirtyBindlessSamplers.clear();
+  pimpl_->pendingBindlessTextures.clear();
+  pimpl_->pendingBindlessSamplers.clear();
 
 #if IGL_VULKAN_PRINT_COMMANDS
   IGL_LOG_INFO("growBindlessDescriptorPool(%u, %u)\n", newMaxTextures, newMaxSamplers);
@@ -1288,9 +1415,7 @@ void VulkanContext::growBindlessDescriptorPool(uint32_t newMaxTextures, uint32_t
   VkDevice device = getVkDevice();
 
   if (pimpl_->dpBindless != VK_NULL_HANDLE) {
-    deferredTask(std::packaged_task<void()>([vf = &vf_, device, dp = pimpl_->dpBindless]() {
-      vf->vkDestroyDescriptorPool(device, dp, nullptr);
-    }));
+    deferredDestroy(VulkanRetirementQueue::Type::DescriptorPool, pimpl_->dpBindless);
   }
 
   // create default descriptor set layout which is going to be shared by graphics pipelines
@@ -1441,8 +1566,8 @@ std::unique_ptr<VulkanBuffer> VulkanContext::createBuffer(VkDeviceSize bufferSiz
                                                           VkBufferUsageFlags usageFlags,
                                                           VkMemoryPropertyFlags memFlags,
                                                           Result* IGL_NULLABLE outResult,
-                                                          const char* IGL_NULLABLE
-                                                              debugName) const {
+                                                          const char* IGL_NULLABLE debugName,
+                                                          MemoryCategory memoryCategory) const {
   IGL_PROFILER_FUNCTION();
 
 #define ENSURE_BUFFER_SIZE(flag, maxSize)                                                      \
@@ -1463,7 +1588,7 @@ std::unique_ptr<VulkanBuffer> VulkanContext::createBuffer(VkDeviceSize bufferSiz
 
   Result::setOk(outResult);
   return std::make_unique<VulkanBuffer>(
-      *this, vkDevice_, bufferSize, usageFlags, memFlags, debugName);
+      *this, vkDevice_, bufferSize, usageFlags, memFlags, debugName, memoryCategory);
 }
 
 VulkanImage VulkanContext::createImage(VkImageType imageType,
@@ -1579,6 +1704,7 @@ void VulkanContext::pruneTextures() {
     for (uint32_t i = 1; i < static_cast<uint32_t>(textures_.objects_.size()); i++) {
       if (textures_.objects_[i] && textures_.objects_[i].use_count() == 1) {
         textures_.destroy(textures_.getHandle(i));
+        markBindlessTextureDirty(i, true);
       }
     }
   }
@@ -1600,14 +1726,35 @@ VkResult VulkanContext::checkAndUpdateDescriptorSets() {
     return VK_SUCCESS;
   }
 
-  uint32_t newMaxTextures = pimpl_->currentMaxBindlessTextures;
-  uint32_t newMaxSamplers = pimpl_->currentMaxBindlessSamplers;
+  // grow geometrically in large steps: every growth reallocates the descriptor set and requires
+  // rewriting all of its slots, so it should happen as rarely as possible
+  const auto grow = [](uint32_t current, size_t required, uint32_t hardwareLimit) -> uint32_t {
+    uint32_t newMax = current;
+    while (required > newMax) {
+      newMax = std::max(newMax * 2, kMinBindlessGrowth);
+    }
+    if (newMax != current && hardwareLimit) {
+      newMax = std::min(newMax, hardwareLimit);
+    }
+    return newMax;
+  };
 
-  while (textures_.objects_.size() > newMaxTextures) {
-    newMaxTextures *= 2;
-  }
-  while (samplers_.objects_.size() > newMaxSamplers) {
-    newMaxSamplers *= 2;
+  const VkPhysicalDeviceDescriptorIndexingPropertiesEXT& props =
+      vkPhysicalDeviceDescriptorIndexingProperties_;
+  const uint32_t newMaxTextures = grow(pimpl_->currentMaxBindlessTextures,
+                                       textures_.objects_.size(),
+                                       props.maxDescriptorSetUpdateAfterBindSampledImages);
+  const uint32_t newMaxSamplers = grow(pimpl_->currentMaxBindlessSamplers,
+                                       samplers_.objects_.size(),
+                                       props.maxDescriptorSetUpdateAfterBindSamplers);
+  if (textures_.objects_.size() > newMaxTextures || samplers_.objects_.size() > newMaxSamplers) {
+    IGL_LOG_ERROR(
+        "Bindless descriptor set limits exceeded: %u textures (max %u), %u samplers (max %u)\n",
+        static_cast<uint32_t>(textures_.objects_.size()),
+        newMaxTextures,
+        static_cast<uint32_t>(samplers_.objects_.size()),
+        newMaxSamplers);
+    return VK_ERROR_TOO_MANY_OBJECTS;
   }
   if (newMaxTextures != pimpl_->currentMaxBindlessTextures ||
       newMaxSamplers != pimpl_->currentMaxBindlessSamplers) {
@@ -1618,22 +1765,87 @@ VkResult VulkanContext::checkAndUpdateDescriptorSets() {
   IGL_DEBUG_ASSERT(!textures_.objects_.empty());
   IGL_DEBUG_ASSERT(!samplers_.objects_.empty());
 
-  // 1. Sampled and storage images
-  std::vector<VkDescriptorImageInfo> infoSampledImages;
-  std::vector<VkDescriptorImageInfo> infoStorageImages;
-  infoSampledImages.reserve(textures_.objects_.size());
-  infoStorageImages.reserve(textures_.objects_.size());
+  std::vector<uint32_t>& dirtyTextures = pimpl_->dirtyBindlessTextures;
+  std::vector<uint32_t>& dirtySamplers = pimpl_->dirtyBindlessSamplers;
+
+  const bool isFullUpdate = pimpl_->needsFullBindlessUpdate;
+
+  if (isFullUpdate) {
+    dirtyTextures.resize(textures_.objects_.size());
+    dirtySamplers.resize(samplers_.objects_.size());
+    std::iota(dirtyTextures.begin(), dirtyTextures.end(), 0u);
+    std::iota(dirtySamplers.begin(), dirtySamplers.end(), 0u);
+  } else {
+    // the same slot can be marked multiple times (i.e. destroyed and then reused)
+    std::sort(dirtyTextures.begin(), dirtyTextures.end());
+    dirtyTextures.erase(std::unique(dirtyTextures.begin(), dirtyTextures.end()),
+                        dirtyTextures.end());
+    std::sort(dirtySamplers.begin(), dirtySamplers.end());
+    dirtySamplers.erase(std::unique(dirtySamplers.begin(), dirtySamplers.end()),
+                        dirtySamplers.end());
+  }
+
+  // Slots of destroyed resources are never rewritten: the bindings are PARTIALLY_BOUND, so a stale
+  // descriptor in a slot no shader indexes anymore is legal. A slot reused by a new resource while
+  // the submit which destroyed its previous resource is still pending could be dynamically used by
+  // that submit, so only then wait for that particular submit.
+  std::vector<VulkanImmediateCommands::SubmitHandle> waitHandles;
+  const auto collectPendingSlots =
+      [this, isFullUpdate, &waitHandles](
+          std::vector<std::pair<uint32_t, VulkanImmediateCommands::SubmitHandle>>& pending,
+          const std::vector<uint32_t>& dirty) {
+        if (isFullUpdate) {
+          // a freshly allocated descriptor set is not referenced by any submit
+          pending.clear();
+          return;
+        }
+        const auto isRetired = [this](const auto& p) { return immediate_->isReady(p.second); };
+        pending.erase(std::remove_if(pending.begin(), pending.end(), isRetired), pending.end());
+        for (const auto& [slot, handle] : pending) {
+          if (std::binary_search(dirty.begin(), dirty.end(), slot)) {
+            waitHandles.push_back(handle);
+          }
+        }
+      };
+  collectPendingSlots(pimpl_->pendingBindlessTextures, dirtyTextures);
+  collectPendingSlots(pimpl_->pendingBindlessSamplers, dirtySamplers);
 
   // use the dummy texture/sampler to avoid sparse array
   VkImageView dummyImageView = textures_.objects_[0]->imageView_.getVkImageView();
   VkSampler dummySampler = samplers_.objects_[0].vkSampler;
 
-  for (const auto& entry : textures_.objects_) {
-    const VulkanTexture* texture = entry.get();
-    if (texture) {
+  // all image infos are reserved upfront: VkWriteDescriptorSet structures point into them
+  std::vector<VkDescriptorImageInfo> infoSampledImages;
+  std::vector<VkDescriptorImageInfo> infoStorageImages;
+  std::vector<VkDescriptorImageInfo> infoSamplers;
+  infoSampledImages.reserve(dirtyTextures.size());
+  infoStorageImages.reserve(dirtyTextures.size());
+  infoSamplers.reserve(dirtySamplers.size());
+
+  std::vector<VkWriteDescriptorSet> write;
+  uint32_t numDescriptors = 0;
+
+  // every run of consecutive dirty slots is written with a single VkWriteDescriptorSet per binding
+  const auto forEachRun = [](const std::vector<uint32_t>& slots, const auto& func) {
+    for (size_t first = 0; first < slots.size();) {
+      size_t last = first;
+      while (last + 1 < slots.size() && slots[last + 1] == slots[last] + 1) {
+        last++;
+      }
+      func(slots[first], static_cast<uint32_t>(last - first + 1), &slots[first]);
+      first = last + 1;
+    }
+  };
+
+  // 1. Sampled and storage images
+  forEachRun(dirtyTextures, [&](uint32_t firstSlot, uint32_t count, const uint32_t* slots) {
+    const size_t infoOffset = infoSampledImages.size();
+    for (uint32_t i = 0; i != count; i++) {
+      const VulkanTexture* texture =
+          slots[i] < textures_.objects_.size() ? textures_.objects_[slots[i]].get() : nullptr;
       // multisampled images cannot be directly accessed from shaders
       const bool isTextureAvailable =
-          (texture->image.samples_ & VK_SAMPLE_COUNT_1_BIT) == VK_SAMPLE_COUNT_1_BIT;
+          texture && (texture->image.samples_ & VK_SAMPLE_COUNT_1_BIT) == VK_SAMPLE_COUNT_1_BIT;
       const bool isSampledImage = isTextureAvailable && texture->image.isSampledImage();
       const bool isStorageImage = isTextureAvailable && texture->image.isStorageImage();
       infoSampledImages.push_back(
@@ -1644,74 +1856,261 @@ VkResult VulkanContext::checkAndUpdateDescriptorSets() {
           .sampler = VK_NULL_HANDLE,
           .imageView = isStorageImage ? texture->imageView_.getVkImageView() : dummyImageView,
           .imageLayout = VK_IMAGE_LAYOUT_GENERAL});
-    } else {
-      infoSampledImages.push_back({.sampler = dummySampler,
-                                   .imageView = dummyImageView,
-                                   .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL});
-      infoStorageImages.push_back(VkDescriptorImageInfo{.sampler = VK_NULL_HANDLE,
-                                                        .imageView = dummyImageView,
-                                                        .imageLayout = VK_IMAGE_LAYOUT_GENERAL});
+      IGL_DEBUG_ASSERT(infoSampledImages.back().imageView != VK_NULL_HANDLE);
+      IGL_DEBUG_ASSERT(infoStorageImages.back().imageView != VK_NULL_HANDLE);
     }
-    IGL_DEBUG_ASSERT(infoSampledImages.back().imageView != VK_NULL_HANDLE);
-    IGL_DEBUG_ASSERT(infoStorageImages.back().imageView != VK_NULL_HANDLE);
-  }
+    // use the same indexing for every texture type
+    for (uint32_t b = kBinding_Texture2D; b != kBinding_TextureCube + 1; b++) {
+      VkWriteDescriptorSet w = ivkGetWriteDescriptorSetImageInfo(pimpl_->dsBindless,
+                                                                 b,
+                                                                 VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+                                                                 count,
+                                                                 &infoSampledImages[infoOffset]);
+      w.dstArrayElement = firstSlot;
+      write.push_back(w);
+    }
+    VkWriteDescriptorSet w = ivkGetWriteDescriptorSetImageInfo(pimpl_->dsBindless,
+                                                               kBinding_StorageImages,
+                                                               VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                                                               count,
+                                                               &infoStorageImages[infoOffset]);
+    w.dstArrayElement = firstSlot;
+    write.push_back(w);
+    numDescriptors += 5 * count;
+  });
 
   // 2. Samplers
-  std::vector<VkDescriptorImageInfo> infoSamplers;
-  infoSamplers.reserve(samplers_.objects_.size());
+  forEachRun(dirtySamplers, [&](uint32_t firstSlot, uint32_t count, const uint32_t* slots) {
+    const size_t infoOffset = infoSamplers.size();
+    for (uint32_t i = 0; i != count; i++) {
+      const VkSampler sampler =
+          slots[i] < samplers_.objects_.size() ? samplers_.objects_[slots[i]].vkSampler
+                                        : VK_NULL_HANDLE;
+      infoSamplers.push_back({.sampler = sampler != VK_NULL_HANDLE ? sampler : dummySampler,
+                              .imageView = VK_NULL_HANDLE,
+                              .imageLayout = VK_IMAGE_LAYOUT_UNDEFINED});
+    }
+    for (uint32_t b = kBinding_Sampler; b != kBinding_SamplerShadow + 1; b++) {
+      VkWriteDescriptorSet w = ivkGetWriteDescriptorSetImageInfo(
+          pimpl_->dsBindless, b, VK_DESCRIPTOR_TYPE_SAMPLER, count, &infoSamplers[infoOffset]);
+      w.dstArrayElement = firstSlot;
+      write.push_back(w);
+    }
+    numDescriptors += 2 * count;
+  });
 
-  for (const auto& entry : samplers_.objects_) {
-    const VulkanSampler* sampler = &entry;
-    infoSamplers.push_back({.sampler = sampler ? sampler->vkSampler : dummySampler,
-                            .imageView = VK_NULL_HANDLE,
-                            .imageLayout = VK_IMAGE_LAYOUT_UNDEFINED});
+  // do not touch the descriptor set if there is nothing to update
+  if (!write.empty()) {
+#if IGL_VULKAN_PRINT_COMMANDS
+    IGL_LOG_INFO("Updating descriptor set dsBindless_: %u descriptors (%s)\n",
+                 numDescriptors,
+                 isFullUpdate ? "full" : "incremental");
+#endif // IGL_VULKAN_PRINT_COMMANDS
+    // The bindless bindings are UPDATE_AFTER_BIND | UPDATE_UNUSED_WHILE_PENDING: slots which are
+    // not referenced by any in-flight command buffer can be written right away
+    for (const VulkanImmediateCommands::SubmitHandle& handle : waitHandles) {
+      VK_ASSERT(immediate_->wait(handle, config_.fenceTimeoutNanoseconds));
+    }
+    vf_.vkUpdateDescriptorSets(
+        vkDevice_, static_cast<uint32_t>(write.size()), write.data(), 0, nullptr);
   }
 
-  std::vector<VkWriteDescriptorSet> write;
+  BindlessDescriptorStats& stats = pimpl_->bindlessStats;
+  const uint64_t frameNumber = getFrameNumber();
+  if (stats.frameNumber != frameNumber) {
+    stats.frameNumber = frameNumber;
+    stats.numDescriptorsWrittenThisFrame = 0;
+    stats.numWritesThisFrame = 0;
+  }
+  stats.numDescriptorsWrittenThisFrame += numDescriptors;
+  stats.numWritesThisFrame += static_cast<uint32_t>(write.size());
+  stats.numDescriptorsWrittenTotal += numDescriptors;
+  stats.numFullUpdates += isFullUpdate ? 1u : 0u;
+  stats.numWaitsForReusedSlots += static_cast<uint32_t>(waitHandles.size());
 
-  if (!infoSampledImages.empty()) {
-    // use the same indexing for every texture type
-    for (uint32_t i = kBinding_Texture2D; i != kBinding_TextureCube + 1; i++) {
-      write.push_back(
-          ivkGetWriteDescriptorSetImageInfo(pimpl_->dsBindless,
-                                            i,
-                                            VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
-                                            static_cast<uint32_t>(infoSampledImages.size()),
-                                            infoSampledImages.data()));
+  dirtyTextures.clear();
+  dirtySamplers.clear();
+  pimpl_->needsFullBindlessUpdate = false;
+
+  awaitingCreation_ = false;
+  return VK_SUCCESS;
+}
+
+void VulkanContext::markBindlessTextureDirty(uint32_t index, bool destroyed) const {
+  if (!config_.enableDescriptorIndexing) {
+    return;
+  }
+  if (!pimpl_->needsFullBindlessUpdate) {
+    if (destroyed) {
+      pimpl_->pendingBindlessTextures.emplace_back(index, immediate_->getNextSubmitHandle());
+    } else {
+      pimpl_->dirtyBindlessTextures.push_back(index);
     }
-  };
+  }
+  awaitingCreation_ = true;
+}
 
-  if (!infoSamplers.empty()) {
-    for (uint32_t i = kBinding_Sampler; i != kBinding_SamplerShadow + 1; i++) {
-      write.push_back(ivkGetWriteDescriptorSetImageInfo(pimpl_->dsBindless,
-                                                        i,
-                                                        VK_DESCRIPTOR_TYPE_SAMPLER,
-                                                        static_cast<uint32_t>(infoSamplers.size()),
-                                                        infoSamplers.data()));
+void VulkanContext::markBindlessSamplerDirty(uint32_t index, bool destroyed) const {
+  if (!config_.enableDescriptorIndexing) {
+    return;
+  }
+  if (!pimpl_->needsFullBindlessUpdate) {
+    if (destroyed) {
+      pimpl_->pendingBindlessSamplers.emplace_back(index, immediate_->getNextSubmitHandle());
+    } else {
+      pimpl_->dirtyBindlessSamplers.push_back(index);
     }
   }
+  awaitingCreation_ = true;
+}
+
+DescriptorSetCacheStats VulkanContext::getDescriptorSetCacheStats() const {
+  return pimpl_->descriptorSetCacheStats;
+}
 
-  if (!infoStorageImages.empty()) {
-    write.push_back(
-        ivkGetWriteDescriptorSetImageInfo(pimpl_->dsBindless,
-                                          kBinding_StorageImages,
-                                          VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
-                                          static_cast<uint32_t>(infoStorageImages.size()),
-                                          infoStorageImages.data()));
+MemoryStats VulkanContext::getMemoryStats(bool detailed) const {
+  IGL_PROFILER_FUNCTION();
+
+  MemoryStats stats = {
+      .hasMemoryBudget = features_.has_VK_EXT_memory_budget,
+      .numHeaps = memoryProperties.memoryHeapCount,
   };
 
-  // do not switch to the next descriptor set if there is nothing to update
-  if (!write.empty()) {
-#if IGL_VULKAN_PRINT_COMMANDS
-    IGL_LOG_INFO("Updating descriptor set dsBindless_\n");
-#endif // IGL_VULKAN_PRINT_COMMANDS
-    VK_ASSERT(immediate_->wait(immediate_->getLastSubmitHandle()));
-    vf_.vkUpdateDescriptorSets(
-        vkDevice_, static_cast<uint32_t>(write.size()), write.data(), 0, nullptr);
+  for (uint32_t i = 0; i != stats.numHeaps; i++) {
+    const VkMemoryHeap& heap = memoryProperties.memoryHeaps[i];
+    stats.heaps[i].size = heap.size;
+    stats.heaps[i].isDeviceLocal = (heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
   }
 
-  awaitingCreation_ = false;
-  return VK_SUCCESS;
+  if (IGL_VULKAN_USE_VMA && pimpl_->vma) {
+    // VMA uses VK_EXT_memory_budget when available and falls back to its own estimates otherwise
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS] = {};
+    vmaGetHeapBudgets(pimpl_->vma, budgets);
+    for (uint32_t i = 0; i != stats.numHeaps; i++) {
+      stats.heaps[i].budget = budgets[i].budget;
+      stats.heaps[i].usage = budgets[i].usage;
+    }
+    if (detailed) {
+      VmaTotalStatistics total = {};
+      vmaCalculateStatistics(pimpl_->vma, &total);
+      for (uint32_t i = 0; i != stats.numHeaps; i++) {
+        const VmaDetailedStatistics& s = total.memoryHeap[i];
+        stats.heaps[i].blockCount = s.statistics.blockCount;
+        stats.heaps[i].allocationCount = s.statistics.allocationCount;
+        stats.heaps[i].blockBytes = s.statistics.blockBytes;
+        stats.heaps[i].allocationBytes = s.statistics.allocationBytes;
+        stats.heaps[i].unusedRangeCount = s.unusedRangeCount;
+        stats.heaps[i].unusedRangeSizeMax = s.unusedRangeSizeMax;
+      }
+    }
+  } else if (stats.hasMemoryBudget) {
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT,
+    };
+    VkPhysicalDeviceMemoryProperties2 props = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2,
+        .pNext = &budgetProps,
+    };
+    vf_.vkGetPhysicalDeviceMemoryProperties2(vkPhysicalDevice_, &props);
+    for (uint32_t i = 0; i != stats.numHeaps; i++) {
+      stats.heaps[i].budget = budgetProps.heapBudget[i];
+      stats.heaps[i].usage = budgetProps.heapUsage[i];
+    }
+  } else {
+    // same heuristic as VMA uses without VK_EXT_memory_budget
+    for (uint32_t i = 0; i != stats.numHeaps; i++) {
+      stats.heaps[i].budget = stats.heaps[i].size * 8 / 10;
+    }
+  }
+
+  for (size_t i = 0; i != (size_t)MemoryCategory::Count; i++) {
+    const int64_t bytes = pimpl_->memoryCategoryBytes[i].load(std::memory_order_relaxed);
+    stats.categoryBytes[i] = bytes > 0 ? static_cast<VkDeviceSize>(bytes) : 0;
+  }
+
+  return stats;
+}
+
+VkDeviceSize VulkanContext::getAllocatedMemoryBytes() const {
+  int64_t bytes = 0;
+  for (const auto& b : pimpl_->memoryCategoryBytes) {
+    bytes += b.load(std::memory_order_relaxed);
+  }
+  return bytes > 0 ? static_cast<VkDeviceSize>(bytes) : 0;
+}
+
+void VulkanContext::addMemoryBudgetCallback(float budgetFraction, MemoryBudgetCallback callback) {
+  IGL_DEBUG_ASSERT(budgetFraction >= 0.0f);
+  IGL_DEBUG_ASSERT(callback);
+
+  pimpl_->memoryBudgetCallbacks.push_back({
+      .budgetFraction = budgetFraction,
+      .callback = std::move(callback),
+  });
+}
+
+void VulkanContext::trackMemoryUsage(MemoryCategory category, int64_t bytes) const {
+  IGL_DEBUG_ASSERT(category < MemoryCategory::Count);
+
+  pimpl_->memoryCategoryBytes[(size_t)category].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void VulkanContext::checkMemoryBudgets() const {
+  if (IGL_VULKAN_USE_VMA && pimpl_->vma) {
+    // let VMA refresh its cached budget values once per frame
+    const uint64_t frameNumber = getFrameNumber();
+    if (frameNumber != pimpl_->vmaFrameNumber) {
+      pimpl_->vmaFrameNumber = frameNumber;
+      vmaSetCurrentFrameIndex(pimpl_->vma, static_cast<uint32_t>(frameNumber));
+    }
+  }
+
+  if (pimpl_->memoryBudgetCallbacks.empty()) {
+    return;
+  }
+
+  // querying budgets is not free: check once per presented frame or, when nothing is presented,
+  // once every kMemoryBudgetCheckInterval submits
+  const uint64_t frameNumber = getFrameNumber();
+  if (frameNumber == pimpl_->budgetCheckFrameNumber && pimpl_->numSubmitsUntilBudgetCheck) {
+    pimpl_->numSubmitsUntilBudgetCheck--;
+    return;
+  }
+  pimpl_->budgetCheckFrameNumber = frameNumber;
+  pimpl_->numSubmitsUntilBudgetCheck = kMemoryBudgetCheckInterval;
+
+  IGL_PROFILER_FUNCTION();
+
+  const MemoryStats stats = getMemoryStats();
+
+  for (auto& info : pimpl_->memoryBudgetCallbacks) {
+    for (uint32_t i = 0; i != stats.numHeaps; i++) {
+      const MemoryHeapStats& heap = stats.heaps[i];
+      const uint32_t heapBit = 1u << i;
+      const bool isOverBudget =
+          heap.budget && float(heap.usage) > info.budgetFraction * float(heap.budget);
+      if (!isOverBudget) {
+        info.heapsOverBudget &= ~heapBit;
+      } else if ((info.heapsOverBudget & heapBit) == 0) {
+        info.heapsOverBudget |= heapBit;
+        info.callback(stats, i);
+      }
+    }
+  }
+}
+
+BindlessDescriptorStats VulkanContext::getBindlessDescriptorStats() const {
+  BindlessDescriptorStats stats = pimpl_->bindlessStats;
+  const uint64_t frameNumber = getFrameNumber();
+  if (stats.frameNumber != frameNumber) {
+    stats.frameNumber = frameNumber;
+    stats.numDescriptorsWrittenThisFrame = 0;
+    stats.numWritesThisFrame = 0;
+  }
+  stats.maxTextures = config_.enableDescriptorIndexing ? pimpl_->currentMaxBindlessTextures : 0;
+  stats.maxSamplers = config_.enableDescriptorIndexing ? pimpl_->currentMaxBindlessSamplers : 0;
+  return stats;
 }
 
 std::shared_ptr<VulkanTexture> VulkanContext::createTexture(
@@ -1732,6 +2131,7 @@ std::shared_ptr<VulkanTexture> VulkanContext::createTexture(
   texture->textureId_ = handle.index();
 
   awaitingCreation_ = true;
+  markBindlessTextureDirty(handle.index(), false);
 
   return texture;
 }
@@ -1782,6 +2182,7 @@ SamplerHandle VulkanContext::createSampler(const VkSamplerCreateInfo& ci,
   samplers_.get(handle)->samplerId = handle.index();
 
   awaitingCreation_ = true;
+  markBindlessSamplerDirty(handle.index(), false);
 
   return handle;
 }
@@ -1911,15 +2312,13 @@ void VulkanContext::updateBindingsTextures(VkCommandBuffer IGL_NONNULL cmdBuf,
   DescriptorPoolsArena& arena = pimpl_->getOrCreateArena_CombinedImageSamplers(
       *this, dsl.getVkDescriptorSetLayout(), dsl.numBindings);
 
-  VkDescriptorSet dset = arena.getNextDescriptorSet(*immediate_, nextSubmitHandle);
-
   // NOLINTNEXTLINE(modernize-avoid-c-arrays)
   VkDescriptorImageInfo infoSampledImages[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  uint32_t locations[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
   uint32_t numImages = 0;
 
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  VkWriteDescriptorSet writes[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
-  uint32_t numWrites = 0;
+  DescriptorSetContents<3 * IGL_TEXTURE_SAMPLERS_MAX> contents;
 
   // make sure the guard value is always there
   IGL_DEBUG_ASSERT(!textures_.objects_.empty());
@@ -1941,26 +2340,49 @@ void VulkanContext::updateBindingsTextures(VkCommandBuffer IGL_NONNULL cmdBuf,
       IGL_DEBUG_ASSERT(data.samplers[loc], "A sampler should be bound to every bound texture slot");
     }
     VkSampler sampler = data.samplers[loc] ? data.samplers[loc] : dummySampler;
-    writes[numWrites++] = ivkGetWriteDescriptorSetImageInfo(
-        dset, loc, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, &infoSampledImages[numImages]);
-    infoSampledImages[numImages++] = VkDescriptorImageInfo{
+    locations[numImages] = loc;
+    infoSampledImages[numImages] = VkDescriptorImageInfo{
         .sampler = hasTexture ? sampler : dummySampler,
         .imageView = hasTexture ? texture : dummyImageView,
         .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
     };
+    contents.add(loc);
+    contents.add((uint64_t)infoSampledImages[numImages].sampler);
+    contents.add((uint64_t)infoSampledImages[numImages].imageView);
+    numImages++;
+  }
+
+  if (!numImages) {
+    return;
   }
 
-  if (numWrites) {
+  VkDescriptorSet dset =
+      pimpl_->findCachedDescriptorSet(*this, arena, nextSubmitHandle, contents, numImages);
+
+  if (dset == VK_NULL_HANDLE) {
+    dset = arena.getNextDescriptorSet(*immediate_, nextSubmitHandle);
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    VkWriteDescriptorSet writes[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
+    for (uint32_t i = 0; i != numImages; i++) {
+      writes[i] = ivkGetWriteDescriptorSetImageInfo(
+          dset, locations[i], VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, &infoSampledImages[i]);
+    }
+
     IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
-    vf_.vkUpdateDescriptorSets(vkDevice_, numWrites, writes, 0, nullptr);
+    vf_.vkUpdateDescriptorSets(vkDevice_, numImages, writes, 0, nullptr);
     IGL_PROFILER_ZONE_END();
 
+    if (config_.enableDescriptorSetCache) {
+      arena.cacheDescriptorSet(dset, contents.words, contents.numWords, contents.hash);
+    }
+  }
+
 #if IGL_VULKAN_PRINT_COMMANDS
-    IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - textures\n", cmdBuf, bindPoint);
+  IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - textures\n", cmdBuf, bindPoint);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    vf_.vkCmdBindDescriptorSets(
-        cmdBuf, bindPoint, layout, kBindPoint_CombinedImageSamplers, 1, &dset, 0, nullptr);
-  }
+  vf_.vkCmdBindDescriptorSets(
+      cmdBuf, bindPoint, layout, kBindPoint_CombinedImageSamplers, 1, &dset, 0, nullptr);
 }
 
 void VulkanContext::updateBindingsStorageImages(
@@ -1976,15 +2398,13 @@ void VulkanContext::updateBindingsStorageImages(
   DescriptorPoolsArena& arena = pimpl_->getOrCreateArena_StorageImages(
       *this, dsl.getVkDescriptorSetLayout(), dsl.numBindings);
 
-  VkDescriptorSet dset = arena.getNextDescriptorSet(*immediate_, nextSubmitHandle);
-
   // NOLINTNEXTLINE(modernize-avoid-c-arrays)
   VkDescriptorImageInfo infoStorageImages[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  uint32_t locations[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
   uint32_t numStorageImages = 0;
 
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  VkWriteDescriptorSet writes[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
-  uint32_t numWrites = 0;
+  DescriptorSetContents<2 * IGL_TEXTURE_SAMPLERS_MAX> contents;
 
   // make sure the guard value is always there
   IGL_DEBUG_ASSERT(!textures_.objects_.empty());
@@ -1997,26 +2417,48 @@ void VulkanContext::updateBindingsStorageImages(
     const uint32_t loc = d.bindingLocation;
     IGL_DEBUG_ASSERT(loc < IGL_TEXTURE_SAMPLERS_MAX);
     VkImageView imageView = data.images[loc];
-    writes[numWrites++] = ivkGetWriteDescriptorSetImageInfo(
-        dset, loc, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, &infoStorageImages[numStorageImages]);
-    infoStorageImages[numStorageImages++] = VkDescriptorImageInfo{
+    locations[numStorageImages] = loc;
+    infoStorageImages[numStorageImages] = VkDescriptorImageInfo{
         .sampler = VK_NULL_HANDLE,
         .imageView = imageView ? imageView : dummyImageView,
         .imageLayout = VK_IMAGE_LAYOUT_GENERAL,
     };
+    contents.add(loc);
+    contents.add((uint64_t)infoStorageImages[numStorageImages].imageView);
+    numStorageImages++;
+  }
+
+  if (!numStorageImages) {
+    return;
   }
 
-  if (numWrites) {
+  VkDescriptorSet dset =
+      pimpl_->findCachedDescriptorSet(*this, arena, nextSubmitHandle, contents, numStorageImages);
+
+  if (dset == VK_NULL_HANDLE) {
+    dset = arena.getNextDescriptorSet(*immediate_, nextSubmitHandle);
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    VkWriteDescriptorSet writes[IGL_TEXTURE_SAMPLERS_MAX]; // uninitialized
+    for (uint32_t i = 0; i != numStorageImages; i++) {
+      writes[i] = ivkGetWriteDescriptorSetImageInfo(
+          dset, locations[i], VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, &infoStorageImages[i]);
+    }
+
     IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
-    vf_.vkUpdateDescriptorSets(vkDevice_, numWrites, writes, 0, nullptr);
+    vf_.vkUpdateDescriptorSets(vkDevice_, numStorageImages, writes, 0, nullptr);
     IGL_PROFILER_ZONE_END();
 
+    if (config_.enableDescriptorSetCache) {
+      arena.cacheDescriptorSet(dset, contents.words, contents.numWords, contents.hash);
+    }
+  }
+
 #if IGL_VULKAN_PRINT_COMMANDS
-    IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - storage images\n", cmdBuf, bindPoint);
+  IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - storage images\n", cmdBuf, bindPoint);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    vf_.vkCmdBindDescriptorSets(
-        cmdBuf, bindPoint, layout, kBindPoint_StorageImages, 1, &dset, 0, nullptr);
-  }
+  vf_.vkCmdBindDescriptorSets(
+      cmdBuf, bindPoint, layout, kBindPoint_StorageImages, 1, &dset, 0, nullptr);
 }
 
 void VulkanContext::updateBindingsBuffers(VkCommandBuffer IGL_NONNULL cmdBuf,
@@ -2031,11 +2473,7 @@ void VulkanContext::updateBindingsBuffers(VkCommandBuffer IGL_NONNULL cmdBuf,
   DescriptorPoolsArena& arena =
       pimpl_->getOrCreateArena_Buffers(*this, dsl.getVkDescriptorSetLayout(), dsl.numBindings);
 
-  VkDescriptorSet dset = arena.getNextDescriptorSet(*immediate_, nextSubmitHandle);
-
-  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-  VkWriteDescriptorSet writes[IGL_UNIFORM_BLOCKS_BINDING_MAX]; // uninitialized
-  uint32_t numWrites = 0;
+  DescriptorSetContents<5 * IGL_UNIFORM_BLOCKS_BINDING_MAX> contents;
 
   for (const util::BufferDescription& b : info.buffers) {
     IGL_DEBUG_ASSERT(b.descriptorSet == kBindPoint_Buffers);
@@ -2044,25 +2482,53 @@ void VulkanContext::updateBindingsBuffers(VkCommandBuffer IGL_NONNULL cmdBuf,
         IGL_FORMAT("Did you forget to call bindBuffer() for a buffer at the binding location {}?",
                    b.bindingLocation)
             .c_str());
-    writes[numWrites++] = ivkGetWriteDescriptorSetBufferInfo(
-        dset,
-        b.bindingLocation,
-        b.isStorage ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-        1,
-        &data.buffers[b.bindingLocation]);
+    const VkDescriptorBufferInfo& bufferInfo = data.buffers[b.bindingLocation];
+    contents.add(b.bindingLocation);
+    contents.add(b.isStorage ? 1u : 0u);
+    contents.add((uint64_t)bufferInfo.buffer);
+    contents.add(bufferInfo.offset);
+    contents.add(bufferInfo.range);
+  }
+
+  const auto numBuffers = static_cast<uint32_t>(info.buffers.size());
+
+  if (!numBuffers) {
+    return;
   }
 
-  if (numWrites) {
+  VkDescriptorSet dset =
+      pimpl_->findCachedDescriptorSet(*this, arena, nextSubmitHandle, contents, numBuffers);
+
+  if (dset == VK_NULL_HANDLE) {
+    dset = arena.getNextDescriptorSet(*immediate_, nextSubmitHandle);
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    VkWriteDescriptorSet writes[IGL_UNIFORM_BLOCKS_BINDING_MAX]; // uninitialized
+    uint32_t numWrites = 0;
+
+    for (const util::BufferDescription& b : info.buffers) {
+      writes[numWrites++] = ivkGetWriteDescriptorSetBufferInfo(
+          dset,
+          b.bindingLocation,
+          b.isStorage ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+          1,
+          &data.buffers[b.bindingLocation]);
+    }
+
     IGL_PROFILER_ZONE("vkUpdateDescriptorSets()", IGL_PROFILER_COLOR_UPDATE);
     vf_.vkUpdateDescriptorSets(vkDevice_, numWrites, writes, 0, nullptr);
     IGL_PROFILER_ZONE_END();
 
+    if (config_.enableDescriptorSetCache) {
+      arena.cacheDescriptorSet(dset, contents.words, contents.numWords, contents.hash);
+    }
+  }
+
 #if IGL_VULKAN_PRINT_COMMANDS
-    IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - buffers\n", cmdBuf, bindPoint);
+  IGL_LOG_INFO("%p vkCmdBindDescriptorSets(%u) - buffers\n", cmdBuf, bindPoint);
 #endif // IGL_VULKAN_PRINT_COMMANDS
-    vf_.vkCmdBindDescriptorSets(
-        cmdBuf, bindPoint, layout, kBindPoint_Buffers, 1, &dset, 0, nullptr);
-  }
+  vf_.vkCmdBindDescriptorSets(
+      cmdBuf, bindPoint, layout, kBindPoint_Buffers, 1, &dset, 0, nullptr);
 }
 
 void VulkanContext::updateBindingsTexturesByDescriptorBuffer(
@@ -2303,6 +2769,71 @@ void VulkanContext::deferredTask(std::packaged_task<void()>&& task, SubmitHandle
   deferredTasks.back().frameId = this->getFrameNumber();
 }
 
+void VulkanContext::deferredDestroy(const VulkanRetirementQueue::Entry& entry,
+                                    SubmitHandle handle) const {
+  if (handle.empty()) {
+    handle = immediate_->getNextSubmitHandle();
+  }
+  retirementQueue.push(handle, getFrameNumber(), entry);
+}
+
+void VulkanContext::destroyRetiredObject(const VulkanRetirementQueue::Entry& entry) const {
+  using Q = VulkanRetirementQueue;
+
+  VkDevice device = vkDevice_;
+  const uint64_t handle = entry.handle;
+  const uint64_t allocation = entry.allocation;
+
+  switch (entry.type) {
+  case Q::Type::Buffer:
+    vf_.vkDestroyBuffer(device, Q::fromUint64<VkBuffer>(handle), nullptr);
+    if (allocation) {
+      vf_.vkFreeMemory(device, Q::fromUint64<VkDeviceMemory>(allocation), nullptr);
+    }
+    break;
+  case Q::Type::BufferVma:
+    vmaDestroyBuffer(pimpl_->vma,
+                     Q::fromUint64<VkBuffer>(handle),
+                     Q::fromUint64<VmaAllocation>(allocation));
+    break;
+  case Q::Type::Image:
+    vf_.vkDestroyImage(device, Q::fromUint64<VkImage>(handle), nullptr);
+    if (allocation) {
+      vf_.vkFreeMemory(device, Q::fromUint64<VkDeviceMemory>(allocation), nullptr);
+    }
+    break;
+  case Q::Type::ImageVma:
+    vmaDestroyImage(
+        pimpl_->vma, Q::fromUint64<VkImage>(handle), Q::fromUint64<VmaAllocation>(allocation));
+    break;
+  case Q::Type::ImageView:
+    vf_.vkDestroyImageView(device, Q::fromUint64<VkImageView>(handle), nullptr);
+    break;
+  case Q::Type::Sampler:
+    vf_.vkDestroySampler(device, Q::fromUint64<VkSampler>(handle), nullptr);
+    break;
+  case Q::Type::Framebuffer:
+    vf_.vkDestroyFramebuffer(device, Q::fromUint64<VkFramebuffer>(handle), nullptr);
+    break;
+  case Q::Type::DescriptorPool:
+    vf_.vkDestroyDescriptorPool(device, Q::fromUint64<VkDescriptorPool>(handle), nullptr);
+    break;
+  case Q::Type::DescriptorSetLayout:
+    vf_.vkDestroyDescriptorSetLayout(
+        device, Q::fromUint64<VkDescriptorSetLayout>(handle), nullptr);
+    break;
+  case Q::Type::Pipeline:
+    vf_.vkDestroyPipeline(device, Q::fromUint64<VkPipeline>(handle), nullptr);
+    break;
+  case Q::Type::PipelineLayout:
+    vf_.vkDestroyPipelineLayout(device, Q::fromUint64<VkPipelineLayout>(handle), nullptr);
+    break;
+  case Q::Type::QueryPool:
+    vf_.vkDestroyQueryPool(device, Q::fromUint64<VkQueryPool>(handle), nullptr);
+    break;
+  }
+}
+
 bool VulkanContext::areValidationLayersEnabled() const {
   return config_.enableValidation;
 }
@@ -2325,6 +2856,18 @@ void VulkanContext::processDeferredTasks() const {
     deferredTasks.front().task();
     deferredTasks.pop_front();
   }
+
+  retirementQueue.process(
+      [this, frameId](SubmitHandle handle, uint64_t retiredFrameId) {
+        // same rules as above: do not destroy anything not yet older than kNumWaitFrames
+        if (frameId && frameId <= retiredFrameId + kNumWaitFrames) {
+          return false;
+        }
+        return immediate_->isReady(handle);
+      },
+      [this](const VulkanRetirementQueue::Entry& entry) { destroyRetiredObject(entry); });
+
+  checkMemoryBudgets();
 }
 
 void VulkanContext::waitDeferredTasks() {
@@ -2335,6 +2878,10 @@ void VulkanContext::waitDeferredTasks() {
     task.task();
   }
   deferredTasks.clear();
+
+  retirementQueue.processAll(
+      [this](SubmitHandle handle) { immediate_->wait(handle, config_.fenceTimeoutNanoseconds); },
+      [this](const VulkanRetirementQueue::Entry& entry) { destroyRetiredObject(entry); });
 }
 
 // @fb-only
@@ -2785,10 +3332,8 @@ void VulkanContext::destroy(BindGroupTextureHandle handle) {
     return;
   }
 
-  deferredTask(std::packaged_task<void()>(
-      [vf = &vf_, device = getVkDevice(), pool = pimpl_->bindGroupTexturesPool.get(handle)->pool] {
-        vf->vkDestroyDescriptorPool(device, pool, nullptr);
-      }));
+  deferredDestroy(VulkanRetirementQueue::Type::DescriptorPool,
+                  pimpl_->bindGroupTexturesPool.get(handle)->pool);
 
   pimpl_->bindGroupTexturesPool.destroy(handle);
 }
@@ -2798,10 +3343,8 @@ void VulkanContext::destroy(BindGroupBufferHandle handle) {
     return;
   }
 
-  deferredTask(std::packaged_task<void()>(
-      [vf = &vf_, device = getVkDevice(), pool = pimpl_->bindGroupBuffersPool.get(handle)->pool] {
-        vf->vkDestroyDescriptorPool(device, pool, nullptr);
-      }));
+  deferredDestroy(VulkanRetirementQueue::Type::DescriptorPool,
+                  pimpl_->bindGroupBuffersPool.get(handle)->pool);
 
   pimpl_->bindGroupBuffersPool.destroy(handle);
 }
@@ -2813,10 +3356,9 @@ void VulkanContext::destroy(SamplerHandle handle) {
     return;
   }
 
-  deferredTask(std::packaged_task<void()>(
-      [vf = &vf_, device = getVkDevice(), sampler = samplers_.get(handle)->vkSampler]() {
-        vf->vkDestroySampler(device, sampler, nullptr);
-      }));
+  deferredDestroy(VulkanRetirementQueue::Type::Sampler, samplers_.get(handle)->vkSampler);
+
+  markBindlessSamplerDirty(handle.index(), true);
 
   samplers_.destroy(handle);
 }
@@ -2828,6 +3370,8 @@ void VulkanContext::destroy(TextureHandle handle) {
     return;
   }
 
+  markBindlessTextureDirty(handle.index(), true);
+
   textures_.destroy(handle);
 }
 
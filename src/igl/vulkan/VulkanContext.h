@@ -9,6 +9,7 @@
 
 #include <atomic>
 #include <deque>
+#include <functional>
 #include <future>
 #include <ldrutils/lutils/Pool.h>
 #include <memory>
@@ -21,6 +22,7 @@
 #include <igl/vulkan/VulkanImmediateCommands.h>
 #include <igl/vulkan/VulkanQueuePool.h>
 #include <igl/vulkan/VulkanRenderPassBuilder.h>
+#include <igl/vulkan/VulkanRetirementQueue.h>
 #include <igl/vulkan/VulkanStagingDevice.h>
 
 #if defined(IGL_ANDROID_HWBUFFER_SUPPORTED)
@@ -87,6 +89,115 @@ struct DescriptorBuffer {
   VkCommandBuffer bindCmdBuffer = VK_NULL_HANDLE;
 };
 
+/// @brief Counters describing how the bindless descriptor set (set 3) is being updated.
+struct BindlessDescriptorStats {
+  /// The frame number the `*ThisFrame` counters belong to
+  uint64_t frameNumber = 0;
+  /// Number of descriptors written into the bindless descriptor set during `frameNumber`
+  uint32_t numDescriptorsWrittenThisFrame = 0;
+  /// Number of VkWriteDescriptorSet structures submitted during `frameNumber`
+  uint32_t numWritesThisFrame = 0;
+  /// Number of descriptors written since the context was created
+  uint64_t numDescriptorsWrittenTotal = 0;
+  /// Number of times the whole descriptor set was rewritten (initial creation and every growth)
+  uint32_t numFullUpdates = 0;
+  /// Number of waits for a pending submit before rewriting a slot reused by a new resource
+  uint32_t numWaitsForReusedSlots = 0;
+  /// Current capacity of the bindless descriptor set
+  uint32_t maxTextures = 0;
+  uint32_t maxSamplers = 0;
+};
+
+/// @brief Counters describing how often descriptor sets 0-2 are reused instead of being rewritten
+/// (see VulkanContextConfig::enableDescriptorSetCache).
+struct DescriptorSetCacheStats {
+  uint64_t numLookups = 0;
+  /// Every cache hit binds an already written descriptor set and skips vkUpdateDescriptorSets()
+  uint64_t numUpdateDescriptorSetsSaved = 0;
+  uint64_t numDescriptorWritesSaved = 0;
+
+  [[nodiscard]] float hitRate() const {
+    return numLookups ? float(numUpdateDescriptorSetsSaved) / float(numLookups) : 0.0f;
+  }
+};
+
+/// @brief Kinds of GPU memory allocations made by IGL itself (see MemoryStats::categoryBytes).
+enum class MemoryCategory : uint8_t {
+  Buffer = 0,
+  Texture,
+  Staging, // VulkanStagingDevice buffers
+  DescriptorBuffer, // VK_EXT_descriptor_buffer storage
+  Count,
+};
+
+/// @brief Budget and usage of a single Vulkan memory heap.
+struct MemoryHeapStats {
+  VkDeviceSize size = 0;
+  /// Amount of memory this process can allocate from the heap. Reported by the driver when
+  /// VK_EXT_memory_budget is available; otherwise, estimated as 80% of the heap size.
+  VkDeviceSize budget = 0;
+  /// Memory currently allocated from the heap. Includes other APIs and processes when
+  /// VK_EXT_memory_budget is available; otherwise, only VMA allocations made by this context.
+  VkDeviceSize usage = 0;
+  bool isDeviceLocal = false;
+
+  /// VMA block statistics, only populated by VulkanContext::getMemoryStats(true).
+  /// `blockBytes - allocationBytes` is the memory wasted by fragmentation and unused blocks.
+  uint32_t blockCount = 0;
+  uint32_t allocationCount = 0;
+  VkDeviceSize blockBytes = 0;
+  VkDeviceSize allocationBytes = 0;
+  uint32_t unusedRangeCount = 0;
+  VkDeviceSize unusedRangeSizeMax = 0;
+
+  [[nodiscard]] float usageFraction() const {
+    return budget ? float(usage) / float(budget) : 0.0f;
+  }
+};
+
+/// @brief A snapshot of GPU memory usage of a VulkanContext.
+struct MemoryStats {
+  /// Budget and usage values come from VK_EXT_memory_budget
+  bool hasMemoryBudget = false;
+  uint32_t numHeaps = 0;
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  MemoryHeapStats heaps[VK_MAX_MEMORY_HEAPS] = {};
+  /// Bytes allocated by IGL buffers and textures, indexed by MemoryCategory
+  // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+  VkDeviceSize categoryBytes[(size_t)MemoryCategory::Count] = {};
+
+  [[nodiscard]] VkDeviceSize getCategoryBytes(MemoryCategory category) const {
+    return categoryBytes[(size_t)category];
+  }
+  /// Bytes allocated by IGL buffers and textures of this context in all categories
+  [[nodiscard]] VkDeviceSize getTotalCategoryBytes() const {
+    VkDeviceSize bytes = 0;
+    for (VkDeviceSize b : categoryBytes) {
+      bytes += b;
+    }
+    return bytes;
+  }
+  /// Usage of all heaps; see MemoryHeapStats::usage for what is included
+  [[nodiscard]] VkDeviceSize getTotalUsage() const {
+    VkDeviceSize usage = 0;
+    for (uint32_t i = 0; i != numHeaps; i++) {
+      usage += heaps[i].usage;
+    }
+    return usage;
+  }
+  [[nodiscard]] VkDeviceSize getTotalBudget() const {
+    VkDeviceSize budget = 0;
+    for (uint32_t i = 0; i != numHeaps; i++) {
+      budget += heaps[i].budget;
+    }
+    return budget;
+  }
+};
+
+/// @brief Invoked when the usage of the heap `heapIndex` exceeds the registered fraction of its
+/// budget. It is not invoked again for the same heap until the usage drops below that fraction.
+using MemoryBudgetCallback = std::function<void(const MemoryStats& stats, uint32_t heapIndex)>;
+
 class VulkanContext final {
  public:
   VulkanContext(VulkanContextConfig config,
@@ -156,7 +267,9 @@ class VulkanContext final {
                                              VkBufferUsageFlags usageFlags,
                                              VkMemoryPropertyFlags memFlags,
                                              Result* IGL_NULLABLE outResult,
-                                             const char* IGL_NULLABLE debugName = nullptr) const;
+                                             const char* IGL_NULLABLE debugName = nullptr,
+                                             MemoryCategory memoryCategory = MemoryCategory::Buffer)
+      const;
   std::shared_ptr<VulkanTexture> createTexture(VulkanImage&& image,
                                                VulkanImageView&& imageView,
                                                const char* IGL_NULLABLE debugName) const;
@@ -231,6 +344,23 @@ class VulkanContext final {
   // execute a task some time in the future after the submit handle finished processing
   void deferredTask(std::packaged_task<void()>&& task, SubmitHandle handle = SubmitHandle()) const;
 
+  // destroy a Vulkan object some time in the future after the submit handle finished processing;
+  // prefer this over deferredTask() for plain object destruction as it does not allocate memory
+  template<typename T, typename A = uint64_t>
+  void deferredDestroy(VulkanRetirementQueue::Type type,
+                       T handle,
+                       A allocation = 0,
+                       SubmitHandle submitHandle = SubmitHandle()) const {
+    deferredDestroy(VulkanRetirementQueue::Entry{
+                        .type = type,
+                        .handle = VulkanRetirementQueue::toUint64(handle),
+                        .allocation = VulkanRetirementQueue::toUint64(allocation),
+                    },
+                    submitHandle);
+  }
+  void deferredDestroy(const VulkanRetirementQueue::Entry& entry,
+                       SubmitHandle submitHandle = SubmitHandle()) const;
+
   bool areValidationLayersEnabled() const;
 
   void* IGL_NULLABLE getVmaAllocator() const;
@@ -239,6 +369,30 @@ class VulkanContext final {
 
   void freeResourcesForDescriptorSetLayout(VkDescriptorSetLayout dsl) const;
 
+  /// @brief Returns bindless descriptor set update counters. The `*ThisFrame` values are zero if
+  /// nothing was written during the current frame.
+  [[nodiscard]] BindlessDescriptorStats getBindlessDescriptorStats() const;
+
+  /// @brief Returns counters of the descriptor set cache used for non-bindless bindings.
+  [[nodiscard]] DescriptorSetCacheStats getDescriptorSetCacheStats() const;
+
+  /// @brief Returns per-heap budget/usage and per-category totals of GPU memory. Detailed VMA
+  /// block statistics require traversing all allocations and are collected only if `detailed` is
+  /// true.
+  [[nodiscard]] MemoryStats getMemoryStats(bool detailed = false) const;
+
+  /// @brief Returns the bytes allocated by IGL buffers and textures of this context, i.e. the sum
+  /// of MemoryStats::categoryBytes, without querying the driver.
+  [[nodiscard]] VkDeviceSize getAllocatedMemoryBytes() const;
+
+  /// @brief Registers a callback which is invoked from CommandQueue::submit() when the usage of any
+  /// memory heap exceeds `budgetFraction` of its budget, e.g. to evict streamed resources before
+  /// running out of memory.
+  void addMemoryBudgetCallback(float budgetFraction, MemoryBudgetCallback callback);
+
+  /// @brief Adjusts the number of bytes accounted to `category` in MemoryStats::categoryBytes.
+  void trackMemoryUsage(MemoryCategory category, int64_t bytes) const;
+
   const VulkanFeatures& features() const noexcept;
 
   [[nodiscard]] const VkSurfaceCapabilitiesKHR& getSurfaceCapabilities() const noexcept {
@@ -273,7 +427,11 @@ class VulkanContext final {
   void pruneTextures();
   void querySurfaceCapabilities();
   void processDeferredTasks() const;
+  void checkMemoryBudgets() const;
+  void destroyRetiredObject(const VulkanRetirementQueue::Entry& entry) const;
   void growBindlessDescriptorPool(uint32_t newMaxTextures, uint32_t newMaxSamplers);
+  void markBindlessTextureDirty(uint32_t index, bool destroyed) const;
+  void markBindlessSamplerDirty(uint32_t index, bool destroyed) const;
   BindGroupTextureHandle createBindGroup(const BindGroupTextureDesc& desc,
                                          const IRenderPipelineState* IGL_NULLABLE
                                              compatiblePipeline,
@@ -349,7 +507,7 @@ class VulkanContext final {
   // 2. Descriptor sets can be updated when they are not in use.
   mutable ldr::Pool<TextureTag, std::shared_ptr<VulkanTexture>> textures_;
   mutable ldr::Pool<SamplerTag, VulkanSampler> samplers_;
-  // a texture/sampler was created since the last descriptor set update
+  // a texture/sampler was created or destroyed since the last descriptor set update
   mutable bool awaitingCreation_ = false;
 
   mutable std::atomic<size_t> drawCallCount_{0};
@@ -420,6 +578,7 @@ class VulkanContext final {
   };
 
   mutable std::deque<DeferredTask> deferredTasks;
+  mutable VulkanRetirementQueue retirementQueue;
 
   // sync resources
   uint32_t syncCurrentIndex = 0u;
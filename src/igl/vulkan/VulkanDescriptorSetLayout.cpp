@@ -41,10 +41,7 @@ VulkanDescriptorSetLayout::VulkanDescriptorSetLayout(const VulkanContext& ctx,
 VulkanDescriptorSetLayout::~VulkanDescriptorSetLayout() {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_DESTROY);
   ctx.freeResourcesForDescriptorSetLayout(vkDescriptorSetLayout);
-  ctx.deferredTask(std::packaged_task<void()>(
-      [vf = &ctx.vf_, device = ctx.getVkDevice(), layout = vkDescriptorSetLayout] {
-        vf->vkDestroyDescriptorSetLayout(device, layout, nullptr);
-      }));
+  ctx.deferredDestroy(VulkanRetirementQueue::Type::DescriptorSetLayout, vkDescriptorSetLayout);
 }
 
 } // namespace igl::vulkan
@@ -571,6 +571,8 @@ void VulkanFeatures::enableCommonDeviceExtensions(const VulkanContextConfig& con
 
   has_VK_EXT_mesh_shader = enable(VK_EXT_MESH_SHADER_EXTENSION_NAME, ExtensionType::Device);
 
+  has_VK_EXT_memory_budget = enable(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, ExtensionType::Device);
+
   // Enable fragment shading rate extension (required when primitiveFragmentShadingRateMeshShader is
   // used)
   enable(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME, ExtensionType::Device);
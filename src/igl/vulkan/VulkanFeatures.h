@@ -116,6 +116,7 @@ class VulkanFeatures final {
   bool has_VK_EXT_fragment_density_map = false;
   bool has_VK_EXT_headless_surface = false;
   bool has_VK_EXT_index_type_uint8 = false; // promoted to Vulkan 1.4
+  bool has_VK_EXT_memory_budget = false;
   bool has_VK_EXT_mesh_shader = false;
   bool has_VK_EXT_queue_family_foreign = false;
   bool has_VK_KHR_8bit_storage = false; // promoted to Vulkan 1.2
@@ -45,10 +45,7 @@ VulkanFramebuffer::VulkanFramebuffer(const VulkanContext& ctx,
 VulkanFramebuffer::~VulkanFramebuffer() {
   IGL_PROFILER_FUNCTION_COLOR(IGL_PROFILER_COLOR_DESTROY);
 
-  ctx.deferredTask(
-      std::packaged_task<void()>([vf = &ctx.vf_, device = vkDevice, framebuffer = vkFramebuffer]() {
-        vf->vkDestroyFramebuffer(device, framebuffer, nullptr);
-      }));
+  ctx.deferredDestroy(VulkanRetirementQueue::Type::Framebuffer, vkFramebuffer);
 }
 
 } // namespace igl::vulkan
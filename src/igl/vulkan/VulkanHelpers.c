@@ -767,6 +767,7 @@ VkResult ivkVmaCreateAllocator(const struct VulkanFunctionTable* vt,
                                VkInstance instance,
                                uint32_t apiVersion,
                                bool enableBufferDeviceAddress,
+                               bool enableMemoryBudget,
                                VkDeviceSize preferredLargeHeapBlockSize,
                                VmaAllocator* outVma) {
   const VmaVulkanFunctions funcs = {
@@ -804,8 +805,16 @@ VkResult ivkVmaCreateAllocator(const struct VulkanFunctionTable* vt,
 #endif
   };
 
+  VmaAllocatorCreateFlags flags = 0;
+  if (enableBufferDeviceAddress) {
+    flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+  }
+  if (enableMemoryBudget) {
+    flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+  }
+
   const VmaAllocatorCreateInfo ci = {
-      .flags = enableBufferDeviceAddress ? VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT : 0,
+      .flags = flags,
       .physicalDevice = physDev,
       .device = device,
       .preferredLargeHeapBlockSize = preferredLargeHeapBlockSize,
@@ -251,6 +251,7 @@ VkResult ivkVmaCreateAllocator(const struct VulkanFunctionTable* vt,
                                VkInstance instance,
                                uint32_t apiVersion,
                                bool enableBufferDeviceAddress,
+                               bool enableMemoryBudget,
                                VkDeviceSize preferredLargeHeapBlockSize,
                                VmaAllocator* outVma);
 
@@ -362,6 +362,8 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
   VK_ASSERT(ivkSetDebugObjectName(
       &ctx_->vf_, device_, VK_OBJECT_TYPE_IMAGE, (uint64_t)vkImage_, debugName));
 
+  ctx_->trackMemoryUsage(MemoryCategory::Texture, static_cast<int64_t>(allocatedSize));
+
   // Get physical device's properties for the image's format
   ctx_->vf_.vkGetPhysicalDeviceFormatProperties(physicalDevice_, imageFormat_, &formatProperties_);
 }
@@ -923,6 +925,8 @@ VulkanImage::VulkanImage(const VulkanContext& ctx,
   }
   VK_ASSERT(ctx_->vf_.vkBindImageMemory2(device_, numPlanes, bindInfo.data()));
 
+  ctx_->trackMemoryUsage(MemoryCategory::Texture, static_cast<int64_t>(allocatedSize));
+
 #if IGL_PLATFORM_WINDOWS
   const VkMemoryGetWin32HandleInfoKHR getHandleInfo{
       .sType = VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR,
@@ -956,26 +960,19 @@ void VulkanImage::destroy() {
   IGL_ENSURE_VULKAN_CONTEXT_THREAD(ctx_);
 
   if (!isExternallyManaged_) {
+    ctx_->trackMemoryUsage(MemoryCategory::Texture, -static_cast<int64_t>(allocatedSize));
+
     if (vkMemory_[1] == VK_NULL_HANDLE) {
       if (vmaAllocation_) {
         if (mappedPtr_) {
           vmaUnmapMemory(static_cast<VmaAllocator>(ctx_->getVmaAllocator()), vmaAllocation_);
         }
-        ctx_->deferredTask(std::packaged_task<void()>(
-            [vma = ctx_->getVmaAllocator(), image = vkImage_, allocation = vmaAllocation_]() {
-              vmaDestroyImage(static_cast<VmaAllocator>(vma), image, allocation);
-            }));
+        ctx_->deferredDestroy(VulkanRetirementQueue::Type::ImageVma, vkImage_, vmaAllocation_);
       } else {
         if (mappedPtr_) {
           ctx_->vf_.vkUnmapMemory(device_, vkMemory_[0]);
         }
-        ctx_->deferredTask(std::packaged_task<void()>(
-            [vf = &ctx_->vf_, device = device_, image = vkImage_, memory = vkMemory_[0]]() {
-              vf->vkDestroyImage(device, image, nullptr);
-              if (memory != VK_NULL_HANDLE) {
-                vf->vkFreeMemory(device, memory, nullptr);
-              }
-            }));
+        ctx_->deferredDestroy(VulkanRetirementQueue::Type::Image, vkImage_, vkMemory_[0]);
       }
     } else {
       // this never uses VMA
@@ -77,10 +77,7 @@ void VulkanImageView::destroy() {
 
   IGL_ENSURE_VULKAN_CONTEXT_THREAD(ctx);
 
-  ctx->deferredTask(std::packaged_task<void()>(
-      [vf = &ctx->vf_, device = ctx->getVkDevice(), imageView = vkImageView]() {
-        vf->vkDestroyImageView(device, imageView, nullptr);
-      }));
+  ctx->deferredDestroy(VulkanRetirementQueue::Type::ImageView, vkImageView);
 
   vkImageView = VK_NULL_HANDLE;
   ctx = nullptr;
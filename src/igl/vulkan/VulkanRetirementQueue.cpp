@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <igl/vulkan/VulkanRetirementQueue.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace igl::vulkan {
+
+void VulkanRetirementQueue::push(SubmitHandle handle, uint64_t frameId, const Entry& entry) {
+  if (numBuckets_) {
+    Bucket& last = bucketAt(numBuckets_ - 1);
+    if (last.handle == handle && last.frameId == frameId) {
+      last.entries.push_back(entry);
+      numEntries_++;
+      return;
+    }
+  }
+
+  if (numBuckets_ == buckets_.size()) {
+    grow();
+  }
+
+  Bucket& b = bucketAt(numBuckets_++);
+  b.handle = handle;
+  b.frameId = frameId;
+  IGL_DEBUG_ASSERT(b.entries.empty());
+  b.entries.push_back(entry);
+  numEntries_++;
+}
+
+void VulkanRetirementQueue::grow() {
+  constexpr size_t kMinNumBuckets = 16;
+
+  std::vector<Bucket> buckets(std::max(kMinNumBuckets, buckets_.size() * 2));
+
+  // move all buckets, including the free ones, to keep their preallocated storage
+  for (size_t i = 0; i != buckets_.size(); i++) {
+    buckets[i] = std::move(bucketAt(i));
+  }
+
+  buckets_ = std::move(buckets);
+  first_ = 0;
+}
+
+} // namespace igl::vulkan
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <igl/vulkan/VulkanImmediateCommands.h>
+
+namespace igl::vulkan {
+
+/**
+ * @brief Stores Vulkan objects which should be destroyed once the GPU is done with them. Unlike
+ * VulkanContext::deferredTask(), objects are stored as plain {type, handle, allocation} records and
+ * no closures are created. Records are grouped into buckets, one per SubmitHandle and frame, which
+ * are kept in a ring buffer. The storage of retired buckets is reused, hence, once the queue has
+ * warmed up, retiring an object does not allocate memory.
+ */
+class VulkanRetirementQueue final {
+ public:
+  using SubmitHandle = VulkanImmediateCommands::SubmitHandle;
+
+  enum class Type : uint8_t {
+    Buffer, // VkBuffer + optional VkDeviceMemory
+    BufferVma, // VkBuffer + VmaAllocation
+    Image, // VkImage + optional VkDeviceMemory
+    ImageVma, // VkImage + VmaAllocation
+    ImageView,
+    Sampler,
+    Framebuffer,
+    DescriptorPool,
+    DescriptorSetLayout,
+    Pipeline,
+    PipelineLayout,
+    QueryPool,
+  };
+
+  struct Entry {
+    Type type = Type::Buffer;
+    uint64_t handle = 0;
+    uint64_t allocation = 0;
+  };
+
+  /// @brief Adds an object which can be destroyed once `handle` has completed and `frameId` is old
+  /// enough.
+  void push(SubmitHandle handle, uint64_t frameId, const Entry& entry);
+
+  /// @brief Destroys objects from the oldest buckets while `canRetire(handle, frameId)` returns
+  /// true. `destroy(entry)` must not push new objects into this queue.
+  template<typename CanRetire, typename Destroy>
+  void process(CanRetire&& canRetire, Destroy&& destroy) {
+    while (numBuckets_) {
+      Bucket& b = bucketAt(0);
+      if (!canRetire(b.handle, b.frameId)) {
+        break;
+      }
+      for (const Entry& e : b.entries) {
+        destroy(e);
+      }
+      numEntries_ -= b.entries.size();
+      b.entries.clear(); // keeps the capacity for future buckets
+      first_ = (first_ + 1) % buckets_.size();
+      numBuckets_--;
+    }
+  }
+
+  /// @brief Destroys all objects. `wait(handle)` is called before each bucket is destroyed.
+  template<typename Wait, typename Destroy>
+  void processAll(Wait&& wait, Destroy&& destroy) {
+    process(
+        [&wait](SubmitHandle handle, uint64_t /*frameId*/) {
+          wait(handle);
+          return true;
+        },
+        std::forward<Destroy>(destroy));
+  }
+
+  [[nodiscard]] bool empty() const {
+    return numEntries_ == 0;
+  }
+
+  /// @brief Returns the number of objects waiting to be destroyed
+  [[nodiscard]] size_t size() const {
+    return numEntries_;
+  }
+
+  /// @brief Returns the number of distinct (SubmitHandle, frame) buckets waiting to be processed
+  [[nodiscard]] size_t numBuckets() const {
+    return numBuckets_;
+  }
+
+  /// @brief Converts a Vulkan handle to a value which can be stored in Entry
+  template<typename T>
+  [[nodiscard]] static uint64_t toUint64(T handle) {
+    if constexpr (std::is_pointer_v<T>) {
+      return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+    } else {
+      return static_cast<uint64_t>(handle);
+    }
+  }
+
+  /// @brief Converts a value stored in Entry back to a Vulkan handle
+  template<typename T>
+  [[nodiscard]] static T fromUint64(uint64_t value) {
+    if constexpr (std::is_pointer_v<T>) {
+      return reinterpret_cast<T>(static_cast<uintptr_t>(value));
+    } else {
+      return static_cast<T>(value);
+    }
+  }
+
+ private:
+  struct Bucket {
+    SubmitHandle handle = {};
+    uint64_t frameId = 0;
+    std::vector<Entry> entries;
+  };
+
+  Bucket& bucketAt(size_t i) {
+    return buckets_[(first_ + i) % buckets_.size()];
+  }
+
+  void grow();
+
+ private:
+  std::vector<Bucket> buckets_; // ring buffer
+  size_t first_ = 0;
+  size_t numBuckets_ = 0;
+  size_t numEntries_ = 0;
+};
+
+} // namespace igl::vulkan
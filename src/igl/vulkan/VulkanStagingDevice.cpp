@@ -845,7 +845,8 @@ void VulkanStagingDevice::allocateStagingBuffer(VkDeviceSize minimumSize) {
       VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
       IGL_FORMAT("Buffer: staging buffer #{} with {}B", stagingBufferCounter_, stagingBufferSize)
-          .c_str()));
+          .c_str(),
+      MemoryCategory::Staging));
   IGL_DEBUG_ASSERT(stagingBuffers_.back().get());
 
   // Add region that represents the entire buffer
@@ -146,6 +146,8 @@ TextureFormat vkTextureFormatToTextureFormat(int32_t vkFormat) {
     return TextureFormat::R_F32;
   case VK_FORMAT_R32_UINT:
     return TextureFormat::R_UInt32;
+  case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
+    return TextureFormat::R9G9B9E5_F;
   case VK_FORMAT_R32G32_SFLOAT:
     return TextureFormat::RG_F32;
   case VK_FORMAT_R16G16B16_SFLOAT: